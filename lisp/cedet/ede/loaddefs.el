@@ -0,0 +1,181 @@
+;;; loaddefs.el --- automatically extracted autoloads
+;;
+;;; Code:
+
+
+;;;### (autoloads nil "ede/cpp-root" "cpp-root.el" "4e1583de763a66a41e8f8f8e8eff5eb0")
+;;; Generated autoloads from cpp-root.el
+
+(eieio-defclass-autoload 'ede-cpp-root-project '(ede-project eieio-instance-tracker) "ede/cpp-root" "EDE cpp-root project class.\nEach directory needs a project file to control it.")
+
+;;;***
+
+;;;### (autoloads nil "ede/custom" "custom.el" "fab892ca0be550374436261d97488781")
+;;; Generated autoloads from custom.el
+
+(autoload 'ede-customize-project "ede/custom" "\
+Edit fields of the current project through EIEIO & Custom.
+
+\(fn)" t nil)
+
+(defalias 'customize-project 'ede-customize-project)
+
+(autoload 'ede-customize-current-target "ede/custom" "\
+Edit fields of the current target through EIEIO & Custom.
+
+\(fn)" t nil)
+
+(defalias 'customize-target 'ede-customize-current-target)
+
+(autoload 'ede-project-sort-targets "ede/custom" "\
+Create a custom-like buffer for sorting targets of current project.
+
+\(fn)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/dired" "dired.el" "662e7f335993b736d2b87310d9ee2ca4")
+;;; Generated autoloads from dired.el
+
+(autoload 'ede-dired-minor-mode "ede/dired" "\
+A minor mode that should only be activated in DIRED buffers.
+If ARG is nil or a positive number, force on, if
+negative, force off.
+
+\(fn &optional ARG)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/emacs" "emacs.el" "c83317bfcf14c238db77957b2db54335")
+;;; Generated autoloads from emacs.el
+
+(ede-add-project-autoload (make-instance 'ede-project-autoload :name "EMACS ROOT" :file 'ede/emacs :proj-file "src/emacs.c" :load-type 'ede-emacs-load :class-sym 'ede-emacs-project :new-p nil :safe-p t) 'unique)
+
+;;;***
+
+;;;### (autoloads nil "ede/files" "files.el" "119c450b23f9ae2407b2f3b42b74bfcd")
+;;; Generated autoloads from files.el
+
+(autoload 'ede-find-file "ede/files" "\
+Find FILE in project.  FILE can be specified without a directory.
+There is no completion at the prompt.  FILE is searched for within
+the current EDE project.
+
+\(fn FILE)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/generic" "generic.el" "7dacdca67d8361a40e0bf71600a22843")
+;;; Generated autoloads from generic.el
+
+(autoload 'ede-enable-generic-projects "ede/generic" "\
+Enable generic project loaders.
+
+\(fn)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/linux" "linux.el" "df3e0084a35b0d6cec0d6b0bfa1b8d0d")
+;;; Generated autoloads from linux.el
+
+(autoload 'ede-linux-load "ede/linux" "\
+Return an Linux Project object if there is a match.
+Return nil if there isn't one.
+Argument DIR is the directory it is created for.
+ROOTPROJ is nil, since there is only one project.
+
+\(fn DIR &optional ROOTPROJ)" nil nil)
+
+(ede-add-project-autoload (make-instance 'ede-project-autoload :name "LINUX ROOT" :file 'ede/linux :proj-file "scripts/ver_linux" :load-type 'ede-linux-load :class-sym 'ede-linux-project :new-p nil :safe-p t) 'unique)
+
+;;;***
+
+;;;### (autoloads nil "ede/locate" "locate.el" "fb750c25b447e93f032c8437c759197b")
+;;; Generated autoloads from locate.el
+
+(autoload 'ede-enable-locate-on-project "ede/locate" "\
+Enable an EDE locate feature on PROJECT.
+Attempt to guess which project locate style to use
+based on `ede-locate-setup-options'.
+
+\(fn &optional PROJECT)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/make" "make.el" "f4bd3e27866e4784d553fffd97a3416c")
+;;; Generated autoloads from make.el
+
+(autoload 'ede-make-check-version "ede/make" "\
+Check the version of GNU Make installed.
+The check passes if the MAKE version is no high enough, or if it
+is not GNU make.
+If NOERROR is non-nil, return t for success, nil for failure.
+If NOERROR is nil, then throw an error on failure.  Return t otherwise.
+
+\(fn &optional NOERROR)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/speedbar" "speedbar.el" "2d0ec99ff82e12991e39fd618a9016a9")
+;;; Generated autoloads from speedbar.el
+
+(autoload 'ede-speedbar-file-setup "ede/speedbar" "\
+Setup some keybindings in the Speedbar File display.
+
+\(fn)" nil nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/system" "system.el" "b5e045d8b4b3239d024162c8c8f9d367")
+;;; Generated autoloads from system.el
+
+(autoload 'ede-web-browse-home "ede/system" "\
+Browse the home page of the current project.
+
+\(fn)" t nil)
+
+(autoload 'ede-edit-web-page "ede/system" "\
+Edit the web site for this project.
+
+\(fn)" t nil)
+
+(autoload 'ede-upload-distribution "ede/system" "\
+Upload the current distribution to the correct location.
+Use /user@ftp.site.com: file names for FTP sites.
+Download tramp, and use /r:machine: for names on remote sites w/out FTP access.
+
+\(fn)" t nil)
+
+(autoload 'ede-upload-html-documentation "ede/system" "\
+Upload the current distributions documentation as HTML.
+Use /user@ftp.site.com: file names for FTP sites.
+Download tramp, and use /r:machine: for names on remote sites w/out FTP access.
+
+\(fn)" t nil)
+
+(autoload 'ede-vc-project-directory "ede/system" "\
+Run `vc-dir' on the current project.
+
+\(fn)" t nil)
+
+;;;***
+
+;;;### (autoloads nil "ede/util" "util.el" "049b7c58b5f7aa796cf3c8b21e4e11fc")
+;;; Generated autoloads from util.el
+
+(autoload 'ede-update-version "ede/util" "\
+Update the current projects main version number.
+Argument NEWVERSION is the version number to use in the current project.
+
+\(fn NEWVERSION)" t nil)
+
+;;;***
+
+(provide 'loaddefs)
+;; Local Variables:
+;; version-control: never
+;; no-byte-compile: t
+;; no-update-autoloads: t
+;; coding: utf-8
+;; End:
+;;; loaddefs.el ends here
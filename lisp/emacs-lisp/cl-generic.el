@@ -1089,6 +1089,7 @@ cl--generic-typeof-types
     (char-table array sequence)
     (bool-vector array sequence)
     (frame) (hash-table) (font-spec) (font-entity) (font-object)
+    (thread) (mutex) (condition-variable)
     (vector array sequence)
     ;; Plus, hand made:
     (null symbol list sequence)
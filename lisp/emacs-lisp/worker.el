@@ -0,0 +1,296 @@
+;;; worker.el --- run Lisp functions in parallel worker processes  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2015 Free Software Foundation, Inc.
+
+;; Keywords: lisp, processes
+;; Package: emacs
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; This package runs CPU-bound Lisp computations, such as compiling
+;; a directory of files, in parallel on all processors.  Lisp threads
+;; cannot do that, since only one of them runs Lisp at a time.
+;;
+;; The computations run in a pool of `emacs --batch' subprocesses,
+;; the workers.  Each worker is started once and then serves any
+;; number of requests, so a computation costs only the transfer of its
+;; arguments and result, not the startup of Emacs.  The pool stays
+;; alive between calls until `worker-stop' is called.
+;;
+;; The main entry point is `worker-map', which is like `mapcar' but
+;; spreads the calls over the workers:
+;;
+;;     (worker-map #'byte-compile-file files)
+;;
+;; Workers are processes, so arguments and results are copied: they
+;; are printed with `prin1' and read back with `read', and must have a
+;; printed representation that can be read.  Workers share no state
+;; with the calling Emacs or with each other, except that they use its
+;; `load-path', and that a named function is loaded from the file that
+;; defined it before a worker first calls it.
+
+;;; Code:
+
+(defgroup worker nil
+  "Running Lisp functions in parallel worker processes."
+  :group 'lisp
+  :version "25.1")
+
+(defcustom worker-count nil
+  "Number of worker processes in the pool.
+If nil, start one worker per processor."
+  :type '(choice (const :tag "One per processor" nil)
+                 integer)
+  :version "25.1")
+
+(define-error 'worker-error "Worker failed")
+
+(defconst worker--server
+  '(let ((print-escape-newlines t)
+         (print-escape-nonascii t)
+         (print-escape-multibyte t)
+         (print-circle t)
+         (print-length nil)
+         (print-level nil)
+         line)
+     (while (setq line (condition-case nil
+                           (read-from-minibuffer "")
+                         (error nil)))
+       (let ((reply
+              (condition-case err
+                  (let ((request (car (read-from-string line)))
+                        (standard-output #'ignore))
+                    (dolist (file (car request))
+                      (load file nil t))
+                    (list 'ok (apply (nth 1 request) (nthcdr 2 request))))
+                (error (list 'error err)))))
+         (princ (prin1-to-string reply) t)
+         (terpri t))))
+  "The form each worker evaluates.
+It reads one request per line from standard input, and prints one
+reply per line on standard output.  A request has the form
+\(FILES FUNCTION . ARGS); the worker loads FILES and applies
+FUNCTION to ARGS.  The reply is (ok VALUE) or (error ERROR).")
+
+(defvar worker--processes nil
+  "The live worker processes.")
+
+;; The state of the running `worker-map'.
+(defvar worker--function nil)
+(defvar worker--files nil)
+(defvar worker--queue nil)
+(defvar worker--results nil)
+(defvar worker--errors nil)
+(defvar worker--remaining 0)
+
+(defun worker--processor-count ()
+  "Return the number of processors, or 1 if it is unknown."
+  (max 1 (or (ignore-errors
+               (string-to-number (getenv "NUMBER_OF_PROCESSORS")))
+             (ignore-errors
+               (with-temp-buffer
+                 (insert-file-contents "/proc/cpuinfo")
+                 (how-many "^processor[[:blank:]]*:")))
+             1)))
+
+(defun worker--print (object)
+  "Return the printed representation of OBJECT, on a single line."
+  (let ((print-escape-newlines t)
+        (print-escape-nonascii t)
+        (print-escape-multibyte t)
+        (print-circle t)
+        (print-length nil)
+        (print-level nil))
+    (prin1-to-string object)))
+
+(defun worker--send (process job files function &rest args)
+  "Make PROCESS apply FUNCTION to ARGS, after loading FILES.
+JOB identifies the request; it is an index into `worker--results'
+or a symbol."
+  (process-put process 'worker-job job)
+  (process-send-string process
+                       (concat (worker--print (cons files
+                                                    (cons function args)))
+                               "\n")))
+
+(defun worker--dispatch (process)
+  "Give the next element of `worker--queue' to PROCESS, if any."
+  (when worker--queue
+    (let* ((job (pop worker--queue))
+           (loaded (process-get process 'worker-loaded))
+           (files (delq nil (mapcar (lambda (file)
+                                      (unless (member file loaded) file))
+                                    worker--files))))
+      (process-put process 'worker-loaded (append files loaded))
+      (worker--send process (car job) files worker--function (cdr job)))))
+
+(defun worker--finish (job reply)
+  "Record REPLY as the outcome of JOB."
+  (when (integerp job)
+    (if (eq (car-safe reply) 'ok)
+        (aset worker--results job (nth 1 reply))
+      (push (cons job (if (eq (car-safe reply) 'error)
+                          (nth 1 reply)
+                        (list 'worker-error "Unreadable reply" reply)))
+            worker--errors))
+    (setq worker--remaining (1- worker--remaining))))
+
+(defun worker--filter (process string)
+  "Handle the replies in STRING, the output of worker PROCESS."
+  (let ((output (concat (process-get process 'worker-output) string))
+        (start 0))
+    (while (string-match "\n" output start)
+      (let ((line (substring output start (match-beginning 0)))
+            (job (process-get process 'worker-job)))
+        (setq start (match-end 0))
+        (process-put process 'worker-job nil)
+        (worker--finish job (condition-case nil
+                                (car (read-from-string line))
+                              (error line)))
+        (worker--dispatch process)))
+    (process-put process 'worker-output (substring output start))))
+
+(defun worker--reap (process)
+  "Forget worker PROCESS if it has died.
+A call it was running fails with a `worker-error'."
+  (unless (process-live-p process)
+    (setq worker--processes (delq process worker--processes))
+    (let ((stderr (process-get process 'worker-stderr))
+          (job (process-get process 'worker-job)))
+      (when (process-live-p stderr)
+        (delete-process stderr))
+      (process-put process 'worker-job nil)
+      (worker--finish job (list 'error (list 'worker-error "Worker died"
+                                             (process-exit-status process)))))))
+
+(defun worker--sentinel (process _event)
+  "Forget worker PROCESS if it has died."
+  (worker--reap process))
+
+(defun worker--busy-process ()
+  "Return a worker process that has a request to answer, or nil."
+  (catch 'busy
+    (dolist (process worker--processes)
+      (when (process-get process 'worker-job)
+        (throw 'busy process)))))
+
+(defun worker--start-process ()
+  "Start a worker process and return it."
+  (let* ((stderr (make-pipe-process :name "worker-stderr"
+                                    :buffer (get-buffer-create
+                                             " *worker output*")
+                                    :noquery t))
+         (process (make-process
+                   :name "worker"
+                   :command (list (expand-file-name invocation-name
+                                                    invocation-directory)
+                                  "-Q" "--batch" "--eval"
+                                  (worker--print worker--server))
+                   :coding 'utf-8-emacs-unix
+                   :connection-type 'pipe
+                   :noquery t
+                   :stderr stderr
+                   :filter #'worker--filter
+                   :sentinel #'worker--sentinel)))
+    (process-put process 'worker-stderr stderr)
+    (worker--send process 'init nil #'set 'load-path load-path)
+    process))
+
+;;;###autoload
+(defun worker-start (&optional count)
+  "Make sure the pool has COUNT worker processes.
+COUNT defaults to `worker-count', or the number of processors if
+that is nil.  `worker-map' calls this when the pool is empty, so
+calling it in advance only saves the time to start the workers."
+  (let ((count (or count worker-count (worker--processor-count))))
+    (while (< (length worker--processes) count)
+      (push (worker--start-process) worker--processes))))
+
+(defun worker-stop ()
+  "Kill all worker processes."
+  (interactive)
+  (dolist (process worker--processes)
+    ;; Don't let the sentinel record the death as a failed call.
+    (process-put process 'worker-job nil)
+    (delete-process process))
+  (setq worker--processes nil))
+
+(defun worker--function-files (function)
+  "Return the files a worker must load to call FUNCTION."
+  (let ((file (and (symbolp function)
+                   (not (subrp (symbol-function function)))
+                   (symbol-file function 'defun))))
+    (and file (list file))))
+
+;;;###autoload
+(defun worker-map (function sequence)
+  "Apply FUNCTION to each element of SEQUENCE in worker processes.
+Return a list of the results, like `mapcar'.  The calls run in
+parallel in a pool of `emacs --batch' processes, which are started
+on the first call; see `worker-start'.
+
+FUNCTION, the elements of SEQUENCE and the results must be readable
+when printed.  If FUNCTION is a symbol, a worker loads the file that
+defined it before calling it.  FUNCTION must not depend on other
+state of this Emacs, except for `load-path'.
+
+If any call signals an error, signal the error of the first such
+element of SEQUENCE, once all the calls have finished."
+  (when (> worker--remaining 0)
+    (error "`worker-map' is already running"))
+  (unless worker--processes
+    (worker-start))
+  (let ((index -1))
+    (setq worker--function function
+          worker--files (worker--function-files function)
+          worker--queue (mapcar (lambda (elt) (cons (setq index (1+ index)) elt))
+                                sequence)
+          worker--results (make-vector (length worker--queue) nil)
+          worker--errors nil
+          worker--remaining (length worker--queue)))
+  (unwind-protect
+      (progn
+        (dolist (process worker--processes)
+          (unless (process-get process 'worker-job)
+            (worker--dispatch process)))
+        (while (> worker--remaining 0)
+          (unless worker--processes
+            (signal 'worker-error '("All workers died")))
+          ;; Waiting for any process would last the whole timeout.
+          (accept-process-output (worker--busy-process) 1)
+          ;; Waiting for a process that has exited does not always run
+          ;; its sentinel.
+          (mapc #'worker--reap (copy-sequence worker--processes)))
+        (when worker--errors
+          (let ((first (car (sort worker--errors
+                                  (lambda (a b) (< (car a) (car b)))))))
+            (signal (car (cdr first)) (cdr (cdr first)))))
+        (append worker--results nil))
+    ;; If the calls did not finish, the workers would deliver their
+    ;; results to the next `worker-map'.
+    (when (> worker--remaining 0)
+      (worker-stop))
+    (setq worker--function nil
+          worker--files nil
+          worker--queue nil
+          worker--results nil
+          worker--errors nil
+          worker--remaining 0)))
+
+(provide 'worker)
+;;; worker.el ends here
@@ -0,0 +1,772 @@
+;; Quail package `chinese-sw
+;;   Generated by the command `titdic-convert'
+;;	Original TIT dictionary file: SW.tit
+
+;; # Header added for Emacs -*- coding: euc-china -*-
+;; #
+;; # This file is included in the directory contrib/clients/cxterm of the
+;; # distribution of X11R6.  As the file itself doesn't contain copyright
+;; # and license notices, the following statements in the section 6 of
+;; # the file .../cxterm/README covers it.
+;; #
+;; # X11R6 CXTERM (C) 1994 BY YONGGUANG ZHANG.
+;; # X11R5 CXTERM (C) 1991 BY YONGGUANG ZHANG AND MAN-CHI PONG.
+;; # 
+;; # Permission to use, copy, modify, and distribute this software and
+;; # its documentation for any purpose is hereby granted without fee,
+;; # provided that this entire copyright and permission notice appear
+;; # in all such copies, and that the name of the authors may not be
+;; # used to endorse or promote products derived from this material
+;; # without specific prior written permission.  The authors make no
+;; # representations about the suitability of this software for any
+;; # purpose.  It is provided "as is" without express or implied warranty.
+;; #
+;; # End of header added for Emacs
+;; # HANZI input table for cxterm
+;; # To be used by cxterm, convert me to .cit format first
+;; # .cit version 2
+;; ENCODE:	GB
+;; AUTOSELECT:	NO
+;; PROMPT:	β\040
+;; #
+;; COMMENT	(Դ CCDOS)
+;; COMMENT	дúʱġױʡβʡ磬βʽΪڡ
+;; COMMENT βģʽ ff0 롣 f ڡβģʽбʾڡ
+;; # define keys
+;; VALIDINPUTKEY:	abcdefghijklmnopqrstuvwxyz
+;; WILDCARDKEY:	*
+;; WILDCHARKEY:	?
+;; SELECTKEY:	1\040
+;; SELECTKEY:	2
+;; SELECTKEY:	3
+;; SELECTKEY:	4
+;; SELECTKEY:	5
+;; SELECTKEY:	6
+;; SELECTKEY:	7
+;; SELECTKEY:	8
+;; SELECTKEY:	9
+;; SELECTKEY:	0
+;; BACKSPACE:	\010\177
+;; DELETEALL:	\015\025
+;; MOVERIGHT:	.>
+;; MOVELEFT:	,<
+;; REPEATKEY:	\020\022
+;; KEYPROMPT(a):	
+;; KEYPROMPT(b):	ڢɽ
+;; KEYPROMPT(c):	ʬ
+;; KEYPROMPT(d):	ؼ
+;; KEYPROMPT(e):	
+;; KEYPROMPT(f):	ڿ
+;; KEYPROMPT(g):	
+;; KEYPROMPT(h):	
+;; KEYPROMPT(i):	ڥ
+;; KEYPROMPT(j):	ܳ
+;; KEYPROMPT(k):	
+;; KEYPROMPT(l):	ľ
+;; KEYPROMPT(m):	ʮ
+;; KEYPROMPT(n):	⻴
+;; KEYPROMPT(o):	
+;; KEYPROMPT(p):	
+;; KEYPROMPT(q):	ʯ
+;; KEYPROMPT(r):	ح
+;; KEYPROMPT(s):	Ů
+;; KEYPROMPT(t):	د
+;; KEYPROMPT(u):	
+;; KEYPROMPT(v):	С
+;; KEYPROMPT(w):	볧
+;; KEYPROMPT(x):	
+;; KEYPROMPT(y):	һ߮
+;; KEYPROMPT(z):	˲
+;; # the following line must not be removed
+;; BEGINDICTIONARY
+
+;;; End of the header of original TIT dictionary.
+
+;;; Code:
+
+(require 'quail)
+
+(quail-define-package "chinese-sw" "Chinese-GB" "β"
+ '(   (122 . "˲")
+   (121 . "һ߮")
+   (120 . "")
+   (119 . "볧")
+   (118 . "С")
+   (117 . "")
+   (116 . "د")
+   (115 . "Ů")
+   (114 . "ح")
+   (113 . "ʯ")
+   (112 . "")
+   (111 . "")
+   (110 . "⻴")
+   (109 . "ʮ")
+   (108 . "ľ")
+   (107 . "")
+   (106 . "ܳ")
+   (105 . "ڥ")
+   (104 . "")
+   (103 . "")
+   (102 . "ڿ")
+   (101 . "")
+   (100 . "ؼ")
+   (99 . "ʬ")
+   (98 . "ڢɽ")
+   (97 . "")
+)"β
+
+	(Դ CCDOS)
+	дúʱġױʡβʡ磬βʽΪڡ
+ βģʽ ff0 롣 f ڡβģʽбʾڡ
+
+Radical base input method for Chinese charset GB2312 (`chinese-gb2312').
+
+In this input method, you enter a Chinese character by typing two
+keys.  The first key corresponds to the first () radical, the second
+key corresponds to the last (β) radical.  The correspondence of keys
+and radicals is as below:
+
+ first radical:
+ a  b  c  d  e  f  g  h  i  j  k  l  m  n  o  p  q  r  s  t  u  v  w  x  y  z
+  ڢ ʬ ؼ     ڥ ܳ  ľ     ʯ   د     һ 
+ last radical:
+ a  b  c  d  e  f  g  h  i  j  k  l  m  n  o  p  q  r  s  t  u  v  w  x  y  z
+  ɽ           ʮ     ح Ů   С   ߮ 
+
+\\<quail-translation-docstring>
+"
+ '(("\C-?" . quail-delete-last-char)
+   
+   ("." . quail-next-translation)
+   (">" . quail-next-translation)
+   ("," . quail-prev-translation)
+   ("<" . quail-prev-translation))
+ nil nil nil nil)
+
+(quail-define-rules
+("aa" "溶˫")
+("ac" "ʥΩ")
+("ad" "Ȱ")
+("ae" "˻")
+("af" "ǡ")
+("ag" "޼")
+("ah" "")
+("ai" "ÿ")
+("aj" "Լ")
+("ak" "")
+("al" "ɣ")
+("am" "и")
+("ao" "ų")
+("ap" "")
+("ar" "ѻ")
+("as" "")
+("at" "زҳۻŻп")
+("au" "ϧ")
+("av" "")
+("ax" "")
+("ay" "æϷ")
+("az" "߹߻")
+("ba" "ž")
+("bb" "ɽҤڢ")
+("bc" "")
+("bd" "Ѻд")
+("be" "̿۩")
+("bf" "ٺҽѾڣ")
+("bg" "ũ")
+("bh" "")
+("bi" "įʵͻϿ")
+("bj" "ѧ")
+("bk" "")
+("bl" "կ")
+("bm" "庱")
+("bn" "")
+("bo" "ڻ¿Ԣ")
+("bq" "")
+("br" "ո")
+("bs" "Ѩڤ")
+("bt" "赳ھܿΡԩլ")
+("bu" "")
+("bv" "")
+("bx" "")
+("by" "")
+("bz" "Ƕխ")
+("ca" "Ļο־ܬܲ")
+("cb" "ܥ")
+("cc" "ڶѹ͹ʬʿܧ")
+("cd" "෻սپ־Τܣܨ")
+("ce" "ȴ")
+("cf" "ξƩϲ")
+("cg" "Ԭչ")
+("ch" "õ̵帰ȤԽ")
+("ci" "ܩ")
+("cj" "⾲ˢξТ")
+("ck" "ȥ̳")
+("cl" "ĩʺδܦܮ")
+("cm" "ٲƺϬܯܱ")
+("cn" "")
+("co" "۱շع̮мܡܪܭ")
+("cq" "")
+("cr" "")
+("cs" "")
+("ct" "ҵغľǿƨβܢ")
+("cu" "߶½üǽܰ")
+("cv" "ܤܫ")
+("cw" "")
+("cx" "")
+("cy" "Ǻ̹Ҽԫַ")
+("cz" "ӿ׸")
+("da" "￢")
+("db" "")
+("dc" "ԻͯҫӺ׳׼")
+("dd" "۷۷ȯΪؼۿ")
+("de" "۵")
+("df" "˾ұճվ")
+("dg" "˥װ")
+("dh" "")
+("di" "սͷ״")
+("dj" "ȭͤ")
+("dk" "ڡ")
+("dl" "⽰")
+("dm" "ױ䶷Ծ")
+("dn" "")
+("do" "ֳ˶طŸ߸ŴФЧҹի")
+("dp" "")
+("dr" "Ѿ")
+("ds" "¦ױ")
+("dt" "ɵ;ʩϰӮ")
+("du" "߾äĶƳȿ֮")
+("dv" "ڶ")
+("dw" "")
+("dx" "")
+("dy" "ֵ¾å")
+("dz" "θӺ")
+("ea" "Ϩ")
+("eb" "½")
+("ec" "ݶ¡¯׹")
+("ed" "ɿϩ")
+("ee" "۰")
+("ef" "")
+("eg" "")
+("eh" "")
+("ei" "Ȳ")
+("ej" "Ƹ")
+("ek" "")
+("el" "úȼ")
+("em" "麸")
+("eo" "")
+("ep" "")
+("eq" "")
+("er" "ͽ")
+("es" "")
+("et" "¤Ժ")
+("eu" "İ")
+("ev" "¼˸϶")
+("ex" "")
+("ey" "ª")
+("ez" "ӷը")
+("fa" "̾֨")
+("fb" "")
+("fc" "Ψ")
+("fd" "Ժẓ̌ѫӴ߶߷߿")
+("fe" "ɶ۫ߵ")
+("ff" "ῦ·Ʒɶ")
+("fg" "ι")
+("fh" "")
+("fi" "ͺԾ߻߾")
+("fj" "춣׸кǺߺѽ")
+("fk" "ߺ")
+("fl" "ȴɤζ")
+("fm" "ơҶ")
+("fn" "")
+("fo" "ĲŻҧӻ")
+("fp" "")
+("fq" "")
+("fr" "ʴڽ˻Х߹")
+("fs" "Ⱥſֻ")
+("ft" "ɳԶֹ𻣿Ǻ˱߳ߴ߸߼߽")
+("fu" "䳪ž̤")
+("fv" "ӽ")
+("fx" "")
+("fy" "ŸºŶҭֺ")
+("fz" "ȿԱզ߲")
+("ga" "ΰⱨ޺ͶԮ")
+("gb" "ҡ׾")
+("gc" "ݴһ̯ײߪ߫")
+("gd" "󵷷վп°Я")
+("ge" "Ų")
+("gf" "ݿʰ̧")
+("gg" "ߧ߭")
+("gh" "׽")
+("gi" "Ю")
+("gj" "Ʋųִšֿߤ")
+("gk" "")
+("gl" "ٲĨ̽")
+("gm" "赧ƴǤˤҾߦߨ")
+("gn" "")
+("go" "ܾƲɨͱҴӵժ")
+("gp" "")
+("gq" "")
+("gr" "˩˺Ѻߥߩ")
+("gs" "Ǳ§׫")
+("gt" "ѱ󸧽£ִ")
+("gu" "鴤ҿĴָץߡߣ")
+("gv" "̢ͦ߬")
+("gw" "")
+("gx" "ɦ")
+("gy" "굣ּ񿸿Ťק")
+("gz" "ߢ")
+("ha" "ɺû")
+("hb" "")
+("hc" "໦̲Ϋ")
+("hd" "зڹк")
+("he" "")
+("hf" "ƻºǢԡմ")
+("hg" "Ũ")
+("hh" "")
+("hi" "ĻĮ̭Ϫ")
+("hj" "ⴾŢ͡")
+("hk" "")
+("hl" "ĭȾͿ")
+("hm" "̶֭")
+("hn" "ϫ")
+("ho" "ζ©ŽμҺӿ")
+("hp" "")
+("hq" "")
+("hr" "ýԨע")
+("hs" "")
+("ht" "׳ظȸۻ콽ɳϴ")
+("hu" "ԾƿǱ")
+("hv" "ƯӾԴ")
+("hx" "")
+("hy" "λ㽦ǳɬʪйѴտ")
+("hz" "")
+("ia" "á̬")
+("ib" "ҥڨڰ")
+("ic" "˭ڴ")
+("id" "ʷú̫ѯڼ")
+("ie" "̸ڶ")
+("if" "ŵڬگڱڵڸھ")
+("ii" "Ȯڥ")
+("ij" "ʫл׻ڭں")
+("ik" "")
+("il" "ıڳ")
+("im" "ƽǣ̷ڦڻ")
+("io" "νکڪګڲڽ")
+("ip" "")
+("ir" "ѵڹڿ")
+("is" "ʶ")
+("it" "Ѽ˵ڷ")
+("iu" "ܻǫг")
+("iv" "Ǵ")
+("iy" "ϽѶ֤ڧڮ")
+("iz" "̸թ")
+("ja" "оޥީ޲")
+("jb" "")
+("jc" "維«ĹЬܶ޳޷޽")
+("jd" "ٷҹھϾĻļȵέҩܵܺݣݬݺ")
+("je" "ӫ۴ݶ")
+("jf" "ɻ̦Ӫ")
+("jg" "ݢݹ")
+("jh" "")
+("ji" "ԿĪӢܽݤ")
+("jj" "ɺʼéġεѿܳݡݧݩݪݳ޶޿")
+("jk" "ܿݿ")
+("jl" "˲轶պݱޡ޹޻")
+("jm" "ݸ羮çƻƼѦܷݷަ޵޺")
+("jn" "")
+("jo" "α޺źɢܸݫݯݼޱ޴޸")
+("jp" "")
+("jq" "Ģ")
+("jr" "нӨݾޭ")
+("js" "ήݴݽޮ")
+("jt" "ŰаͲԷɯѥԷܴܹܻܼܾݵݸݻޢޤް")
+("ju" "ܷĺǾ֥ݮޣިޫެ")
+("jv" "̹Ľˮݥ޼޾")
+("jw" "")
+("jx" "ө")
+("jy" "ؾâãïإݦݭݰݲުޯ")
+("jz" "ķȧݨާ")
+("ka" "˳͵¼ٽɵ")
+("kb" "")
+("kc" "߼ֶٵ")
+("kd" "·ݷΰα١٨ٷ")
+("ke" "ۢ")
+("kf" "̨٤٥ټ")
+("kg" "ٯ")
+("kh" "ͽ")
+("ki" "ٶٹٿ")
+("kj" "÷κͣ͵ٱ")
+("kk" "")
+("kl" "٪")
+("km" "黪ĲƧǪʲ٦ٰٺپ")
+("kn" "")
+("ko" "㶱żƫʹ΢Ӷ٧٫ٮٳٸٻ")
+("kp" "")
+("kr" "ס٭")
+("ks" "")
+("kt" "γ𻯽ľƾ٢٣٩٬")
+("ku" "۲軲ɮѭ")
+("kv" "ٴ")
+("kw" "ٲ")
+("ky" "Ͷ󽩾λֵ")
+("kz" "ծٽ")
+("la" "Ȩ֦")
+("lb" "")
+("lc" "Źȶ׮׵")
+("ld" "ϡ")
+("le" "𳻷Ҭ")
+("lf" "׺ͼϼڽսۿ")
+("lg" "")
+("lh" "")
+("li" "ģШ")
+("lj" "ĳ弾")
+("lk" "˽")
+("ll" "ܿľɭ")
+("lm" "ްӸ˸ѿ")
+("ln" "")
+("lo" "幣񼫿öͩͰϭУդ")
+("lp" "")
+("lq" "")
+("lr" "˨")
+("ls" "¥ίӣ")
+("lt" "Ź´ǹɼ˰ͺΦκ")
+("lu" "ز۴̻÷")
+("lv" "ƶ")
+("ly" "ȸ̴ܻеջֲ")
+("lz" "ե")
+("ma" "֧")
+("mc" "¢ǵ")
+("md" "ﲪݿЭרת")
+("me" "ۣ")
+("mf" "żȹϽԣ")
+("mg" "ɥϮԯշ")
+("mi" "򸤼")
+("mj" "ųĴ̴浻")
+("mk" "")
+("ml" "ĳ")
+("mm" "ܼʮئ")
+("mn" "")
+("mo" "󸦸ʺϾ")
+("mp" "")
+("mq" "")
+("mr" "˹ն")
+("ms" "")
+("mt" "ſǬҲףظ")
+("mu" "ʺ")
+("mv" "»̩")
+("mx" "")
+("my" "ôؿֱ̻")
+("mz" "߶ٹӺؼˬ")
+("na" "ƶͷԹ")
+("nb" "")
+("nc" "׶")
+("nd" "ƹϦԧ")
+("ne" "í")
+("nf" "ݾ̾Ǧղ")
+("ng" "ҿ")
+("nh" "")
+("ni" "þۼ")
+("nj" "ա")
+("nk" "")
+("nl" "Ȼɷ")
+("nm" "ǥп")
+("nn" "")
+("no" "ָ½ǽͭԿۻ")
+("np" "")
+("nq" "")
+("nr" "")
+("ns" "")
+("nt" "۷꼢ɫΣϳ")
+("nu" "³êǯ")
+("nv" "")
+("nw" "")
+("nx" "ʴз")
+("ny" "ťǮ")
+("nz" "Ƿ")
+("oa" "Ź֫")
+("ob" "")
+("oc" "ʤӷ")
+("od" "򳦴ͷιŸϣв")
+("oe" "ۭۧ۱ۺ")
+("of" "¸̥ͬ")
+("og" "ŧ")
+("oh" "")
+("oi" "Ĥҽ")
+("oj" "Ƹɲɾ")
+("ok" "")
+("ol" "ɱ")
+("om" "Ƣ")
+("on" "")
+("oo" "ܲ縬Թǻ߽Ҹس")
+("or" "˽ϻ")
+("os" "Ӥ")
+("ot" "ʼƥ˦ͮ")
+("ou" "֬׬")
+("ov" "ϥ")
+("oy" "ؼǻ߱")
+("oz" "˺ŷ")
+("pa" "л׺")
+("pb" "")
+("pc" "ά")
+("pd" "޷ķ׻γѤԼ")
+("pe" "")
+("pf" "Ե")
+("pg" "")
+("ph" "")
+("pi" "")
+("pj" "ո")
+("pk" "")
+("pl" "")
+("pm" "¼")
+("po" "ټɽʾ")
+("pp" "")
+("pr" "բ")
+("ps" "ӧ֯")
+("pt" ";ɴͳ")
+("pu" "ϸ")
+("pv" "")
+("pw" "")
+("px" "")
+("py" "̼꾭Ŧ˿ֽ")
+("pz" "Ҽ")
+("qa" "ɿƤԦ")
+("qb" "")
+("qc" "¿")
+("qd" "Ҹש")
+("qe" "̼")
+("qf" "ԥ")
+("qg" "")
+("qh" "")
+("qi" "")
+("qj" "ìѰ")
+("qk" "ź")
+("ql" "")
+("qm" "Ⱥ")
+("qn" "")
+("qo" "ĺƭȷʻӲ")
+("qq" "ʯ")
+("qr" "ѱפؾ")
+("qs" "")
+("qt" "ڳ۵ʷɰ")
+("qu" "й»")
+("qv" "µ¼")
+("qw" "")
+("qx" "ǿɧ")
+("qy" "Ǽｮӯةؽ")
+("qz" "Ѻ˶Ԥ")
+("ra" "Ѳɪ")
+("rb" "")
+("rc" "")
+("rd" "ʦ˧")
+("re" "")
+("rf" "")
+("rg" "")
+("rh" "")
+("ri" "")
+("rj" "")
+("rk" "")
+("rl" "")
+("rm" "Ū")
+("rn" "")
+("ro" "õȽɺʷ")
+("rq" "")
+("rr" "߰മح")
+("rs" "伽")
+("rt" "ȱе緫")
+("ru" "Ծñ")
+("rv" "")
+("rx" "")
+("ry" "ҵҷ")
+("rz" "ǹ֡")
+("sa" "ȷ޼ūŭɩˡϱ")
+("sb" "")
+("sc" "")
+("sd" "ּܷŬү")
+("se" "֣۷")
+("sf" "ùȼʼ")
+("sg" "")
+("sh" "")
+("si" "ؼ")
+("sj" "ǰ")
+("sk" "")
+("sl" "ý")
+("sm" "")
+("sn" "")
+("so" "ո˷")
+("sp" "")
+("sq" "")
+("sr" "")
+("ss" "˽Ů")
+("st" "ֶƿǼҦ")
+("su" "ķ")
+("sv" "")
+("sx" "")
+("sy" "ǽ")
+("sz" "ƶǸ")
+("ta" "ηϢϤػ")
+("tb" "")
+("tc" "ĵ")
+("td" "Ҳҵĵ췭˾Ѯؿ۾")
+("te" "îӡۡۥۨ۬ۮۯ۶")
+("tf" "Ѻ")
+("tg" "")
+("th" "")
+("ti" "³ʧز")
+("tj" "򳸶κ˾ʣ")
+("tk" "ô")
+("tl" "ɳ޺Ѭ")
+("tm" "ݱǸţǧ˴غ")
+("tn" "")
+("to" "")
+("tq" "")
+("tr" "ǴԻʽƬ")
+("ts" "")
+("tt" "ʲնëòƹ̺ձدذرشط")
+("tu" "ײѶܷϻʿҨּצض")
+("tv" "˶Ȫͧϵ")
+("tw" "")
+("ty" "Ѫص")
+("tz" "⿿ó˳ӱ")
+("ua" "ů˼Ͼ")
+("ub" "")
+("uc" "ī˯ͫ")
+("ud" "ĸͼΧѼ")
+("ue" "")
+("uf" "̻Ϲհ")
+("ug" "η")
+("uh" "")
+("ui" "Ĭӳ")
+("uj" "붢ʱҰ")
+("uk" "ѣ")
+("ul" "ǹ")
+("um" "˲")
+("un" "")
+("uo" "θخ")
+("uq" "ǭ")
+("ur" "׽")
+("us" "")
+("ut" "ͶڻμȦӰ԰")
+("uu" "û޾ðɹ͹գ")
+("uv" "")
+("uw" "")
+("uy" "ĿԻ")
+("uz" "ЪԲ")
+("va" "")
+("vb" "ң")
+("vc" "ȸ͢")
+("vd" "ߵݼ͸ΥѲ")
+("ve" "ӭ")
+("vf" "ǲ׷")
+("vg" "")
+("vi" "")
+("vj" "")
+("vk" "")
+("vl" ";")
+("vm" "űܷ꽨Ǩ")
+("vn" "")
+("vo" "ͨ")
+("vr" "ѹ")
+("vs" "")
+("vt" "ѡԶ")
+("vu" "Ƴٵ϶ݶʡ")
+("vv" "Сѷ")
+("vy" "Ѹ")
+("vz" "")
+("wa" "ȷϸƣԸ")
+("wb" "")
+("wc" "®̱ѹׯ")
+("wd" "ʨϯӥ")
+("we" "̵")
+("wf" "մƦ")
+("wg" "ۺԳ")
+("wh" "")
+("wi" "﻾")
+("wj" "޳Ħ")
+("wk" "")
+("wl" "")
+("wm" "Ѣ")
+("wn" "")
+("wo" "·踯űȳʹӸӹ")
+("wp" "")
+("wq" "ĥ")
+("wr" "ԽȬ")
+("ws" "")
+("wt" "̱ӱ񴯴ö򷸸¹ħ")
+("wu" "è")
+("wv" "ͥԭ")
+("ww" "")
+("wx" "")
+("wy" "ɵ׶ѾʢӦ֢")
+("wz" "̡")
+("xa" "")
+("xc" "")
+("xd" "ڽɸ")
+("xe" "")
+("xf" "֩׭")
+("xi" "ؿЦ")
+("xj" "ȷ")
+("xk" "")
+("xl" "")
+("xm" "")
+("xn" "")
+("xo" "ݹƪͲӼ")
+("xp" "")
+("xr" "")
+("xs" "ɻ¨")
+("xt" "ʱӬ")
+("xu" "ѻ׼Ы")
+("xv" "")
+("xx" "")
+("xy" "귤ƺǩ")
+("xz" "Ϻ")
+("ya" "϶񸲺ȡϼ")
+("yc" "")
+("yd" "ӹƸѳѻؤ۽")
+("ye" "аҮ۪ۤ۲۳۸۹")
+("yf" "ۿ¶")
+("yg" "")
+("yh" "")
+("yi" "̪")
+("yj" "絽绮Ϳءث")
+("yk" "")
+("yl" "")
+("ym" "ɼ߿ƽ")
+("yn" "")
+("yo" "Ա±ҸƮͪѩت")
+("yr" "껭ȩآ")
+("ys" "ȢˣҪְ")
+("yt" "ҢԪأ")
+("yu" "ٴ׺øùư˪")
+("yv" "Ʊʾ")
+("yw" "")
+("yx" "")
+("yy" "гܶɸ깤ʭʽһյֳابج߮߯߰")
+("yz" "蹱ҳ")
+("za" "")
+("zb" "")
+("zc" "ƹ¬")
+("zd" "²")
+("ze" "жۦ")
+("zf" "ռ֪")
+("zg" "ʳ")
+("zh" "")
+("zi" "ȱʸ")
+("zj" "")
+("zk" "")
+("zl" "")
+("zm" "ɡб׿")
+("zo" "ݼؿŰȣ")
+("zq" "")
+("zr" "ýȫ")
+("zs" "")
+("zt" "벽ִ˻ع")
+("zu" "±ÿ")
+("zv" "")
+("zy" "Ե̷շ׺Щսֹ")
+("zz" "ӿ­Ƶ̰է")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: chinese-iso-8bit-unix
+;; End:
@@ -0,0 +1,12584 @@
+;; Quail package `chinese-cns-tsangchi'
+;;   Generated by the command `miscdic-convert'
+;;   Source dictionary file: cangjie-table.cns
+;;   Copyright notice of the source file
+;;------------------------------------------------------
+;; # Copyright 2001 Christian Wittern <wittern@iis.sinica.edu.tw>
+;; #
+;; # Permission to copy and distribute both modified and
+;; # unmodified versions is granted without royalty provided
+;; # this notice is preserved.
+;;------------------------------------------------------
+
+;;; Code:
+
+(require 'quail)
+(quail-define-package "chinese-cns-tsangchi" "Chinese-CNS" "$(GT?(BC" t
+"$AVPND$(GrS$AHk!>$(GT?on$A!?(BCNS
+
+	$(GiGk#T?onrS$AHk$(Guomu(B
+
+   [Q $AJV(B] [W $ALo(B] [E $AK.(B] [R $A?Z(B] [T $AX%(B] [Y $A27(B] [U $AI=(B] [I $A8j(B] [O $AHK(B] [P $APD(B]
+
+    [A $AHU(B] [S $AJ,(B] [D $AD>(B] [F $A;p(B] [G $AMA(B] [H $AVq(B] [J $AJ.(B] [L $AVP(B]
+
+      [Z  ] [X $(GyE(B] [C $A=p(B] [V $AE.(B] [B $ATB(B] [N $A9-(B] [M $AR;(B]
+
+\\<quail-translation-docstring>"
+  '(("." . quail-next-translation-block)
+   ("," . quail-prev-translation-block))
+  nil nil)
+
+(quail-define-rules
+("a"	"$AHUT;(B")
+("aa"	"$A2}$(H'-(B")
+("aaa"	"$A>'(B")
+("aamh"	"$(GdB(B")
+("aaph"	"$(H<I(B")
+("aapv"	"$(GdC(B")
+("aate"	"$AFX(B")
+("aayf"	"$(HWE(B")
+("ab"	"$ACw(B")
+("abac"	"$AjT(B")
+("abbe"	"$(Gsp(B")
+("abbt"	"$ACK(B")
+("abhaf"	"$(Hp!(B")
+("abik"	"$(H=q(B")
+("abjcm"	"$(HWG(B")
+("abjj"	"$(Gd=d?(B")
+("abme"	"$AE/(B")
+("abms"	"$(G[+(B")
+("abof"	"$(HPl(B")
+("abu"	"$AC0(B")
+("abuu"	"$(H5m(B")
+("acim"	"$(HJ](B")
+("acnh"	"$(H5o(B")
+("acsh"	"$(H'1(B")
+("ad"	"$Aj=(B")
+("adhaf"	"$(Ho~(B")
+("adhl"	"$ANz(B")
+("admq"	"$(HCH(B")
+("adwf"	"$(HCG(B")
+("aenl"	"$(HNW(B")
+("af"	"$AjA$(H'y(B")
+("afbf"	"$(Hp8(B")
+("afdq"	"$(HWD(B")
+("aff"	"$(H<H(B")
+("afhhh"	"$AS0(B")
+("afmbc"	"$(G{B|O(B")
+("afmu"	"$A;N(B")
+("afno"	"$(Hat(B")
+("agbt"	"$(HW@(B")
+("agdi"	"$(GUk(B")
+("aggu"	"$(Gpn(B")
+("ahbr"	"$AIN$(H/X(B")
+("ahbu"	"$AC<(B")
+("ahe"	"$(H''(B")
+("ahgf"	"$AjV(B")
+("ahhl"	"$AjD(B")
+("ahln"	"$AL^(B")
+("ahml"	"$Aj?(B")
+("ahog"	"$(H<G(B")
+("ahoo"	"$(HPk(B")
+("ahor"	"$AjP(B")
+("ahqm"	"$APG(B")
+("ahqo"	"$(H*s(B")
+("ahs"	"$AWr$(H')(B")
+("ahsk"	"$(H\}(B")
+("aht"	"$(GN#(B")
+("ahvl"	"$A0:(B")
+("ahxu"	"$(H<K(B")
+("aice"	"$(H5n(B")
+("aihs"	"$AjI(B")
+("aijb"	"$AjN(B")
+("aimvu"	"$A<H(B")
+("aine"	"$(H*x(B")
+("aisl"	"$A<4(B")
+("aitc"	"$(Gx:(B")
+("aj"	"$ATg(B")
+("ajbj"	"$(HCL(B")
+("ajd"	"$ACA(B")
+("ajii"	"$(HPn(B")
+("ajka"	"$AJn(B")
+("ajmm"	"$AjQ(B")
+("ajmu"	"$(H5k(B")
+("ajnu"	"$(H<D(B")
+("ajv"	"$AjL(B")
+("ak"	"$(H$<(B")
+("akcf"	"$(Gpr(B")
+("akkb"	"$(G[)(B")
+("akll"	"$(H*q(B")
+("aklu"	"$(H<F(B")
+("akms"	"$(H/W(B")
+("akn"	"$Aj9(B")
+("albk"	"$AS3(B")
+("alg"	"$(H.M(B")
+("alln"	"$(H*n(B")
+("almo"	"$AjK(B")
+("alnc"	"$(HWA(B")
+("am"	"$A5)(B")
+("amam"	"$(GUq(B")
+("ambb"	"$(Hah(B")
+("ambc"	"$(HCJ(B")
+("ambg"	"$(Hh~(B")
+("ambi"	"$(Gpq(B")
+("amcw"	"$AI9(B")
+("amd"	"$(H$:(B")
+("amg"	"$AMz(B")
+("amhaf"	"$(H\1(B")
+("amhqu"	"$(HK3(B")
+("ami"	"$Aj-(B")
+("amig"	"$(H/U(B")
+("amj"	"$A:5j:(B")
+("amk"	"$Aj;(B")
+("amks"	"$(H*y(B")
+("ammk"	"$(HCM(B")
+("ammp"	"$(G|:(B")
+("ammr"	"$ANn(B")
+("ammv"	"$A3?(B")
+("amo"	"$Aj>(B")
+("amob"	"$(H*u(B")
+("amsh"	"$(H*p(B")
+("amtb"	"$(HeV(B")
+("amwg"	"$AA?(B")
+("amwj"	"$(HWB(B")
+("amyo"	"$AJG(B")
+("an"	"$(GO\(B")
+("ana"	"$(Gbf(B")
+("anaa"	"$(H[W(B")
+("anasm"	"$(Hd8(B")
+("anau"	"$ACaMm(B")
+("anayk"	"$(H[V(B")
+("anb"	"$(Gbg(B")
+("anbbe"	"$(H[X(B")
+("anbue"	"$(H`?(B")
+("anbuk"	"$(H`>(B")
+("ancru"	"$(Goe(B")
+("and"	"$(Gbe(B")
+("andh"	"$(G]p(B")
+("andmq"	"$(Gu}(B")
+("andwf"	"$(Gu|(B")
+("anehr"	"$(Guz(B")
+("anf"	"$(H=i(B")
+("anfbg"	"$(Hge(B")
+("anfbw"	"$(Hl[(B")
+("angg"	"$(Gk\(B")
+("angit"	"$(Gw^(B")
+("anhe"	"$(H'.(B")
+("anher"	"$(Gk^(B")
+("anhpa"	"$(H[Z(B")
+("anhqu"	"$(HAB(B")
+("anhud"	"$(Hd:(B")
+("anhx"	"$(HUR(B")
+("aniav"	"$(HUO(B")
+("anirm"	"$(H[T(B")
+("anit"	"$(HHU(B")
+("anjbc"	"$(Gw`(B")
+("anjka"	"$(H[S(B")
+("anki"	"$(Gbh(B")
+("anklu"	"$(H[U(B")
+("anlmc"	"$(HjT(B")
+("anlmi"	"$(Gk](B")
+("anm"	"$(GSm(B")
+("anmfj"	"$(HHV(B")
+("anmg"	"$(Gbc(B")
+("anmj"	"$(H:*(B")
+("anmjk"	"$(HjS(B")
+("anmmm"	"$(H:)(B")
+("anmnr"	"$(HHT(B")
+("anmt"	"$(Gbd(B")
+("anmwg"	"$(H`=(B")
+("annhx"	"$(Gro(B")
+("annkg"	"$(HUQ(B")
+("annok"	"$(Gu{(B")
+("ano"	"$(GX`$(H'J(B")
+("anog"	"$(H[Y(B")
+("anoi"	"$(Gk_(B")
+("anok"	"$AjR(B")
+("anomm"	"$(HjU(B")
+("anomr"	"$(Gk`(B")
+("anp"	"$(G_,(B")
+("anph"	"$(HHS(B")
+("anqou"	"$(Hgd(B")
+("anr"	"$(GYB(B")
+("anrhr"	"$(God(B")
+("anrrj"	"$(GzO(B")
+("anrrr"	"$(Gu~(B")
+("ansj"	"$(GjL(B")
+("ansqf"	"$(Gw_(B")
+("ansrj"	"$(G{<(B")
+("antcu"	"$(H`<(B")
+("antuo"	"$(Gwa(B")
+("anumt"	"$(Hd9(B")
+("anvit"	"$(GyC(B")
+("anwd"	"$(HUP(B")
+("anwl"	"$(GgP(B")
+("anwlv"	"$(HlZ(B")
+("anygq"	"$(HlY(B")
+("anyhn"	"$(HAA(B")
+("anyhs"	"$(HA@(B")
+("anyk"	"$(Gbb(B")
+("anymr"	"$(HTF(B")
+("anysy"	"$(H[R(B")
+("anyta"	"$(H`;(B")
+("anyvo"	"$(Gk[(B")
+("aodmq"	"$(HdN(B")
+("aofh"	"$(HBQ(B")
+("aohaf"	"$(Hk3(B")
+("aoii"	"$(GQV(B")
+("aoin"	"$(H'0(B")
+("aombc"	"$(Gwn(B")
+("aop"	"$A3W(B")
+("aowy"	"$A;^(B")
+("aphh"	"$ARW$(H'((B")
+("api"	"$(H$;(B")
+("apim"	"$Aj@(B")
+("app"	"$A@%(B")
+("apr"	"$(H*t(B")
+("apu"	"$(H'/(B")
+("apvo"	"$AjB(B")
+("aqka"	"$(HCK(B")
+("aqmb"	"$AGg(B")
+("arf"	"$AUUlc(B")
+("armd"	"$(H."(B")
+("arrj"	"$(HWF(B")
+("arrk"	"$(Hp9(B")
+("arye"	"$AO>(B")
+("asf"	"$(HDW(B")
+("ashr"	"$AUQ(B")
+("asje"	"$AWn(B")
+("asmg"	"$AjW(B")
+("asp"	"$AjG(B")
+("astr"	"$(Gm4(B")
+("atak"	"$(HPp(B")
+("atbc"	"$(H<J(B")
+("atbo"	"$(Haf(B")
+("atce"	"$A1)(B")
+("atcr"	"$(H_X(B")
+("atgs"	"$AjX(B")
+("atlb"	"$(HPo(B")
+("atlf"	"$(Hh}(B")
+("atlo"	"$(HPj(B")
+("atmj"	"$(Gpp(B")
+("au"	"$A0M$(H$=(B")
+("auam"	"$At_(B")
+("aug"	"$(H:i(B")
+("auhqu"	"$(HD'(B")
+("auks"	"$A[C(B")
+("aumt"	"$(HJ_(B")
+("aunl"	"$(H@x(B")
+("aunwf"	"$(Hj~(B")
+("auu"	"$(H#f*r(B")
+("av"	"$At^(B")
+("avhaf"	"$(Hk4m)ni(B")
+("avhl"	"$(HWC(B")
+("avhqu"	"$(HD%(B")
+("avno"	"$AP*(B")
+("awla"	"$AJo(B")
+("awle"	"$AB|(B")
+("aybp"	"$(Hh|(B")
+("aydk"	"$AjU(B")
+("ayhs"	"$(H'%(B")
+("ayk"	"$(H'&'*(B")
+("ayoj"	"$(H<E(B")
+("ayrb"	"$(HJ^(B")
+("ayrf"	"$A>0A@(B")
+("ayrv"	"$AjY(B")
+("aysd"	"$(HCE(B")
+("ayt"	"$AjE(B")
+("ayta"	"$A05(B")
+("aytg"	"$(HW>(B")
+("aytj"	"$(HPm(B")
+("ayvi"	"$(H*m(B")
+("b"	"$ATB(B")
+("bahm"	"$APH(B")
+("bamh"	"$(Gf#(B")
+("bau"	"$A7J(B")
+("bayc"	"$AZ$(B")
+("bb"	"$AEs(B")
+("bbb"	"$A9G(B")
+("bbbr"	"$(HFG(B")
+("bbbuu"	"$(Hg!(B")
+("bbdhe"	"$(HU{(B")
+("bbdi"	"$(H8N(B")
+("bbe"	"$AJ\(B")
+("bbggu"	"$(HnQ(B")
+("bbhaf"	"$(Hm*(B")
+("bbher"	"$Aw@(B")
+("bbhf"	"$(Gy\(B")
+("bbhhj"	"$AwB(B")
+("bbhne"	"$Aw;(B")
+("bbibi"	"$(Hjt(B")
+("bbijc"	"$(Hln(B")
+("bbjhr"	"$AwD(B")
+("bbjmc"	"$(Hpb(B")
+("bbjr"	"$Aw<(B")
+("bbjti"	"$(G}/(B")
+("bbkms"	"$(H[y(B")
+("bbkni"	"$(HHo(B")
+("bbln"	"$(H3o(B")
+("bblwv"	"$(G{H(B")
+("bbmbc"	"$(Hgt(B")
+("bbmj"	"$(HHn(B")
+("bbmlk"	"$(H`p(B")
+("bbmr"	"$AkX(B")
+("bbnd"	"$Akc(B")
+("bbnq"	"$AK4(B")
+("bboll"	"$Aw:(B")
+("bbpe"	"$(Gcx(B")
+("bbr"	"$(H)K(B")
+("bbtmt"	"$(G|((B")
+("bbtqm"	"$(Hjs(B")
+("bbtwt"	"$(G|U(B")
+("bbu"	"$(Gc*(B")
+("bbug"	"$(Hmr(B")
+("bbul"	"$(HV=(B")
+("bbuu"	"$(G]<(B")
+("bbwd"	"$AwA(B")
+("bbwli"	"$AwG(B")
+("bbyck"	"$(H[v(B")
+("bbyhn"	"$(Gks(B")
+("bbykb"	"$AKh(B")
+("bbymp"	"$(H[x(B")
+("bbyrb"	"$(Hjr(B")
+("bbytj"	"$(Gy0(B")
+("bbyvo"	"$A:!(B")
+("bcabu"	"$(HZ`(B")
+("bcaph"	"$(Go2(B")
+("bcbcc"	"$(HlB(B")
+("bcbcd"	"$(HTV(B")
+("bcbgr"	"$(HTS(B")
+("bcbjj"	"$(HZb(B")
+("bcbuc"	"$(HN<(B")
+("bcbuu"	"$(H_G(B")
+("bccwa"	"$(Gy%(B")
+("bcdh"	"$(GXB(B")
+("bcff"	"$(HTW(B")
+("bcgwc"	"$(G{u(B")
+("bchaf"	"$(He!(B")
+("bche"	"$(G]I(B")
+("bcher"	"$(Gfv(B")
+("bchio"	"$(Gb:(B")
+("bchpm"	"$(H@O(B")
+("bchqm"	"$(H@Q(B")
+("bcibi"	"$(GuW(B")
+("bcii"	"$(Go-(B")
+("bciih"	"$(Hc`(B")
+("bcij"	"$(Gfp(B")
+("bcije"	"$(HN;(B")
+("bcikk"	"$(Hg4(B")
+("bcims"	"$(G{.(B")
+("bcir"	"$(Gb4(B")
+("bcj"	"$(H(N(B")
+("bcjir"	"$(HZd(B")
+("bcjka"	"$(Go/(B")
+("bcjmn"	"$(Gb1(B")
+("bckb"	"$(Gfs(B")
+("bcll"	"$(HN=(B")
+("bclmt"	"$(HlA(B")
+("bcln"	"$(GP,(B")
+("bcmj"	"$A:1(B")
+("bcmmv"	"$(Gk4(B")
+("bcmpm"	"$(Go,(B")
+("bcmvn"	"$(Hf#(B")
+("bcmwj"	"$(Hg6(B")
+("bcncr"	"$(GzE(B")
+("bcnl"	"$(H3<H+(B")
+("bcoju"	"$(Gz-(B")
+("bcok"	"$(GZu(B")
+("bcomf"	"$(Gk5(B")
+("bcpd"	"$(H3%(B")
+("bcqka"	"$(HZc(B")
+("bcr"	"$(H#,(B")
+("bcrhu"	"$(H@N(B")
+("bcrl"	"$(Gf&(B")
+("bcru"	"$(G\k(B")
+("bcrxu"	"$(Hp((B")
+("bcsmv"	"$(Go.(B")
+("bctbc"	"$(HTR(B")
+("bctct"	"$(H_d(B")
+("bcttb"	"$(GuU(B")
+("bctxc"	"$(GuS(B")
+("bcv"	"$(GsO(B")
+("bcyhn"	"$(H9U(B")
+("bcymr"	"$(Hl@(B")
+("bcyoj"	"$(HTQ(B")
+("bcyr"	"$(Gb2(B")
+("bcytr"	"$(Go*(B")
+("bcyvo"	"$(Gfw(B")
+("bd"	"$A2I(B")
+("bdhhh"	"$A2J(B")
+("bdi"	"$AVb(B")
+("bdnl"	"$A[.(B")
+("bdoe"	"$AO%(B")
+("bdu"	"$AHi(B")
+("beee"	"$(H?2(B")
+("behaf"	"$(Hk6(B")
+("bf"	"$AVK(B")
+("bfbg"	"$ALE(B")
+("bfcb"	"$(HM0(B")
+("bfd"	"$(H%M(B")
+("bfdq"	"$Al"(B")
+("bfhvf"	"$(Gql(B")
+("bfmu"	"$AkW(B")
+("bfp"	"$(Gyl(B")
+("bfq"	"$AEV(B")
+("bfqc"	"$(GuV(B")
+("bfqe"	"$Akx(B")
+("bfqf"	"$(GzV$(HYC(B")
+("bfqg"	"$Aks(B")
+("bfqi"	"$(HZ4(B")
+("bfqr"	"$(GuN(B")
+("bfqs"	"$(G^9(B")
+("bfqu"	"$(H?/(B")
+("bfqv"	"$Akt(B")
+("bfu"	"$(H3N(B")
+("bg"	"$A6G(B")
+("bggu"	"$(HYV(B")
+("bghqu"	"$Ak,(B")
+("bgi"	"$(H,y(B")
+("bgr"	"$AV\(B")
+("bgte"	"$Ak{(B")
+("bgth"	"$AEr(B")
+("bha"	"$(H-&(B")
+("bhae"	"$AOY(B")
+("bhbue"	"$(Hqx(B")
+("bhbvk"	"$(H_b(B")
+("bhdh"	"$A2r(B")
+("bhdv"	"$(H?3(B")
+("bhdw"	"$(HYZ(B")
+("bher"	"$A8l(B")
+("bhgf"	"$(Hbk(B")
+("bhhau"	"$AC2(B")
+("bhher"	"$A:Q(B")
+("bhhh"	"$Ak@(B")
+("bhhhj"	"$(HTP(B")
+("bhhj"	"$AF"(B")
+("bhhv"	"$(GWc(B")
+("bhhwp"	"$Auy(B")
+("bhjc"	"$(H@L(B")
+("bhje"	"$(HFC(B")
+("bhjg"	"$(Gf'(B")
+("bhjm"	"$(HFF(B")
+("bhju"	"$(HFE(B")
+("bhlq"	"$(HG_(B")
+("bhlwv"	"$(Hc](B")
+("bhma"	"$Auv(B")
+("bhmam"	"$(HG^(B")
+("bhmj"	"$(H3$(B")
+("bhml"	"$(H(O(B")
+("bhn"	"$AH_<!(B")
+("bhne"	"$A9I(B")
+("bhob"	"$(H9T(B")
+("bhod"	"$Auw(B")
+("bhomn"	"$(HZ_(B")
+("bhon"	"$(H22(B")
+("bhpi"	"$A1*(B")
+("bhpm"	"$AkU(B")
+("bhqm"	"$AJ$(B")
+("bhqo"	"$(H,~(B")
+("bhrrj"	"$(Hg3(B")
+("bhrye"	"$(HZ](B")
+("bhs"	"$AkQ(B")
+("bhshr"	"$Auu(B")
+("bhsrr"	"$(Hc[(B")
+("bhtak"	"$Aux(B")
+("bhtw"	"$(GrI(B")
+("bhuc"	"$(G|D(B")
+("bhumb"	"$(HZ^(B")
+("bhuu"	"$(H@MY[(B")
+("bhvo"	"$AkR(B")
+("bhwg"	"$(Gk1(B")
+("bhwp"	"$(HM/(B")
+("bhx"	"$AR((B")
+("bhxo"	"$Aki(B")
+("bibi"	"$A22(B")
+("bice"	"$(H5q8S(B")
+("bijb"	"$A8,(B")
+("bije"	"$(H8K(B")
+("bikk"	"$(H,{(B")
+("bioi"	"$A8-(B")
+("bipc"	"$(Gqx(B")
+("bipf"	"$(HfL(B")
+("bir"	"$AL%(B")
+("biypu"	"$Ak=(B")
+("bjb"	"$A7N(B")
+("bjbd"	"$A21(B")
+("bjbj"	"$Akn(B")
+("bjcg"	"$Aky(B")
+("bjcm"	"$AG;(B")
+("bjdhe"	"$(HL)(B")
+("bje"	"$AV+(B")
+("bjhaf"	"$(Hk)(B")
+("bjii"	"$(HS)(B")
+("bjlmi"	"$(Hfp(B")
+("bjmbc"	"$(HdR(B")
+("bjmc"	"$(Gw-(B")
+("bjmu"	"$Akd(B")
+("bjnl"	"$(H@u(B")
+("bjnu"	"$AMs(B")
+("bjtc"	"$(HYW(B")
+("bjti"	"$(HfK(B")
+("bjv"	"$A07(B")
+("bjwj"	"$(GS[(B")
+("bkcf"	"$(HYY(B")
+("bkcor"	"$(GuQ(B")
+("bkf"	"$AH;(B")
+("bkhaf"	"$(Hk2(B")
+("bki"	"$AkE(B")
+("bkk"	"$AMx(B")
+("bklu"	"$Akg(B")
+("bkms"	"$A?h(B")
+("bkn"	"$ARH(B")
+("bkni"	"$(H$w(B")
+("bknl"	"$(H@{(B")
+("bkog"	"$(Gwf(B")
+("bkoo"	"$(H8J(B")
+("bks"	"$A@_(B")
+("blbk"	"$(H-)(B")
+("blln"	"$(H,x(B")
+("blmo"	"$(H/Z21(B")
+("blmy"	"$Akh(B")
+("bln"	"$Ak>(B")
+("blwl"	"$AkO(B")
+("blwv"	"$(HS+(B")
+("blxh"	"$(H-'(B")
+("bm"	"$AGR8X`m(B")
+("bmbb"	"$(Hbi(B")
+("bmbg"	"$(Hi`(B")
+("bmbl"	"$(H2/(B")
+("bmfm"	"$AE_(B")
+("bmig"	"$(H20(B")
+("bmj"	"$A8N(B")
+("bmke"	"$Ak<(B")
+("bmks"	"$AVz(B")
+("bmln"	"$(H#/(B")
+("bmmc"	"$A>_(B")
+("bmmo"	"$AZ#(B")
+("bmmu"	"$AkC(B")
+("bmmv"	"$(G\n(B")
+("bmog"	"$AvB(B")
+("bmr"	"$AM,(B")
+("bmrb"	"$Aku(B")
+("bmrt"	"$(G\m(B")
+("bmrw"	"$(HF;(B")
+("bmso"	"$Ak`(B")
+("bmui"	"$A9Z(B")
+("bmvm"	"$(H8L(B")
+("bmwf"	"$A1l(B")
+("bmwv"	"$AQ|(B")
+("bn"	"$(H!h(B")
+("bnau"	"$(H8R(B")
+("bncr"	"$(Gu$(B")
+("bnd"	"$AfZ(B")
+("bnii"	"$(HS,(B")
+("bnkg"	"$(H8Q(B")
+("bnkq"	"$Akl(B")
+("bnlii"	"$(Hl5(B")
+("bnmu"	"$A4`(B")
+("bnui"	"$AT)(B")
+("boae"	"$A89(B")
+("bob"	"$AkG(B")
+("bobo"	"$(H/Y(B")
+("bodi"	"$(H-%(B")
+("bog"	"$(H?4(B")
+("bogf"	"$(HY](B")
+("bogs"	"$(H^Z(B")
+("bohh"	"$AkS(B")
+("boin"	"$(H(M(B")
+("boip"	"$(H?5(B")
+("boma"	"$(Gu&(B")
+("bommf"	"$A<@(B")
+("bomn"	"$Akr(B")
+("bomo"	"$(Gu%(B")
+("bomrt"	"$(HGY(B")
+("bon"	"$(H$v(B")
+("boog"	"$Akb(B")
+("bopd"	"$(H-!(B")
+("botf"	"$(HY\(B")
+("bowy"	"$(H8U(B")
+("bpa"	"$AV,(B")
+("bpr"	"$AkT$(H-$(B")
+("bpru"	"$A0{(B")
+("bpu"	"$AkF(B")
+("bpuk"	"$APX(B")
+("bq"	"$ASC(B")
+("bqkk"	"$Akm(B")
+("bqmf"	"$(HM,(B")
+("bqu"	"$AK&(B")
+("brc"	"$(H,z(B")
+("brhaf"	"$(HhT(B")
+("brhg"	"$(H8M(B")
+("brhhh"	"$(GZ4(B")
+("bri"	"$(H/1(B")
+("brog"	"$A5q(B")
+("brrd"	"$Ak}(B")
+("brsmm"	"$(HM$(B")
+("bsd"	"$(GNh(B")
+("bsef"	"$(HhU(B")
+("bshh"	"$Aut(B")
+("bshi"	"$(H$t(B")
+("bsjr"	"$(H?1(B")
+("bsle"	"$A7~(B")
+("bsmg"	"$(HF>(B")
+("bsmh"	"$(GnO(B")
+("bsmv"	"$(GaN(B")
+("bss"	"$AM9(B")
+("bt"	"$(GEu$ACs(B")
+("bta"	"$A@0(B")
+("btab"	"$(Gp6(B")
+("btak"	"$AD$(B")
+("btbc"	"$ALs(B")
+("btbo"	"$Ak|(B")
+("btct"	"$(HM+(B")
+("btgr"	"$AIE(B")
+("btis"	"$(G{p(B")
+("btk"	"$Ak^(B")
+("btlf"	"$(Hia(B")
+("btlk"	"$(HCN(B")
+("btln"	"$(GI4(B")
+("btmbc"	"$(H[f(B")
+("btmd"	"$(HF<(B")
+("btoe"	"$(Hbj(B")
+("btt"	"$Ak](B")
+("btu"	"$(GM%(B")
+("btwv"	"$(Gu#(B")
+("btyj"	"$(HYX(B")
+("btyv"	"$AXh(B")
+("bu"	"$AD?(B")
+("buamj"	"$(H>B(B")
+("buamo"	"$(HL+(B")
+("buana"	"$(H]i(B")
+("buank"	"$(Hq)(B")
+("buav"	"$AQ[(B")
+("bubac"	"$An((B")
+("bubbq"	"$AK2(B")
+("bubd"	"$A2G(B")
+("bubgr"	"$(HEH(B")
+("bubsd"	"$(GeJ(B")
+("bubuk"	"$(HL*(B")
+("bubuu"	"$(H>AN.(B")
+("buc"	"$(GKJ(B")
+("buce"	"$(HFA(B")
+("bucim"	"$(HRG(B")
+("bucms"	"$(H,H(B")
+("bucnh"	"$Am{(B")
+("bucsh"	"$AEN(B")
+("budoo"	"$(GeE(B")
+("bufb"	"$(H>@(B")
+("bufbf"	"$(Hq((B")
+("bufbg"	"$An*(B")
+("bufd"	"$ACP(B")
+("bufdq"	"$An,(B")
+("buff"	"$(HEA(B")
+("bufh"	"$Amp(B")
+("bufqu"	"$(HE@(B")
+("bugce"	"$(HEB(B")
+("bugcg"	"$AD@(B")
+("bugg"	"$Amu(B")
+("bugit"	"$An'(B")
+("buhaf"	"$(G{O$(HXk(B")
+("buhdf"	"$A3r(B")
+("buhe"	"$(H,E(B")
+("buhgf"	"$(Hf'(B")
+("buhhj"	"$An"(B")
+("buhhv"	"$(H7R(B")
+("buhio"	"$AU#(B")
+("buhjm"	"$AK/(B")
+("buhju"	"$(HL2(B")
+("buhml"	"$(H,I(B")
+("buhni"	"$(Hgx(B")
+("buhok"	"$(Hix(B")
+("buhoo"	"$(HXf(B")
+("buhpa"	"$(HEE(B")
+("buhqi"	"$(H>E(B")
+("buhqo"	"$(H15(B")
+("buhqu"	"$(H,F(B")
+("buhsk"	"$(HEG(B")
+("buhu"	"$(GKD(B")
+("buhus"	"$(HiE(B")
+("buhvf"	"$Atm(B")
+("buhxe"	"$An$(B")
+("buhxu"	"$Am~(B")
+("buihq"	"$Amx(B")
+("buik"	"$(H+~(B")
+("buir"	"$Amt(B")
+("buitc"	"$(HiC(B")
+("buiv"	"$(H13(B")
+("bujbc"	"$(Gmz(B")
+("bujd"	"$(H11(B")
+("bujka"	"$A6C(B")
+("bujlo"	"$A=^(B")
+("bujmc"	"$(HXbf%(B")
+("bujmn"	"$(H10(B")
+("bujmu"	"$(H>>(B")
+("bujnu"	"$(HE>(B")
+("bujqr"	"$AO9(B")
+("bukcf"	"$(GtK(B")
+("bukkb"	"$(H>D(B")
+("bukn"	"$(H7N(B")
+("bulbu"	"$Amq(B")
+("bullp"	"$(HXh(B")
+("bulmc"	"$(H]j(B")
+("bulmi"	"$(HMz(B")
+("bulmo"	"$ALw(B")
+("buln"	"$(GTK(B")
+("bulwl"	"$(H14(B")
+("bulwv"	"$(HXe(B")
+("bumbg"	"$(Hkn(B")
+("bumd"	"$Aml(B")
+("bumgg"	"$Am}(B")
+("bumj"	"$(H(:(B")
+("bumjk"	"$An+(B")
+("bumls"	"$Amm(B")
+("bummi"	"$(H,C(B")
+("bumn"	"$A6"(B")
+("bumwf"	"$An)(B")
+("bumwj"	"$(H]g(B")
+("bumym"	"$(H12(B")
+("bunau"	"$(H>F(B")
+("bunbe"	"$(HiD(B")
+("buncr"	"$AU0(B")
+("bunhb"	"$(H]h(B")
+("bunin"	"$Amw(B")
+("bunir"	"$(H7Q(B")
+("bunok"	"$An%(B")
+("bunot"	"$A5I(B")
+("buog"	"$An!vD$(HS-(B")
+("buoge"	"$A[G(B")
+("buogf"	"$AGF(B")
+("buohh"	"$(H17(B")
+("buoma"	"$(HbB(B")
+("buomb"	"$(HEF(B")
+("buomn"	"$(HL.(B")
+("buomo"	"$(Gvo(B")
+("buon"	"$(H(;(B")
+("buotf"	"$(H]k(B")
+("bupa"	"$(H7P(B")
+("bupim"	"$(H,G(B")
+("bupu"	"$Amo(B")
+("buqmb"	"$A>&(B")
+("buqou"	"$(HXd(B")
+("burb"	"$(H>C(B")
+("burrd"	"$(HbA(B")
+("burvp"	"$AC_(B")
+("bushr"	"$(H1;(B")
+("busj"	"$(H7O(B")
+("busmg"	"$A?t(B")
+("busyi"	"$(G}3(B")
+("butak"	"$(HXj(B")
+("butbo"	"$(GxT(B")
+("butco"	"$(H]m(B")
+("butk"	"$(H7K(B")
+("butlb"	"$(GqP(B")
+("butmj"	"$(H]l(B")
+("butq"	"$(H7T(B")
+("butrg"	"$(Ho:(B")
+("butw"	"$ACi(B")
+("buu"	"$(H*z,}(B")
+("buvfb"	"$(Hf&(B")
+("buvis"	"$(H16(B")
+("buvml"	"$A6&(B")
+("buvne"	"$(HED(B")
+("buwd"	"$(G`z(B")
+("buybp"	"$(Gzz(B")
+("buyfd"	"$(Gmw(B")
+("buyoj"	"$(HE?(B")
+("buytg"	"$AM+(B")
+("buytj"	"$(HXi(B")
+("buyub"	"$(HXc(B")
+("buyv"	"$(H(8(B")
+("buyvi"	"$AQ#(B")
+("bv"	"$AMW(B")
+("bvg"	"$(GpJ(B")
+("bvhaf"	"$(G}E(B")
+("bvhl"	"$(HY^(B")
+("bvik"	"$A^I(B")
+("bvnl"	"$(H@|(B")
+("bvno"	"$(HFB(B")
+("bvp"	"$(Gs^(B")
+("bvvv"	"$(Gxi(B")
+("bvvw"	"$(Gf*(B")
+("bwim"	"$(HS*(B")
+("bwk"	"$AkY(B")
+("bwl"	"$AkN(B")
+("bwlb"	"$(HF?(B")
+("bwli"	"$A>t$(H^Y(B")
+("bwmv"	"$(HF@(B")
+("bwot"	"$(HM-(B")
+("bwp"	"$AHy(B")
+("by"	"$A5$(B")
+("byav"	"$AMH(B")
+("bybb"	"$(H^[(B")
+("bybp"	"$(Gyr(B")
+("bybs"	"$A0r(B")
+("byhaf"	"$(HV9(B")
+("byhhh"	"$AM.(B")
+("byhn"	"$A09(B")
+("byhr"	"$(HM.(B")
+("byhs"	"$A7>(B")
+("byia"	"$(HYT(B")
+("byij"	"$(HS((B")
+("byln"	"$(H!}(B")
+("byoj"	"$(H?6(B")
+("byok"	"$AR8(B")
+("bypo"	"$(H^V(B")
+("bypt"	"$(Gz/(B")
+("byrn"	"$(H8T(B")
+("byta"	"$(HF9(B")
+("bytg"	"$(HWHY_(B")
+("bytoe"	"$(Hd@(B")
+("bytp"	"$AR\(B")
+("byvg"	"$AS7(B")
+("byvi"	"$(H,w(B")
+("byvo"	"$Ak\(B")
+("bywm"	"$Ak~(B")
+("byx"	"$(Gw,(B")
+("c"	"$A=p(B")
+("ca"	"$(HA:(B")
+("caa"	"$(H[F(B")
+("cafu"	"$(Hd4(B")
+("cam"	"$(HH@(B")
+("camh"	"$(Gux(B")
+("camj"	"$(Goc(B")
+("camo"	"$(H`%(B")
+("camvn"	"$Aj5(B")
+("can"	"$(H[8(B")
+("canl"	"$(HT}(B")
+("canw"	"$(HqB(B")
+("caph"	"$(Grf(B")
+("capp"	"$(Gre(B")
+("capv"	"$(H`4(B")
+("casm"	"$(Hd%(B")
+("cate"	"$(G|M(B")
+("cau"	"$(HA1(B")
+("cav"	"$(GkQ(B")
+("cawe"	"$(Gy;(B")
+("cb"	"$(HA=(B")
+("cbb"	"$(H[L(B")
+("cbbe"	"$(HlW(B")
+("cbbr"	"$(Gur(B")
+("cbcn"	"$(H`"(B")
+("cbdi"	"$(HU8(B")
+("cbgr"	"$(H[9(B")
+("cbjj"	"$(H`/(B")
+("cbm"	"$(HHB(B")
+("cbme"	"$(Guw(B")
+("cbmr"	"$(GkR(B")
+("cbms"	"$(Go\(B")
+("cbsd"	"$(Grh(B")
+("cbu"	"$(HHA(B")
+("cbuc"	"$(Goa(B")
+("cbue"	"$(Hr1(B")
+("cbuu"	"$(HUF(B")
+("ccc"	"$AvN(B")
+("cci"	"$(HA5(B")
+("ccnh"	"$(GoY(B")
+("ccor"	"$(HU=(B")
+("ccr"	"$(GgE(B")
+("ccru"	"$(Go^(B")
+("ccsh"	"$(HA>(B")
+("cdh"	"$(H:'(B")
+("cdhe"	"$(GgM(B")
+("cdk"	"$(HA0(B")
+("cdl"	"$(HUC(B")
+("cdmq"	"$(H`1(B")
+("cdoo"	"$(H[2(B")
+("cdwf"	"$(Gup(B")
+("cea"	"$(H[J(B")
+("ceah"	"$(Hj5(B")
+("ceed"	"$(Hd.(B")
+("ceee"	"$(H[5(B")
+("cehv"	"$(H_z(B")
+("cei"	"$(G]j(B")
+("cf"	"$(HA+(B")
+("cfb"	"$(GoZ(B")
+("cfbc"	"$(GwU(B")
+("cfbd"	"$(HjM(B")
+("cfbf"	"$(Hr/(B")
+("cfbg"	"$(Gy:(B")
+("cfbr"	"$(H[E(B")
+("cfbu"	"$(Hd3(B")
+("cfbw"	"$(G{8(B")
+("cfd"	"$(HN_(B")
+("cfdq"	"$(Hj7(B")
+("cff"	"$(H[.(B")
+("cffd"	"$(Hn<(B")
+("cffs"	"$(HjG(B")
+("cfh"	"$(GbY(B")
+("cfmu"	"$(HNz(B")
+("cfq"	"$(HHG(B")
+("cfqu"	"$(H[-(B")
+("cg"	"$(H:%(B")
+("cgce"	"$(H[C(B")
+("cgcg"	"$(H[B(B")
+("cgg"	"$(HNt(B")
+("cggu"	"$(GzM(B")
+("cgi"	"$(HHK(B")
+("cgit"	"$(Hd2(B")
+("cgni"	"$(G{{(B")
+("cgp"	"$(HUB(B")
+("cgr"	"$(HNu(B")
+("cgrv"	"$(Hd1(B")
+("cha"	"$(GgH(B")
+("chab"	"$(Grj(B")
+("chag"	"$(H`((B")
+("chd"	"$(HHP(B")
+("chdb"	"$(HjN(B")
+("chdf"	"$(Guu(B")
+("chdh"	"$(IOP(B")
+("chdn"	"$(HUH(B")
+("chdw"	"$(HjD(B")
+("che"	"$(Gba(B")
+("chej"	"$(Go`(B")
+("cher"	"$(GkU(B")
+("chey"	"$(HHQ(B")
+("chgi"	"$(HN}(B")
+("chgr"	"$(HU:(B")
+("chgu"	"$(GkZ(B")
+("chhaf"	"$(HV7dy(B")
+("chhe"	"$(Ho[(B")
+("chhh"	"$(H:!(B")
+("chhj"	"$(H[;(B")
+("chhl"	"$(GgO(B")
+("chhw"	"$(Hd*(B")
+("chjd"	"$(GkT(B")
+("chje"	"$(Guv(B")
+("chjg"	"$(Gut(B")
+("chjm"	"$(Gus(B")
+("chjr"	"$(HNa(B")
+("chju"	"$(H`9(B")
+("chjx"	"$(H_|(B")
+("chlc"	"$(HoY(B")
+("chln"	"$ALj(B")
+("chlo"	"$(HA4(B")
+("chmbc"	"$(Ggc(B")
+("chml"	"$(HA3(B")
+("chmr"	"$(HNk(B")
+("chni"	"$(G]o(B")
+("chnl"	"$(H%,(B")
+("chok"	"$(H'"(B")
+("choo"	"$(HgW(B")
+("chpa"	"$(H[N(B")
+("chqi"	"$(HU<(B")
+("chqm"	"$(HHN(B")
+("chrf"	"$(GwV(B")
+("chuc"	"$(G}=(B")
+("chud"	"$(GwW(B")
+("chup"	"$(Hd6(B")
+("chvo"	"$(HHR(B")
+("chwp"	"$(Hd)(B")
+("chxe"	"$(Hd((B")
+("chxh"	"$(HUI(B")
+("ci"	"$A9+(B")
+("ciav"	"$(HU-(B")
+("cibi"	"$(Hd#(B")
+("cice"	"$(HUG(B")
+("cihf"	"$(HgP(B")
+("cihm"	"$(HNv(B")
+("cihq"	"$(HN{(B")
+("cihr"	"$(H`!(B")
+("cihs"	"$(HNn(B")
+("cihu"	"$(HA<(B")
+("cii"	"$(Grd(B")
+("ciih"	"$(Hg`(B")
+("ciil"	"$(H_{(B")
+("cijb"	"$(Go[(B")
+("cijc"	"$(HH:(B")
+("cije"	"$(HU1(B")
+("cikk"	"$(GgA(B")
+("cilb"	"$(HgL(B")
+("cile"	"$(HgZ(B")
+("cill"	"$(HNp(B")
+("cilr"	"$(Hd+(B")
+("cimbc"	"$(Ggd(B")
+("cimn"	"$ANM(B")
+("cine"	"$(HNr(B")
+("cip"	"$(H9{(B")
+("cipf"	"$(G|K(B")
+("cipm"	"$(HNs(B")
+("cipp"	"$(HU3(B")
+("cir"	"$(HHF(B")
+("cism"	"$ANL(B")
+("citc"	"$(G{5(B")
+("cite"	"$(Gul(B")
+("citf"	"$(Hg[(B")
+("civ"	"$(HH;(B")
+("cixp"	"$(Hg\(B")
+("cj"	"$(GX\(B")
+("cjbc"	"$(GwX(B")
+("cjbd"	"$(HUA(B")
+("cjbf"	"$(Hd0(B")
+("cjcr"	"$(GwS(B")
+("cjig"	"$(G{7(B")
+("cjii"	"$(Hg](B")
+("cjip"	"$(HjJ(B")
+("cjka"	"$(H[1(B")
+("cjki"	"$(HU,(B")
+("cjkp"	"$(HNc(B")
+("cjks"	"$(GkP(B")
+("cjmc"	"$(HgYn6(B")
+("cjmf"	"$(H[=(B")
+("cjmm"	"$(H`-(B")
+("cjmo"	"$(Gr_$(Hc}(B")
+("cjmu"	"$(HU?(B")
+("cjnu"	"$(H[>(B")
+("cjp"	"$(HH4(B")
+("cjpn"	"$(Hn:(B")
+("cjr"	"$(Gg?(B")
+("cjrr"	"$(H[+(B")
+("cjtc"	"$(HjK(B")
+("cjto"	"$(HqE(B")
+("cjv"	"$(GkX(B")
+("ck"	"$A88$(H9|(B")
+("ckau"	"$A0V(B")
+("ckb"	"$(HNe(B")
+("ckce"	"$(HgV(B")
+("ckcf"	"$(Hj=(B")
+("ckgg"	"$(H`3(B")
+("ckhml"	"$A8+(B")
+("cki"	"$(HA.A9(B")
+("ckjt"	"$(H[4(B")
+("cklb"	"$(GgB(B")
+("ckld"	"$(HNx(B")
+("ckmf"	"$(H[3(B")
+("ckmgc"	"$A8*(B")
+("ckmr"	"$(Grk(B")
+("ckms"	"$(HNy(B")
+("ckn"	"$(H3GNq(B")
+("cknin"	"$A5y(B")
+("ckoo"	"$(HU2(B")
+("cksjl"	"$(Ge%(B")
+("clbk"	"$(HHC(B")
+("clbu"	"$(HA8(B")
+("clll"	"$(G]m(B")
+("clmc"	"$(HjB(B")
+("clmo"	"$(HNh(B")
+("cln"	"$(GX](B")
+("clnc"	"$(Hj>(B")
+("clw"	"$(GgD(B")
+("clwv"	"$(Gy@(B")
+("clx"	"$(GzN(B")
+("cm"	"$(G]n(B")
+("cma"	"$(HNw(B")
+("cmbb"	"$(Hn7(B")
+("cmbc"	"$(H`T(B")
+("cmbw"	"$(G{6(B")
+("cmd"	"$(H:#(B")
+("cmfb"	"$(Hn=(B")
+("cmfe"	"$(HU.(B")
+("cmfj"	"$(HNd(B")
+("cmgi"	"$(HH7(B")
+("cmgr"	"$(HpZ(B")
+("cmhaf"	"$(Hm6(B")
+("cmig"	"$(HNf(B")
+("cmj"	"$(H9z(B")
+("cmlm"	"$(H[0(B")
+("cmmr"	"$(HU0(B")
+("cmms"	"$(H:$(B")
+("cmmv"	"$(HUD(B")
+("cmn"	"$(GX[(B")
+("cmnr"	"$(HH9(B")
+("cmp"	"$(HW.(B")
+("cmr"	"$(HHL(B")
+("cmrb"	"$(Gw[(B")
+("cmrt"	"$(HU/(B")
+("cmt"	"$(HA,(B")
+("cmtn"	"$(HN`(B")
+("cmua"	"$(Hj<(B")
+("cmvi"	"$(Hd!(B")
+("cmvm"	"$(HUE(B")
+("cmvs"	"$AYb(B")
+("cmwf"	"$(Gy=(B")
+("cmwj"	"$(Hj:(B")
+("cmym"	"$(HH8(B")
+("cmys"	"$(Gb[(B")
+("cn"	"$(H-a(B")
+("cnao"	"$(HjO(B")
+("cnau"	"$(HNi(B")
+("cnd"	"$(H:&(B")
+("cndt"	"$(Grb(B")
+("cng"	"$(GbZ(B")
+("cnhb"	"$(Hj@(B")
+("cnhd"	"$(H`0(B")
+("cnhe"	"$(HA2(B")
+("cnhs"	"$(H3F(B")
+("cnhx"	"$(H[:(B")
+("cni"	"$(H9~(B")
+("cnii"	"$(HgR(B")
+("cnin"	"$(HNj(B")
+("cnir"	"$(GkS(B")
+("cnkg"	"$(HU9(B")
+("cnkm"	"$(H[<(B")
+("cnkq"	"$(Guo(B")
+("cnl"	"$(H">A/(B")
+("cnlh"	"$A5\$(HjL(B")
+("cnlr"	"$(H[6(B")
+("cnn"	"$(H3E(B")
+("cno"	"$(G`#(B")
+("cnoe"	"$(HjH(B")
+("cnot"	"$(Hj?(B")
+("cnri"	"$(HqD(B")
+("coae"	"$(H`'(B")
+("cob"	"$(Gb\(B")
+("cod"	"$(HN~(B")
+("cog"	"$(Gri(B")
+("cogd"	"$(HjP(B")
+("cogf"	"$(HjE(B")
+("cogj"	"$(Hd5(B")
+("cogs"	"$(G{;(B")
+("cohg"	"$(HO!(B")
+("coii"	"$(GgI(B")
+("coim"	"$(HqC(B")
+("coin"	"$(Gb_(B")
+("coir"	"$(Gw]$(HUJ(B")
+("colb"	"$(HHO(B")
+("colh"	"$(Hd/(B")
+("colmi"	"$(H_;(B")
+("comb"	"$(G},$(H[O(B")
+("comg"	"$(GkV(B")
+("como"	"$(HlX(B")
+("comr"	"$(HNl(B")
+("con"	"$(H9}(B")
+("cond"	"$(Hd'(B")
+("conk"	"$(H`)(B")
+("coog"	"$(Go_(B")
+("cop"	"$(Gll(B")
+("cor"	"$A9H(B")
+("cowy"	"$(HU;(B")
+("cp"	"$(HA*(B")
+("cph"	"$(GgK(B")
+("cpi"	"$(G]l(B")
+("cpim"	"$(Gb](B")
+("cpou"	"$(H[M(B")
+("cpp"	"$(HA-(B")
+("cppa"	"$(H_~(B")
+("cpr"	"$(GgG(B")
+("cpru"	"$(GgF(B")
+("cptd"	"$(H`2(B")
+("cpu"	"$(Gb^(B")
+("cpyr"	"$(H`8(B")
+("cqd"	"$(HN|(B")
+("cqhk"	"$(Guq(B")
+("cqjm"	"$(HgN(B")
+("cqmb"	"$(H[/(B")
+("cqmv"	"$(Gr`(B")
+("cqo"	"$(Gb`(B")
+("cr"	"$(G]k(B")
+("crb"	"$(HU7(B")
+("crhaf"	"$(He%(B")
+("crhr"	"$(Go](B")
+("crhu"	"$(GI+(B")
+("crjcm"	"$(HTN(B")
+("crki"	"$(H9P(B")
+("crmjk"	"$(Hg0(B")
+("crnl"	"$(H3A(B")
+("crno"	"$AS{(B")
+("crnq"	"$(H9Q(B")
+("croir"	"$(HN8(B")
+("crp"	"$(Ha[(B")
+("crrd"	"$(HlR(B")
+("crrs"	"$(Guy(B")
+("crsl"	"$(GP3(B")
+("crsmh"	"$(HcY(B")
+("crtc"	"$(HGX(B")
+("cruc"	"$(HjI(B")
+("crvk"	"$(HU5(B")
+("crvp"	"$(HHI(B")
+("crybp"	"$(HoR(B")
+("crye"	"$(H`#(B")
+("cseg"	"$(GyA(B")
+("csh"	"$A7V(B")
+("cshc"	"$(G]N(B")
+("cshf"	"$(H'z(B")
+("cshg"	"$A[P(B")
+("cshp"	"$A7^(B")
+("cshr"	"$(HH>(B")
+("csht"	"$AEh$(H#r(B")
+("cshu"	"$A2m(B")
+("csit"	"$(G{|(B")
+("csj"	"$(HNb(B")
+("csje"	"$(H[A(B")
+("csjj"	"$(G}5(B")
+("csjr"	"$(Gra(B")
+("cslb"	"$(HHJ(B")
+("csme"	"$(HU4(B")
+("csmh"	"$(HgQ(B")
+("csmr"	"$(HHH(B")
+("csmv"	"$(H[@(B")
+("csp"	"$(HH=(B")
+("csqf"	"$(Hd"(B")
+("csrr"	"$(HgO(B")
+("css"	"$(GgL(B")
+("cssr"	"$(HU@(B")
+("csyi"	"$(Hr7(B")
+("cta"	"$(Grc(B")
+("ctak"	"$(HgT(B")
+("ctbc"	"$(H[I(B")
+("ctbk"	"$(Hj;(B")
+("ctca"	"$(Hj8(B")
+("ctco"	"$(HjC(B")
+("ctct"	"$(GwZ(B")
+("ctei"	"$(HqA(B")
+("ctgi"	"$(Hn?(B")
+("ctgk"	"$(Gum(B")
+("ctgt"	"$(Hn>(B")
+("ctgu"	"$(H[?(B")
+("ctis"	"$(Hqc(B")
+("ctm"	"$(Gg@(B")
+("ctmc"	"$(H[D(B")
+("ctmj"	"$(HjA(B")
+("ctmv"	"$(H_}(B")
+("ctoe"	"$(Hn8(B")
+("ctop"	"$(H[H(B")
+("ctor"	"$(Hd$(B")
+("ctpd"	"$(HlU(B")
+("ctqm"	"$(Hd,(B")
+("ctrg"	"$(Hqd(B")
+("ctsr"	"$(H`7(B")
+("ctt"	"$(GkY(B")
+("ctub"	"$(Hd-(B")
+("ctvi"	"$(H_y(B")
+("ctw"	"$(Gun(B")
+("ctwi"	"$(Hj9(B")
+("ctxc"	"$(Hc~(B")
+("ctyj"	"$(HoZ(B")
+("ctyv"	"$(HU6(B")
+("cu"	"$(H-b(B")
+("cuce"	"$(H`&(B")
+("cuhqu"	"$(H0"(B")
+("cumj"	"$(H[K(B")
+("cumt"	"$(Hd&(B")
+("cuob"	"$(Hqa(B")
+("cuog"	"$(HgU(B")
+("cuok"	"$(H5i(B")
+("cv"	"$(H:"(B")
+("cvfr"	"$(HjQ(B")
+("cvid"	"$(G|L(B")
+("cvii"	"$(HjF(B")
+("cvio"	"$(HHE(B")
+("cvmi"	"$(Gy?(B")
+("cvne"	"$(Grg(B")
+("cvr"	"$(HNm(B")
+("cvvv"	"$(Ho\(B")
+("cvvw"	"$(Grn(B")
+("cw"	"$(GgN(B")
+("cwa"	"$ATx(B")
+("cwd"	"$(H[7(B")
+("cwg"	"$(Gob(B")
+("cwjr"	"$(Grm(B")
+("cwk"	"$(HNg(B")
+("cwl"	"$(GgC(B")
+("cwlg"	"$(G}?(B")
+("cwli"	"$(G{:(B")
+("cwlj"	"$(G{9(B")
+("cwlv"	"$(HlO(B")
+("cwmv"	"$(H`5(B")
+("cwp"	"$(H`$(B")
+("cwtj"	"$(Hg^(B")
+("cwvf"	"$(Gy>(B")
+("cwwg"	"$(Hqb(B")
+("cwyi"	"$(HHD(B")
+("cy"	"$(GX_(B")
+("cybb"	"$(H`.lS(B")
+("cybc"	"$(H`6(B")
+("cybk"	"$(Hr0(B")
+("cybp"	"$(HpY(B")
+("cybs"	"$(GwT(B")
+("cycb"	"$(Gy6(B")
+("cyck"	"$(GkO(B")
+("cydk"	"$(Hj6(B")
+("cye"	"$(HA;(B")
+("cyg"	"$(HH5(B")
+("cygq"	"$(HlQ(B")
+("cyhm"	"$(Gy7(B")
+("cyhn"	"$(HA7(B")
+("cyhr"	"$(Gw\(B")
+("cyhs"	"$(HA)(B")
+("cyhv"	"$(HN^(B")
+("cyib"	"$(HUK(B")
+("cyiu"	"$(HH<(B")
+("cyj"	"$(HA6(B")
+("cyjj"	"$(Gy9(B")
+("cylb"	"$(HH6(B")
+("cymb"	"$(H[G(B")
+("cymh"	"$(HlV(B")
+("cymy"	"$(HHM(B")
+("cypd"	"$(HgS(B")
+("cypo"	"$(HlN(B")
+("cypp"	"$(HoX(B")
+("cyps"	"$(HlT(B")
+("cypt"	"$(G|o(B")
+("cyr"	"$(HH?(B")
+("cyrb"	"$(GwY(B")
+("cyrd"	"$(H[,(B")
+("cyrv"	"$(G}+(B")
+("cysk"	"$(Gy8(B")
+("cyso"	"$(HgM(B")
+("cytg"	"$(GzL(B")
+("cytj"	"$(GoX(B")
+("cyto"	"$(HlP(B")
+("cytp"	"$(HlM(B")
+("cytu"	"$(Gy5(B")
+("cyvi"	"$(GgJ(B")
+("cywi"	"$(Hg_(B")
+("cyx"	"$(Hn;(B")
+("d"	"$AD>(B")
+("da"	"$AhC(B")
+("dafu"	"$(HK)(B")
+("dagi"	"$(HJs(B")
+("dahu"	"$Ai9(B")
+("dail"	"$(H5z(B")
+("daiu"	"$A8E(B")
+("dam"	"$A2i$(H+>(B")
+("damh"	"$(GdN(B")
+("damj"	"$(G[2(B")
+("dang"	"$(HWf(B")
+("danr"	"$(Gx>(B")
+("danw"	"$(Gzq(B")
+("dapp"	"$A9w(B")
+("dapv"	"$(HC`(B")
+("dasm"	"$Ai=(B")
+("dau"	"$AhK(B")
+("dav"	"$A8y(B")
+("dawe"	"$(HQ!(B")
+("db"	"$(H"U(B")
+("dbac"	"$(HJf(B")
+("dbb"	"$AEo(B")
+("dbbb"	"$(HJr(B")
+("dbcd"	"$(H<p(B")
+("dbcv"	"$(Gzp(B")
+("dbd"	"$(H<`(B")
+("dbdb"	"$A<,$(G_l(B")
+("dbgr"	"$(H<w(B")
+("dbhx"	"$(HJu(B")
+("dbjj"	"$(HCR(B")
+("dbkf"	"$(HWZ(B")
+("dbln"	"$A4L(B")
+("dbm"	"$(H+*(B")
+("dbmc"	"$(H<_(B")
+("dbme"	"$(HCc(B")
+("dbmr"	"$AM)(B")
+("dbnd"	"$Ahu(B")
+("dbo"	"$(HI#(B")
+("dbou"	"$(Gi8(B")
+("dbsd"	"$(H<t(B")
+("dbse"	"$(H<u(B")
+("dbt"	"$(GQ`(B")
+("dbtu"	"$(H<^(B")
+("dbu"	"$AO`(B")
+("dbuc"	"$(H6/(B")
+("dbug"	"$(HmR(B")
+("dbv"	"$(H6!(B")
+("dbvk"	"$(HJv(B")
+("dc"	"$(H"W(B")
+("dcav"	"$(Has(B")
+("dchd"	"$(H<z(B")
+("dci"	"$AKI(B")
+("dcip"	"$(H<|(B")
+("dcms"	"$(H'>(B")
+("dcnh"	"$AL](B")
+("dcru"	"$(H6#(B")
+("dcsh"	"$(H'?(B")
+("dcwa"	"$(HWL(B")
+("dd"	"$AAV(B")
+("ddam"	"$Ai+(B")
+("ddb"	"$(H/e(B")
+("ddbuh"	"$(G}H(B")
+("ddcsh"	"$Ah{(B")
+("ddd"	"$AI-(B")
+("dddo"	"$(H]3(B")
+("ddec"	"$(Haq(B")
+("ddf"	"$A7Y(B")
+("ddg"	"$(H44(B")
+("ddh"	"$A2D(B")
+("ddhe"	"$(H+&(B")
+("ddhh"	"$A1r(B")
+("ddhni"	"$Ahs$(H]6(B")
+("ddi"	"$A4e(B")
+("ddixp"	"$AB4(B")
+("ddj"	"$(H+!(B")
+("ddk"	"$A7.(B")
+("ddkli"	"$(Hl4(B")
+("ddkmr"	"$(Gy~(B")
+("ddkq"	"$AEJ(B")
+("ddl"	"$(H6+(B")
+("ddln"	"$(HCq(B")
+("ddlo"	"$(HPv(B")
+("ddmmf"	"$A={(B")
+("ddmq"	"$(HCv(B")
+("ddnl"	"$A3;(B")
+("ddnyo"	"$A3~(B")
+("ddoin"	"$(H<j(B")
+("ddoo"	"$(H<Z(B")
+("ddp"	"$Am.(B")
+("ddv"	"$A@7(B")
+("ddw"	"$(G_n$(HE#(B")
+("ddwf"	"$Ai,(B")
+("deee"	"$(H<](B")
+("defh"	"$Ahx(B")
+("dei"	"$Ah>(B")
+("deid"	"$(GmC(B")
+("dembc"	"$(Gkj(B")
+("demj"	"$(H(7(B")
+("depru"	"$(GVs(B")
+("df"	"$A=\(B")
+("dfb"	"$AIR(B")
+("dfbd"	"$(HWd(B")
+("dfbf"	"$(Hp:(B")
+("dfbg"	"$AiL(B")
+("dfbh"	"$(HWe(B")
+("dfbw"	"$(Gsr(B")
+("dfdq"	"$(HWK(B")
+("dff"	"$(H<S(B")
+("dffn"	"$(HW`(B")
+("dffs"	"$(HW_(B")
+("dfh"	"$AhB(B")
+("dfle"	"$(Gv"(B")
+("dfmu"	"$Ahf(B")
+("dfq"	"$(H*~(B")
+("dfqu"	"$(H<R(B")
+("dg"	"$A6E(B")
+("dgb"	"$(H++(B")
+("dgce"	"$A@b(B")
+("dgg"	"$A9p(B")
+("dggi"	"$(HPu(B")
+("dggu"	"$(Gq#(B")
+("dgit"	"$(HJk(B")
+("dgni"	"$(GvT(B")
+("dgov"	"$AiP(B")
+("dgow"	"$(Gsw(B")
+("dgr"	"$A=[(B")
+("dgrg"	"$(GvU(B")
+("dgrv"	"$(HJj(B")
+("dgti"	"$(Gpy(B")
+("dgwc"	"$(Gx=(B")
+("dh"	"$A2E(B")
+("dha"	"$A0X(B")
+("dhab"	"$AC^(B")
+("dhag"	"$(HCy(B")
+("dhaj"	"$Ai@(B")
+("dhal"	"$(Gsv(B")
+("dhbul"	"$(H\C(B")
+("dhcq"	"$(Hk_(B")
+("dhdf"	"$Ai1(B")
+("dhdw"	"$(HWg(B")
+("dhe"	"$AF$0e(B")
+("dhej"	"$(H65(B")
+("dher"	"$A8q(B")
+("dhey"	"$(H+B(B")
+("dhge"	"$(H]*(B")
+("dhgr"	"$Aht(B")
+("dhhaf"	"$(Hpr(B")
+("dhhh"	"$AI<(B")
+("dhhi"	"$Ai?(B")
+("dhhj"	"$(H<d(B")
+("dhhl"	"$AAx(B")
+("dhhw"	"$AAq(B")
+("dhi"	"$A;1(B")
+("dhij"	"$(Ham(B")
+("dhio"	"$(H+A(B")
+("dhja"	"$(Hal(B")
+("dhjd"	"$AVj(B")
+("dhje"	"$Ai2(B")
+("dhjm"	"$Ai"(B")
+("dhjr"	"$Ahi(B")
+("dhju"	"$(HCi(B")
+("dhkb"	"$(Gp}(B")
+("dhlb"	"$(HCh(B")
+("dhlc"	"$(Heb(B")
+("dhml"	"$ANv(B")
+("dhmu"	"$(G[=(B")
+("dhmy"	"$AhX(B")
+("dhn"	"$A;z(B")
+("dhne"	"$(H'G(B")
+("dhni"	"$(GdR$(H$G(B")
+("dhon"	"$Ahl$(HCz(B")
+("dhoo"	"$(GmA(B")
+("dhpa"	"$(H<xWY(B")
+("dhpm"	"$Ah\(B")
+("dhqo"	"$(H+2(B")
+("dhqu"	"$(H';(B")
+("dhs"	"$AWu(B")
+("dhsb"	"$(HCj(B")
+("dhsk"	"$AO-(B")
+("dhsu"	"$(HQ7(B")
+("dhuc"	"$(Ho/(B")
+("dhus"	"$(He\(B")
+("dhuu"	"$AGA(B")
+("dhvo"	"$(H+6(B")
+("dhxo"	"$(H<b(B")
+("dhyg"	"$(HQ5(B")
+("dhyu"	"$(HJy(B")
+("di"	"$A4g(B")
+("diav"	"$(H5r(B")
+("dibi"	"$(HJl(B")
+("dice"	"$AKs(B")
+("digi"	"$(Gx<(B")
+("dihf"	"$AiJ(B")
+("dihr"	"$(HCr(B")
+("dii"	"$(G_q(B")
+("diih"	"$(HQ$(B")
+("diil"	"$A@F(B")
+("dije"	"$(G[B(B")
+("dikk"	"$(H+;(B")
+("dilb"	"$(HQ*(B")
+("dill"	"$(H/p(B")
+("diln"	"$(H!K(B")
+("dilr"	"$(HJd(B")
+("dimo"	"$(H/q(B")
+("dine"	"$(HeX(B")
+("ding"	"$(HJ}(B")
+("dip"	"$(H$@(B")
+("dipc"	"$(HWM(B")
+("dipm"	"$(H/`(B")
+("dirm"	"$(H<X(B")
+("dit"	"$AP5(B")
+("dj"	"$AD)(B")
+("djbc"	"$(HK$(B")
+("djbd"	"$(H6)(B")
+("djbj"	"$Ai*(B")
+("djbm"	"$AV2(B")
+("djc"	"$(H+9(B")
+("djcm"	"$(H<M(B")
+("djcr"	"$AiE(B")
+("djcs"	"$AU%(B")
+("dje"	"$AV&(B")
+("djhr"	"$(HCm(B")
+("djii"	"$(HQ.(B")
+("djip"	"$(HWc(B")
+("djji"	"$(HWR(B")
+("djk"	"$AUH(B")
+("djka"	"$Ahz(B")
+("djkp"	"$Aha(B")
+("djks"	"$Ah`(B")
+("djlv"	"$(G_t(B")
+("djmc"	"$(GvN(B")
+("djmf"	"$AWX(B")
+("djmm"	"$Ai8(B")
+("djmo"	"$(H<o(B")
+("djmu"	"$(G[A(B")
+("djp"	"$Ah^(B")
+("djpa"	"$(HJi(B")
+("djpn"	"$(GvR(B")
+("djr"	"$A?](B")
+("djrb"	"$(HCs(B")
+("djrj"	"$(HWQ(B")
+("djrr"	"$A9W(B")
+("djtc"	"$(HWN(B")
+("djv"	"$Ahq(B")
+("dk"	"$(H!;$A(B")
+("dkb"	"$(H/i(B")
+("dkce"	"$(HQ"(B")
+("dkcf"	"$(HWT(B")
+("dkgg"	"$(HCt(B")
+("dkhaf"	"$(Hno(B")
+("dkhf"	"$(H66(B")
+("dkkb"	"$(H64(B")
+("dkkk"	"$(HQ/(B")
+("dkld"	"$(H/g(B")
+("dkmr"	"$ARN(B")
+("dkms"	"$(H/s(B")
+("dkmym"	"$AU{(B")
+("dkn"	"$(H"Q/a(B")
+("dkok"	"$(HJe(B")
+("dkoo"	"$(H5u(B")
+("dkp"	"$(HW%(B")
+("dks"	"$(H"R(B")
+("dkso"	"$(HP{(B")
+("dksr"	"$A<O$(Hao(B")
+("dl"	"$AJx(B")
+("dlbk"	"$(H+-(B")
+("dlbu"	"$AUm(B")
+("dld"	"$(H68(B")
+("dle"	"$Ai&(B")
+("dlksf"	"$(Hk+(B")
+("dllmi"	"$(HMx(B")
+("dlln"	"$AX]$(H+)(B")
+("dlmc"	"$(HWW(B")
+("dlmo"	"$ALR(B")
+("dlmy"	"$(H<v(B")
+("dlno"	"$(H6:(B")
+("dlok"	"$Ak7(B")
+("dlp"	"$(H;l(B")
+("dlshc"	"$(GrJ(B")
+("dlw"	"$AhV(B")
+("dlwl"	"$(H+?(B")
+("dlws"	"$(H5}(B")
+("dlwv"	"$(Gm=(B")
+("dlx"	"$(HWV(B")
+("dlxl"	"$(H<y(B")
+("dm"	"$A1>8\(B")
+("dmam"	"$A;8(B")
+("dmbb"	"$(Hak(B")
+("dmbc"	"$(Gi+(B")
+("dmbe"	"$(HeY(B")
+("dmbl"	"$(H/h(B")
+("dmbm"	"$(Hr+(B")
+("dmbr"	"$(Gzr(B")
+("dmbs"	"$AiK(B")
+("dmbw"	"$Ai[(B")
+("dmcw"	"$AF\(B")
+("dmd"	"$(H$>(B")
+("dmdm"	"$(Hi#(B")
+("dmem"	"$(GdK(B")
+("dmf"	"$A1-(B")
+("dmfb"	"$(Hap(B")
+("dmfj"	"$AhR(B")
+("dmfm"	"$(H+$(B")
+("dmfn"	"$(H]2(B")
+("dmfr"	"$(H5w(B")
+("dmg"	"$AMw(B")
+("dmgr"	"$(Hi'(B")
+("dmgt"	"$(H5s(B")
+("dmhf"	"$(HK#(B")
+("dmia"	"$(HK%(B")
+("dmig"	"$Ahd(B")
+("dmj"	"$A8K(B")
+("dmjk"	"$AiO(B")
+("dmlk"	"$A9#(B")
+("dmlm"	"$(H<U(B")
+("dmmf"	"$AhM(B")
+("dmmi"	"$(H'A(B")
+("dmmp"	"$(G|;(B")
+("dmmr"	"$AN`(B")
+("dmms"	"$(H$?(B")
+("dmmu"	"$(H'5(B")
+("dmmv"	"$(H5v(B")
+("dmn"	"$(H"P(B")
+("dmnl"	"$(H/b(B")
+("dmnn"	"$(H/f(B")
+("dmnr"	"$A?B(B")
+("dmob"	"$A1z(B")
+("dmr"	"$AhO(B")
+("dmrq"	"$(GSt(B")
+("dmrt"	"$(H6*(B")
+("dmrw"	"$(HCV(B")
+("dmsmm"	"$(H8B(B")
+("dmso"	"$(H<[(B")
+("dmsu"	"$(H'C(B")
+("dmt"	"$(H'4(B")
+("dmto"	"$AiS(B")
+("dmu"	"$Ah;(B")
+("dmue"	"$(HJn(B")
+("dmvh"	"$(H'7(B")
+("dmvm"	"$(H'B6,(B")
+("dmvs"	"$AP`(B")
+("dmvvq"	"$(HFH(B")
+("dmwc"	"$(H]%(B")
+("dmwf"	"$(Gm:$(HPw(B")
+("dmwj"	"$(HWP(B")
+("dmwm"	"$(H]1(B")
+("dnao"	"$AOp(B")
+("dnbg"	"$Ahv(B")
+("dnbj"	"$AiN(B")
+("dnbq"	"$(H]((B")
+("dncr"	"$Ai\(B")
+("dnd"	"$A@n$(H$E(B")
+("dndf"	"$(HK'(B")
+("dnfd"	"$(Hi((B")
+("dng"	"$(H'9(B")
+("dnhb"	"$AiY(B")
+("dnhd"	"$(HC[C\(B")
+("dnhe"	"$A<+(B")
+("dnib"	"$AM0(B")
+("dnin"	"$AhL$(GV/(B")
+("dnkg"	"$Ahh(B")
+("dnkm"	"$(H<c(B")
+("dnkq"	"$Ai%(B")
+("dnlb"	"$(Gp{(B")
+("dnlw"	"$(HQ0(B")
+("dnmu"	"$AN&(B")
+("dno"	"$(H'=(B")
+("dnob"	"$(HC](B")
+("dnok"	"$(HCu(B")
+("dnot"	"$A3H(B")
+("dnq"	"$(HC=(B")
+("dnqd"	"$(HJw(B")
+("dnri"	"$(Hk^(B")
+("dnst"	"$Ai:(B")
+("dnwa"	"$(Gx?(B")
+("dob"	"$AhD(B")
+("dobg"	"$AH6(B")
+("dobuc"	"$(HTU(B")
+("doby"	"$(H/l(B")
+("dodi"	"$(H+5(B")
+("doe"	"$(H6'(B")
+("dog"	"$AW5(B")
+("dogf"	"$AiT(B")
+("dogj"	"$Ai>(B")
+("dogs"	"$(H])(B")
+("dohaf"	"$(HhM(B")
+("doii"	"$AhZ(B")
+("doik"	"$(H=}(B")
+("doim"	"$(Hk](B")
+("doin"	"$(H'I(B")
+("doip"	"$(H<e(B")
+("doir"	"$(Gi3$(H6&(B")
+("doj"	"$AhF(B")
+("dok"	"$AC6(B")
+("dokr"	"$(H<{(B")
+("dolb"	"$(HQ6(B")
+("doma"	"$(Gsu(B")
+("domb"	"$(H<f(B")
+("domd"	"$(H67(B")
+("domg"	"$AK((B")
+("domk"	"$(HCg(B")
+("domn"	"$AS\(B")
+("domo"	"$(Gst(B")
+("don"	"$(H$F(B")
+("donl"	"$(H9o(B")
+("doo"	"$(GKt(B")
+("doog"	"$(H69(B")
+("dop"	"$(H'H(B")
+("dopd"	"$(H+3(B")
+("dowy"	"$AC7(B")
+("doyb"	"$AiU(B")
+("dp"	"$(H"V'@(B")
+("dpa"	"$(H/n/t(B")
+("dpd"	"$(H$D(B")
+("dpfd"	"$(H<a(B")
+("dph"	"$(H*}(B")
+("dpht"	"$(HJ~(B")
+("dpi"	"$Ah<99(B")
+("dpim"	"$(H'D(B")
+("dpp"	"$AhA(B")
+("dppa"	"$A?,(B")
+("dppg"	"$(H5t(B")
+("dpr"	"$Ah[(B")
+("dpru"	"$(H+4(B")
+("dpt"	"$(H+#(B")
+("dptd"	"$(HCW(B")
+("dpu"	"$(H'8(B")
+("dq"	"$(H'E(B")
+("dqbhx"	"$(GyI(B")
+("dqbjj"	"$(HdM(B")
+("dqdj"	"$(HO1(B")
+("dqgwc"	"$(Hp`(B")
+("dqhaj"	"$(Hgq(B")
+("dqhk"	"$AP((B")
+("dqikk"	"$(HO2(B")
+("dqjl"	"$A0p(B")
+("dqjm"	"$(HPt(B")
+("dqka"	"$A4;(B")
+("dqkd"	"$Ai;(B")
+("dqkk"	"$Ai((B")
+("dqkq"	"$A0t(B")
+("dqkx"	"$(Gm8(B")
+("dqmb"	"$(H<q(B")
+("dqmc"	"$(HQ,(B")
+("dqmf"	"$(HK"(B")
+("dqnhd"	"$(HdO(B")
+("dqnl"	"$(H@y(B")
+("dqo"	"$(H'6(B")
+("dqomr"	"$(HU](B")
+("dqou"	"$(HQ+(B")
+("dqptd"	"$(HdP(B")
+("dqshi"	"$(Gby(B")
+("dqsmv"	"$(H`O(B")
+("dqtmj"	"$(Hl_(B")
+("dqttb"	"$(Hgo(B")
+("dqwli"	"$(HnA(B")
+("dqwot"	"$(Hgp(B")
+("dqyrd"	"$(H`N(B")
+("dr"	"$APS(B")
+("drb"	"$(H60(B")
+("drc"	"$AhW(B")
+("drhg"	"$(H5{(B")
+("drhr"	"$(H61(B")
+("drhs"	"$(H+@(B")
+("drhu"	"$(H+/(B")
+("drms"	"$AhU(B")
+("drrd"	"$(Gsx(B")
+("drrj"	"$(HWX(B")
+("drsh"	"$(GQe(B")
+("drsj"	"$Ai.(B")
+("drye"	"$(HC_(B")
+("dsav"	"$(HCp(B")
+("dsfb"	"$AiG(B")
+("dsit"	"$(GvQ(B")
+("dsj"	"$(H/r(B")
+("dsje"	"$(H<W(B")
+("dsjl"	"$AR,(B")
+("dsjr"	"$Ai'(B")
+("dskr"	"$(H6-(B")
+("dslc"	"$(GvP(B")
+("dsly"	"$Ai<(B")
+("dsma"	"$(HP|(B")
+("dsme"	"$(H5y(B")
+("dsmg"	"$A?r$(GvS(B")
+("dsmh"	"$(HP}(B")
+("dsmm"	"$Ahr(B")
+("dsmr"	"$(H+<(B")
+("dsmv"	"$(H<V(B")
+("dsnd"	"$(HWb(B")
+("dsno"	"$AhQ(B")
+("dsp"	"$(H+((B")
+("dsqf"	"$(HK!(B")
+("dsql"	"$(H6.(B")
+("dsrg"	"$(H]$(B")
+("dsrr"	"$(Gm9(B")
+("dss"	"$A9q(B")
+("dssr"	"$(H5x(B")
+("dstv"	"$(HK&(B")
+("dsu"	"$Ah=(B")
+("dswu"	"$(G}#(B")
+("dsyi"	"$(Hq!(B")
+("dsyq"	"$AiX(B")
+("dta"	"$(H<Y(B")
+("dtak"	"$AD#(B")
+("dtaw"	"$(Hq#(B")
+("dtbo"	"$ACJ(B")
+("dtc"	"$(H/d(B")
+("dtce"	"$(HmT(B")
+("dtco"	"$(Gpt(B")
+("dtcw"	"$(HCS(B")
+("dtei"	"$(Hk\(B")
+("dtge"	"$(Gm5(B")
+("dtgf"	"$(HJ{(B")
+("dtgi"	"$(H]#(B")
+("dtgo"	"$(H].(B")
+("dtgr"	"$(HW](B")
+("dthj"	"$(HQ2(B")
+("dtjr"	"$(GdW(B")
+("dtk"	"$(H/\(B")
+("dtkr"	"$(HC^(B")
+("dtlb"	"$(HPy(B")
+("dtlm"	"$AiH(B")
+("dtlx"	"$(Hi%(B")
+("dtm"	"$A8L(B")
+("dtmc"	"$AFe$(Gpw(B")
+("dtmj"	"$(Gpu(B")
+("dtmv"	"$Ai)(B")
+("dtoe"	"$(Har(B")
+("dtor"	"$(HJm(B")
+("dtpa"	"$(HK*(B")
+("dtqm"	"$Ai6(B")
+("dtrg"	"$(G{b(B")
+("dtsj"	"$(HK((B")
+("dtsr"	"$(He[(B")
+("dtt"	"$(H/[(B")
+("dttb"	"$(Gi,(B")
+("dttc"	"$(H<Q(B")
+("dtwa"	"$A2[(B")
+("dtwi"	"$AiW(B")
+("dtxc"	"$(HJ|(B")
+("du"	"$AT}(B")
+("duch"	"$(H63(B")
+("dulmi"	"$(H9/(B")
+("dumb"	"$(HCx(B")
+("dumt"	"$(HJt(B")
+("duob"	"$(HmS(B")
+("duon"	"$(H5|(B")
+("dup"	"$AOk(B")
+("duu"	"$(H+1(B")
+("duvif"	"$(G\T(B")
+("dvfo"	"$(Hec(B")
+("dvid"	"$(He](B")
+("dvii"	"$(Gq"(B")
+("dvis"	"$(H+D(B")
+("dvl"	"$(H"S(B")
+("dvmg"	"$(H62(B")
+("dvno"	"$A4*(B")
+("dvoi"	"$(Hq$(B")
+("dvvd"	"$(HQ%(B")
+("dvvw"	"$(H<g(B")
+("dw"	"$(GN)(B")
+("dwc"	"$(H+0(B")
+("dwd"	"$(G[4$A?C(B")
+("dwf"	"$A<m(B")
+("dwg"	"$(H5~(B")
+("dwhaf"	"$(Hh](B")
+("dwhd"	"$(H<s(B")
+("dwim"	"$(HQ4(B")
+("dwjr"	"$(H<r(B")
+("dwl"	"$AhT(B")
+("dwlg"	"$(Ho1(B")
+("dwlj"	"$(H]'(B")
+("dwls"	"$A@c(B")
+("dwly"	"$(H]5(B")
+("dwmv"	"$(HCa(B")
+("dwp"	"$(HCw(B")
+("dwvf"	"$(HQ3(B")
+("dww"	"$(HE,(B")
+("dwwf"	"$(Hq"(B")
+("dwww"	"$(HeZ(B")
+("dy"	"$AFS(B")
+("dyaj"	"$Ah~(B")
+("dybb"	"$(HCn]&(B")
+("dybc"	"$(GdO(B")
+("dybp"	"$(Hi!(B")
+("dybs"	"$A0q(B")
+("dycb"	"$(HPq(B")
+("dyck"	"$AP#(B")
+("dydk"	"$(HW^(B")
+("dydl"	"$(Gm7(B")
+("dydu"	"$(Gys(B")
+("dyfe"	"$A=7(B")
+("dyg"	"$AVy(B")
+("dyhh"	"$(HCo(B")
+("dyhn"	"$A:<(B")
+("dyhr"	"$Ai3(B")
+("dyhs"	"$AhJ(B")
+("dyia"	"$(HWI(B")
+("dyiu"	"$AJa(B")
+("dyj"	"$(GN8(B")
+("dyjj"	"$(HPx(B")
+("dylb"	"$AJA(B")
+("dymh"	"$(H]4(B")
+("dymu"	"$(Hea(B")
+("dynv"	"$(HWa(B")
+("dyoj"	"$(H<n(B")
+("dypk"	"$(HJq(B")
+("dypm"	"$(HP~(B")
+("dypt"	"$(Hi$(B")
+("dyr"	"$(H+=(B")
+("dyra"	"$(HeW(B")
+("dyrb"	"$AiB(B")
+("dyrf"	"$Ai#(B")
+("dyrn"	"$(HCP(B")
+("dyro"	"$(Han(B")
+("dyrv"	"$(Hk`(B")
+("dysd"	"$(HCQ(B")
+("dysr"	"$(Haj(B")
+("dysy"	"$(H<P(B")
+("dyt"	"$(H+:(B")
+("dytg"	"$(HWJ(B")
+("dytj"	"$AhwUA(B")
+("dyto"	"$(H]!(B")
+("dytp"	"$(H\~(B")
+("dytr"	"$(H<N(B")
+("dytu"	"$(HQ)]/(B")
+("dytv"	"$(H<O(B")
+("dyub"	"$(HPr(B")
+("dyut"	"$(HQ((B")
+("dyvo"	"$A:K(B")
+("dywd"	"$(H]"(B")
+("dywm"	"$AL4(B")
+("dywv"	"$AiA$(Hi"(B")
+("dyx"	"$(Hai(B")
+("e"	"$AK.(B")
+("ea"	"$Achcim3(B")
+("eaa"	"$(H6c(B")
+("eafc"	"$(Hp=q[(B")
+("eafu"	"$(HD9(B")
+("eag"	"$ADy(B")
+("eagi"	"$(HD@(B")
+("eahm"	"$(H=X(B")
+("eahu"	"$AdX(B")
+("eaiu"	"$A8H(B")
+("eam"	"$(H'l(B")
+("eamh"	"$(G`=(B")
+("eami"	"$(H6`(B")
+("eamj"	"$(H07(B")
+("eamk"	"$(H6a(B")
+("eamo"	"$(H=E(B")
+("eana"	"$(GmX(B")
+("eand"	"$(HQO(B")
+("eane"	"$(Hi8(B")
+("eang"	"$(GmW(B")
+("eanj"	"$(Ho3(B")
+("eank"	"$(HQf(B")
+("eanw"	"$(Gyt(B")
+("eapp"	"$A;l(B")
+("eapv"	"$A?J(B")
+("eate"	"$AFY(B")
+("eavf"	"$(Gt.(B")
+("eawe"	"$AB~(B")
+("eayf"	"$(HQb(B")
+("ebac"	"$Adi(B")
+("ebau"	"$AdG(B")
+("ebb"	"$(H6V(B")
+("ebbb"	"$A;,(B")
+("ebbr"	"$(G`<(B")
+("ebbu"	"$(HK](B")
+("ebcd"	"$AIn(B")
+("ebci"	"$(Gv](B")
+("ebcn"	"$(G`A(B")
+("ebcr"	"$(H0I(B")
+("ebcv"	"$(Hi-(B")
+("ebgr"	"$(H6h(B")
+("ebhg"	"$ARy(B")
+("ebhu"	"$A3A(B")
+("ebhx"	"$ALO(B")
+("ebjj"	"$(G`D(B")
+("ebkf"	"$(Hpj(B")
+("ebm"	"$A>Z(B")
+("ebme"	"$(G`K(B")
+("ebmp"	"$(H]B(B")
+("ebmr"	"$A64(B")
+("ebnd"	"$A8!(B")
+("ebof"	"$(HK^(B")
+("ebp"	"$(GvB$(HaS(B")
+("ebr"	"$(H'Z(B")
+("ebsd"	"$(G[g(B")
+("ebuc"	"$(H06(B")
+("ebug"	"$Ae!$(Hkd(B")
+("ebuh"	"$ACl(B")
+("ebuk"	"$(H=D(B")
+("ebul"	"$(HWy(B")
+("ebuu"	"$(H0E(B")
+("ebv"	"$(H0J(B")
+("ebvk"	"$AO*(B")
+("ebwi"	"$(Hi/(B")
+("ebyh"	"$(H0K(B")
+("ec"	"$AdF$(H!a(B")
+("ecc"	"$(H`:(B")
+("ecnh"	"$ALi(B")
+("ecor"	"$AT!(B")
+("ecr"	"$AQX(B")
+("ecru"	"$(H0;(B")
+("ecsh"	"$A7Z(B")
+("ecst"	"$AdT(B")
+("ecwa"	"$(HQ_(B")
+("ed"	"$Ace(B")
+("edam"	"$AT|(B")
+("edbt"	"$(H7J(B")
+("edbu"	"$AOf(B")
+("edci"	"$AdA(B")
+("edd"	"$AA\(B")
+("eddf"	"$(HX*(B")
+("eddg"	"$(HKX(B")
+("eddh"	"$(Hr?(B")
+("eddn"	"$(HKY(B")
+("eddo"	"$(HWu(B")
+("edg"	"$(GcU(B")
+("edgg"	"$(HD=(B")
+("edhe"	"$A2((B")
+("edhl"	"$Ad@(B")
+("edj"	"$AD-(B")
+("edk"	"$(GJn(B")
+("edl"	"$Ad3(B")
+("edlc"	"$(GxB(B")
+("edlo"	"$AJ~(B")
+("edm"	"$(H'i(B")
+("edmbc"	"$(Hgs(B")
+("edmf"	"$(H=7(B")
+("edmq"	"$(H==(B")
+("edoe"	"$AFa(B")
+("edoo"	"$(H6M(B")
+("edw"	"$(H6L(B")
+("edwf"	"$(H=4(B")
+("ee"	"$(H'd(B")
+("eea"	"$(H6T(B")
+("eee"	"$Am5(B")
+("eeed"	"$AI#(B")
+("eeeee"	"$(H<9(B")
+("eeeef"	"$(HhP(B")
+("eeeen"	"$(H.-(B")
+("eeeeo"	"$(H="(B")
+("eeeeu"	"$(H=)(B")
+("eei"	"$Acb(B")
+("eeii"	"$(HD8(B")
+("eemr"	"$(HEQ(B")
+("eetb"	"$(Hb%(B")
+("eev"	"$AFE(B")
+("efb"	"$AO{(B")
+("efbg"	"$(HK[(B")
+("efbk"	"$(HK>(B")
+("efbr"	"$ALJ(B")
+("efbw"	"$(HX,(B")
+("efdc"	"$Ae/(B")
+("efdq"	"$(HQD(B")
+("eff"	"$A5-(B")
+("effe"	"$(H]<(B")
+("efff"	"$(Hei(B")
+("effg"	"$(Ha{(B")
+("effr"	"$(Hi+(B")
+("effs"	"$(HQE(B")
+("efh"	"$AI3(B")
+("efhu"	"$(H=@(B")
+("efmu"	"$(GR,(B")
+("efq"	"$Acz(B")
+("efqf"	"$(HQ](B")
+("eg"	"$AJ%(B")
+("egce"	"$(H6J(B")
+("egcg"	"$(H6_(B")
+("egde"	"$(H]Da|(B")
+("egfe"	"$(Hek(B")
+("egg"	"$AM]$(HB7(B")
+("eggu"	"$(GmO(B")
+("egi"	"$A7((B")
+("egit"	"$Ad[(B")
+("egj"	"$(Gdm(B")
+("eglc"	"$(H0D(B")
+("egni"	"$(Gt'(B")
+("egow"	"$(HWw(B")
+("egr"	"$A=`(B")
+("egrv"	"$(HD<(B")
+("egsk"	"$(HKV(B")
+("egth"	"$AEl(B")
+("egti"	"$Adx(B")
+("egtj"	"$(H6I(B")
+("egwc"	"$(Gv\(B")
+("eha"	"$A24(B")
+("ehag"	"$AdR(B")
+("ehal"	"$(HX#(B")
+("ehar"	"$(HQX(B")
+("ehbk"	"$A0D(B")
+("ehbn"	"$(H6X(B")
+("ehbt"	"$Ad*$(GtE(B")
+("ehbu"	"$Ad)$(Ho4(B")
+("ehby"	"$(H+^(B")
+("ehcn"	"$(Gv_(B")
+("ehdb"	"$Ad{(B")
+("ehde"	"$(HQi(B")
+("ehdf"	"$AdP(B")
+("ehdn"	"$(H0<(B")
+("ehdp"	"$(HDE(B")
+("ehdw"	"$AEK(B")
+("ehe"	"$(H$Z(B")
+("eheq"	"$Ad.(B")
+("eher"	"$ABe(B")
+("ehet"	"$(Hb&(B")
+("ehf"	"$(Gq=(B")
+("ehgr"	"$A:F(B")
+("ehgu"	"$AO4(B")
+("ehhl"	"$Acw(B")
+("ehhv"	"$AEI(B")
+("ehhw"	"$AAo(B")
+("ehio"	"$A7:(B")
+("ehjd"	"$Ad((B")
+("ehjg"	"$(G`L(B")
+("ehjr"	"$A;n(B")
+("ehk"	"$ANV(B")
+("ehkp"	"$ALm(B")
+("ehlq"	"$(HQg(B")
+("ehmgi"	"$(H]R(B")
+("ehml"	"$ARJ(B")
+("ehmo"	"$(HX"(B")
+("ehmr"	"$(H+l>Q(B")
+("ehmy"	"$(H'a(B")
+("ehni"	"$(GHG$(H=M(B")
+("ehnn"	"$(H+i(B")
+("ehnwf"	"$(Gw~(B")
+("ehoe"	"$(HQY(B")
+("ehon"	"$(H+m(B")
+("ehoo"	"$(HKQKR(B")
+("ehpa"	"$(H6[(B")
+("ehpm"	"$(GN_(B")
+("ehq"	"$Aj}(B")
+("ehqi"	"$(H0L(B")
+("ehqj"	"$AEH(B")
+("ehqm"	"$(H'n(B")
+("ehqo"	"$(H'](B")
+("ehrb"	"$(HDF(B")
+("ehsd"	"$(H6\(B")
+("ehsk"	"$(G[a$A<$(B")
+("ehsu"	"$(GiT(B")
+("ehuc"	"$(HeomY(B")
+("ehuk"	"$Ade(B")
+("ehul"	"$Ae((B")
+("ehv"	"$Af6(B")
+("ehvo"	"$(H'`(B")
+("ehvp"	"$(H$Y(B")
+("ehxf"	"$(Gm](B")
+("ehxu"	"$(H6i(B")
+("ehyhv"	"$AtD(B")
+("ei"	"$A2f(B")
+("eiav"	"$A@K(B")
+("eibi"	"$Ad_(B")
+("eice"	"$A?#(B")
+("eid"	"$AA:(B")
+("eidy"	"$(HmW(B")
+("eifd"	"$AA;(B")
+("eihf"	"$(Gdf(B")
+("eihq"	"$(H+h(B")
+("eihr"	"$(G`5(B")
+("eihu"	"$(H$V(B")
+("eii"	"$(G[Q(B")
+("eiih"	"$(GiV(B")
+("eijb"	"$AFV(B")
+("eijc"	"$Acp(B")
+("eik"	"$(H$Q(B")
+("eikf"	"$(H=1(B")
+("eikk"	"$(H'X(B")
+("eiku"	"$(H$O(B")
+("eilb"	"$(HKU(B")
+("eile"	"$(HK<(B")
+("eill"	"$AV^(B")
+("eilmi"	"$ATi(B")
+("eilr"	"$Adg(B")
+("eine"	"$AS>(B")
+("eioc"	"$(HX'(B")
+("eiok"	"$(H0@(B")
+("eipf"	"$(Hax(B")
+("eir"	"$AVN(B")
+("eirm"	"$(H6K(B")
+("eirp"	"$(HX+(B")
+("eitc"	"$Ae%$(Haw(B")
+("eite"	"$A6I(B")
+("eiv"	"$(H'W(B")
+("eiwg"	"$(Hay(B")
+("eixp"	"$Adu(B")
+("ej"	"$AV-(B")
+("ejb"	"$AEf(B")
+("ejbc"	"$A5a(B")
+("ejbd"	"$(H0-(B")
+("ejbj"	"$(H=:(B")
+("ejbm"	"$(H6N(B")
+("ejbv"	"$(Hq%(B")
+("ejc"	"$(H'P(B")
+("ejcb"	"$Adz(B")
+("ejck"	"$(H=P(B")
+("ejcm"	"$(H6G(B")
+("ejco"	"$(HD)(B")
+("ejcr"	"$AH\(B")
+("ejd"	"$(GN]$(H0B(B")
+("ejds"	"$A23(B")
+("eje"	"$(H$[(B")
+("ejhf"	"$(GvY(B")
+("ejhq"	"$(H0+(B")
+("ejhw"	"$(GvZ(B")
+("ejic"	"$(Hi6(B")
+("ejii"	"$(HK?(B")
+("ejik"	"$(H0C(B")
+("ejip"	"$(HQa(B")
+("ejir"	"$(H=3(B")
+("ejjb"	"$A31(B")
+("ejjj"	"$(HWv]>(B")
+("ejjl"	"$(GiL(B")
+("ejjm"	"$Ae+(B")
+("ejjn"	"$(HKA(B")
+("ejka"	"$Ad>(B")
+("ejkd"	"$(H04(B")
+("ejki"	"$(H0*(B")
+("ejks"	"$(H+b(B")
+("ejlv"	"$(G[^(B")
+("ejmc"	"$AQ]$(Gt#(B")
+("ejme"	"$(HK6(B")
+("ejmf"	"$AdH(B")
+("ejmm"	"$AdV(B")
+("ejmn"	"$AE"(B")
+("ejmo"	"$A5m(B")
+("ejmu"	"$Ad=(B")
+("ejnu"	"$(H6F(B")
+("ejp"	"$Ac{(B")
+("ejpn"	"$(Gt"(B")
+("ejpu"	"$(HK5(B")
+("ejqp"	"$(Hep(B")
+("ejr"	"$A9A(B")
+("ejrb"	"$A:~(B")
+("ejrr"	"$AdJ(B")
+("ejtc"	"$(HQF(B")
+("ejv"	"$(H+_(B")
+("ejye"	"$(HK7(B")
+("ejyj"	"$AWR(B")
+("ek"	"$(H"\(B")
+("ekb"	"$Ad"(B")
+("ekc"	"$AvH(B")
+("ekcf"	"$AAJ(B")
+("ekf"	"$(H+d(B")
+("ekhr"	"$Adt(B")
+("eki"	"$AL-$(H$R(B")
+("ekjt"	"$(H6O(B")
+("ekkb"	"$AO}d;(B")
+("ekkk"	"$(HKZ(B")
+("ekld"	"$(H+V(B")
+("eklu"	"$AQM(B")
+("ekms"	"$(H+T(B")
+("ekn"	"$(H!b+R(B")
+("ekni"	"$(GHF(B")
+("ekoo"	"$(GVK(B")
+("ekpb"	"$(GiI(B")
+("eks"	"$(H!c(B")
+("eksr"	"$(H'j(B")
+("el"	"$(GJs(B")
+("elbk"	"$Acs(B")
+("elbu"	"$AIr(B")
+("elg"	"$(H.R(B")
+("elgm"	"$(HQM(B")
+("elhi"	"$(Hpc(B")
+("elim"	"$(H=GmX(B")
+("elll"	"$(H"`$X(B")
+("elln"	"$A7P(B")
+("ellp"	"$Adq(B")
+("elmc"	"$(GmV(B")
+("elmo"	"$Ad,(B")
+("elmt"	"$(H]?(B")
+("elq"	"$A=r(B")
+("elvu"	"$(H=[(B")
+("elw"	"$ASM(B")
+("elwp"	"$(GR-(B")
+("elws"	"$(H0F(B")
+("elwv"	"$(HKF(B")
+("elx"	"$(HQN(B")
+("elxh"	"$(H'_(B")
+("elxl"	"$(G[\(B")
+("em"	"$A=-(B")
+("emam"	"$Ad!(B")
+("embb"	"$Ae&e1(B")
+("embe"	"$(Hb!(B")
+("embg"	"$(Hej(B")
+("embi"	"$(HQ`X(er(B")
+("embk"	"$(H=;(B")
+("embl"	"$(H+e(B")
+("embu"	"$(Hi5(B")
+("emcw"	"$A>FHw(B")
+("emd"	"$(GH?(B")
+("emdm"	"$(GxD(B")
+("emfb"	"$(H]=(B")
+("emfj"	"$(H'S(B")
+("emg"	"$AMt(B")
+("emgg"	"$AQD(B")
+("emgh"	"$(HX)(B")
+("emhf"	"$AT4$(Gv1(B")
+("emia"	"$Adf(B")
+("emig"	"$(H+c(B")
+("emj"	"$A:9(B")
+("emjk"	"$Adw(B")
+("emlk"	"$(H01(B")
+("emls"	"$Acf(B")
+("emmc"	"$(HQG(B")
+("emmf"	"$(H'T(B")
+("emmi"	"$(H$N(B")
+("emmp"	"$(G{d(B")
+("emmr"	"$Ad4(B")
+("emms"	"$AN[(B")
+("emmu"	"$Acd(B")
+("emn"	"$AM!(B")
+("emnn"	"$Ad#(B")
+("emnr"	"$A:S(B")
+("emoa"	"$(Hb#(B")
+("emr"	"$(H'k(B")
+("emrb"	"$(HD4(B")
+("emrr"	"$(HD5(B")
+("emrt"	"$(H00(B")
+("emrw"	"$(H=5(B")
+("emso"	"$AdC(B")
+("emt"	"$(H$L(B")
+("emtb"	"$(Ha~(B")
+("emua"	"$(GmQ(B")
+("emub"	"$(Hkc(B")
+("emvb"	"$(HKB(B")
+("emvg"	"$(Gdi(B")
+("emvi"	"$Ada(B")
+("emvm"	"$(GJ|V=(B")
+("emwd"	"$Ad`(B")
+("emwf"	"$AF/(B")
+("emwg"	"$AdN$(H=V(B")
+("emwj"	"$AL6(B")
+("emwl"	"$AdO(B")
+("emyf"	"$(HKW(B")
+("enao"	"$(HQU(B")
+("enau"	"$Ad<(B")
+("enbk"	"$(G`G(B")
+("enbq"	"$(HX$(B")
+("enbs"	"$(G`0(B")
+("encr"	"$Ae#(B")
+("end"	"$AH>(B")
+("ene"	"$(GJt(B")
+("enhb"	"$(HQL(B")
+("enhe"	"$A<3(B")
+("enhx"	"$(H6Z(B")
+("eni"	"$AO+c|(B")
+("enib"	"$AS?(B")
+("enii"	"$(HKD(B")
+("enin"	"$(H'e(B")
+("enir"	"$(H+[(B")
+("enj"	"$AQ4(B")
+("enkm"	"$AOQ(B")
+("enkq"	"$(H=U(B")
+("enlb"	"$(Hel(B")
+("enlc"	"$(Hb"(B")
+("enld"	"$A3|(B")
+("enls"	"$Acn(B")
+("enmb"	"$(Gyu(B")
+("enmm"	"$ADg(B")
+("enmu"	"$(H+j(B")
+("ennc"	"$(Gq2(B")
+("enob"	"$(H=?(B")
+("enoe"	"$(GmL(B")
+("enok"	"$(H=>(B")
+("enot"	"$A3N(B")
+("enqd"	"$(HDC(B")
+("enri"	"$(Hi2(B")
+("ensj"	"$(H=<(B")
+("ensv"	"$(GiM(B")
+("enue"	"$A:-(B")
+("enwf"	"$(GiU(B")
+("eoah"	"$(HK_(B")
+("eob"	"$(H$U(B")
+("eobt"	"$(G`y(B")
+("eodi"	"$(H'^(B")
+("eodk"	"$(HKO(B")
+("eog"	"$A;4(B")
+("eogd"	"$(HQW(B")
+("eogf"	"$(HQV(B")
+("eohh"	"$(H'b(B")
+("eoii"	"$Acv(B")
+("eoik"	"$(H+](B")
+("eoim"	"$(Hi0(B")
+("eoip"	"$(H6](B")
+("eoir"	"$(Gdo(B")
+("eoj"	"$(H$\(B")
+("eokf"	"$(Hi1(B")
+("eolb"	"$(HKPKS(B")
+("eold"	"$(GiW(B")
+("eolk"	"$(H0>(B")
+("eoma"	"$(HX%(B")
+("eomb"	"$(G[d$Ae.(B")
+("eomd"	"$AM?(B")
+("eomm"	"$(HQZ(B")
+("eomn"	"$AF{Se(B")
+("eomo"	"$(HX2(B")
+("eomr"	"$AG"$(H6j(B")
+("eomt"	"$(H=N(B")
+("eon"	"$Ac`(B")
+("eond"	"$(HDD(B")
+("eoob"	"$(HDG(B")
+("eook"	"$(Gyv(B")
+("eop"	"$(H$](B")
+("eora"	"$(HQh(B")
+("eosk"	"$(H+k(B")
+("eotf"	"$(HQS(B")
+("eoto"	"$Ae'(B")
+("eowy"	"$A:#(B")
+("ep"	"$AG_(B")
+("epa"	"$Ad-(B")
+("epd"	"$A3XFb(B")
+("epfd"	"$(H6g(B")
+("eph"	"$ACZ(B")
+("ephh"	"$(H$W(B")
+("ephp"	"$(H6Y(B")
+("ephr"	"$(H=0(B")
+("epi"	"$(H"_(B")
+("epl"	"$(H0((B")
+("epou"	"$ALT(B")
+("epp"	"$(GJ~(B")
+("eppa"	"$(H=9(B")
+("epr"	"$(H'\(B")
+("epru"	"$AE](B")
+("epsh"	"$AFc(B")
+("ept"	"$AP9(B")
+("eptd"	"$AdM(B")
+("epu"	"$Acg(B")
+("epuk"	"$(GR'(B")
+("epyr"	"$(H=L(B")
+("eqg"	"$(H:u(B")
+("eqhf"	"$(GmN(B")
+("eqhl"	"$AUc(B")
+("eqjr"	"$(H=J(B")
+("eqka"	"$(H=T(B")
+("eqkd"	"$AdZ(B")
+("eqke"	"$(HD;(B")
+("eqkk"	"$(G`1(B")
+("eqmb"	"$AGe(B")
+("eqmc"	"$(GiD(B")
+("eqmf"	"$(HD3(B")
+("eqor"	"$(H=8(B")
+("er"	"$(H#F(B")
+("erau"	"$(GVM(B")
+("erb"	"$Ad8(B")
+("erbc"	"$(HDB(B")
+("erhg"	"$(H09(B")
+("erhu"	"$(GNS(B")
+("erji"	"$(HWz(B")
+("ermr"	"$AB:(B")
+("erp"	"$(H;\(B")
+("erpa"	"$(G`I(B")
+("errd"	"$ATh(B")
+("errj"	"$(HQQ(B")
+("ersj"	"$(H=W(B")
+("eru"	"$Aca(B")
+("eruc"	"$(Gm\(B")
+("ervk"	"$(H0G(B")
+("ervp"	"$Ac}(B")
+("erxu"	"$(Gq3(B")
+("eryo"	"$Ad7(B")
+("esbn"	"$AdL(B")
+("esce"	"$(Gq((B")
+("esd"	"$AG~(B")
+("eshr"	"$AUS(B")
+("eshu"	"$(H0/(B")
+("esim"	"$(Gt*(B")
+("esip"	"$(GVJ(B")
+("esit"	"$(Gt((B")
+("esj"	"$A6}(B")
+("esja"	"$(HKH(B")
+("esjj"	"$(Hkb(B")
+("esjr"	"$(H6^(B")
+("eskr"	"$(H0.(B")
+("esll"	"$(H0,(B")
+("esmb"	"$AB)(B")
+("esmc"	"$(Hi,(B")
+("esme"	"$A=~(B")
+("esmg"	"$AdWe*$(H+Q(B")
+("esmh"	"$(HKC(B")
+("esmi"	"$(Gm[(B")
+("esmj"	"$(H]F(B")
+("esmr"	"$(H'g(B")
+("esnd"	"$Ad}(B")
+("esp"	"$AD`(B")
+("esqf"	"$AdQ(B")
+("esrj"	"$(HWx(B")
+("esrr"	"$(HK@(B")
+("ess"	"$(H'h(B")
+("esu"	"$(GFf(B")
+("esuu"	"$(H6P(B")
+("eswu"	"$(Hp>(B")
+("esyi"	"$(Hp;(B")
+("etak"	"$AD.(B")
+("etaw"	"$(Hp<(B")
+("etbc"	"$(H6R(B")
+("etbn"	"$AdU(B")
+("etbo"	"$(Gt&(B")
+("etc"	"$A:i(B")
+("etca"	"$(HQ^(B")
+("etcd"	"$(HX1(B")
+("etcf"	"$(H]E(B")
+("etcl"	"$Ady(B")
+("etct"	"$ARg(B")
+("etcu"	"$A8[(B")
+("etge"	"$AQz(B")
+("etgf"	"$(HD0(B")
+("etgi"	"$(H]A(B")
+("etgk"	"$(H=2(B")
+("etgt"	"$(H]@(B")
+("etif"	"$(Hi7(B")
+("etit"	"$Ad](B")
+("etk"	"$(H+`(B")
+("etkr"	"$(H=A(B")
+("etlb"	"$(GiH(B")
+("etlk"	"$(H=Z(B")
+("etlo"	"$(GiG(B")
+("etlx"	"$(GxA(B")
+("etm"	"$Aco(B")
+("etmc"	"$Ad?dj(B")
+("etmj"	"$(HQe(B")
+("etmr"	"$(H=B(B")
+("etmv"	"$AU?(B")
+("etoe"	"$(Gt-(B")
+("etog"	"$(G{e(B")
+("etov"	"$(Haz(B")
+("etpp"	"$(HX/(B")
+("etq"	"$AQs(B")
+("etqm"	"$(HD1(B")
+("etrg"	"$A9`(B")
+("etst"	"$(Hkg(B")
+("ett"	"$(H$M+P(B")
+("ettb"	"$(Gdd(B")
+("ettc"	"$(H6H(B")
+("etub"	"$AK](B")
+("etvi"	"$AWL(B")
+("etvp"	"$(H]G(B")
+("etw"	"$(H+f=Y(B")
+("etwa"	"$Adn(B")
+("etwb"	"$(HX.(B")
+("etwi"	"$(Ha}(B")
+("etwt"	"$Ae"(B")
+("etwv"	"$(Gq*(B")
+("etxc"	"$(HD/(B")
+("etym"	"$(H6f(B")
+("etys"	"$(H6e(B")
+("eu"	"$AIG(B")
+("eubb"	"$(HKM(B")
+("euc"	"$AvL$(H`+(B")
+("eugk"	"$(HQR(B")
+("eujt"	"$(Hka(B")
+("eumb"	"$AMD(B")
+("eumf"	"$(H=I(B")
+("euog"	"$(HKN(B")
+("euon"	"$Ad9(B")
+("eutt"	"$(Hr>(B")
+("euu"	"$(H'm(B")
+("ev"	"$AHj(B")
+("evfd"	"$(G}2(B")
+("evfg"	"$(Gt0(B")
+("evfn"	"$(G}$(B")
+("evid"	"$(Hb$(B")
+("evis"	"$(H'o(B")
+("evne"	"$(H6U(B")
+("evr"	"$Ad2(B")
+("evug"	"$(Hke(B")
+("evvd"	"$(HKT(B")
+("evvw"	"$AWM(B")
+("ew"	"$(H'[(B")
+("ewb"	"$AN<(B")
+("ewc"	"$Act(B")
+("ewd"	"$(H0H6b(B")
+("ewdq"	"$(HQd(B")
+("ewfq"	"$(HDA(B")
+("ewg"	"$(GVC(B")
+("ewgf"	"$(HQP(B")
+("ewim"	"$(HK\(B")
+("ewjr"	"$A:T(B")
+("ewk"	"$Ad&(B")
+("ewlb"	"$(H=F(B")
+("ewli"	"$(Gq,(B")
+("ewlj"	"$(Gq+(B")
+("ewln"	"$(Hi.(B")
+("ewlo"	"$(HKL(B")
+("ewlv"	"$(Gq4(B")
+("ewml"	"$AdD(B")
+("ewmo"	"$Adc(B")
+("ewmv"	"$(H=H(B")
+("ewno"	"$(Hed(B")
+("ewo"	"$AGv(B")
+("ewot"	"$(Gdk(B")
+("ewr"	"$Ad'(B")
+("ewtc"	"$(HQc(B")
+("ewtj"	"$(HKE(B")
+("ewvf"	"$Adp(B")
+("ewwg"	"$(Hkf(B")
+("eyaj"	"$ADW(B")
+("eybb"	"$(H=QW|(B")
+("eybc"	"$(H=C(B")
+("eybg"	"$(HmV(B")
+("eybk"	"$A3:(B")
+("eybp"	"$(Heh(B")
+("eybs"	"$Adh(B")
+("eybu"	"$(Gt+(B")
+("eycb"	"$A5N(B")
+("eyck"	"$(H+O(B")
+("eycv"	"$(Gi>(B")
+("eydk"	"$(HQ\(B")
+("eydl"	"$(HK:(B")
+("eydu"	"$(Heg(B")
+("eyed"	"$(HX0(B")
+("eyem"	"$Ae,(B")
+("eyfe"	"$AJg(B")
+("eyg"	"$AW"(B")
+("eyhc"	"$(GxE(B")
+("eyhm"	"$(HK;(B")
+("eyhn"	"$Acl(B")
+("eyhs"	"$(H$K(B")
+("eyib"	"$(H05(B")
+("eyiu"	"$AAw(B")
+("eyjc"	"$(Hqp(B")
+("eyjj"	"$(GiN(B")
+("eyk"	"$Ack(B")
+("eylc"	"$(Hem(B")
+("eylh"	"$AIf(B")
+("eylm"	"$(H$T(B")
+("eymh"	"$(HX!(B")
+("eymp"	"$(H+W(B")
+("eyoj"	"$A4c(B")
+("eyok"	"$AR:(B")
+("eypd"	"$Ado(B")
+("eypk"	"$(HW~(B")
+("eypo"	"$(HW}(B")
+("eypp"	"$(Gv[(B")
+("eypt"	"$(GxF(B")
+("eypu"	"$(H6d(B")
+("eyr"	"$AU4(B")
+("eyrb"	"$(HD+(B")
+("eyrd"	"$A4>(B")
+("eyrf"	"$(G[I(B")
+("eyrj"	"$(HK9(B")
+("eyrn"	"$Ae-$(H=/(B")
+("eyro"	"$Ae)(B")
+("eyru"	"$(H=R(B")
+("eyrv"	"$(Hi)(B")
+("eysd"	"$ASN$(H=S(B")
+("eyso"	"$Adv(B")
+("eysy"	"$ASY(B")
+("eyt"	"$AF|(B")
+("eyta"	"$(H=-(B")
+("eytb"	"$(H=.(B")
+("eytg"	"$Ad|(B")
+("eytj"	"$AUD(B")
+("eytp"	"$(HX&(B")
+("eytr"	"$A8"(B")
+("eyub"	"$A@l(B")
+("eyuh"	"$(HKJ(B")
+("eyv"	"$(H"Z(B")
+("eyvg"	"$(HWt(B")
+("eyvi"	"$Acy(B")
+("eyvw"	"$(HD-(B")
+("eywi"	"$(GiX(B")
+("eywm"	"$Ae$(B")
+("eywv"	"$(HD*eq(B")
+("eyx"	"$(Gt$(B")
+("eyy"	"$Acj(B")
+("f"	"$A;p(B")
+("fab"	"$(H=g(B")
+("fafu"	"$(HKc(B")
+("faht"	"$(H=h(B")
+("fahu"	"$(HDN(B")
+("fam"	"$(H+o(B")
+("famh"	"$(Gd{(B")
+("famj"	"$A:8(B")
+("fank"	"$(HX@(B")
+("fanp"	"$(Gq>(B")
+("fanw"	"$(Gzu(B")
+("fanx"	"$(Hi9(B")
+("fapp"	"$(G`U(B")
+("fate"	"$A1,(B")
+("fawe"	"$AlW(B")
+("fayt"	"$AlO(B")
+("fb"	"$AP$(B")
+("fbac"	"$(HKa(B")
+("fbbe"	"$(H]M(B")
+("fbhaf"	"$(Hm.(B")
+("fbjj"	"$(HDH(B")
+("fbkf"	"$AH<(B")
+("fbln"	"$AOw(B")
+("fbme"	"$(Ge$(B")
+("fbmr"	"$(H0X(B")
+("fbnd"	"$(H6q(B")
+("fbok"	"$A1V3((B")
+("fbr"	"$AIP><(B")
+("fbrbc"	"$(Go+(B")
+("fbrd"	"$ALD(B")
+("fbrg"	"$ALC(B")
+("fbrhu"	"$A53(B")
+("fbrlb"	"$A3#(B")
+("fbrmh"	"$(H=k(B")
+("fbrmn"	"$(HD}E((B")
+("fbrpa"	"$(Gh)(B")
+("fbrq"	"$AUF(B")
+("fbrw"	"$(Ge5(B")
+("fbrwf"	"$(Gz](B")
+("fbryv"	"$AIQ(B")
+("fbwi"	"$Al_(B")
+("fbyh"	"$(H6v(B")
+("fcb"	"$A<9(B")
+("fci"	"$(H'x(B")
+("fcnh"	"$(H6l(B")
+("fcor"	"$(H6y(B")
+("fd"	"$ACW$(H'v(B")
+("fdamg"	"$(Gv}(B")
+("fdau"	"$AtN(B")
+("fdbm"	"$A4V(B")
+("fdbmr"	"$(H>n(B")
+("fdbt"	"$(H8&(B")
+("fdbuu"	"$(HE{(B")
+("fdcsh"	"$A7[(B")
+("fddh"	"$(Hr@(B")
+("fddi"	"$(H,h(B")
+("fddj"	"$(H8%(B")
+("fdeii"	"$(HY4(B")
+("fdha"	"$AFI(B")
+("fdhe"	"$(H1k(B")
+("fdhhj"	"$(HLh(B")
+("fdhj"	"$(H,j(B")
+("fdhoa"	"$AtX(B")
+("fdhqu"	"$(H1p(B")
+("fdhuk"	"$At\(B")
+("fdibi"	"$(HY6(B")
+("fdig"	"$(I=~(B")
+("fdiih"	"$(Gtb(B")
+("fdile"	"$A?7(B")
+("fdilr"	"$ALG(B")
+("fdixp"	"$(Ha6(B")
+("fdj"	"$(H(H(B")
+("fdjk"	"$(H,i(B")
+("fdjmf"	"$AtU(B")
+("fdjrb"	"$A:}(B")
+("fdk"	"$AH2(B")
+("fdma"	"$(H>m(B")
+("fdmbb"	"$AE4(B")
+("fdmcw"	"$AtQ(B")
+("fdmlk"	"$A>,(B")
+("fdmq"	"$(HDJ(B")
+("fdmtb"	"$(Hkt(B")
+("fdnd"	"$AWQ(B")
+("fdng"	"$(H1o(B")
+("fdnhd"	"$At[(B")
+("fdnii"	"$At](B")
+("fdnj"	"$(H,f(B")
+("fdnl"	"$(H1n(B")
+("fdnmm"	"$(HY7(B")
+("fdnob"	"$AtZ(B")
+("fdok"	"$AtM(B")
+("fdon"	"$(H,e(B")
+("fdphh"	"$(H1q(B")
+("fdqmb"	"$A>+(B")
+("fdsit"	"$(HiX(B")
+("fdsmv"	"$(HLe(B")
+("fdss"	"$(H8#(B")
+("fdtak"	"$(Gt_(B")
+("fdtaw"	"$(Hqr(B")
+("fdtbn"	"$(HRj(B")
+("fdtgf"	"$A8b(B")
+("fdthb"	"$(HY3(B")
+("fdtwa"	"$ATc(B")
+("fdv"	"$(H,g(B")
+("fdwd"	"$(HLf(B")
+("fdwf"	"$(Gdx(B")
+("fdwg"	"$(HEz(B")
+("fdwji"	"$(Gz((B")
+("fdwla"	"$(Hf7(B")
+("fdwtc"	"$(Gt^(B")
+("fdy"	"$(H0V(B")
+("fdyhr"	"$A2Z(B")
+("fdyj"	"$AAO(B")
+("fdyoj"	"$A4b(B")
+("fdyr"	"$AU3(B")
+("fdyt"	"$AA#(B")
+("ff"	"$AQW(B")
+("ffbb"	"$(HM1(B")
+("ffbbu"	"$(H_I(B")
+("ffbc"	"$(Hd7(B")
+("ffbd"	"$(Gi*(B")
+("ffbe"	"$(HK4(B")
+("ffbf"	"$(Gi^$(Hp?(B")
+("ffbg"	"$(Gc^(B")
+("ffbhf"	"$(G{M(B")
+("ffbhq"	"$(Gia(B")
+("ffbks"	"$(G^8(B")
+("ffbli"	"$(Gr-(B")
+("ffbmf"	"$(HRV(B")
+("ffbmg"	"$(Gmf(B")
+("ffbmn"	"$(HR5(B")
+("ffbmw"	"$(H_u(B")
+("ffbnj"	"$(HDO(B")
+("ffbou"	"$(HYK(B")
+("ffbrr"	"$(Gt2(B")
+("ffbuu"	"$(HT7(B")
+("ffbv"	"$(HBC(B")
+("ffbvf"	"$(Gqj(B")
+("ffbyr"	"$(H_W(B")
+("ffbyv"	"$(HZB(B")
+("ffdq"	"$(Gq7(B")
+("ffe"	"$A[F(B")
+("fff"	"$AlM(B")
+("fffd"	"$(HX<b*(B")
+("ffff"	"$(HXC(B")
+("ffh"	"$A34(B")
+("ffln"	"$AX_(B")
+("ffmbc"	"$(H`Vkv(B")
+("ffnl"	"$A[0(B")
+("ffno"	"$(H<~(B")
+("ffye"	"$(H<=(B")
+("ffypu"	"$(Hc&(B")
+("ffyr"	"$(HDI(B")
+("fg"	"$ATn(B")
+("fgg"	"$(H0N(B")
+("fggu"	"$(Gq8(B")
+("fgit"	"$(HKh(B")
+("fgni"	"$(Hb+(B")
+("fh"	"$AIY(B")
+("fhag"	"$A;M(B")
+("fhbk"	"$Al[(B")
+("fhbt"	"$(H0Z(B")
+("fhbu"	"$AJ!(B")
+("fhdf"	"$(HD](B")
+("fhdn"	"$(HQw(B")
+("fhdw"	"$Al\(B")
+("fhej"	"$A7i(B")
+("fher"	"$A@S(B")
+("fhey"	"$(H+u(B")
+("fhge"	"$(Gt7(B")
+("fhgf"	"$(Gv`(B")
+("fhgu"	"$(H0Y(B")
+("fhjg"	"$(HD\(B")
+("fhkb"	"$(HXB(B")
+("fhks"	"$AAS(B")
+("fhlo"	"$(H=`(B")
+("fhml"	"$(H'q(B")
+("fhon"	"$(H0[(B")
+("fhs"	"$AU((B")
+("fhsb"	"$(HDQ(B")
+("fhsm"	"$AI?(B")
+("fhsu"	"$(HQp(B")
+("fhup"	"$AO((B")
+("fhwp"	"$(HQx(B")
+("fiav"	"$(H6k(B")
+("fice"	"$(H6p(B")
+("fihr"	"$(HDU(B")
+("fijb"	"$(H6s(B")
+("filii"	"$(Hqu(B")
+("filr"	"$(HKg(B")
+("fipf"	"$(Het(B")
+("fipm"	"$(H0U(B")
+("fitc"	"$(Hes(B")
+("fixp"	"$(HQr(B")
+("fjcm"	"$(H=d(B")
+("fjcr"	"$AH[(B")
+("fjhp"	"$(H0S(B")
+("fjks"	"$A?>(B")
+("fjmu"	"$AMi(B")
+("fjnu"	"$(H=c(B")
+("fk"	"$A<b(B")
+("fkb"	"$(H0W(B")
+("fkbu"	"$AF3(B")
+("fkcf"	"$AAG(B")
+("fkgg"	"$(HDV(B")
+("fkhaf"	"$(Hnm(B")
+("fkhqu"	"$Ak)(B")
+("fkik"	"$(HQ}(B")
+("fkkb"	"$AO)(B")
+("fklb"	"$(Gh\(B")
+("fklmi"	"$(H_=(B")
+("fkmbc"	"$(GyK(B")
+("fkmnp"	"$(Gsn(B")
+("fkn"	"$(Ghc(B")
+("fknwf"	"$(G|*(B")
+("fkp"	"$A1o(B")
+("fkrau"	"$(Hct(B")
+("fkryo"	"$Au?(B")
+("fksb"	"$(HKi(B")
+("fksc"	"$(H]K(B")
+("fkt"	"$A1W(B")
+("fkv"	"$(HIZ(B")
+("flbk"	"$(H+t(B")
+("flii"	"$(HmZ(B")
+("flmo"	"$(H0O(B")
+("flmt"	"$(Gva(B")
+("flwv"	"$(HQv(B")
+("flx"	"$(HX?(B")
+("fm"	"$(H$^(B")
+("fmam"	"$(H0M(B")
+("fmbb"	"$(Gvc(B")
+("fmbc"	"$(Gdv(B")
+("fmbm"	"$(Hr,(B")
+("fmmr"	"$AlI(B")
+("fmob"	"$A1~(B")
+("fmso"	"$(H6u(B")
+("fmu"	"$A9b(B")
+("fmua"	"$(HX6(B")
+("fmvm"	"$(H6o(B")
+("fmwf"	"$(HQl(B")
+("fmwg"	"$(Gdu(B")
+("fmwj"	"$(HX4(B")
+("fmym"	"$(H+s(B")
+("fnbk"	"$(Gd~(B")
+("fng"	"$(H'u(B")
+("fnhb"	"$(HX>(B")
+("fnhd"	"$(HDK(B")
+("fnhx"	"$AQf(B")
+("fnkg"	"$(H6{(B")
+("fnkm"	"$(H=_(B")
+("fnkq"	"$(HDS(B")
+("fno"	"$A46(B")
+("fnot"	"$(Gq9(B")
+("fnq"	"$(HB~(B")
+("fo"	"$(H!<(B")
+("fog"	"$AH8(B")
+("fogf"	"$(HX:(B")
+("foii"	"$(H+v(B")
+("foir"	"$AlJ$(HKj(B")
+("foma"	"$(Gt8(B")
+("fomb"	"$(Hki(B")
+("fomg"	"$(H0\(B")
+("fomr"	"$(H0](B")
+("fond"	"$(HKe(B")
+("fowy"	"$(H6z(B")
+("fpd"	"$(H$_(B")
+("fpi"	"$AWF(B")
+("fpru"	"$AEZ(B")
+("fptd"	"$(HDL(B")
+("fpu"	"$Al@(B")
+("fq"	"$A0k(B")
+("fqbu"	"$A>l(B")
+("fqdmq"	"$(HU^(B")
+("fqhe"	"$AEQ(B")
+("fqhq"	"$(H0c(B")
+("fqlb"	"$(H*3(B")
+("fqln"	"$AEP(B")
+("fqmbc"	"$(HO3(B")
+("fqmso"	"$A;?(B")
+("fqmvn"	"$(H][(B")
+("fqn"	"$(H*=(B")
+("fqnbg"	"$(HGG(B")
+("fqnl"	"$(GoP(B")
+("fqq"	"$AH-(B")
+("fqsh"	"$AH/(B")
+("fqsmm"	"$(Hbf(B")
+("fqsu"	"$A>m(B")
+("fqu"	"$(HAV(B")
+("fqvif"	"$(H>w(B")
+("fqvv"	"$AtT(B")
+("fqymu"	"$(HmB(B")
+("frb"	"$(H6w(B")
+("frbc"	"$(HKb(B")
+("frhu"	"$(H+p(B")
+("frrd"	"$ATo(B")
+("frrj"	"$(HX8(B")
+("frrr"	"$(HDX(B")
+("frye"	"$(Ge"(B")
+("fseg"	"$(HQt(B")
+("fsh"	"$(H"a(B")
+("fshr"	"$(GR:(B")
+("fsit"	"$(Hb'(B")
+("fsma"	"$AlZ(B")
+("fsmg"	"$(Hb((B")
+("fsmi"	"$(HX7(B")
+("fsmt"	"$(HQu(B")
+("fsrr"	"$(HQm(B")
+("fss"	"$A>f(B")
+("fssr"	"$(H6n(B")
+("fswu"	"$(Hq&(B")
+("fta"	"$(H=f(B")
+("ftc"	"$A:f$(H0_(B")
+("ftcw"	"$(HDR(B")
+("ftgi"	"$(H]J(B")
+("ftgs"	"$(Hi:(B")
+("ftlj"	"$(HDT(B")
+("ftlk"	"$AlT(B")
+("ftlo"	"$(HQk(B")
+("ftmc"	"$(HX5(B")
+("ftmd"	"$AC:(B")
+("ftmj"	"$(HX9(B")
+("ftmv"	"$(HDM(B")
+("ftq"	"$AlH(B")
+("ftrg"	"$(Hm[(B")
+("ftwb"	"$(H]L(B")
+("ftwi"	"$(HX=(B")
+("fubjj"	"$(GoB(B")
+("fumb"	"$(HD[(B")
+("fusmg"	"$AR+(B")
+("fvid"	"$(GxH(B")
+("fwb"	"$AlR(B")
+("fwgg"	"$(Hew(B")
+("fwli"	"$(Gt6(B")
+("fwlj"	"$(H]H(B")
+("fwmbc"	"$(HqG(B")
+("fwmv"	"$AlP(B")
+("fwot"	"$(HKd(B")
+("fwtc"	"$(HXA(B")
+("fwtj"	"$(HQo(B")
+("fyaj"	"$AlL(B")
+("fycb"	"$AlX(B")
+("fydk"	"$(Gq6(B")
+("fyed"	"$(Gt4(B")
+("fyg"	"$AlD(B")
+("fyhn"	"$A?;(B")
+("fyia"	"$(Gq5(B")
+("fyj"	"$(H's(B")
+("fyk"	"$(H't(B")
+("fynb"	"$(HQs(B")
+("fyoj"	"$(H=\(B")
+("fyok"	"$(H=e(B")
+("fypt"	"$(Gyw(B")
+("fyrb"	"$(HK`(B")
+("fyrd"	"$(H=](B")
+("fyrv"	"$(Hkj(B")
+("fyto"	"$Al](B")
+("fytp"	"$(H]I(B")
+("fytr"	"$A1:(B")
+("fyvi"	"$AlE(B")
+("fyvo"	"$(H0T(B")
+("g"	"$AMA(B")
+("gagi"	"$(Gc](B")
+("gahu"	"$(H:m(B")
+("gam"	"$AL9(B")
+("gamh"	"$(G^[(B")
+("gamo"	"$A5L(B")
+("ganx"	"$(HeD(B")
+("gaph"	"$A[|(B")
+("gapv"	"$(H:g(B")
+("gasm"	"$AKz(B")
+("gav"	"$A[s(B")
+("gawe"	"$A\,(B")
+("gb"	"$AH=(B")
+("gbac"	"$(HB)(B")
+("gbb"	"$A\!(B")
+("gbbr"	"$(G^`(B")
+("gbcd"	"$(H41(B")
+("gbd"	"$(H4M(B")
+("gbdi"	"$A[x(B")
+("gbhne"	"$Al2(B")
+("gblm"	"$(G^c(B")
+("gbmc"	"$(H4H(B")
+("gbmm"	"$(HB9(B")
+("gbmo"	"$(GcV(B")
+("gbmr"	"$A[m(B")
+("gbmt"	"$AR<(B")
+("gbnd"	"$(H.P(B")
+("gbr"	"$(H%w(B")
+("gbsd"	"$(H4L(B")
+("gbtu"	"$(H49(B")
+("gby"	"$AL.(B")
+("gcbuu"	"$(Hn"(B")
+("gcdhe"	"$(HiA(B")
+("gcg"	"$(H%}(B")
+("gcglc"	"$A:U(B")
+("gche"	"$(H&#(B")
+("gcilr"	"$(H_e(B")
+("gcim"	"$(HB0(B")
+("gcjka"	"$Atw(B")
+("gclmi"	"$(HGb(B")
+("gcnau"	"$(HGc(B")
+("gcnl"	"$A:B(B")
+("gcok"	"$AIb(B")
+("gcrxu"	"$(He.(B")
+("gcrye"	"$(HZf(B")
+("gcsh"	"$(H#N(B")
+("gcsle"	"$Atv(B")
+("gcwa"	"$ATv(B")
+("gcybc"	"$(HZe(B")
+("gdhe"	"$AFB(B")
+("gdhne"	"$(Gn'$(HJh(B")
+("gdi"	"$AKB(B")
+("gdw"	"$(H4C(B")
+("gdwf"	"$(H:k(B")
+("gebu"	"$An-(B")
+("gec"	"$(Hgb(B")
+("gee"	"$(HQ[(B")
+("geeii"	"$(Hp)(B")
+("gefbg"	"$(Hpw(B")
+("gehda"	"$A\0(B")
+("gehey"	"$(Gx)(B")
+("gehhj"	"$A\1(B")
+("gehkb"	"$(Ho2(B")
+("gehor"	"$(Hm<(B")
+("gelmi"	"$(HZ;(B")
+("gelxl"	"$(Hm=(B")
+("gemr"	"$Am`(B")
+("geoju"	"$As@(B")
+("gep"	"$(HJ*(B")
+("gesj"	"$(Gtx(B")
+("gesmv"	"$(Hm>(B")
+("geymr"	"$Av%(B")
+("geyta"	"$(Hj[(B")
+("gfcb"	"$(HB.(B")
+("gff"	"$(H4?(B")
+("gfhne"	"$(HY=m$(B")
+("gfmu"	"$(H)\(B")
+("gfno"	"$A?n(B")
+("gfq"	"$(H%~(B")
+("gfqu"	"$(H42(B")
+("gg"	"$A9g(B")
+("ggce"	"$(H4E(B")
+("ggdi"	"$A7b(B")
+("ggff"	"$(HX3(B")
+("ggg"	"$(H)^(B")
+("gggu"	"$(G^Y$(HOr(B")
+("gghaf"	"$(HhJ(B")
+("ggkni"	"$(H43(B")
+("ggln"	"$(H%Q(B")
+("ggni"	"$(H\W(B")
+("ggnl"	"$(H-Y(B")
+("ggow"	"$(IPJ(B")
+("ggp"	"$Am#(B")
+("ggy"	"$AXT(B")
+("ghag"	"$(H:s(B")
+("ghbk"	"$(HVW(B")
+("ghdw"	"$(GlF(B")
+("ghfd"	"$(H%y(B")
+("ghgf"	"$(GsN(B")
+("ghhj"	"$A[}(B")
+("ghhw"	"$(HB/(B")
+("ghi"	"$(Gc[(B")
+("ghjg"	"$(H:q(B")
+("ghjm"	"$(H:h(B")
+("ghml"	"$A[_(B")
+("ghmr"	"$A98(B")
+("ghmvn"	"$Aj4(B")
+("ghmy"	"$A[e(B")
+("ghnd"	"$A6b(B")
+("ghni"	"$(H:r(B")
+("ghpm"	"$A[f(B")
+("ghrf"	"$(Gc\(B")
+("ghrj"	"$A2:(B")
+("ghsk"	"$(HVT(B")
+("ghvp"	"$(H#J(B")
+("ghxu"	"$(H4O(B")
+("gi"	"$AH%(B")
+("giapv"	"$(HJ`(B")
+("giav"	"$(H.L(B")
+("gibt"	"$AnA(B")
+("gibuc"	"$(Hc_(B")
+("gid"	"$(HQ&(B")
+("gif"	"$(Gm`(B")
+("gig"	"$(Gh<(B")
+("gihab"	"$(GsY(B")
+("gihaf"	"$(Hnn(B")
+("gihq"	"$(HDd(B")
+("gihr"	"$(H:n(B")
+("gihs"	"$A3G(B")
+("giih"	"$(HIE(B")
+("gijb"	"$AFR(B")
+("giks"	"$A=Y$(Gc<(B")
+("gilb"	"$A\-(B")
+("gilmi"	"$(H_6(B")
+("gilr"	"$ALA(B")
+("ginl"	"$(H-Z(B")
+("ginn"	"$(H.V(B")
+("giok"	"$A0#(B")
+("gip"	"$(HPC(B")
+("giq"	"$(Glx$(HPU(B")
+("girm"	"$ASr(B")
+("girxu"	"$(He-(B")
+("gismm"	"$(Hi^(B")
+("gisqf"	"$(Hll(B")
+("gitc"	"$(Gv>(B")
+("gitlj"	"$(HdI(B")
+("givif"	"$(H^K(B")
+("gixp"	"$(HIJ(B")
+("giymr"	"$(HcX(B")
+("gjbc"	"$ALn(B")
+("gjbm"	"$A[z(B")
+("gjcr"	"$(HB1(B")
+("gjhne"	"$(Gu_(B")
+("gjhp"	"$(H)R(B")
+("gjhvo"	"$Ah%(B")
+("gjii"	"$(HI>(B")
+("gjjn"	"$(HI@(B")
+("gjka"	"$A6B(B")
+("gjkni"	"$(GYZ(B")
+("gjmu"	"$A[y(B")
+("gjp"	"$A[g(B")
+("gjsle"	"$(G^^(B")
+("gjtc"	"$(GlB(B")
+("gjv"	"$(H)Q(B")
+("gkbt"	"$(H]e(B")
+("gkbuc"	"$(GwC(B")
+("gkc"	"$AvK(B")
+("gkf"	"$A0>(B")
+("gkik"	"$Aia(B")
+("gkkk"	"$(Gh?(B")
+("gklmi"	"$As'r|(B")
+("gkmb"	"$(H:o(B")
+("gkmr"	"$(H4F(B")
+("gkms"	"$A?e(B")
+("gknwf"	"$(Hna(B")
+("gkpb"	"$(HIA(B")
+("gkq"	"$(HPT(B")
+("gkrxu"	"$(G|}(B")
+("gksj"	"$Aqz(B")
+("gksqf"	"$(Hlk(B")
+("gkymr"	"$(HcQ(B")
+("glbk"	"$(H%v(B")
+("gle"	"$A\$(B")
+("glll"	"$A[Z(B")
+("glln"	"$(H%s(B")
+("glmo"	"$(H)V(B")
+("glnc"	"$A3`(B")
+("glq"	"$(H)[(B")
+("glwl"	"$A@$(B")
+("glwv"	"$(HIC(B")
+("gmam"	"$AT+(B")
+("gmbb"	"$(G|^$(H\V(B")
+("gmbk"	"$(H:e(B")
+("gmc"	"$(HUL(B")
+("gmd"	"$A[W(B")
+("gmdm"	"$(Gx0(B")
+("gmf"	"$A;5(B")
+("gmfj"	"$AF:(B")
+("gmfm"	"$AEw(B")
+("gmgg"	"$(H4G(B")
+("gmig"	"$A[l(B")
+("gmlk"	"$A9!(B")
+("gmlm"	"$(H4D(B")
+("gmms"	"$A[X(B")
+("gmn"	"$(H!O(B")
+("gmnr"	"$A?@(B")
+("gmrb"	"$A\*(B")
+("gmrw"	"$(H:l(B")
+("gmwd"	"$(HB5(B")
+("gmwf"	"$(HIK(B")
+("gmwg"	"$A\'(B")
+("gnbg"	"$(H.Q(B")
+("gnhe"	"$A;x(B")
+("gnhne"	"$(G`&$Al0(B")
+("gnhx"	"$(H4<(B")
+("gnib"	"$(H.W(B")
+("gnkm"	"$A[o(B")
+("gnmf"	"$(Gvb(B")
+("gnmi"	"$(Gh@(B")
+("gnmu"	"$(H)W(B")
+("gno"	"$A?2(B")
+("gnot"	"$(HOs(B")
+("gnui"	"$A\"(B")
+("goamj"	"$(Gk8(B")
+("goamo"	"$(HZh(B")
+("gobm"	"$Atr(B")
+("goc"	"$(HT[(B")
+("godk"	"$(H9V(B")
+("gofb"	"$(Gk7(B")
+("gofbr"	"$ALK(B")
+("gofh"	"$(H9W(B")
+("gog"	"$A6Q(B")
+("goggu"	"$(Hg7(B")
+("gogr"	"$(HGe(B")
+("gohjd"	"$(HGf(B")
+("gohjr"	"$(HGg(B")
+("gohkb"	"$(Hg:(B")
+("gohnd"	"$(HGi(B")
+("gohne"	"$(H_^(B")
+("gohuc"	"$(Hq^(B")
+("goii"	"$(H&"(B")
+("goik"	"$(H)Z(B")
+("goimo"	"$Att(B")
+("goin"	"$(H#K(B")
+("goiv"	"$AT=(B")
+("goks"	"$(H-S(B")
+("golmo"	"$(HGl(B")
+("golxh"	"$(H@T(B")
+("gom"	"$(H%z(B")
+("gomj"	"$A8O(B")
+("gomn"	"$(H:t(B")
+("gomnn"	"$Ats(B")
+("gomr"	"$(H)](B")
+("gon"	"$A[Y(B")
+("gonin"	"$(HGh(B")
+("gonk"	"$A\)(B")
+("goog"	"$(HTZ(B")
+("googf"	"$(Hg9(B")
+("goohh"	"$A3C(B")
+("gooog"	"$(HN>(B")
+("gopfd"	"$(HTY(B")
+("gopim"	"$(H9X(B")
+("gopuu"	"$(GuX(B")
+("gorrd"	"$(Hj$(B")
+("goru"	"$AFp(B")
+("goshr"	"$A3,(B")
+("gosje"	"$AH$(B")
+("gosmg"	"$(HlC(B")
+("gosmm"	"$(HGk(B")
+("gotcw"	"$(HZg(B")
+("gotmc"	"$(Hg8(B")
+("gou"	"$(H3((B")
+("gouu"	"$(H@U(B")
+("govl"	"$Atq(B")
+("gowr"	"$(GcE(B")
+("goy"	"$A80(B")
+("goyaj"	"$(HTX(B")
+("gp"	"$AV>(B")
+("gpbuu"	"$(HN-(B")
+("gpd"	"$A5X(B")
+("gpi"	"$(H"*(B")
+("gpim"	"$A>y(B")
+("gpmm"	"$(H:a(B")
+("gptd"	"$A\&(B")
+("gpu"	"$(H#M(B")
+("gqjl"	"$(H.Y(B")
+("gqkq"	"$(H4A(B")
+("gqmb"	"$(H4B(B")
+("gr"	"$A<*(B")
+("grbc"	"$(HB+(B")
+("grbg"	"$(GjW(B")
+("grgrr"	"$(Hp4(B")
+("grhaf"	"$(Ha'(B")
+("grhg"	"$A[t(B")
+("grhne"	"$(HAvAv(B")
+("grhv"	"$AT,(B")
+("grks"	"$(H%U(B")
+("grmbc"	"$(Gon(B")
+("grmfr"	"$(He=(B")
+("grno"	"$(H/xWk(B")
+("grrj"	"$(HOt(B")
+("grrk"	"$(Ho"(B")
+("grrs"	"$(H:p(B")
+("grrv"	"$(G^F(B")
+("grt"	"$(H)`(B")
+("grtf"	"$Ald(B")
+("grtr"	"$AO2<N(B")
+("gru"	"$A[](B")
+("grye"	"$(HW<(B")
+("gsav"	"$AQ_(B")
+("gsit"	"$(H\X(B")
+("gsjt"	"$(Hhn(B")
+("gsmb"	"$A\#(B")
+("gsme"	"$(H.X(B")
+("gsok"	"$A0=(B")
+("gsp"	"$A[h(B")
+("gsu"	"$A[\(B")
+("gsuu"	"$A\%(B")
+("gsyq"	"$A\/(B")
+("gtak"	"$(HIM(B")
+("gtco"	"$(HOu(B")
+("gtcp"	"$(HB*(B")
+("gtdi"	"$(H;;(B")
+("gtgr"	"$(HOy(B")
+("gtgt"	"$(H\Y(B")
+("gthhh"	"$AEm(B")
+("gtiop"	"$A\2(B")
+("gtj"	"$APR(B")
+("gtje"	"$A9D(B")
+("gtlm"	"$(HI?(B")
+("gtm"	"$A[a(B")
+("gtmv"	"$A?0(B")
+("gtor"	"$AK~(B")
+("gtq"	"$(H)S(B")
+("gtss"	"$(HIP(B")
+("gtu"	"$(HAW(B")
+("gtvs"	"$(HIL(B")
+("gtwi"	"$(HOqOz(B")
+("gu"	"$(H!9(B")
+("gubb"	"$(HID(B")
+("guhne"	"$(HRF(B")
+("gumbc"	"$(Hl`(B")
+("gumt"	"$(HB,(B")
+("guog"	"$(HIN(B")
+("guon"	"$(H.Z(B")
+("gusmm"	"$(Gw((B")
+("gvis"	"$A[j(B")
+("gwd"	"$(H4I(B")
+("gwg"	"$ABq(B")
+("gwj"	"$(H$H(B")
+("gwjr"	"$(H4J(B")
+("gwlb"	"$(H:f(B")
+("gwlc"	"$(Go1(B")
+("gwlj"	"$(HVV(B")
+("gwlm"	"$(HB6(B")
+("gwot"	"$(GcZ(B")
+("gwyi"	"$A[i(B")
+("gybs"	"$(HB2(B")
+("gycb"	"$(HIH(B")
+("gydk"	"$A6U(B")
+("gydl"	"$(HII(B")
+("gyfe"	"$(H4K(B")
+("gyhn"	"$A?S(B")
+("gyhs"	"$A7;(B")
+("gyib"	"$(GTm(B")
+("gylc"	"$(HeC(B")
+("gylm"	"$AV7(B")
+("gyo"	"$AW_(B")
+("gyoj"	"$(H4@(B")
+("gypm"	"$APf(B")
+("gypo"	"$(HVU(B")
+("gypt"	"$(HeB(B")
+("gyr"	"$A[c(B")
+("gyrb"	"$(HB3(B")
+("gyrd"	"$(H40(B")
+("gyro"	"$A:>(B")
+("gyrv"	"$AH@(B")
+("gyt"	"$A@,(B")
+("gyta"	"$(H:b(B")
+("gytg"	"$(HOx(B")
+("gytj"	"$(H.UIG(B")
+("gytr"	"$AE`(B")
+("gytu"	"$A>3(B")
+("gyvo"	"$A[r(B")
+("gywd"	"$(HVS(B")
+("gywm"	"$(GpK(B")
+("gywv"	"$(Gx.(B")
+("h"	"$AVq(B")
+("ha"	"$A0W(B")
+("habwi"	"$(Hmc(B")
+("hae"	"$AH*(B")
+("hahaa"	"$(HRCr"(B")
+("hahaj"	"$(HRB(B")
+("hahdw"	"$Ap+(B")
+("hahe"	"$Ap'(B")
+("hahgr"	"$Ap)(B")
+("hahi"	"$AFG(B")
+("hahqi"	"$(H><(B")
+("hahsk"	"$(Hb>(B")
+("hail"	"$(Geg(B")
+("haipf"	"$(Hi?(B")
+("haj"	"$(H$q(B")
+("hajbd"	"$(H[l(B")
+("hajmu"	"$AMn(B")
+("hakj"	"$A8^(B")
+("haklu"	"$(H`b(B")
+("halb"	"$A2/(B")
+("halmy"	"$(H`c(B")
+("ham"	"$AsN(B")
+("hamg"	"$A;J(B")
+("hamj"	"$(HEv(B")
+("hana"	"$(Gv|(B")
+("hank"	"$(HbV(B")
+("hanw"	"$(G|?(B")
+("haoae"	"$Ap%(B")
+("haoii"	"$(H1.(B")
+("hap"	"$ATm(B")
+("haph"	"$(HO9(B")
+("hapi"	"$A5D(B")
+("hasp"	"$(HO:(B")
+("hatt"	"$(H7H(B")
+("hatxc"	"$(Hg}(B")
+("hau"	"$A0J$(H"g(B")
+("haumt"	"$(Gms(B")
+("havid"	"$(Hi@(B")
+("havt"	"$As~(B")
+("hawot"	"$(Hg~(B")
+("hayck"	"$Ap((B")
+("hayd"	"$(G[@(B")
+("hayf"	"$(G^$(B")
+("haymp"	"$(H7I(B")
+("hayrb"	"$(HR@(B")
+("hayu"	"$(GU5(B")
+("hayv"	"$(GfT(B")
+("hbbm"	"$(HfM(B")
+("hbbuu"	"$(Gz<(B")
+("hbddf"	"$Al`(B")
+("hbe"	"$(H];(B")
+("hbf"	"$(H]Nev(B")
+("hbfe"	"$(Gz{(B")
+("hbg"	"$(HVZ(B")
+("hbhaf"	"$(HhWk9oxpt(B")
+("hbhgr"	"$(Hhm(B")
+("hbk"	"$(Gc_(B")
+("hbks"	"$A=n(B")
+("hbln"	"$AVF(B")
+("hbmbc"	"$(H`U(B")
+("hbmch"	"$(G}*(B")
+("hbmgi"	"$Ah7(B")
+("hbmr"	"$AM2$(HbG(B")
+("hbmvn"	"$(HK|(B")
+("hbnbg"	"$(Hiy(B")
+("hbnd"	"$(GpP(B")
+("hbnl"	"$(HA"(B")
+("hbnwf"	"$(G|x(B")
+("hbok"	"$(HW;(B")
+("hbq"	"$(H"f(B")
+("hbr"	"$AOr(B")
+("hbsd"	"$(Gj.(B")
+("hbse"	"$(HLb(B")
+("hbsmm"	"$Atf(B")
+("hbt"	"$AQ*(B")
+("hbtmc"	"$(G}1(B")
+("hbu"	"$AWT$(HVp(B")
+("hbuf"	"$AWk(B")
+("hbuh"	"$(HRb(B")
+("hbui"	"$A4[(B")
+("hbut"	"$AKc(B")
+("hbuu"	"$(Gej$(HY+(B")
+("hbyi"	"$AV[(B")
+("hchaf"	"$(HqP(B")
+("hchg"	"$(Ho<(B")
+("hcii"	"$(Hmk(B")
+("hcjwj"	"$(HlH(B")
+("hcln"	"$(Gl,$(HkQ(B")
+("hcmr"	"$(Hf,(B")
+("hcnl"	"$(HU$n5(B")
+("hcno"	"$(GvV(B")
+("hcq"	"$(Gu((B")
+("hcv"	"$(HP"(B")
+("hcve"	"$(Hmj(B")
+("hcymr"	"$(G{-(B")
+("hd"	"$A:L(B")
+("hda"	"$AOc(B")
+("hdaiu"	"$(HLL(B")
+("hdamj"	"$(Ga"(B")
+("hdb"	"$A2_(B")
+("hdbgb"	"$(Gj"(B")
+("hdbgr"	"$A3m(B")
+("hdbhx"	"$A5>(B")
+("hdbm"	"$AWb(B")
+("hdbmp"	"$(GxX(B")
+("hdbnd"	"$Ao{(B")
+("hdbof"	"$(HXy(B")
+("hdbt"	"$(H1/(B")
+("hdbu"	"$AOd(B")
+("hdbwi"	"$(Hmg(B")
+("hdcnh"	"$(H>[(B")
+("hdcru"	"$(Ga$(B")
+("hdcsh"	"$(H,_(B")
+("hdd"	"$(HLZ(B")
+("hddj"	"$Aow(B")
+("hddmq"	"$(HLP(B")
+("hdf"	"$AGo(B")
+("hdfb"	"$AIT(B")
+("hdfh"	"$ACk(B")
+("hdgce"	"$(Ge^(B")
+("hdgcg"	"$(HE](B")
+("hdggu"	"$(H^!(B")
+("hdgow"	"$(Gvr(B")
+("hdgr"	"$A=U(B")
+("hdhaf"	"$(Ha+m5(B")
+("hdhah"	"$ADB(B")
+("hdhd"	"$(H1X(B")
+("hdhhj"	"$A0^(B")
+("hdhjg"	"$(Gj!(B")
+("hdhkb"	"$(H^#(B")
+("hdhne"	"$(HWp(B")
+("hdhp"	"$(H(D(B")
+("hdhpm"	"$(H1U(B")
+("hdhqo"	"$AVH(B")
+("hdhqu"	"$(H,](B")
+("hdhsb"	"$(HLO(B")
+("hdhu"	"$(GK5(B")
+("hdhvp"	"$(H,^(B")
+("hdi"	"$AK=(B")
+("hdiav"	"$Ao|(B")
+("hdice"	"$(H>^(B")
+("hdiih"	"$(HX{(B")
+("hdijc"	"$Aox(B")
+("hdipf"	"$(HiO(B")
+("hdir"	"$(H1S(B")
+("hdirm"	"$(HEc(B")
+("hditc"	"$(HiP(B")
+("hdiua"	"$A;|(B")
+("hdiuu"	"$Aoz(B")
+("hdjbc"	"$Ap!(B")
+("hdjbm"	"$(HE_(B")
+("hdjhp"	"$(H7g(B")
+("hdjip"	"$AKk(B")
+("hdjmo"	"$A<Z(B")
+("hdkkb"	"$AO!(B")
+("hdl"	"$A1|VV(B")
+("hdlbk"	"$AQm(B")
+("hdlc"	"$(G{m(B")
+("hdln"	"$A@{6g(B")
+("hdlo"	"$Asy(B")
+("hdlp"	"$A3K(B")
+("hdlw"	"$AST$(H1W(B")
+("hdlxh"	"$Aov(B")
+("hdm"	"$A1?(B")
+("hdmfj"	"$A3S(B")
+("hdmfm"	"$(H1R(B")
+("hdmig"	"$(H7j(B")
+("hdmrw"	"$(HLK(B")
+("hdmvn"	"$(HR4(B")
+("hdnd"	"$A<>(B")
+("hdnhs"	"$APc(B")
+("hdnin"	"$ARF(B")
+("hdnl"	"$A[%$(HNX(B")
+("hdnmu"	"$(HY`(B")
+("hdnob"	"$(HLM(B")
+("hdnwa"	"$(HiQ(B")
+("hdoe"	"$AJr(B")
+("hdog"	"$AVI(B")
+("hdogf"	"$(H]}(B")
+("hdoip"	"$Ao~(B")
+("hdomb"	"$(HEf(B")
+("hdomd"	"$(H>](B")
+("hdoo"	"$(HLd(B")
+("hdp"	"$AO$(B")
+("hdph"	"$ACX(B")
+("hdpp"	"$Aou(B")
+("hdqmc"	"$(GqX(B")
+("hdr"	"$A:M(B")
+("hdrhg"	"$A3L(B")
+("hdsmh"	"$(Gq\(B")
+("hdsp"	"$(H1V(B")
+("hdss"	"$(H1Q(B")
+("hdta"	"$(HEd(B")
+("hdtmc"	"$(HE^^"(B")
+("hdtoe"	"$(GxW(B")
+("hdtwv"	"$(Gvt(B")
+("hdu"	"$(GO'(B")
+("hduce"	"$(HLN(B")
+("hdv"	"$AN/(B")
+("hdvii"	"$(H]~(B")
+("hdw"	"$A7,(B")
+("hdwce"	"$Ap"(B")
+("hdwd"	"$Ao}(B")
+("hdwhd"	"$(HEe(B")
+("hdwjr"	"$(HE`(B")
+("hdwlj"	"$(GzK(B")
+("hdyj"	"$A?F(B")
+("hdymh"	"$(Gvs(B")
+("hdyrb"	"$A8e(B")
+("hdyrd"	"$(HEb(B")
+("hdyrv"	"$Ap&(B")
+("hdytg"	"$(H]|(B")
+("hdyto"	"$(HbL(B")
+("hdyx"	"$(Hf0(B")
+("he"	"$A74(B")
+("heag"	"$(HY#(B")
+("heah"	"$(HbM(B")
+("hebt"	"$(Gmu(B")
+("hed"	"$(Gi7(B")
+("heg"	"$(H.S(B")
+("heha"	"$A2-(B")
+("hehee"	"$(Hqq(B")
+("hehw"	"$(Hks(B")
+("heii"	"$A2>(B")
+("heir"	"$(HLU(B")
+("helb"	"$(HBb(B")
+("hemr"	"$AEM(B")
+("henl"	"$(HH0(B")
+("hep"	"$(Ghf(B")
+("heq"	"$(HJ@(B")
+("heqj"	"$(H#P(B")
+("her"	"$A8w(B")
+("hesu"	"$(H7n(B")
+("hetc"	"$(HRe(B")
+("hetlj"	"$(Hgn(B")
+("hev"	"$(HBD(B")
+("hevif"	"$(HYE(B")
+("hey"	"$A6,(B")
+("heyhv"	"$(HZF(B")
+("heyli"	"$As.(B")
+("heyr"	"$Ap$(B")
+("heyub"	"$(Hp%(B")
+("hfaht"	"$(Hh\(B")
+("hfate"	"$(Hqk(B")
+("hfb"	"$Asb(B")
+("hfbn"	"$(HR`(B")
+("hfbw"	"$(Hf4(B")
+("hfd"	"$A:u$(GK](B")
+("hfdk"	"$(Gp*(B")
+("hffs"	"$(HbN(B")
+("hfhaf"	"$(Hk<(B")
+("hfhn"	"$(HHs(B")
+("hfhrb"	"$(Hm4(B")
+("hfhu"	"$(HRf(B")
+("hfhyu"	"$(Hm0(B")
+("hfice"	"$(He&(B")
+("hfjc"	"$(H\/(B")
+("hfjp"	"$(Gs6(B")
+("hfks"	"$(Gp:(B")
+("hflmi"	"$(HT&(B")
+("hfmvn"	"$(HK}(B")
+("hfn"	"$(HAT(B")
+("hfnl"	"$(HH/(B")
+("hfno"	"$(HK,(B")
+("hfog"	"$(HhX(B")
+("hfomd"	"$(He#(B")
+("hfp"	"$A3n(B")
+("hfq"	"$(HC!(B")
+("hfsqf"	"$(Hm3(B")
+("hftgi"	"$(Hpm(B")
+("hftmc"	"$(HhK(B")
+("hfv"	"$(H;3(B")
+("hfydk"	"$(Hoo(B")
+("hg"	"$AHI(B")
+("hgcr"	"$(HbR(B")
+("hgdi"	"$A5H(B")
+("hgea"	"$(H]:(B")
+("hgf"	"$AQ,(B")
+("hgfmu"	"$(HRA(B")
+("hgg"	"$(H>h(B")
+("hghne"	"$(GdZ(B")
+("hghu"	"$AOH(B")
+("hgi"	"$(GG#(B")
+("hgit"	"$(HY'(B")
+("hgks"	"$(GY/(B")
+("hgmbc"	"$(G{A(B")
+("hgni"	"$(Gz$(B")
+("hgpm"	"$As^(B")
+("hgr"	"$A8f(B")
+("hgrg"	"$(HiS(B")
+("hgrly"	"$A??(B")
+("hhag"	"$Asr(B")
+("hhail"	"$AGd(B")
+("hhbuc"	"$(Gb;(B")
+("hhdi"	"$AId(B")
+("hhdn"	"$(HEx^3(B")
+("hhfbr"	"$ALI(B")
+("hhffs"	"$(HgA(B")
+("hhgr"	"$(HEw(B")
+("hhgu"	"$AsZ(B")
+("hhhaf"	"$(Hh[(B")
+("hhhj"	"$(Gj1(B")
+("hhhnd"	"$A6c(B")
+("hhj"	"$A10(B")
+("hhjm"	"$(Gn4(B")
+("hhjmc"	"$(Hqz(B")
+("hhjr"	"$(H>e(B")
+("hhk"	"$AP&(B")
+("hhkb"	"$(HbW(B")
+("hhlo"	"$AsI(B")
+("hhmbc"	"$(Gb|(B")
+("hhn"	"$A9*(B")
+("hhnwf"	"$(Hh>(B")
+("hhoe"	"$A@h(B")
+("hhol"	"$(H^6(B")
+("hhoo"	"$(H^4(B")
+("hhqm"	"$AsO(B")
+("hhrb"	"$(Gqd(B")
+("hhs"	"$AsP(B")
+("hhsav"	"$(HZt(B")
+("hhsb"	"$AF*(B")
+("hhsl"	"$AC.(B")
+("hhslc"	"$(Hn+(B")
+("hhsld"	"$A7u(B")
+("hhsle"	"$(HWo(B")
+("hhsli"	"$ABQ(B")
+("hhsrr"	"$(GwJ(B")
+("hhuc"	"$(Hq,(B")
+("hhw"	"$AAt(B")
+("hhwgf"	"$Aws(B")
+("hhwp"	"$Asw(B")
+("hhxc"	"$(HiW(B")
+("hhyu"	"$Asx(B")
+("hi"	"$AC49m(B")
+("hiav"	"$(HEl(B")
+("hibt"	"$(HbP(B")
+("hibtv"	"$AwM(B")
+("hifb"	"$AwL(B")
+("hihaf"	"$(Gx&(B")
+("hihml"	"$(HOF(B")
+("hihq"	"$(Hm\(B")
+("hihr"	"$Asp(B")
+("hii"	"$(Gj)(B")
+("hiih"	"$(H^5(B")
+("hiikk"	"$AwI(B")
+("hiirm"	"$(Hdj(B")
+("hiiv"	"$(HV#(B")
+("hijd"	"$AwH(B")
+("hije"	"$(HOE(B")
+("himlb"	"$(Gw|(B")
+("himwf"	"$(Hlt(B")
+("hino"	"$A7&(B")
+("hiog"	"$(Hdl(B")
+("hir"	"$AsW(B")
+("hit"	"$(H7}(B")
+("hitc"	"$(GxY(B")
+("hitmc"	"$(Hdk(B")
+("hivii"	"$(HnV(B")
+("hixp"	"$As|(B")
+("hiyj"	"$A?}(B")
+("hiypm"	"$(HnU(B")
+("hiyub"	"$AwN(B")
+("hj"	"$AG'(B")
+("hjbu"	"$A6\(B")
+("hjcm"	"$Asm(B")
+("hjd"	"$AVl(B")
+("hjhaf"	"$(HhZ(B")
+("hjhne"	"$A6N(B")
+("hjhx"	"$(H-+(B")
+("hjii"	"$(H^+bO(B")
+("hjjj"	"$(Hf2(B")
+("hjjo"	"$(H^:(B")
+("hjju"	"$(Gn/(B")
+("hjka"	"$Asg(B")
+("hjlo"	"$(HLX(B")
+("hjlp"	"$A9T(B")
+("hjmbc"	"$(H`S(B")
+("hjmk"	"$(H^7(B")
+("hjmu"	"$(HEk(B")
+("hjnl"	"$A[/(B")
+("hjr"	"$AI`(B")
+("hjrr"	"$A9\(B")
+("hjsmm"	"$A0?(B")
+("hjtm"	"$A49(B")
+("hjwg"	"$AVX(B")
+("hk"	"$AX2(B")
+("hka"	"$(H',(B")
+("hkcf"	"$(HbS(B")
+("hkd"	"$(H<l(B")
+("hkhaf"	"$(Hpu(B")
+("hkk"	"$(H1d(B")
+("hklmi"	"$A2O(B")
+("hklq"	"$AUX(B")
+("hkoo"	"$(HEn(B")
+("hkp"	"$AcC$(Gx4(B")
+("hkr"	"$AML(B")
+("hkrbr"	"$(G^R(B")
+("hks"	"$(H(G(B")
+("hksr"	"$AsU(B")
+("hku"	"$(HVt(B")
+("hkvif"	"$Atl(B")
+("hkymr"	"$(Hj!(B")
+("hlapv"	"$(Hp-(B")
+("hlbi"	"$ASm(B")
+("hlbuc"	"$(Go3(B")
+("hlha"	"$Ap*(B")
+("hljbv"	"$(HrC(B")
+("hlkn"	"$Aw|(B")
+("hlle"	"$(Hny(B")
+("hllj"	"$(HbX(B")
+("hlln"	"$AXf$(H7r(B")
+("hlmbc"	"$(HHf(B")
+("hlmc"	"$(Gv{(B")
+("hlmj"	"$Aw}(B")
+("hlmmf"	"$(GqW(B")
+("hlmo"	"$(H>d(B")
+("hlmvn"	"$(Hhd(B")
+("hlno"	"$AP@(B")
+("hlo"	"$AW&(B")
+("hlpr"	"$(Hhe(B")
+("hlq"	"$(Ga-(B")
+("hltwv"	"$(Hr)(B")
+("hlvk"	"$(Hkr(B")
+("hlvvu"	"$(Hpx(B")
+("hlw"	"$A5Q(B")
+("hlwli"	"$(H\{(B")
+("hlwv"	"$(GtW(B")
+("hlx"	"$(Gvw(B")
+("hlxh"	"$AsJ(B")
+("hlypm"	"$(HqU(B")
+("hm"	"$(H,d(B")
+("hmbc"	"$(HY.(B")
+("hmbg"	"$(Hmh(B")
+("hmbu"	"$Amr(B")
+("hmd"	"$AsD(B")
+("hmgn"	"$(HL\iT(B")
+("hmgt"	"$(HEm(B")
+("hmhaf"	"$(H\:m,(B")
+("hmhqm"	"$(H1#(B")
+("hmj"	"$A8M(B")
+("hml"	"$A=o(B")
+("hmm"	"$AsC(B")
+("hmmu"	"$(H1h(B")
+("hmmvn"	"$(HK{(B")
+("hmnd"	"$(Gq`(B")
+("hmnj"	"$AV~(B")
+("hmnl"	"$A[!$(GbS$(H7o(B")
+("hmnq"	"$(HY0(B")
+("hmnr"	"$(H7p(B")
+("hmoo"	"$As_(B")
+("hmr"	"$A:s(B")
+("hmrg"	"$(H)_(B")
+("hmsl"	"$AsL(B")
+("hmsmb"	"$(GvW(B")
+("hmsu"	"$AX4(B")
+("hmt"	"$AsG(B")
+("hmua"	"$At"(B")
+("hmwd"	"$Asv(B")
+("hmwf"	"$(H^,(B")
+("hmwj"	"$At!(B")
+("hmwks"	"$AI{(B")
+("hmy"	"$A3b(B")
+("hn"	"$A<8(B")
+("hnamh"	"$(Gwq(B")
+("hnbmc"	"$(Gv)(B")
+("hncr"	"$(Gx](B")
+("hnd"	"$A6d@f(B")
+("hndo"	"$(HL](B")
+("hne"	"$Al/(B")
+("hnef"	"$(HY/(B")
+("hneii"	"$(Hgy(B")
+("hnhag"	"$A;K(B")
+("hnhe"	"$AsE(B")
+("hnhhh"	"$(HAR(B")
+("hnhhw"	"$(Hlc(B")
+("hnhjr"	"$(Goq(B")
+("hnhli"	"$(GSx(B")
+("hnhq"	"$A@g(B")
+("hnhxe"	"$(GyN(B")
+("hni"	"$A72(B")
+("hnib"	"$(HEo(B")
+("hnir"	"$(Gkm(B")
+("hnkcf"	"$(Hla(B")
+("hnkg"	"$(HEr(B")
+("hnkm"	"$As[(B")
+("hnld"	"$(HY*(B")
+("hnlh"	"$A5Z(B")
+("hnmaf"	"$(Gkz(B")
+("hnmgh"	"$(HnD(B")
+("hnmm"	"$(Gqb(B")
+("hnmni"	"$AYm(B")
+("hnmnn"	"$(HUg(B")
+("hnmvh"	"$(HHg(B")
+("hnot"	"$At#(B")
+("hnp"	"$Am)(B")
+("hnpru"	"$(HO5(B")
+("hnq"	"$A38(B")
+("hnryo"	"$(Hn2(B")
+("hnsmh"	"$(Hja(B")
+("hnwp"	"$(HdU(B")
+("hnyhv"	"$(Gj{(B")
+("hnymr"	"$(Hn((B")
+("hnyr"	"$(HO4(B")
+("ho"	"$A0Ka\(B")
+("hoa"	"$AjC(B")
+("hoami"	"$A5C(B")
+("hoamo"	"$(H;Z(B")
+("hoau"	"$AE@(B")
+("hoaue"	"$(Hhu(B")
+("hoav"	"$A:\(B")
+("hobc"	"$(G}K(B")
+("hobg"	"$(HY%(B")
+("hobgn"	"$Aai(B")
+("hobgr"	"$(H54(B")
+("hobm"	"$Aa^(B")
+("hobou"	"$Aaf(B")
+("hobrn"	"$(H@((B")
+("hobvk"	"$(HBi(B")
+("hoci"	"$(H#t(B")
+("hocmn"	"$(GkW(B")
+("hodhe"	"$A1K(B")
+("hodi"	"$A7{(B")
+("hodmq"	"$(H;[(B")
+("hodoo"	"$(GZ:(B")
+("hodqn"	"$(Gnl(B")
+("hoemn"	"$AQ\(B")
+("hof"	"$(HQy(B")
+("hofbk"	"$(HJ((B")
+("hofbr"	"$Aad(B")
+("hogdi"	"$A4}(B")
+("hoggn"	"$A=V(B")
+("hogyo"	"$AM=(B")
+("hohaf"	"$(H\3\4(B")
+("hohag"	"$Aae(B")
+("hohgn"	"$(Gnm(B")
+("hohju"	"$AQ-(B")
+("hohne"	"$AR[(B")
+("hohpm"	"$(H&X(B")
+("hohqo"	"$Ap,(B")
+("hohs"	"$(HEt(B")
+("hohsk"	"$Aah(B")
+("hoi"	"$A7$(B")
+("hoicn"	"$(G]4(B")
+("hoii"	"$(H7{(B")
+("hoim"	"$(G|>(B")
+("hoin"	"$(H1j(B")
+("hojmf"	"$(H53(B")
+("hojrn"	"$(HT*(B")
+("hojwp"	"$A5B(B")
+("hokmr"	"$(H52(B")
+("hoks"	"$(H#2(B")
+("hold"	"$(Gt[(B")
+("holii"	"$(HpA(B")
+("holk"	"$Asc(B")
+("holln"	"$(GM=(B")
+("holmy"	"$AEG(B")
+("holq"	"$ABI(B")
+("homb"	"$(G|@(B")
+("homcw"	"$(H*?(B")
+("homd"	"$(HEu(B")
+("homg"	"$As\(B")
+("homjn"	"$(H-L(B")
+("homk"	"$(HRc(B")
+("hommn"	"$APP(B")
+("homo"	"$(Gx\(B")
+("homr"	"$A4p(B")
+("homrn"	"$AQC(B")
+("homvm"	"$(GU@(B")
+("homym"	"$AUw(B")
+("honhe"	"$(H#u(B")
+("honk"	"$Ass(B")
+("honkn"	"$A:b(B")
+("hooae"	"$(G_&(B")
+("hooii"	"$(H&W(B")
+("hooma"	"$(HW"(B")
+("hoomd"	"$APl(B")
+("hooml"	"$ASy(B")
+("hoooo"	"$(GZ7(B")
+("hop"	"$(Glk(B")
+("hopa"	"$Aa_(B")
+("hopi"	"$(H"?(0(B")
+("hopru"	"$(H0~(B")
+("hoqb"	"$(HY2(B")
+("hor"	"$A>L(B")
+("horye"	"$(H;Y(B")
+("hosj"	"$(Gt{(B")
+("hosyq"	"$(HP@(B")
+("hotcn"	"$(H@'(B")
+("hotq"	"$Aa`(B")
+("houfk"	"$A;U$(G|\$(Hn`(B")
+("hougk"	"$Aag(B")
+("hourk"	"$(H\i(B")
+("houuk"	"$AN"(B")
+("hovie"	"$Aaa(B")
+("howr"	"$A;2(B")
+("hoybk"	"$(Ghe(B")
+("hoybp"	"$(HeK(B")
+("hoybs"	"$(Gcq(B")
+("hoyg"	"$AMy(B")
+("hoyhs"	"$Aa](B")
+("hoyin"	"$(H94(B")
+("hoyj"	"$(H<@(B")
+("hoylo"	"$Aac(B")
+("hoyrv"	"$(Hht(B")
+("hp"	"$AX1(B")
+("hpa"	"$A;h$(Ga1(B")
+("hpdk"	"$A?j(B")
+("hphaf"	"$(He"(B")
+("hphh"	"$AsK(B")
+("hpim"	"$(H1i(B")
+("hpln"	"$AJ#(B")
+("hpm"	"$AX5(B")
+("hpnl"	"$(HH1(B")
+("hpp"	"$(H1c(B")
+("hpr"	"$AsQ(B")
+("hpru"	"$(H8"(B")
+("hpsl"	"$AS!(B")
+("hpuu"	"$(HY1(B")
+("hq"	"$AE#(B")
+("hqate"	"$(Hey(B")
+("hqbmc"	"$Ajx(B")
+("hqbtu"	"$(H=o(B")
+("hqbu"	"$A?4(B")
+("hqbuk"	"$(HDb(B")
+("hqda"	"$A<.(B")
+("hqfqu"	"$(H=l(B")
+("hqg"	"$AD5(B")
+("hqgdi"	"$ALX(B")
+("hqgwc"	"$(GxJ(B")
+("hqhdj"	"$(HDc(B")
+("hqhgr"	"$Ajv(B")
+("hqhkb"	"$(HXF(B")
+("hqhpm"	"$(GR>(B")
+("hqhq"	"$(H'{(B")
+("hqhqm"	"$AI|(B")
+("hqhw"	"$At&(B")
+("hqi"	"$ANR(B")
+("hqipf"	"$(Hex(B")
+("hqiuh"	"$(H7"(B")
+("hqjbm"	"$(H=n(B")
+("hqjm"	"$(H^)(B")
+("hqjnd"	"$(H0a(B")
+("hqjqr"	"$(HKm(B")
+("hqjr"	"$Ajt(B")
+("hqkmr"	"$Ajw(B")
+("hqks"	"$(H"b(B")
+("hqlw"	"$(H+{(B")
+("hqlxh"	"$(H+z(B")
+("hqm"	"$AIz(B")
+("hqmb"	"$Asd(B")
+("hqmc"	"$(H^*(B")
+("hqmmr"	"$Aju(B")
+("hqmqj"	"$A0](B")
+("hqmtb"	"$(He|(B")
+("hqmvm"	"$(H7#(B")
+("hqnbg"	"$(H9K(B")
+("hqnkq"	"$(HD`(B")
+("hqo"	"$AJ'(B")
+("hqok"	"$ADA(B")
+("hqomg"	"$(H0b(B")
+("hqp"	"$Ajr(B")
+("hqpd"	"$(GK((B")
+("hqphh"	"$ANo(B")
+("hqpuu"	"$(HKo(B")
+("hqr"	"$AsX(B")
+("hqrye"	"$(HDa(B")
+("hqsb"	"$A9?(B")
+("hqshi"	"$(H$`(B")
+("hqta"	"$(H^-(B")
+("hqtb"	"$(Hf3(B")
+("hqtce"	"$(Hq'(B")
+("hqtgs"	"$(Gzv(B")
+("hqthb"	"$(HKn(B")
+("hqtm"	"$Asi(B")
+("hqu"	"$AC+(B")
+("hqvvv"	"$(He{(B")
+("hqwj"	"$(Hmi(B")
+("hqwlp"	"$(Hez(B")
+("hqwyi"	"$(H+|(B")
+("hqyrb"	"$Aj{(B")
+("hqyrd"	"$(H=m(B")
+("hqytg"	"$(HXE(B")
+("hrbc"	"$(HY,(B")
+("hrff"	"$(HM2(B")
+("hrgb"	"$(H8V(B")
+("hrhaf"	"$(Gx'$(Ha,a-a5(B")
+("hrhkp"	"$ALr(B")
+("hrhpm"	"$(Grl$(H-TD^[~(B")
+("hrhr"	"$(HEq(B")
+("hrhvp"	"$AsB(B")
+("hrj"	"$A87(B")
+("hrks"	"$(H)5(B")
+("hrlb"	"$(GPu(B")
+("hrlmi"	"$(H@#(B")
+("hrln"	"$A9N$(HLa(B")
+("hrmbc"	"$(HUf(B")
+("hrmlb"	"$(GU:(B")
+("hrmr"	"$(Hf5(B")
+("hrnl"	"$(H-`$A[,(B")
+("hrog"	"$AvC(B")
+("hrok"	"$(GZv(B")
+("hrrj"	"$(Gvz(B")
+("hrtm"	"$ALp(B")
+("hru"	"$(H*&(B")
+("hruc"	"$(HbU(B")
+("hrvp"	"$(H7s(B")
+("hryf"	"$(GVT(B")
+("hs"	"$(GEB$AU'(B")
+("hsb"	"$A<g(B")
+("hsbr"	"$Alg(B")
+("hsbt"	"$A1b(B")
+("hsff"	"$(H;t(B")
+("hshml"	"$AKy(B")
+("hshne"	"$ARs(B")
+("hshr"	"$AsT(B")
+("hsik"	"$Ale(B")
+("hsit"	"$(Gz%(B")
+("hsko"	"$(HR_(B")
+("hslmy"	"$Ali(B")
+("hsly"	"$Asu(B")
+("hsmg"	"$A?p$(HiU(B")
+("hsmr"	"$AsS(B")
+("hsog"	"$A9M(B")
+("hsp"	"$ATu(B")
+("hsqf"	"$(Gqa(B")
+("hsr"	"$AsM(B")
+("hsrau"	"$Alh(B")
+("hsru"	"$(H$((B")
+("hssmm"	"$AIH(B")
+("hsyhs"	"$A7?(B")
+("hsyhv"	"$(H/2(B")
+("hsyj"	"$Alf(B")
+("hsyr"	"$(H*S(B")
+("ht"	"$AI}(B")
+("htbn"	"$A<}(B")
+("htce"	"$At$(B")
+("htcg"	"$(H^;(B")
+("hthaf"	"$(Hnk(B")
+("htkr"	"$Ash(B")
+("htmc"	"$A;~;I(B")
+("htmf"	"$(H2q(B")
+("htng"	"$At,(B")
+("htsj"	"$(H@&(B")
+("htsl"	"$(GL<(B")
+("httb"	"$Ast(B")
+("httwi"	"$(Hl6(B")
+("hubuc"	"$(Gy&(B")
+("hud"	"$At+(B")
+("huff"	"$AL:(B")
+("huhaf"	"$(He)hYk8(B")
+("huhgu"	"$(H0#:D(B")
+("huhuu"	"$Ak%(B")
+("huij"	"$(H0&(B")
+("huije"	"$(G[F(B")
+("huik"	"$A3t(B")
+("huikk"	"$(HL-(B")
+("hulmc"	"$(Hf1(B")
+("humbc"	"$(Gs%(B")
+("humcw"	"$(H0%(B")
+("hunkq"	"$Ak&(B")
+("hunl"	"$(H-_9p(B")
+("huno"	"$(HK-(B")
+("hunwa"	"$(Hef(B")
+("huooo"	"$(H?8(B")
+("hup"	"$AO"m,(B")
+("hutak"	"$(HQ>(B")
+("hutca"	"$Ak+(B")
+("huwml"	"$A1G(B")
+("huwp"	"$(HD((B")
+("huytr"	"$(H=((B")
+("hvbjj"	"$(Hnx(B")
+("hvbu"	"$(HT9(B")
+("hvbuc"	"$(HkF(B")
+("hvbuk"	"$(Hnw(B")
+("hvbuu"	"$(HGB(B")
+("hvbvk"	"$Aw{(B")
+("hvcsh"	"$Aww(B")
+("hve"	"$(H7|(B")
+("hvfi"	"$(HRd(B")
+("hvgdi"	"$(Hhc(B")
+("hvhey"	"$(He4(B")
+("hvhi"	"$AN:(B")
+("hvhqm"	"$(He2(B")
+("hvhu"	"$A65(B")
+("hvhyu"	"$(Hp,(B")
+("hvif"	"$AO5(B")
+("hvik"	"$(Ha?(B")
+("hvikk"	"$(He0(B")
+("hvil"	"$(HpF(B")
+("hvio"	"$A9O(B")
+("hvjck"	"$(Hnv(B")
+("hvlw"	"$Awx(B")
+("hvmmr"	"$Awy(B")
+("hvmr"	"$(He1(B")
+("hvmvn"	"$(HD|(B")
+("hvnkg"	"$(HkG(B")
+("hvno"	"$AW-(B")
+("hvp"	"$AJO(B")
+("hvpr"	"$(He3(B")
+("hvqmb"	"$(Hm?(B")
+("hvr"	"$(H>g(B")
+("hvsav"	"$(G|0(B")
+("hvsl"	"$(H!7(B")
+("hvtxc"	"$(Hp*(B")
+("hvyk"	"$(Ha>(B")
+("hwe"	"$(H7x(B")
+("hwgti"	"$AX:(B")
+("hwhaf"	"$(Hm-p#(B")
+("hwhd"	"$(HL`(B")
+("hwim"	"$(H^1(B")
+("hwjr"	"$(Gj0(B")
+("hwk"	"$AX6(B")
+("hwkk"	"$(GIY(B")
+("hwks"	"$(HI+(B")
+("hwl"	"$(H8!(B")
+("hwlg"	"$(G}&(B")
+("hwli"	"$Asz(B")
+("hwml"	"$Ask(B")
+("hwmvs"	"$(Gem(B")
+("hwnl"	"$A[6(B")
+("hwsmm"	"$A7-(B")
+("hwtj"	"$(H^0(B")
+("hx"	"$A>J(B")
+("hxbc"	"$(Gq{(B")
+("hxbt"	"$AnB(B")
+("hxh"	"$AIm(B")
+("hxhu"	"$(GL#(B")
+("hxjc"	"$(Gua(B")
+("hxlb"	"$(H*4(B")
+("hxle"	"$A[E(B")
+("hxno"	"$Al&(B")
+("hxo"	"$At'(B")
+("hxt"	"$At((B")
+("hxvyv"	"$AJs(B")
+("hxwks"	"$A>K(B")
+("hxyc"	"$(GjX(B")
+("hxyf"	"$At*(B")
+("hyabu"	"$(HS1(B")
+("hyau"	"$(H26(B")
+("hybb"	"$(Hf6(B")
+("hybg"	"$(G}%(B")
+("hybnd"	"$(HFK(B")
+("hybp"	"$(G{l(B")
+("hybs"	"$(HY$(B")
+("hyck"	"$(H>b(B")
+("hycr"	"$A4,(B")
+("hyfb"	"$At9(B")
+("hyfbw"	"$(HfO(B")
+("hyha"	"$A20(B")
+("hyhaf"	"$(Ha/(B")
+("hyhag"	"$(HS3(B")
+("hyhe"	"$At2(B")
+("hyhej"	"$(HFL(B")
+("hyheq"	"$(H?>(B")
+("hyhj"	"$AEq(B")
+("hyhlo"	"$(Hbm(B")
+("hyhm"	"$(H^'(B")
+("hyhn"	"$(H1a(B")
+("hyhne"	"$A0c(B")
+("hyhr"	"$(H^2(B")
+("hyhs"	"$At7$(Hq+(B")
+("hyhsb"	"$(HS4(B")
+("hyhxe"	"$AKR(B")
+("hyjp"	"$A6f(B")
+("hykms"	"$(H??(B")
+("hykpb"	"$(H^_(B")
+("hyl"	"$At1(B")
+("hylw"	"$At6(B")
+("hylwv"	"$(H^](B")
+("hym"	"$At-(B")
+("hymnr"	"$At4(B")
+("hymo"	"$(H^.(B")
+("hyndt"	"$At;(B")
+("hynkg"	"$AM'(B")
+("hynri"	"$(Ho>(B")
+("hyoge"	"$(HpI(B")
+("hyoii"	"$(H8[(B")
+("hyoir"	"$(Gq}(B")
+("hyoj"	"$(HLc(B")
+("hyomd"	"$(HFM(B")
+("hypt"	"$(Hml(B")
+("hyptd"	"$(HS0(B")
+("hypu"	"$(H2ZL^(B")
+("hyr"	"$(H7v(B")
+("hyrb"	"$A8](B")
+("hyrl"	"$(H^8(B")
+("hyrn"	"$(Hq\(B")
+("hyro"	"$(HiV(B")
+("hysd"	"$(HR^(B")
+("hysh"	"$(H(Q(B")
+("hyshu"	"$At:(B")
+("hysit"	"$(Gz0(B")
+("hysk"	"$A4X(B")
+("hysy"	"$(HLW(B")
+("hyt"	"$AsR(B")
+("hytbo"	"$At?(B")
+("hytc"	"$(H?=(B")
+("hytct"	"$(HYc(B")
+("hytgi"	"$(HfN(B")
+("hythu"	"$At<(B")
+("hytqm"	"$(HYb(B")
+("hytwa"	"$At=(B")
+("hyu"	"$At.(B")
+("hyub"	"$A@i(B")
+("hyuce"	"$(HS2(B")
+("hyv"	"$(H,c(B")
+("hywl"	"$(H8Y(B")
+("hywv"	"$(Gq_(B")
+("hyybs"	"$(HYa(B")
+("hyyhn"	"$A:=(B")
+("hyyhs"	"$At3(B")
+("hyyo"	"$(Ho;(B")
+("hyyps"	"$(HfP(B")
+("hyypt"	"$(Hms(B")
+("hyytg"	"$At>(B")
+("hyyvi"	"$AOO(B")
+("hyyx"	"$(Hic(B")
+("i"	"$A8j(B")
+("iaie"	"$(G_#(B")
+("iav"	"$AA<(B")
+("ib"	"$(H!g(B")
+("ibcn"	"$(G_!(B")
+("ibcv"	"$(Hhr(B")
+("ibdi"	"$(H.k(B")
+("ibg"	"$(HB8(B")
+("ibhaf"	"$(Hd{nd(B")
+("ibnl"	"$(GkI$(H38(B")
+("ibpp"	"$AD\(B")
+("icnl"	"$(Hcu(B")
+("icno"	"$(HP=(B")
+("icp"	"$(H*@(B")
+("id"	"$A42(B")
+("idbu"	"$(G_"(B")
+("idfd"	"$ACS(B")
+("idg"	"$(HIF(B")
+("idhd"	"$(HXz(B")
+("idhi"	"$AD'(B")
+("idhq"	"$(HQ{(B")
+("idhqu"	"$Awb(B")
+("idjtc"	"$(Hp$(B")
+("idlmy"	"$ACR(B")
+("idlyf"	"$(Ho5(B")
+("idmr"	"$AD%(B")
+("idoo"	"$(H5.(B")
+("idq"	"$AD&(B")
+("idsje"	"$(Hha(B")
+("idvi"	"$(Gk{(B")
+("idvif"	"$Awc(B")
+("iea"	"$AjF(B")
+("iebt"	"$(H>=(B")
+("iedhe"	"$Aqe(B")
+("ieln"	"$(H3l(B")
+("ieok"	"$A>H(B")
+("ieyhv"	"$AtC(B")
+("ifamh"	"$(HLF(B")
+("ifamo"	"$(HLE(B")
+("ifasm"	"$(HRW(B")
+("ifbbr"	"$(Gi~(B")
+("ifbgr"	"$(HEZ(B")
+("ifbjj"	"$(HLH(B")
+("ifbk"	"$(Gl^(B")
+("ifbm"	"$AWf(B")
+("ifbme"	"$(HLJ(B")
+("ifbuu"	"$(Ga~(B")
+("ifdmq"	"$(HLD(B")
+("iffkc"	"$(HpD(B")
+("ifg"	"$AIg(B")
+("ifgi"	"$Aln(B")
+("ifgni"	"$(GxV(B")
+("ifgrr"	"$Al{(B")
+("ifhaf"	"$(G|.(B")
+("ifhgr"	"$(H>Y(B")
+("ifhjd"	"$(H7a(B")
+("ifhk"	"$(H,Y(B")
+("ifhml"	"$AFm(B")
+("ifhne"	"$(H,X(B")
+("ifhpm"	"$Als(B")
+("ifhqo"	"$(H1O(B")
+("ifhs"	"$Alq(B")
+("ifhuc"	"$(HpE(B")
+("ifhvp"	"$(GRl(B")
+("ifhyu"	"$(HRU(B")
+("ifikk"	"$Alp(B")
+("ifit"	"$(H>V(B")
+("ifjbc"	"$(HRX(B")
+("ifjr"	"$Alo(B")
+("ifkr"	"$(GW*(B")
+("ifl"	"$(H,W(B")
+("iflmo"	"$Alv(B")
+("iflwl"	"$AIq(B")
+("ifmbc"	"$(Hj^(B")
+("ifmfb"	"$(Hf/(B")
+("ifmk"	"$All(B")
+("ifmmv"	"$(H>W(B")
+("ifmr"	"$(H1K(B")
+("ifmrw"	"$A8#(B")
+("ifmtb"	"$(HiN(B")
+("ifmwg"	"$(HLB(B")
+("ifmwj"	"$(H]z(B")
+("ifnhs"	"$(H$r(B")
+("ifnl"	"$AFn$(H@v(B")
+("ifnmu"	"$(H7b(B")
+("ifodi"	"$(H1I(B")
+("ifohv"	"$(H7c(B")
+("ifoll"	"$(H,Z(B")
+("ifoma"	"$(HbK(B")
+("ifomb"	"$(Hme(B")
+("ifomr"	"$(H7d(B")
+("ifp"	"$(GlipU(B")
+("ifpd"	"$(H(B(B")
+("ifph"	"$(GW)(B")
+("ifpi"	"$(H(C(B")
+("ifpou"	"$(HE\(B")
+("ifqhk"	"$Aly(B")
+("ifrhu"	"$AW#(B")
+("ifrrj"	"$(GtS(B")
+("ifru"	"$Alk(B")
+("ifryo"	"$Au>(B")
+("ifshr"	"$(H1N(B")
+("ifsme"	"$(H>X(B")
+("ifsmm"	"$(H7_(B")
+("ifsmr"	"$Alt(B")
+("ifsqf"	"$(HRT(B")
+("iftgf"	"$Alz(B")
+("iftmc"	"$Alw(B")
+("iftmd"	"$(HLC(B")
+("iftq"	"$AOi(B")
+("iftwt"	"$(Gvq(B")
+("ifvii"	"$(H]{(B")
+("ifvne"	"$(GeZ(B")
+("ifvno"	"$(HLI(B")
+("ifwd"	"$(HEY(B")
+("ifwlm"	"$(HXx(B")
+("ifwp"	"$(HLG(B")
+("ifybb"	"$(HL@(B")
+("ifybc"	"$(Gi|(B")
+("ifyhs"	"$(H,V(B")
+("ifylm"	"$Alm(B")
+("ifyoj"	"$(HE[(B")
+("ifyrv"	"$Al|(B")
+("ifyto"	"$(HbJ(B")
+("ig"	"$AW/(B")
+("igb"	"$Ab_(B")
+("igce"	"$(H5+(B")
+("igdi"	"$(H*7(B")
+("ighaf"	"$(G|y(B")
+("igit"	"$(HBc(B")
+("igow"	"$(HVz(B")
+("igp"	"$(Gs\(B")
+("igsk"	"$AbZ(B")
+("igti"	"$(GlZ(B")
+("ih"	"$ANl(B")
+("ihhi"	"$(H_4o&(B")
+("ihhj"	"$AbX(B")
+("ihhqu"	"$(HQ@(B")
+("ihhw"	"$(HBg(B")
+("ihi"	"$AJy$(HBe(B")
+("ihln"	"$(HAn(B")
+("ihm"	"$APg(B")
+("ihml"	"$(H#q(B")
+("ihmr"	"$AOL(B")
+("ihmv"	"$AM~(B")
+("ihpm"	"$A5W(B")
+("ihq"	"$AD2(B")
+("ihs"	"$A3I(B")
+("ihu"	"$ATJ(B")
+("ihxe"	"$(HBf(B")
+("ihxo"	"$AbW(B")
+("ihymf"	"$AF](B")
+("ii"	"$(H&p(B")
+("iib"	"$A@J(B")
+("iibt"	"$(Ge@(B")
+("iiif"	"$(H>y(B")
+("iiih"	"$(GY6(B")
+("iiil"	"$A@H(B")
+("iiln"	"$(H%S(B")
+("iinl"	"$A@I(B")
+("iino"	"$(H/{(B")
+("iiobo"	"$A8/(B")
+("iiuh"	"$(H.z(B")
+("iixp"	"$(HIz(B")
+("ij"	"$AHV(B")
+("ijb"	"$A8&(B")
+("ijc"	"$(GFZ(B")
+("ijcc"	"$ABi(B")
+("ije"	"$AGsbQ(B")
+("ijjb"	"$(Gl[(B")
+("ijkd"	"$(H.w(B")
+("ijwj"	"$(GU;(B")
+("ik"	"$AH.(B")
+("ikbuc"	"$(H@R(B")
+("ikhni"	"$(Hlb(B")
+("ikikk"	"$(H=r(B")
+("ikjwj"	"$(H@o(B")
+("ikk"	"$(H!d(B")
+("iklu"	"$AbV(B")
+("iknf"	"$(GR3(B")
+("ikno"	"$(H6=(B")
+("ikp"	"$(HPQ(B")
+("ikpb"	"$(HI|(B")
+("ikrm"	"$(H.}(B")
+("iku"	"$ASH(B")
+("ikw"	"$A[N(B")
+("ilb"	"$AS9(B")
+("ile"	"$A?5(B")
+("ilil"	"$AV](B")
+("ilmo"	"$(H*:(B")
+("iln"	"$A;.(B")
+("ilo"	"$A8}(B")
+("iloc"	"$(Go4(B")
+("ilr"	"$ALF(B")
+("ilwv"	"$(HJ$(B")
+("imbgr"	"$A5r(B")
+("imbsd"	"$(H.'(B")
+("imc"	"$(H.(./(B")
+("imcw"	"$(H.x(B")
+("imdw"	"$(GTD(B")
+("ime"	"$A1y(B")
+("imgce"	"$AAh(B")
+("imhgu"	"$AY~(B")
+("imig"	"$(H*8(B")
+("imikk"	"$(H#-(B")
+("imir"	"$AR1(B")
+("imjlv"	"$AF`(B")
+("immnn"	"$AY}(B")
+("immp"	"$(HmM(B")
+("immvm"	"$AY|(B")
+("immwg"	"$(H3k(B")
+("imno"	"$A4N(B")
+("imog"	"$AW<(B")
+("imoii"	"$A@d(B")
+("imoir"	"$(H:E(B")
+("imomr"	"$(H%O(B")
+("imp"	"$A;s(B")
+("impko"	"$AD}(B")
+("imqmb"	"$(H.$(B")
+("imsll"	"$Aj0(B")
+("imsqf"	"$(Gc%(B")
+("imsuf"	"$(HVD(B")
+("imtcl"	"$(HI'(B")
+("imue"	"$(Gcn(B")
+("imuog"	"$(HAj(B")
+("imvh"	"$(H#o(B")
+("imwjr"	"$(H.&(B")
+("imywd"	"$(Gl)(B")
+("inbq"	"$Ab](B")
+("ine"	"$AS@(B")
+("infq"	"$(Hhs(B")
+("inin"	"$APr(B")
+("inkg"	"$AM%(B")
+("inli"	"$(HJ!(B")
+("ino"	"$AV.(B")
+("inoe"	"$(GlY(B")
+("io"	"$(H![(B")
+("iobuc"	"$(Gfq(B")
+("iod"	"$AbS$(H/u(B")
+("iodi"	"$A8.(B")
+("iofd"	"$AtR(B")
+("iohaf"	"$(HhG(B")
+("iohd"	"$(H7i(B")
+("ioin"	"$(H#p(B")
+("iok"	"$ARS(B")
+("ioma"	"$(HV}(B")
+("iomvn"	"$A4I(B")
+("ioog"	"$AWy(B")
+("iooiv"	"$(HUh(B")
+("iop"	"$Am'(B")
+("ior"	"$AWI(B")
+("iord"	"$(HCk(B")
+("iotf"	"$(HP>(B")
+("iov"	"$AWK(B")
+("ip"	"$A_.bO(B")
+("ipbm"	"$(H\<(B")
+("ipbuc"	"$(H3&(B")
+("ipc"	"$Awi(B")
+("ipf"	"$AP\$(HV;(B")
+("ipfd"	"$Awg(B")
+("ipfdq"	"$Awk(B")
+("ipg"	"$(Gh8(B")
+("iphaf"	"$(Gky(B")
+("iphd"	"$Awe(B")
+("iphhi"	"$Awj(B")
+("iphn"	"$Awd(B")
+("iphor"	"$(Hh_(B")
+("iphxu"	"$(Hh`(B")
+("ipihr"	"$(Hk?(B")
+("ipipp"	"$(HrA(B")
+("iplmi"	"$(HZ<(B")
+("ipm"	"$AJ=(B")
+("ipmc"	"$(HI}(B")
+("ipmmc"	"$(Gb3(B")
+("ipmmv"	"$(He*(B")
+("ipmwd"	"$(Hm8(B")
+("ipmwm"	"$(Hpv(B")
+("ipnl"	"$(HNQ(B")
+("ipnsj"	"$(Hk@(B")
+("ipog"	"$(H:0(B")
+("ipp"	"$A1S$(Ghh$A_/$(HHt(B")
+("ipru"	"$AbR(B")
+("iprvk"	"$(He+(B")
+("iprye"	"$(HkA(B")
+("iptmc"	"$Awh(B")
+("ipu"	"$(H#n(B")
+("ipyg"	"$Awf(B")
+("ipyiu"	"$(Ha8(B")
+("ipyx"	"$(HqR(B")
+("iqhaf"	"$(Ha0(B")
+("iqhf"	"$(HP;(B")
+("iqje"	"$(H.y(B")
+("ir"	"$AL((B")
+("ird"	"$(H+8(B")
+("irf"	"$AlF(B")
+("irhaf"	"$(Hm!(B")
+("irm"	"$A;r(B")
+("irmbc"	"$(HdS(B")
+("irmvn"	"$(H1"(B")
+("irnbg"	"$(HZK(B")
+("irnl"	"$A["(B")
+("irp"	"$A5!8P(B")
+("isbt"	"$AJ"(B")
+("isgp"	"$(G}"(B")
+("isja"	"$(HI~(B")
+("ismh"	"$AAN(B")
+("isnl"	"$(H-[(B")
+("isok"	"$A7s(B")
+("isrj"	"$(HV{(B")
+("it"	"$A[M=d(B")
+("ita"	"$(H5,(B")
+("itcl"	"$(Gl\(B")
+("ite"	"$A6H(B")
+("itf"	"$AJ|(B")
+("ithaf"	"$(H\6(B")
+("itlb"	"$AO/(B")
+("itlm"	"$Ab[(B")
+("itmc"	"$(Gl](B")
+("itq"	"$AbT(B")
+("itso"	"$AbU(B")
+("itt"	"$(H*6(B")
+("itxc"	"$AA.(B")
+("iuhhh"	"$(H#^(B")
+("iv"	"$(H!](B")
+("ivug"	"$(HkY(B")
+("iwcg"	"$Ab\(B")
+("iwtc"	"$(HJ"(B")
+("ixe"	"$(Glc(B")
+("ixf"	"$(HBd(B")
+("ixp"	"$AB9(B")
+("iybp"	"$(Gx2(B")
+("iydl"	"$A@*(B")
+("iyln"	"$(HkP(B")
+("iymp"	"$(H*9(B")
+("iypt"	"$(Gx3(B")
+("iyr"	"$A5j(B")
+("iywd"	"$(HVy(B")
+("j"	"$AJ.(B")
+("jaf"	"$AVs(B")
+("jamo"	"$(H;7(B")
+("janl"	"$A6<(B")
+("jasmm"	"$Atc(B")
+("jav"	"$AQg(B")
+("jb"	"$(H!=(B")
+("jbd"	"$(H4u(B")
+("jbhaf"	"$(Hk=(B")
+("jbhod"	"$(He^(B")
+("jblli"	"$(Hc7(B")
+("jbm"	"$ARK(B")
+("jbmc"	"$AUf(B")
+("jbmm"	"$AV1(B")
+("jbmrd"	"$AiR(B")
+("jbmri"	"$As<(B")
+("jbnd"	"$AXC(B")
+("jbof"	"$A2l(B")
+("jbrrv"	"$ADR(B")
+("jbtj"	"$ADO(B")
+("jbvif"	"$AKw(B")
+("jbwno"	"$(HL!(B")
+("jc"	"$AQ((B")
+("jcbbr"	"$(Gj$(B")
+("jcbu"	"$(H1[(B")
+("jcegg"	"$(Gj#$(HK8(B")
+("jcemd"	"$(H7k(B")
+("jcfdj"	"$(HR[(B")
+("jcgfo"	"$(H^$(B")
+("jcgg"	"$(H7m(B")
+("jcgwc"	"$(Gz"(B")
+("jchaf"	"$(HX~m&(B")
+("jchdb"	"$(G|=(B")
+("jchdp"	"$(HX}(B")
+("jchgr"	"$A=Q(B")
+("jchhl"	"$(H1](B")
+("jchhn"	"$(Gn,(B")
+("jchio"	"$Aq9(B")
+("jchk"	"$(H,a(B")
+("jchoo"	"$AqA(B")
+("jchs"	"$AU-(B")
+("jchsk"	"$(Gvv(B")
+("jchuu"	"$(H^&(B")
+("jchvo"	"$(H1^(B")
+("jchwk"	"$A40(B")
+("jchxv"	"$(Gvu(B")
+("jci"	"$(HPS(B")
+("jcik"	"$AM;(B")
+("jcirm"	"$(HEh(B")
+("jcjbc"	"$(HR\(B")
+("jcjkd"	"$(H>_(B")
+("jckn"	"$A>?(B")
+("jclb"	"$AA1(B")
+("jclmo"	"$Aq;(B")
+("jclwv"	"$(HX|(B")
+("jcm"	"$A?U(B")
+("jcmbc"	"$(GyM(B")
+("jcmd"	"$(H(F(B")
+("jcmig"	"$AVO(B")
+("jcmmu"	"$(H^%(B")
+("jcmob"	"$(H1Z(B")
+("jcmvh"	"$A4)(B")
+("jcn"	"$Aq7$(H"h(B")
+("jcnhx"	"$(HEi(B")
+("jcni"	"$Aq6(B")
+("jcnlm"	"$AA~(B")
+("jcno"	"$(HWi(B")
+("jcold"	"$(HY!(B")
+("jcomn"	"$Aq>(B")
+("jcor"	"$AH](B")
+("jcpru"	"$(H1_(B")
+("jcpu"	"$Aq8(B")
+("jcqhk"	"$(HLR(B")
+("jcqou"	"$(Gq](B")
+("jcsjl"	"$(HY"(B")
+("jcskr"	"$A>=(B")
+("jcsmm"	"$(Hbg(B")
+("jcsuu"	"$A?_(B")
+("jctgf"	"$(Gn+(B")
+("jcuu"	"$(H1\(B")
+("jcvis"	"$Aq:(B")
+("jcwd"	"$Aq=(B")
+("jcyck"	"$(H7l(B")
+("jcyoj"	"$(HEg(B")
+("jcyta"	"$Aq?(B")
+("jd"	"$AN4KN(B")
+("jdhaf"	"$(Hdz(B")
+("jdi"	"$AJX(B")
+("jdks"	"$A2*(B")
+("jdnl"	"$(H3:(B")
+("jdok"	"$A=L(B")
+("je"	"$AV'(B")
+("jed"	"$(H],(B")
+("jeg"	"$A[T(B")
+("jehaf"	"$(HV3(B")
+("jejwj"	"$(Hj-(B")
+("jelmi"	"$(Hfq(B")
+("jembc"	"$(HHe(B")
+("jeoju"	"$(HfD(B")
+("jeq"	"$(Gsd(B")
+("jese"	"$(HBN(B")
+("jesmi"	"$(HW:(B")
+("jesmm"	"$A3a(B")
+("jevif"	"$(Gx_(B")
+("jfb"	"$AO|(B")
+("jhdw"	"$(GlP(B")
+("jher"	"$A?M(B")
+("jhk"	"$(H#\(B")
+("jhoo"	"$(HBP(B")
+("jhp"	"$AU,(B")
+("jhq"	"$A@N(B")
+("jhqu"	"$(H#](B")
+("jhxf"	"$(GlQ(B")
+("jibi"	"$A2)(B")
+("jid"	"$ATT(B")
+("jidi"	"$(GYq(B")
+("jihaf"	"$(Hne(B")
+("jihs"	"$(H.j(B")
+("jijwj"	"$(Gg%(B")
+("jikf"	"$(H;4(B")
+("jilmi"	"$(H?x(B")
+("jiln"	"$(HAl(B")
+("jimcw"	"$(HBy(B")
+("jimig"	"$(H?9(B")
+("jinl"	"$(HNT(B")
+("jiobo"	"$(H?-(B")
+("jiog"	"$A=X(B")
+("jip"	"$A;](B")
+("jir"	"$ATU(B")
+("jiwtc"	"$A4w(B")
+("jiyhv"	"$A2C(B")
+("jj"	"$A^C(B")
+("jjapp"	"$(GoJ(B")
+("jjapv"	"$(HZw(B")
+("jjb"	"$A3/(B")
+("jjbb"	"$(HTt(B")
+("jjbc"	"$(HBO(B")
+("jjbgr"	"$(HTu(B")
+("jjbtv"	"$(GoI(B")
+("jjcor"	"$(HNO(B")
+("jjdmq"	"$(Gv'(B")
+("jjeee"	"$(GoD(B")
+("jjfb"	"$(HNN(B")
+("jjfdq"	"$(Gy.(B")
+("jjgce"	"$(HTq(B")
+("jjgow"	"$(Hj)(B")
+("jjgrv"	"$(Gu`(B")
+("jjhby"	"$(HH"(B")
+("jjhdw"	"$(HgF(B")
+("jjher"	"$(HG~(B")
+("jjhg"	"$(H9c(B")
+("jjhju"	"$(HZ{(B")
+("jjhkb"	"$(Gy/(B")
+("jjhml"	"$(GZ}(B")
+("jjhne"	"$(H9b(B")
+("jjhni"	"$(H3-(B")
+("jjhpm"	"$(H@j(B")
+("jjhqo"	"$(GbJ(B")
+("jjhqu"	"$(H9_(B")
+("jjhsn"	"$(H@l(B")
+("jjhvo"	"$(H@n(B")
+("jjhvp"	"$(H9`(B")
+("jjhxu"	"$(HTv(B")
+("jji"	"$Aj*(B")
+("jjii"	"$(HTr(B")
+("jjijb"	"$(Gk:(B")
+("jjikk"	"$(H@c(B")
+("jjipm"	"$(Gg&(B")
+("jjir"	"$(H@q(B")
+("jjirp"	"$(Hj*(B")
+("jjixp"	"$(Hcp(B")
+("jjjii"	"$(GwK(B")
+("jjjjj"	"$(G{2(B")
+("jjjmu"	"$(HNL(B")
+("jjjqr"	"$(Gu](B")
+("jjjtc"	"$(HgB(B")
+("jjk"	"$(H3,(B")
+("jjkcf"	"$(HgC(B")
+("jjkn"	"$(GS\(B")
+("jjlbk"	"$(H@g(B")
+("jjlo"	"$(H4t(B")
+("jjlw"	"$(GbI(B")
+("jjmbl"	"$(HG}(B")
+("jjmdm"	"$(HoV(B")
+("jjmfj"	"$(H@b(B")
+("jjmig"	"$(Gg'(B")
+("jjmj"	"$(GXF(B")
+("jjmlb"	"$(GoC(B")
+("jjmnr"	"$(GbH(B")
+("jjmrw"	"$(GrQ(B")
+("jjmsu"	"$(G]S(B")
+("jjmu"	"$(GXH(B")
+("jjmvm"	"$(Gk<(B")
+("jjnau"	"$(Gk=(B")
+("jjnhd"	"$(HZv(B")
+("jjno"	"$(G]T(B")
+("jjoae"	"$(HZy(B")
+("jjob"	"$(H9a(B")
+("jjod"	"$(Gi6(B")
+("jjodi"	"$(H@i(B")
+("jjohf"	"$(Hm'(B")
+("jjohh"	"$(H@m(B")
+("jjoii"	"$(H@k(B")
+("jjoin"	"$(H9d(B")
+("jjoli"	"$(HZ-(B")
+("jjomb"	"$(GoG(B")
+("jjomg"	"$(HH!(B")
+("jjomj"	"$(Gcl(B")
+("jjomn"	"$(GrS(B")
+("jjon"	"$AG,(B")
+("jjoog"	"$(Hd<(B")
+("jjosm"	"$A:2(B")
+("jjoyj"	"$ANS(B")
+("jjpr"	"$(H@h(B")
+("jjpu"	"$(H9^(B")
+("jjpyr"	"$(HZz(B")
+("jjqkd"	"$(H_l(B")
+("jjqkk"	"$(GrT(B")
+("jjqmb"	"$(HTp(B")
+("jjrc"	"$(H@e(B")
+("jjrhu"	"$(H@f(B")
+("jjrsj"	"$(GrR(B")
+("jjshi"	"$(GXG(B")
+("jjshr"	"$(H@d(B")
+("jjsit"	"$(HlF(B")
+("jjsju"	"$(Gk;(B")
+("jjskr"	"$(HNM(B")
+("jjsmh"	"$(Hcq(B")
+("jjsnd"	"$(HgD(B")
+("jjstv"	"$(Gu^(B")
+("jjtav"	"$(Hj+(B")
+("jjtc"	"$(HG|(B")
+("jjtco"	"$(HgE(B")
+("jjtcw"	"$(HZu(B")
+("jjtgi"	"$(Hj(lG(B")
+("jjtt"	"$(HG{(B")
+("jju"	"$(GOQ(B")
+("jjumb"	"$(HZx(B")
+("jjvid"	"$(Hn4(B")
+("jjvvd"	"$(Hcr(B")
+("jjvvw"	"$(GoH(B")
+("jjwd"	"$(HTs(B")
+("jjwlv"	"$(Hj,(B")
+("jjwot"	"$(H_m(B")
+("jjwww"	"$(Hn3(B")
+("jjybk"	"$(GwL(B")
+("jjyck"	"$(Gg$(B")
+("jjyg"	"$(H@p(B")
+("jjyjj"	"$(Hcs(B")
+("jjypt"	"$(HoU(B")
+("jjyrf"	"$(HTo(B")
+("jjyvo"	"$(HGz(B")
+("jk"	"$AUI(B")
+("jka"	"$AU_(B")
+("jkb"	"$Ae6(B")
+("jkcf"	"$Ae<(B")
+("jkhaf"	"$(Hk'(B")
+("jki"	"$A:j(B")
+("jkmdo"	"$(HeS(B")
+("jkme"	"$(HQC(B")
+("jkmhq"	"$(Gmc(B")
+("jkmhu"	"$(HQA(B")
+("jkmnd"	"$(HId(B")
+("jkmr"	"$A<D(B")
+("jkmsh"	"$(HAk(B")
+("jkmv"	"$AfK(B")
+("jkmwg"	"$(GwR(B")
+("jkn"	"$Ae3(B")
+("jknd"	"$AP"(B")
+("jkp"	"$A@O(B")
+("jkpr"	"$(H,r(B")
+("jkss"	"$(GL6(B")
+("jkys"	"$A?<(B")
+("jla"	"$(Gm2(B")
+("jlc"	"$(GyB(B")
+("jld"	"$(HQ'(B")
+("jlg"	"$(Gh=(B")
+("jlk"	"$A@t(B")
+("jlln"	"$AJB(B")
+("jlmo"	"$(H)x(B")
+("jlmr"	"$(HXr(B")
+("jlryo"	"$(Hco(B")
+("jlv"	"$AF^(B")
+("jlw"	"$AVf(B")
+("jlwv"	"$(HIe(B")
+("jlyo"	"$(H(5(B")
+("jm"	"$AJ?(B")
+("jmam"	"$AP{(B")
+("jmc"	"$(Hn9(B")
+("jmch"	"$A9Q(B")
+("jmd"	"$ASn(B")
+("jmhc"	"$(Gk3(B")
+("jmig"	"$AJR(B")
+("jmjmm"	"$A4#(B")
+("jmlc"	"$ARz(B")
+("jmmc"	"$(HTT(B")
+("jmmf"	"$AWZ(B")
+("jmmu"	"$AMj(B")
+("jmmv"	"$Ae7(B")
+("jmn"	"$AD~(B")
+("jmr"	"$Ae4(B")
+("jmrw"	"$A8;(B")
+("jmso"	"$A<R(B")
+("jmuc"	"$(Gyj(B")
+("jmue"	"$A?\(B")
+("jmyo"	"$A6((B")
+("jnd"	"$AWV(B")
+("jngi"	"$(H\>(B")
+("jnhaf"	"$(HqL(B")
+("jnihq"	"$(Ha9(B")
+("jniu"	"$AMp(B")
+("jnln"	"$(H.*(B")
+("jnmwl"	"$(Gz\(B")
+("jnon"	"$(HOM(B")
+("jnpfd"	"$Atp(B")
+("jnpru"	"$(H\?(B")
+("jnqo"	"$(Gp+(B")
+("jnujt"	"$(Hr9(B")
+("jnup"	"$(H;^(B")
+("jnyub"	"$(Hnt(B")
+("jogs"	"$(HVg(B")
+("joma"	"$AK^(B")
+("jombc"	"$(H`Q(B")
+("joni"	"$(G^'(B")
+("jose"	"$(H;8(B")
+("jp"	"$AK|(B")
+("jpa"	"$AjH(B")
+("jpbn"	"$(GhO(B")
+("jpbq"	"$Ae8(B")
+("jpbt"	"$(H;5(B")
+("jph"	"$Ae5(B")
+("jphi"	"$AC[(B")
+("jphqu"	"$Ak#(B")
+("jphu"	"$AC\(B")
+("jpko"	"$(H\e(B")
+("jpmig"	"$Aqs(B")
+("jqmp"	"$(GpT(B")
+("jqmr"	"$A:&(B")
+("jr"	"$A9E(B")
+("jrb"	"$A:z(B")
+("jrbhf"	"$(Hk,(B")
+("jrcor"	"$A;m(B")
+("jrhaf"	"$(Gs7$(Hl~(B")
+("jrhne"	"$(HK2(B")
+("jrhr"	"$(GU'(B")
+("jrhu"	"$A?K(B")
+("jrln"	"$A8n(B")
+("jrlr"	"$A9Y(B")
+("jrmbc"	"$(Gwl(B")
+("jrok"	"$A9J(B")
+("jrrp"	"$(H;](B")
+("jrrye"	"$AXE(B")
+("jrytj"	"$A9<(B")
+("jskr"	"$(H.i(B")
+("jsll"	"$A;B$(H.h(B")
+("jsmh"	"$AAH(B")
+("jt"	"$A;\(B")
+("jtak"	"$AD/(B")
+("jtbc"	"$(Gb5(B")
+("jtbi"	"$(GlO(B")
+("jtcc"	"$(GuT(B")
+("jtcd"	"$AU/(B")
+("jtcf"	"$(GzU$(Hm1(B")
+("jtcg"	"$AH{(B")
+("jtco"	"$Ae?(B")
+("jtcq"	"$Ae:(B")
+("jtcr"	"$Ae@(B")
+("jtcu"	"$(H;6(B")
+("jtcv"	"$Ae=(B")
+("jtcy"	"$A:.(B")
+("jtge"	"$(He/(B")
+("ju"	"$AF_(B")
+("juhaf"	"$(HhE(B")
+("jujru"	"$A>$(B")
+("juks"	"$(H)4(B")
+("juln"	"$(GP+$AX`(B")
+("jv"	"$A02(B")
+("jvd"	"$A08(B")
+("jvhaf"	"$(Ha$hI(B")
+("jvmb"	"$(H;:(B")
+("jvmbc"	"$(HU_(B")
+("jvmd"	"$ACB$(H\d(B")
+("jvme"	"$(GhT(B")
+("jvmr"	"$Ae;$(HIf(B")
+("jvnl"	"$(H9l(B")
+("jwbuu"	"$(Hn#(B")
+("jwj"	"$(GKO(B")
+("jwjc"	"$(GhR(B")
+("jwlb"	"$AT"(B")
+("jwlv"	"$Ae>(B")
+("jybc"	"$(H;9(B")
+("jybp"	"$(Gx1(B")
+("jyfe"	"$A<E(B")
+("jytj"	"$ATW(B")
+("k"	"$A4s$(H!!(B")
+("kam"	"$Apc(B")
+("kamh"	"$(Gil(B")
+("kanb"	"$(H]c(B")
+("karrj"	"$(Ho#(B")
+("kau"	"$A0L(B")
+("kav"	"$A:[(B")
+("kb"	"$ASP$(H!.(B")
+("kbb"	"$(HE8(B")
+("kbbr"	"$(HL&(B")
+("kbcv"	"$(Hmb(B")
+("kbhaf"	"$(He$(B")
+("kbhne"	"$(H='(B")
+("kbhqu"	"$(HD$(B")
+("kbirm"	"$(HJ?(B")
+("kbm"	"$A>R(B")
+("kbmr"	"$(H7E(B")
+("kbmvn"	"$(H>/(B")
+("kbnl"	"$ASt[-$(H9t(B")
+("kbno"	"$Al$(B")
+("kbof"	"$Aq)(B")
+("kcano"	"$(H`@(B")
+("kchne"	"$(G[D(B")
+("kcipm"	"$(Gco(B")
+("kcln"	"$(GP&(B")
+("kdd"	"$(Ge?(B")
+("kdhe"	"$AF#(B")
+("kdlc"	"$(Gzy(B")
+("kdln"	"$Apx(B")
+("ke"	"$ASQ(B")
+("kefh"	"$App(B")
+("keii"	"$Ap~(B")
+("kell"	"$(HIQ(B")
+("kf"	"$A;R$(GRR(B")
+("kfb"	"$(H>8(B")
+("kfbt"	"$A?x(B")
+("kfcb"	"$Aq$(B")
+("kff"	"$AL5(B")
+("kffs"	"$(GtB(B")
+("kfhaf"	"$(Hoq(B")
+("kfp"	"$(H56(B")
+("kgdi"	"$AVL(B")
+("kgg"	"$A?|(B")
+("kghaf"	"$(He'(B")
+("kgp"	"$Apk(B")
+("khaa"	"$A2~(B")
+("khahm"	"$API(B")
+("khal"	"$(Hb8(B")
+("kham"	"$(H(%(B")
+("khapp"	"$(H7((B")
+("khapv"	"$(H=x(B")
+("khav"	"$A:](B")
+("khawe"	"$(HKs(B")
+("khbbb"	"$A;+(B")
+("khbbr"	"$(H=w(B")
+("khbm"	"$A>Q(B")
+("khbmr"	"$(H,%(B")
+("khbn"	"$(HE4(B")
+("khbou"	"$(HDh(B")
+("khbsd"	"$(G[z(B")
+("khbtt"	"$(H,&(B")
+("khbuc"	"$(GVY(B")
+("khbue"	"$(Ho8(B")
+("khdc"	"$(Hkm(B")
+("khdd"	"$(HE9(B")
+("khdlc"	"$(GxL(B")
+("khdn"	"$AA!(B")
+("khdv"	"$Apt(B")
+("khefh"	"$(H0d(B")
+("khey"	"$AL[(B")
+("khf"	"$A5R(B")
+("khfbk"	"$(HR((B")
+("khggu"	"$(HR"(B")
+("khgr"	"$(H,!(B")
+("khgrv"	"$AT3(B")
+("khhbn"	"$(H7)(B")
+("khhdn"	"$Aa{(B")
+("khhg"	"$(H$g(B")
+("khhgf"	"$Ab4(B")
+("khhhj"	"$(H7+(B")
+("khhj"	"$(Ge<(B")
+("khhkb"	"$(HR)(B")
+("khhl"	"$(H&$(B")
+("khhni"	"$(H=z(B")
+("khhqm"	"$(H(&(B")
+("khhrb"	"$(Ge((B")
+("khhsb"	"$(H7-=|(B")
+("khhsk"	"$(HXK(B")
+("khhvo"	"$A:|(B")
+("khhw"	"$AAv(B")
+("khhxe"	"$Ajy(B")
+("khhxf"	"$(HR&(B")
+("khhxu"	"$Ab%(B")
+("khi"	"$(HR<(B")
+("khiav"	"$A@G(B")
+("khibi"	"$(HDe(B")
+("khice"	"$Ab!(B")
+("khihu"	"$Aaq(B")
+("khij"	"$Aau(B")
+("khio"	"$(H1-(B")
+("khitc"	"$(Gvd(B")
+("khiv"	"$(H'~(B")
+("khjc"	"$(H'|(B")
+("khjdi"	"$Aaw(B")
+("khjjl"	"$(HKr(B")
+("khjkp"	"$(H,#(B")
+("khjpn"	"$(Gt<(B")
+("khjr"	"$(H("(B")
+("khjrb"	"$Ab)(B")
+("khkcf"	"$Ab2(B")
+("khkkb"	"$(H0h(B")
+("khkmr"	"$Ab"(B")
+("khkn"	"$Aal(B")
+("khkoo"	"$(GVX(B")
+("khl"	"$(H$d(B")
+("khlln"	"$Aat(B")
+("khlmo"	"$(H,'(B")
+("khmam"	"$(H,$(B")
+("khmbb"	"$(H]O(B")
+("khmbe"	"$(Hb,(B")
+("khmce"	"$(Hm](B")
+("khmfb"	"$(H]P(B")
+("khmfm"	"$(H(!(B")
+("khmg"	"$A?q(B")
+("khmhf"	"$(HDf(B")
+("khmj"	"$Aam(B")
+("khmmf"	"$(H'}(B")
+("khmto"	"$Ab1(B")
+("khmvh"	"$(H$b(B")
+("khnbq"	"$Ab3(B")
+("khndf"	"$(HDg(B")
+("khndt"	"$ACM(B")
+("khne"	"$AR_(B")
+("khng"	"$Aap(B")
+("khngu"	"$(H.q(B")
+("khnhb"	"$(HR$(B")
+("khnhd"	"$Ab.(B")
+("khni"	"$(Gim(B")
+("khnkm"	"$(H7,(B")
+("khnmb"	"$(Hi=(B")
+("khoii"	"$(H('(B")
+("khoir"	"$(HDj(B")
+("khok"	"$(Gy{$(Hb;(B")
+("khoma"	"$(HXM(B")
+("khomd"	"$Aa|(B")
+("khomo"	"$(HXL(B")
+("khomr"	"$Ab&(B")
+("khon"	"$(H"d(B")
+("khonk"	"$A:o(B")
+("khoo"	"$(HX^(B")
+("khpa"	"$(HE6(B")
+("khppg"	"$Aay(B")
+("khpr"	"$A97(B")
+("khqhk"	"$(H=s(B")
+("khqhl"	"$(H0g(B")
+("khqkd"	"$(HDk(B")
+("khqmb"	"$A2B(B")
+("khrb"	"$Aaz(B")
+("khrrk"	"$(Ho7(B")
+("khrye"	"$(H=v(B")
+("khs"	"$Apd(B")
+("khsp"	"$(H($(B")
+("khsu"	"$A78(B")
+("khtav"	"$(HXH(B")
+("khtco"	"$(HR%(B")
+("khtcw"	"$(G`Y(B")
+("khtjl"	"$(Ho6(B")
+("khtmc"	"$(HR'(B")
+("khtoe"	"$(Gt=(B")
+("khtrg"	"$Ab5(B")
+("khub"	"$(GxR(B")
+("khuce"	"$(H={(B")
+("khup"	"$(HR;(B")
+("khvno"	"$(H=y(B")
+("khvp"	"$(H,>(B")
+("khvvv"	"$(Gve(B")
+("khwd"	"$Ab#(B")
+("khwg"	"$A@j(B")
+("khwl"	"$Aar(B")
+("khwlg"	"$(G{f(B")
+("khwli"	"$(GqA(B")
+("khwlv"	"$(HXI(B")
+("khwmv"	"$Ab+(B")
+("khxe"	"$AJ](B")
+("khxo"	"$Apu(B")
+("khxv"	"$(Hb9(B")
+("khyck"	"$A=F(B")
+("khye"	"$Aq#(B")
+("khyhn"	"$(H$f(B")
+("khymh"	"$(HXG(B")
+("khymr"	"$Aa~(B")
+("khyoj"	"$Ab'(B")
+("khypu"	"$(H7'(B")
+("khyrk"	"$(Gib(B")
+("khyrv"	"$(Hi<(B")
+("khytg"	"$(HR!(B")
+("khytj"	"$Ab/(B")
+("khytu"	"$Ab0(B")
+("khyy"	"$(H$a(B")
+("ki"	"$AL+(B")
+("kice"	"$(G`s(B")
+("kijb"	"$(H>5(B")
+("kiku"	"$Ap`(B")
+("kiog"	"$AP[(B")
+("kismm"	"$(H2'(B")
+("kiuh"	"$(H>7(B")
+("kiv"	"$(H"2(B")
+("kjbc"	"$(HR>(B")
+("kjcc"	"$(Ge:|b(B")
+("kjka"	"$AI]$(HE%E.(B")
+("kjkd"	"$(H>4(B")
+("kjrr"	"$(HE$E-(B")
+("kjt"	"$A1<(B")
+("kk"	"$AX3(B")
+("kkb"	"$AkH$(H7C(B")
+("kkcf"	"$(GtC(B")
+("kkhaf"	"$(HnfqQ(B")
+("kkkk"	"$AK,(B")
+("kklb"	"$AO#(B")
+("kklu"	"$(HE'E0(B")
+("kkn"	"$Apj(B")
+("kkog"	"$(HR8(B")
+("kkop"	"$(HXY(B")
+("kkrb"	"$AH3(B")
+("kks"	"$A:;(B")
+("kksr"	"$Aph(B")
+("klb"	"$A2<(B")
+("klg"	"$ATZ(B")
+("klll"	"$A^E(B")
+("klln"	"$(H1+(B")
+("klmi"	"$(H7D(B")
+("klmy"	"$Apr(B")
+("kln"	"$AXW(B")
+("klnd"	"$A4f(B")
+("klwu"	"$AQY(B")
+("km"	"$AWs$(H(6(B")
+("kmaa"	"$(GlG(B")
+("kmbw"	"$(Hb<(B")
+("kmfr"	"$AF&(B")
+("kmmf"	"$ADN(B")
+("kmmr"	"$Apm(B")
+("kmms"	"$A?d(B")
+("kmn"	"$Ap[(B")
+("kmnr"	"$AFf(B")
+("kmob"	"$A2!(B")
+("kmrt"	"$A6;(B")
+("kmso"	"$Aj3pq(B")
+("kmvm"	"$(G`p(B")
+("kmwf"	"$Aq&(B")
+("kmym"	"$AV"(B")
+("kn"	"$A>ERD(B")
+("kna"	"$APqj8(B")
+("knbk"	"$(Gio(B")
+("kncr"	"$(Hb=(B")
+("knfq"	"$(G{j(B")
+("knhaf"	"$(Ggm(B")
+("kni"	"$AMh$(H!8(B")
+("knib"	"$AM4(B")
+("knin"	"$(H)b7F(B")
+("knlm"	"$Aq*(B")
+("knlp"	"$(G{i(B")
+("knlr"	"$(HE1(B")
+("knmbc"	"$(H:2(B")
+("kno"	"$A>N(B")
+("knoe"	"$(H]a(B")
+("knthu"	"$AX8(B")
+("knymr"	"$(H-Q(B")
+("knypu"	"$(H2Y(B")
+("kog"	"$(HE:(B")
+("kogi"	"$(GhD(B")
+("kogw"	"$(GpM(B")
+("kohaf"	"$(Hd|(B")
+("kohh"	"$AUn(B")
+("koir"	"$(Gmq(B")
+("kok"	"$A<2(B")
+("kokr"	"$A3U(B")
+("koll"	"$A=j(B")
+("koma"	"$(Hb:(B")
+("kombc"	"$(Gr~(B")
+("komg"	"$AH,(B")
+("komn"	"$(Gin(B")
+("komp"	"$(Gvk(B")
+("kon"	"$A8m(B")
+("konk"	"$Apz(B")
+("konl"	"$(H3;(B")
+("koo"	"$(GIh(B")
+("koog"	"$Apn(B")
+("kowy"	"$(H>:(B")
+("kp"	"$(H$p(B")
+("kpblb"	"$(GZ'(B")
+("kpko"	"$(GxS(B")
+("kpp"	"$(H,?(B")
+("kpr"	"$(H1*(B")
+("kpt"	"$(H1,(B")
+("kqhk"	"$(HL#(B")
+("kqhp"	"$Aq!(B")
+("kr"	"$ASR(B")
+("krbuc"	"$(Gb7(B")
+("krc"	"$(H1((B")
+("krd"	"$A<\(B")
+("krhaf"	"$(H\8hL(B")
+("krhqu"	"$(H+L(B")
+("krje"	"$(H<7(B")
+("krln"	"$AX^(B")
+("krmnr"	"$A[A(B")
+("krno"	"$Al%(B")
+("krrj"	"$(H]b(B")
+("krru"	"$A0)(B")
+("krsqf"	"$(Go{(B")
+("krye"	"$(H<8$Ap}(B")
+("kryhv"	"$AtB(B")
+("ks"	"$AA&(B")
+("ksce"	"$Aq0(B")
+("kshaf"	"$(Ha((B")
+("kshvf"	"$(HF*(B")
+("kshvo"	"$Ap-(B")
+("ksj"	"$A^G(B")
+("ksksb"	"$(GW](B")
+("kskss"	"$(H!~(B")
+("ksksv"	"$(H)w(B")
+("ksln"	"$AXZ(B")
+("ksmb"	"$(GqL(B")
+("ksmh"	"$Aq,(B")
+("ksmi"	"$ALW(B")
+("kspru"	"$A^K(B")
+("ksr"	"$A<S(B")
+("ksrj"	"$Aq1(B")
+("ksrr"	"$(GhE(B")
+("kswp"	"$A[D(B")
+("ktak"	"$Aq"(B")
+("ktbc"	"$(HE7(B")
+("ktjr"	"$(HL((B")
+("ktlm"	"$(HXZ(B")
+("ktm"	"$Apa(B")
+("ktog"	"$(G|a(B")
+("ktor"	"$A4q(B")
+("ktov"	"$(Gyz(B")
+("ktq"	"$(H,p$AQw(B")
+("ktqm"	"$Ap{(B")
+("ktuo"	"$(HR=(B")
+("ktwb"	"$(Gvj(B")
+("ku"	"$A^Lp^(B")
+("kubbb"	"$(HBR(B")
+("kuhaf"	"$(Gy[(B")
+("kuhjg"	"$(H;<(B")
+("kumg"	"$(H#_(B")
+("kuoll"	"$A^N(B")
+("kupi"	"$A^M(B")
+("kusit"	"$(GsS(B")
+("kvfb"	"$(Hr:(B")
+("kvug"	"$(Ho9(B")
+("kwjr"	"$Aps(B")
+("kwle"	"$(HR:(B")
+("kwml"	"$A1T(B")
+("kwot"	"$ANA(B")
+("kwr"	"$(H7G(B")
+("kwvf"	"$Aq'(B")
+("kyg"	"$Apf(B")
+("kymp"	"$A4C(B")
+("kyoj"	"$A4a(B")
+("kypm"	"$(Gik(B")
+("kyr"	"$(H1'(B")
+("kysk"	"$(HXW(B")
+("kysy"	"$Apv(B")
+("kyta"	"$(HL"(B")
+("kytj"	"$AUN(B")
+("kyvo"	"$(H7A(B")
+("kyx"	"$(Hf$(B")
+("l"	"$AVP(B")
+("la"	"$(H2t(B")
+("laa"	"$(HN$(B")
+("lam"	"$AL;(B")
+("lamo"	"$(HT2(B")
+("lanb"	"$(HcD(B")
+("lanw"	"$(HoK(B")
+("laph"	"$AqS(B")
+("lapv"	"$A:V(B")
+("lasm"	"$(HZJ(B")
+("late"	"$(Hl9(B")
+("lav"	"$AqL(B")
+("lb"	"$A=m(B")
+("lbabu"	"$AC1(B")
+("lbafu"	"$A;O(B")
+("lbau"	"$(H#k(B")
+("lbawe"	"$Aa#(B")
+("lbayf"	"$(HP:(B")
+("lbbac"	"$(HB_(B")
+("lbbhx"	"$(HBa(B")
+("lbcru"	"$(H.v(B")
+("lbdhe"	"$A`z(B")
+("lbdmq"	"$(G^|(B")
+("lbfb"	"$(H.u(B")
+("lbgni"	"$(H\g(B")
+("lbgr"	"$(Gj~(B")
+("lbha"	"$AEA(B")
+("lbhal"	"$(HVx(B")
+("lbhdw"	"$Aa&(B")
+("lbhni"	"$A7+(B")
+("lbhqo"	"$A`y(B")
+("lbigi"	"$(HaR(B")
+("lbii"	"$(H5*(B")
+("lbiih"	"$(HIy(B")
+("lbikk"	"$(H&N(B")
+("lbjj"	"$(HT,(B")
+("lbjka"	"$(H5)(B")
+("lbjmo"	"$(HB^(B")
+("lbjqp"	"$(HeJ(B")
+("lbjtc"	"$(HP7(B")
+("lbk"	"$AQk(B")
+("lblbu"	"$(H#l(B")
+("lbm"	"$(H9F(B")
+("lbmbc"	"$(H;WB`(B")
+("lbme"	"$(HT4(B")
+("lbmn"	"$(H!Y(B")
+("lbmrw"	"$A7y(B")
+("lbncr"	"$(HVv(B")
+("lbnl"	"$(H@}(B")
+("lbog"	"$Aa!(B")
+("lbomr"	"$(H*2(B")
+("lbotf"	"$(HP9(B")
+("lbqmc"	"$(HIw(B")
+("lbrrd"	"$(HVu(B")
+("lbrrj"	"$(HP8(B")
+("lbsmg"	"$Aa"(B")
+("lbsmv"	"$(GZ((B")
+("lbt"	"$AVQ(B")
+("lbtak"	"$(HIx(B")
+("lbtbo"	"$(H\h(B")
+("lbtt"	"$(H*1(B")
+("lbtwi"	"$(HaQ(B")
+("lbu"	"$(H!5(B")
+("lbwim"	"$(Gh^(B")
+("lbybc"	"$(G^{(B")
+("lbyia"	"$(GlW(B")
+("lbyr"	"$AL{(B")
+("lbytg"	"$A41(B")
+("lbytj"	"$Aa$(B")
+("lcnl"	"$(HU!(B")
+("lcor"	"$AT#(B")
+("lcru"	"$(HG<(B")
+("lcsh"	"$(H2z(B")
+("ldbb"	"$(Hc>(B")
+("lddf"	"$A=s(B")
+("lddq"	"$Aqa(B")
+("ldhe"	"$A1;(B")
+("ldk"	"$AqG(B")
+("ldmq"	"$(HT0(B")
+("leed"	"$(HZI(B")
+("leee"	"$AqV(B")
+("lei"	"$AqC(B")
+("lfbk"	"$(H_D(B")
+("lfbw"	"$(Gxv(B")
+("lff"	"$(HM}(B")
+("lfq"	"$AqH(B")
+("lfqu"	"$(HM|(B")
+("lga"	"$(GUs(B")
+("lgam"	"$(G[$(B")
+("lgb"	"$(H9<(B")
+("lgce"	"$(HN)(B")
+("lggu"	"$(Hc=(B")
+("lggy"	"$A9S(B")
+("lgi"	"$(H99(B")
+("lgr"	"$(H@)(B")
+("lgrc"	"$(Hl7(B")
+("lgwc"	"$(Hl8(B")
+("lgwm"	"$(G`k(B")
+("lha"	"$(H9@(B")
+("lhbk"	"$(Gxx(B")
+("lheq"	"$(H@/(B")
+("lher"	"$AqK(B")
+("lhg"	"$AqE(B")
+("lhhh"	"$AI@(B")
+("lhhj"	"$AqT(B")
+("lhjd"	"$(H@.(B")
+("lhoo"	"$(H_E(B")
+("lhpm"	"$(H9A(B")
+("lhqo"	"$(H9=(B")
+("lhsb"	"$Aq[(B")
+("lhul"	"$(Hiv(B")
+("lhvp"	"$(GX3(B")
+("lhyu"	"$Aq](B")
+("lia"	"$(H2m(B")
+("liabu"	"$(HSx(B")
+("liahu"	"$(HSu(B")
+("liail"	"$(HG0(B")
+("liamh"	"$(HSw(B")
+("liamo"	"$(HSv(B")
+("liaph"	"$Arf(B")
+("liapv"	"$AP+(B")
+("liau"	"$(H2c(B")
+("liav"	"$(H?|(B")
+("liavo"	"$(Gxs(B")
+("liawe"	"$(H_1(B")
+("libac"	"$ACx(B")
+("libbb"	"$(HZ0(B")
+("libbr"	"$(Gnf(B")
+("libcv"	"$(HoI(B")
+("libdi"	"$(HG5(B")
+("libgr"	"$Arh(B")
+("libm"	"$AGy(B")
+("libme"	"$(HS|(B")
+("libnd"	"$Ar](B")
+("libp"	"$(HZ?(B")
+("libue"	"$As=(B")
+("libug"	"$(HpL(B")
+("libuu"	"$(GfJ(B")
+("libvk"	"$(HZ3(B")
+("lici"	"$Ar<(B")
+("licim"	"$(HZ=(B")
+("lick"	"$(H2g(B")
+("licru"	"$(GfG(B")
+("licsh"	"$(H2i(B")
+("lid"	"$(H2`(B")
+("lidci"	"$(HMd(B")
+("lidhe"	"$(H93(B")
+("lidhl"	"$Ara(B")
+("lidk"	"$(H2b(B")
+("lidw"	"$(HM`(B")
+("lieee"	"$(HMf(B")
+("liesd"	"$(Hc<(B")
+("lifb"	"$ArY(B")
+("lifbg"	"$As+(B")
+("lifbw"	"$(Hfj(B")
+("liffd"	"$(Hir(B")
+("liffs"	"$(Hc'(B")
+("lifqu"	"$Ari(B")
+("ligb"	"$ArE(B")
+("ligg"	"$AM\(B")
+("liggu"	"$(Gw7(B")
+("ligr"	"$(H?y(B")
+("ligrr"	"$(Hc)(B")
+("ligth"	"$As2(B")
+("lihad"	"$(H_2(B")
+("lihag"	"$A;H(B")
+("lihdj"	"$Arr(B")
+("lihdn"	"$Ar[(B")
+("lihdp"	"$As,(B")
+("lihdv"	"$(HMl(B")
+("lihdw"	"$As4(B")
+("lihej"	"$A7d(B")
+("lihhj"	"$Arg(B")
+("lihi"	"$(HZ8(B")
+("lihjd"	"$AVk(B")
+("lihjg"	"$(HT)(B")
+("lihjr"	"$ArR(B")
+("lihkb"	"$(Hc2(B")
+("lihlb"	"$(HS~(B")
+("lihml"	"$(H2e(B")
+("lihmy"	"$(H9,(B")
+("lihn"	"$Ar1(B")
+("lihp"	"$(H-H(B")
+("lihpm"	"$(H9+(B")
+("lihqi"	"$A6j(B")
+("lihqo"	"$(H9)(B")
+("lihqu"	"$Ar:(B")
+("lihrb"	"$(HZ9(B")
+("lihrf"	"$(HZ6(B")
+("lihs"	"$ArF(B")
+("lihsb"	"$Ary(B")
+("lihsk"	"$(HMv(B")
+("lihsu"	"$(H2f(B")
+("lihuk"	"$(HZ7(B")
+("lihup"	"$As#(B")
+("lihvo"	"$(H9-(B")
+("lihvp"	"$(H2p(B")
+("lihwp"	"$(H_3(B")
+("lihxu"	"$(HMq(B")
+("lihyu"	"$(HZ:(B")
+("liiav"	"$(HG)(B")
+("liih"	"$(H_F(B")
+("liihq"	"$ArV(B")
+("liihv"	"$(HSp(B")
+("liiil"	"$Ark(B")
+("liijb"	"$(HG7(B")
+("liije"	"$(HG+(B")
+("liikf"	"$(HSl(B")
+("liikk"	"$(H9$(B")
+("liiku"	"$(H2l(B")
+("liilr"	"$As%(B")
+("liioc"	"$(Hff(B")
+("liirm"	"$Arb(B")
+("liitc"	"$As9(B")
+("liitf"	"$(H_)(B")
+("liitu"	"$(HSk(B")
+("liiuh"	"$(HG.(B")
+("liixp"	"$(H_*(B")
+("lijb"	"$(GfP(B")
+("lijbj"	"$Aro(B")
+("lijcg"	"$(H_>(B")
+("lije"	"$(H2_(B")
+("lijip"	"$As3(B")
+("lijj"	"$(Gr1(B")
+("lijjl"	"$(H_,(B")
+("lijka"	"$(HM_(B")
+("lijlo"	"$(HM^(B")
+("lijmc"	"$(H_&ip(B")
+("lijmm"	"$(HSh(B")
+("lijnu"	"$Arj(B")
+("lijp"	"$AI_(B")
+("lijqr"	"$(HZ)(B")
+("lijr"	"$ArA(B")
+("lijrb"	"$A:{(B")
+("lijtc"	"$(Hc((B")
+("likcf"	"$(Hc.(B")
+("likk"	"$(H9:(B")
+("likn"	"$(H?w(B")
+("likok"	"$(HZ*(B")
+("likoo"	"$(HG-(B")
+("likpb"	"$(H_/(B")
+("lilii"	"$(Gw9(B")
+("lilit"	"$(G|G(B")
+("lille"	"$(HMt(B")
+("lilmq"	"$(HMj(B")
+("lilw"	"$ArD(B")
+("lilwv"	"$(Gu=(B")
+("lilxl"	"$(HMs(B")
+("lim"	"$A:g(B")
+("lima"	"$(H@$(B")
+("limbb"	"$AHd(B")
+("limbc"	"$(HT'(B")
+("limbk"	"$(HSr(B")
+("limfm"	"$(H92(B")
+("limhf"	"$As"(B")
+("limig"	"$ArN(B")
+("limj"	"$(H-G(B")
+("limmu"	"$(H2](B")
+("limmv"	"$(HG*(B")
+("limn"	"$(H(g(B")
+("limnn"	"$(H?z(B")
+("limnr"	"$ArB(B")
+("limob"	"$(H91(B")
+("limrw"	"$Arp(B")
+("limtb"	"$(G{$(B")
+("limvh"	"$AQA(B")
+("limvm"	"$(HG/(B")
+("limwf"	"$As*(B")
+("limwj"	"$(Hc+(B")
+("limwl"	"$(HSq(B")
+("linao"	"$As-(B")
+("linbc"	"$(HT"(B")
+("lincr"	"$As8(B")
+("lindt"	"$Arl(B")
+("linhd"	"$(HSs(B")
+("linhx"	"$(HMn(B")
+("linib"	"$AS<(B")
+("linkg"	"$ArQ(B")
+("linkm"	"$AQQ(B")
+("linl"	"$Ar>(B")
+("linmu"	"$(H?}(B")
+("linob"	"$(HSt(B")
+("linue"	"$(HMg(B")
+("lioae"	"$Ars(B")
+("liob"	"$Ar8(B")
+("liodi"	"$(H9*(B")
+("liog"	"$(HMo(B")
+("liogf"	"$(Hc4(B")
+("lioii"	"$ArH(B")
+("lioin"	"$(H2h(B")
+("liokr"	"$AV)(B")
+("lioll"	"$Ar;(B")
+("liom"	"$ArG(B")
+("liomb"	"$(HMu(B")
+("liomd"	"$Ar\(B")
+("liomn"	"$Aru(B")
+("liomr"	"$A8r(B")
+("lion"	"$Ar4(B")
+("liono"	"$(HG4(B")
+("liopc"	"$(Hc5(B")
+("liosk"	"$(H?~(B")
+("lipi"	"$(H-J(B")
+("lipim"	"$(H2o(B")
+("lipou"	"$(HMm(B")
+("lipp"	"$Ar7(B")
+("lippa"	"$(HSo(B")
+("lippg"	"$(HG,(B")
+("lipr"	"$(H90(B")
+("liptd"	"$A5{(B")
+("liqj"	"$A0v(B")
+("liqkd"	"$Ar{(B")
+("liqmb"	"$Ar_(B")
+("liqmy"	"$(HSm(B")
+("liqo"	"$Ar6(B")
+("lirb"	"$(HG2(B")
+("lirrj"	"$(Gw8(B")
+("liruc"	"$(Hc0(B")
+("lirvk"	"$ArZ(B")
+("lirxu"	"$(Gxr(B")
+("lirye"	"$(Gne(B")
+("lisav"	"$(HSn(B")
+("lisem"	"$(HoH(B")
+("lish"	"$(H(i(B")
+("lishr"	"$(H9%(B")
+("lisjr"	"$(HMe(B")
+("lismg"	"$(His(B")
+("lismh"	"$(H_0(B")
+("lismi"	"$(Hc/(B")
+("liso"	"$(H2a(B")
+("lisqf"	"$(Gr,(B")
+("lisrg"	"$(Hfi(B")
+("liss"	"$(H9#(B")
+("lisyi"	"$(Hqt(B")
+("lita"	"$A@/(B")
+("litak"	"$As!(B")
+("litb"	"$(HZH(B")
+("litbo"	"$As7(B")
+("litcw"	"$Arx(B")
+("litgi"	"$(Gxq(B")
+("litgu"	"$Ar^(B")
+("litit"	"$Ar~(B")
+("litlk"	"$(HT((B")
+("litlm"	"$(H_.(B")
+("litlx"	"$(Hm{(B")
+("litm"	"$Ar@(B")
+("litmc"	"$Ar`s((B")
+("litoe"	"$As6(B")
+("litpd"	"$(Hfs(B")
+("litq"	"$ArU(B")
+("litrg"	"$(HpK(B")
+("litt"	"$(H?v(B")
+("litw"	"$ArP(B")
+("litwa"	"$As)(B")
+("litwi"	"$As:(B")
+("liuce"	"$(HS}(B")
+("liumt"	"$(HZ1(B")
+("liuob"	"$(HpM(B")
+("livii"	"$(Hc6(B")
+("livis"	"$ArJ(B")
+("livl"	"$(H(h(B")
+("livno"	"$(HS{(B")
+("livvv"	"$(G{'(B")
+("liwb"	"$(HSz(B")
+("liwd"	"$Ard(B")
+("liwgf"	"$(Hc1(B")
+("liwhd"	"$(HMk(B")
+("liwim"	"$(Gu?(B")
+("liwli"	"$(Hfm(B")
+("liwlj"	"$(Hfl(B")
+("liwlv"	"$(Hfk(B")
+("liwot"	"$(HZ2(B")
+("liwr"	"$A;W(B")
+("liwvf"	"$AB](B")
+("liwww"	"$(Hl0(B")
+("liyav"	"$(HZ/(B")
+("liybp"	"$(Hmz(B")
+("liybs"	"$As&(B")
+("liycb"	"$(H_'(B")
+("liyck"	"$ArT(B")
+("liyg"	"$AV{(B")
+("liyhn"	"$(H2[(B")
+("liyia"	"$(Hc8(B")
+("liyij"	"$As0(B")
+("liyj"	"$Ar=(B")
+("liyk"	"$ANC(B")
+("liypt"	"$(Hm|(B")
+("liyr"	"$(H9&(B")
+("liyra"	"$(Hl/(B")
+("liyrd"	"$(HM\(B")
+("liyrn"	"$(HT$(B")
+("liyro"	"$(Gz9(B")
+("liyrv"	"$(HoF(B")
+("liysd"	"$Arv(B")
+("liytj"	"$As/(B")
+("liyub"	"$As$(B")
+("liyv"	"$Ar5(B")
+("liyvi"	"$(H9"(B")
+("liywm"	"$(Hfg(B")
+("liyx"	"$(Hiq(B")
+("ljc"	"$(H96(B")
+("ljcr"	"$(HZG(B")
+("lje"	"$(H2~(B")
+("ljic"	"$(HoJ(B")
+("ljka"	"$AqR(B")
+("ljp"	"$(H95(B")
+("lk"	"$AJ7(B")
+("lkbt"	"$A0;(B")
+("lkhaf"	"$(Gs8(B")
+("lkld"	"$(H@,(B")
+("lklu"	"$(HN"(B")
+("lkma"	"$(Hl:(B")
+("lkoo"	"$(HG?(B")
+("ll"	"$A4.$(H2u(B")
+("llamh"	"$(Gi#(B")
+("llbu"	"$(H2}(B")
+("lldwf"	"$(HJa(B")
+("llfq"	"$(H+x(B")
+("llgwc"	"$(GxI(B")
+("llhe"	"$A0f(B")
+("llhhj"	"$AEF(B")
+("llhsb"	"$Ak;(B")
+("llii"	"$(H=j(B")
+("lll"	"$A4((B")
+("lllc"	"$(Gb{(B")
+("llml"	"$AF,(B")
+("llmy"	"$(HN&(B")
+("lln"	"$A8%(B")
+("llomn"	"$(HD_(B")
+("llp"	"$A;<(B")
+("llpb"	"$AqX(B")
+("llptd"	"$Ak:(B")
+("llshr"	"$(H+y(B")
+("llw"	"$APd(B")
+("llwv"	"$(GuD(B")
+("llww"	"$(H%1(B")
+("llxl"	"$(HN*(B")
+("llybs"	"$(HKl(B")
+("lma"	"$(H@+(B")
+("lmbb"	"$Aq`(B")
+("lmbuc"	"$(Gb8(B")
+("lmfbc"	"$(HZa(B")
+("lmfbt"	"$(Gip(B")
+("lmi"	"$A3f(B")
+("lmlb"	"$(HN!(B")
+("lmln"	"$(Gh"(B")
+("lmmm"	"$A>B(B")
+("lmmp"	"$(Hq7(B")
+("lmmv"	"$(HG8(B")
+("lmp"	"$A11(B")
+("lmpnl"	"$AZ}(B")
+("lmrt"	"$(HG9(B")
+("lmrw"	"$(HT-(B")
+("lmuo"	"$AUW(B")
+("lmuoc"	"$(Goo(B")
+("lmuou"	"$(GfW(B")
+("lmvi"	"$AHl(B")
+("lmwf"	"$(H_B(B")
+("lmwu"	"$(H_A(B")
+("lmyq"	"$(GO.(B")
+("lmyyn"	"$(H..(B")
+("lmyyy"	"$A7G(B")
+("ln"	"$(GXn(B")
+("lnao"	"$(HcB(B")
+("lnbuc"	"$(Gb6(B")
+("lncr"	"$(Hfy(B")
+("lnhe"	"$(H2x(B")
+("lnhxu"	"$(Hdh(B")
+("lnii"	"$Aq_(B")
+("lnln"	"$(H#.(B")
+("lnmjk"	"$(HnS(B")
+("lnnau"	"$Aeu(B")
+("lnnxu"	"$(Hqf(B")
+("lnoe"	"$(Hc?(B")
+("lntc"	"$(Gs4(B")
+("lnylb"	"$(Gp#(B")
+("loae"	"$(Gno(B")
+("lob"	"$AqD(B")
+("lohh"	"$(H9B(B")
+("loik"	"$A8$(B")
+("loim"	"$(HoL(B")
+("loin"	"$AqF(B")
+("loma"	"$(Hfz(B")
+("lomn"	"$(Gnr(B")
+("lomo"	"$(Hf{(B")
+("lomr"	"$AqJ(B")
+("lopd"	"$(H9>(B")
+("lord"	"$AqY(B")
+("lp"	"$AVR(B")
+("lpb"	"$A13(B")
+("lpd"	"$(H-N(B")
+("lpim"	"$(H2w(B")
+("lpr"	"$(H9?(B")
+("lpru"	"$AE[(B")
+("lptd"	"$(HT.(B")
+("lpwtc"	"$A<=(B")
+("lq"	"$Am2(B")
+("lqhk"	"$(HT6(B")
+("lqmat"	"$(HpN(B")
+("lqmv"	"$AqQ(B")
+("lqo"	"$(H2s(B")
+("lrb"	"$(HG@(B")
+("lrhg"	"$AqN(B")
+("lrrd"	"$(Hf|(B")
+("lrrj"	"$(Hc@(B")
+("lsav"	"$(HT/(B")
+("lsh"	"$A3u(B")
+("lshr"	"$(H9;(B")
+("lsit"	"$(Gz;(B")
+("lsjr"	"$AqU(B")
+("lskr"	"$AH9(B")
+("lsma"	"$Aq^(B")
+("lsmi"	"$(HcC(B")
+("ltbi"	"$(Hq8(B")
+("ltco"	"$(HcA(B")
+("ltgi"	"$(Hq9(B")
+("ltor"	"$AqW(B")
+("ltwi"	"$(G{((B")
+("ltwv"	"$(Hfv(B")
+("lu"	"$A6y(B")
+("lue"	"$(H'c(B")
+("luhaf"	"$(Gp((B")
+("lunl"	"$(H%)(B")
+("lvbu"	"$AX7(B")
+("lvhaf"	"$(Hnj(B")
+("lvhqu"	"$(HQ?(B")
+("lvis"	"$(H9G(B")
+("lvno"	"$(HT3(B")
+("lvok"	"$(Gm0(B")
+("lvr"	"$(H@2(B")
+("lw"	"$ASI(B")
+("lwb"	"$(GP$$AkP(B")
+("lwd"	"$ABc$(HG:(B")
+("lwg"	"$(GfS(B")
+("lwk"	"$(H@-(B")
+("lwl"	"$AIj(B")
+("lwli"	"$(Hfx(B")
+("lwlj"	"$(Hfw(B")
+("lwlp"	"$(G{)(B")
+("lwlv"	"$(GY_(B")
+("lwmvs"	"$(H$n(B")
+("lwot"	"$(HZ>(B")
+("lwp"	"$AR7(B")
+("lx"	"$(GaH(B")
+("lxhaf"	"$(Hos(B")
+("lyav"	"$AMJ(B")
+("lybb"	"$(HT+(B")
+("lybp"	"$(Hn!(B")
+("lyd"	"$(H<i(B")
+("lydu"	"$(G{r(B")
+("lyiu"	"$(H@*(B")
+("lyjj"	"$(H_@(B")
+("lyjwj"	"$(GoE(B")
+("lyk"	"$(H4P(B")
+("lylmi"	"$Arc(B")
+("lyoiv"	"$(H`W(B")
+("lyp"	"$A1/(B")
+("lysmm"	"$Atd(B")
+("lyto"	"$(Hfu(B")
+("lyub"	"$(H_?(B")
+("lyv"	"$(H4](B")
+("lyvi"	"$(H97(B")
+("lywm"	"$(Hft(B")
+("lyyhv"	"$AEa(B")
+("lyyk"	"$Al3(B")
+("m"	"$AR;(B")
+("ma"	"$A0Y(B")
+("mabk"	"$(Gh%(B")
+("mad"	"$(He`(B")
+("mahr"	"$(HI-(B")
+("mai"	"$(HJ=(B")
+("mama"	"$(H>;(B")
+("mamr"	"$A1L(B")
+("mand"	"$A:q(B")
+("manl"	"$(HH-(B")
+("mbbhg"	"$Av2(B")
+("mbbhv"	"$(HdC(B")
+("mbbmo"	"$(HdD(B")
+("mbcsh"	"$(HAM(B")
+("mbdbu"	"$AK*(B")
+("mbdd"	"$AAX(B")
+("mbddh"	"$(Hgk(B")
+("mbdi"	"$ADM(B")
+("mbebg"	"$Av/(B")
+("mbebr"	"$(H`F(B")
+("mbed"	"$(HUX(B")
+("mbejb"	"$Av,(B")
+("mbemm"	"$(Hq{(B")
+("mbeni"	"$(H[_(B")
+("mbetc"	"$(H`E(B")
+("mbetv"	"$(HjV(B")
+("mbeyr"	"$(Gru(B")
+("mbfb"	"$AOv(B")
+("mbhaf"	"$(Ha)m%qM(B")
+("mbhfd"	"$(HH](B")
+("mbhhh"	"$(H,t(B")
+("mbhhw"	"$(Gwg(B")
+("mbhok"	"$(Hl](B")
+("mbhxu"	"$AD^(B")
+("mbjlv"	"$(H[](B")
+("mbk"	"$(H,s(B")
+("mbks"	"$(GsD(B")
+("mblbk"	"$(HH_(B")
+("mbll"	"$A6x(B")
+("mblmi"	"$AHZ(B")
+("mblmo"	"$(HO%(B")
+("mblmy"	"$Av-(B")
+("mbm"	"$(GG'(B")
+("mbmbl"	"$APh(B")
+("mbmdm"	"$(G|p(B")
+("mbmgi"	"$(GxM(B")
+("mbmmi"	"$(Gbx(B")
+("mbmms"	"$Av'(B")
+("mbmmv"	"$AUp(B")
+("mbnhs"	"$(GyG(B")
+("mbnhu"	"$(Hn@(B")
+("mbnih"	"$(HH\(B")
+("mbnkg"	"$Av*(B")
+("mbnl"	"$AZ{(B")
+("mbnot"	"$(HjW(B")
+("mboah"	"$(Hls(B")
+("mbog"	"$A;t(B")
+("mbogg"	"$(Hp](B")
+("mboii"	"$AAc(B")
+("mbowy"	"$AC9(B")
+("mbp"	"$Am$(B")
+("mbphe"	"$(Glh(B")
+("mbpru"	"$A1"(B")
+("mbrbc"	"$(HdB(B")
+("mbrji"	"$(Hl\(B")
+("mbrmr"	"$AB6(B")
+("mbrrm"	"$(G|q(B")
+("mbrrr"	"$(H`G(B")
+("mbrye"	"$AO<(B")
+("mbsfi"	"$(Hgj(B")
+("mbsm"	"$AQ)(B")
+("mbsma"	"$(Hgh(B")
+("mbsmm"	"$Atg(B")
+("mbsrj"	"$AEy(B")
+("mbtbk"	"$Av1(B")
+("mbtjb"	"$A0T(B")
+("mbtlk"	"$(H`H(B")
+("mbtm"	"$(HH^(B")
+("mbuc"	"$(GSwXC(B")
+("mbuce"	"$(Hh3(B")
+("mbv"	"$AK#(B")
+("mbw"	"$A@W(B")
+("mbwtc"	"$(Hgi(B")
+("mbwu"	"$(GgY(B")
+("mbybp"	"$(Hp^(B")
+("mbydl"	"$(Hgg(B")
+("mbyhs"	"$(HAL(B")
+("mbyk"	"$Av)(B")
+("mbymr"	"$(HUV(B")
+("mbyrv"	"$(G|r(B")
+("mbytn"	"$(H`D(B")
+("mbytv"	"$Av.(B")
+("mbyx"	"$(G{~(B")
+("mche"	"$(HeE(B")
+("mcw"	"$ANw(B")
+("mcwm"	"$ASO(B")
+("md"	"$ASZ(B")
+("mda"	"$(Gpm(B")
+("mdbt"	"$AS[(B")
+("mdhaf"	"$(Hm((B")
+("mdm"	"$ANe(B")
+("mdmr"	"$(H]t(B")
+("mdnl"	"$(H"s(B")
+("mdylm"	"$(Gq%(B")
+("me"	"$A9/(B")
+("mem"	"$AX=(B")
+("menl"	"$(Hcw(B")
+("mf"	"$A2;(B")
+("mfbk"	"$(Gi_(B")
+("mfbq"	"$A1B(B")
+("mfbt"	"$(GRZ(B")
+("mfbuc"	"$(G{v(B")
+("mfbuu"	"$(HN+(B")
+("mfhaf"	"$(HV5(B")
+("mfhhh"	"$(HJ'(B")
+("mfhni"	"$(GzQ(B")
+("mfhvo"	"$AF0(B")
+("mfj"	"$AF=(B")
+("mfk"	"$(H#Q(B")
+("mfln"	"$AXb(B")
+("mfm"	"$AX'(B")
+("mfmbc"	"$(GyL$(Hj\(B")
+("mfmym"	"$AMa(B")
+("mfnl"	"$A[3(B")
+("mfp"	"$AT8(B")
+("mfr"	"$A7q(B")
+("mfsmm"	"$(H^S(B")
+("mfvnd"	"$AX+(B")
+("mg"	"$AMu(B")
+("mgaa"	"$(H>,(B")
+("mgabu"	"$Ah#(B")
+("mgahm"	"$(HDw(B")
+("mgahu"	"$(HDv(B")
+("mgamh"	"$(HDo(B")
+("mgapp"	"$Ag{(B")
+("mgau"	"$AEC(B")
+("mgayf"	"$(GqE(B")
+("mgayk"	"$(H>+(B")
+("mgb"	"$ATY$(GNv(B")
+("mgbbe"	"$(Gt@(B")
+("mgbcd"	"$Ah!(B")
+("mgbcv"	"$(Gzx(B")
+("mgbgr"	"$(H>((B")
+("mgbjj"	"$(Ge1(B")
+("mgbm"	"$(H,3(B")
+("mgbme"	"$(HDq(B")
+("mgbnd"	"$(H7>(B")
+("mgbou"	"$(Gid(B")
+("mgbsd"	"$(H>)(B")
+("mgbt"	"$AI:(B")
+("mgbuc"	"$(H79(B")
+("mgbuu"	"$(G\"(B")
+("mgby"	"$(H(.(B")
+("mgcnh"	"$(H70(B")
+("mgcsh"	"$Agc(B")
+("mgcwa"	"$(HXQ(B")
+("mgdd"	"$AAU(B")
+("mgdhe"	"$A2#(B")
+("mgdk"	"$(H(+(B")
+("mgdmq"	"$(HDn(B")
+("mgegi"	"$(G`](B")
+("mgeii"	"$(HKw(B")
+("mgfbc"	"$(Gie(B")
+("mgfbw"	"$(H]T(B")
+("mgfdq"	"$(GqD(B")
+("mgff"	"$Ag|(B")
+("mgfmu"	"$(H0o(B")
+("mggb"	"$(H,5(B")
+("mggg"	"$(GVa(B")
+("mggnf"	"$(Hm`(B")
+("mggsk"	"$(HR1(B")
+("mgha"	"$Agj(B")
+("mghae"	"$(HDy(B")
+("mghaf"	"$(HV2(B")
+("mghby"	"$(H0{(B")
+("mghdn"	"$(G\#(B")
+("mghds"	"$(H76(B")
+("mghdw"	"$(HXP(B")
+("mgher"	"$Ags(B")
+("mghgu"	"$(H0z(B")
+("mghhl"	"$(H,8(B")
+("mghi"	"$A9e(B")
+("mghjd"	"$AVi(B")
+("mghlb"	"$(HDr(B")
+("mghnb"	"$(GV_(B")
+("mghon"	"$Agq(B")
+("mghoo"	"$(HR/(B")
+("mghqi"	"$(H7=(B")
+("mghuc"	"$(G|<(B")
+("mghwp"	"$Ah.(B")
+("mghxc"	"$(Hb/(B")
+("mgi"	"$ASq$(H!f(B")
+("mgiav"	"$A@E(B")
+("mgihr"	"$(HDm(B")
+("mgihs"	"$(H?;(B")
+("mgii"	"$(H>$(B")
+("mgiil"	"$(Ge+(B")
+("mgije"	"$AGr(B")
+("mgilg"	"$A0`(B")
+("mgilr"	"$Ah)(B")
+("mgir"	"$(H,6(B")
+("mgisk"	"$(Hf!(B")
+("mgjbc"	"$(HKv(B")
+("mgjch"	"$(HDs(B")
+("mgjcr"	"$(HKt(B")
+("mgjii"	"$(HR2(B")
+("mgjmc"	"$(Hb-(B")
+("mgjmf"	"$Ag}(B")
+("mgjmm"	"$(HDl(B")
+("mgjnu"	"$Ag~(B")
+("mgjrb"	"$A:w(B")
+("mgjrr"	"$(G`e(B")
+("mgkb"	"$(H0v(B")
+("mgkkb"	"$(H7<(B")
+("mgkld"	"$(H0w(B")
+("mgkmr"	"$Agy(B")
+("mgksr"	"$Agl(B")
+("mglll"	"$(H$k(B")
+("mglmo"	"$Agr(B")
+("mglmt"	"$(Hb2(B")
+("mglmy"	"$(H>.(B")
+("mgln"	"$A5=(B")
+("mglq"	"$(H0u(B")
+("mglwl"	"$(H,,(B")
+("mgm"	"$(H$l(B")
+("mgmbb"	"$(Hb.(B")
+("mgmbc"	"$(Ggb(B")
+("mgmd"	"$(H$i(B")
+("mgmfj"	"$(H,.(B")
+("mgmg"	"$(GNs(B")
+("mgmgh"	"$(H]X(B")
+("mgmhl"	"$Agp(B")
+("mgmig"	"$(H?:(B")
+("mgmj"	"$(H$h(B")
+("mgmmr"	"$(H71(B")
+("mgmmu"	"$AMf(B")
+("mgmn"	"$Ag`(B")
+("mgmnr"	"$Agf(B")
+("mgmso"	"$AWA(B")
+("mgmvh"	"$(H()(B")
+("mgmvn"	"$AUg(B")
+("mgmwd"	"$(HKz(B")
+("mgnbe"	"$(GxN(B")
+("mgnbk"	"$(HDx(B")
+("mgnhb"	"$(HXO(B")
+("mgnkg"	"$(H75(B")
+("mgnl"	"$A[$[2(B")
+("mgno"	"$A>A$(HC|(B")
+("mgnot"	"$(HXR(B")
+("mgohh"	"$AUd(B")
+("mgoii"	"$AAa(B")
+("mgoin"	"$AGY(B")
+("mgoip"	"$Agi(B")
+("mgoir"	"$(H77Kx(B")
+("mgoj"	"$(H(/(B")
+("mgok"	"$AC5VB(B")
+("mgoll"	"$(H(-(B")
+("mgoma"	"$(H]Z(B")
+("mgomn"	"$Ah$(B")
+("mgomr"	"$(H0|(B")
+("mgono"	"$(H74(B")
+("mgpa"	"$(H0r(B")
+("mgph"	"$AI*$(H,)(B")
+("mgpi"	"$(H$j(B")
+("mgpp"	"$AE}$(H(*(B")
+("mgppa"	"$(HDu(B")
+("mgpru"	"$(H,7(B")
+("mgpt"	"$(H,0(B")
+("mgqj"	"$(H(((B")
+("mgqkd"	"$AUi$(HKy(B")
+("mgqkq"	"$(H>#(B")
+("mgrb"	"$(H73(B")
+("mgrhg"	"$(H72(B")
+("mgrmr"	"$Ah4(B")
+("mgrr"	"$AX,(B")
+("mgrrd"	"$(H]V(B")
+("mgrye"	"$Ah&(B")
+("mgryo"	"$(H7:(B")
+("mgshr"	"$(H,2(B")
+("mgsj"	"$Agm(B")
+("mgsjr"	"$Ah"(B")
+("mgskr"	"$(H78(B")
+("mgsmh"	"$(HR-(B")
+("mgsmi"	"$(HXS(B")
+("mgsmj"	"$(Hb3(B")
+("mgsmm"	"$(H0x(B")
+("mgsqf"	"$(Gif(B")
+("mgt"	"$AE*(B")
+("mgtbc"	"$(H>-(B")
+("mgtbn"	"$(HDt(B")
+("mgtc"	"$Agn(B")
+("mgtco"	"$Ah1(B")
+("mgtgt"	"$(Hb4(B")
+("mgtlb"	"$(HR,(B")
+("mgtlk"	"$Agx(B")
+("mgtlm"	"$Ah*(B")
+("mgtm"	"$(H,/(B")
+("mgtmc"	"$Agwh+(B")
+("mgtod"	"$(HR3(B")
+("mgtoe"	"$(Hb0(B")
+("mgtq"	"$(H0t(B")
+("mgtqm"	"$(HKu(B")
+("mgtrg"	"$(Hm^(B")
+("mgtrk"	"$(H]Y(B")
+("mgumb"	"$AHp(B")
+("mguob"	"$(Hma(B")
+("mguog"	"$Ah-(B")
+("mguon"	"$(H7;(B")
+("mgvid"	"$(He~(B")
+("mgvii"	"$(GqC(B")
+("mgvne"	"$(H>'(B")
+("mgvno"	"$(HDp(B")
+("mgvvd"	"$(HR0(B")
+("mgvvw"	"$Ah'(B")
+("mgwg"	"$A@m(B")
+("mgwk"	"$(H0y(B")
+("mgwl"	"$(H,4(B")
+("mgwlv"	"$(Gt?(B")
+("mgwww"	"$(Hf"(B")
+("mgybj"	"$(H]W(B")
+("mgybk"	"$(Hp@(B")
+("mgybp"	"$(Gyy(B")
+("mgybu"	"$(Gvg(B")
+("mgyck"	"$(H0l(B")
+("mgyed"	"$Ah2(B")
+("mgyfe"	"$(H>&(B")
+("mgyiu"	"$AAp$(H,1(B")
+("mgyjj"	"$(HR+(B")
+("mgyk"	"$Agd(B")
+("mgykg"	"$A0_(B")
+("mgymp"	"$(H0p(B")
+("mgyog"	"$(HXT(B")
+("mgypo"	"$Ah3(B")
+("mgypu"	"$Agz(B")
+("mgyr"	"$Agh(B")
+("mgyrv"	"$(Gzw(B")
+("mgyso"	"$Ah/(B")
+("mgytj"	"$Ah0(B")
+("mgyto"	"$(H]S(B")
+("mgytr"	"$(H>*(B")
+("mgyub"	"$AA'(B")
+("mgyvi"	"$(H,-(B")
+("mgyx"	"$(Hb1(B")
+("mgyyb"	"$(He}(B")
+("mh"	"$A3'(B")
+("mhaf"	"$AT-(B")
+("mhdd"	"$(H:H(B")
+("mhhaf"	"$(Gp)(B")
+("mhjm"	"$(H3s(B")
+("mhnl"	"$AP0(B")
+("mhog"	"$AQE(B")
+("mhoiv"	"$AwQ(B")
+("mhpm"	"$(H#6(B")
+("mhs"	"$(H#7(B")
+("mibbe"	"$(HqF(B")
+("mig"	"$AVA(B")
+("mihi"	"$A;j(B")
+("miia"	"$(GUl(B")
+("minl"	"$(HH,(B")
+("mioin"	"$(H[^(B")
+("miuh"	"$(H)9(B")
+("miyle"	"$(Hp\(B")
+("mj"	"$A8I(B")
+("mjbc"	"$(H:I(B")
+("mjf"	"$(H0^(B")
+("mjhaf"	"$(HOJor(B")
+("mjixp"	"$(Ha7(B")
+("mjln"	"$A?/(B")
+("mjmbc"	"$(HAQ(B")
+("mjnl"	"$AZu(B")
+("mjok"	"$A8R(B")
+("mjwj"	"$(H):(B")
+("mk"	"$ALl(B")
+("mkg"	"$(GsL(B")
+("mkhi"	"$(G|w(B")
+("mkhqm"	"$(G`j(B")
+("mkmwl"	"$(G|N(B")
+("mknl"	"$(H37(B")
+("mkoiv"	"$(G|P(B")
+("mkp"	"$A:)(B")
+("mks"	"$A9&(B")
+("mkv"	"$(H\b(B")
+("mkwgf"	"$(Hqm(B")
+("mkwl"	"$(He;(B")
+("ml"	"$AX"(B")
+("mlbo"	"$(GL%(B")
+("mlby"	"$ASj(B")
+("mllm"	"$(GKi(B")
+("mlm"	"$A9$(B")
+("mlmy"	"$(H.2(B")
+("mlvs"	"$(H!-(B")
+("mlwk"	"$A8|(B")
+("mm"	"$A6~(B")
+("mmbbp"	"$(Gy^(B")
+("mmbc"	"$(Gbz(B")
+("mmf"	"$AJ>(B")
+("mmg"	"$(GYS(B")
+("mmhaf"	"$(GyY$(Hd}(B")
+("mmi"	"$ATF(B")
+("mmig"	"$(H%Z(B")
+("mmks"	"$(GP0(B")
+("mml"	"$AXA(B")
+("mmlmi"	"$(HMh(B")
+("mmln"	"$(H)2(B")
+("mmm"	"$AH}(B")
+("mmmbc"	"$(Gs!(B")
+("mmmv"	"$A3=(B")
+("mmn"	"$AX!(B")
+("mmnl"	"$AZ|(B")
+("mmok"	"$AU~(B")
+("mmp"	"$(G_*(B")
+("mmr"	"$ANa(B")
+("mmu"	"$AT*(B")
+("mmuu"	"$(Ha=(B")
+("mmvh"	"$(H"$(B")
+("mmvn"	"$(H(1(B")
+("mmvs"	"$AGI(B")
+("mmyiu"	"$(HB](B")
+("mmypu"	"$(HZ%(B")
+("mn"	"$A6!(B")
+("mnbm"	"$Aic(B")
+("mnbnd"	"$Aih(B")
+("mnc"	"$AvF(B")
+("mnf"	"$AAR(B")
+("mng"	"$APM(B")
+("mngbt"	"$Ail(B")
+("mngwc"	"$(Hee(B")
+("mnhaf"	"$(HQ=a1(B")
+("mnhbt"	"$(H/~(B")
+("mnhjd"	"$AJb(B")
+("mnhk"	"$(H'K(B")
+("mnhpa"	"$(H=%(B")
+("mnhuk"	"$(HK0(B")
+("mni"	"$A4u(B")
+("mnii"	"$(G`$(B")
+("mnije"	"$(H6?(B")
+("mnir"	"$A4y(B")
+("mnjbm"	"$AV3(B")
+("mnjmc"	"$(GvX$(HQ:(B")
+("mnjru"	"$(H6>(B")
+("mnklu"	"$(H=$(B")
+("mnkoo"	"$(H6A(B")
+("mnkpb"	"$(HQ<(B")
+("mnl"	"$AZv(B")
+("mnlbk"	"$AQj(B")
+("mnle"	"$(H=#(B")
+("mnlmi"	"$ArK(B")
+("mnln"	"$AAP(B")
+("mnlq"	"$(H/}(B")
+("mnmbc"	"$(G^!(B")
+("mnmem"	"$Aij(B")
+("mnmvm"	"$(H6B(B")
+("mnmwm"	"$(H]8(B")
+("mnne"	"$(GN?(B")
+("mnnwf"	"$(H`}(B")
+("mnoah"	"$(GmF(B")
+("mnohh"	"$Aie(B")
+("mnoim"	"$(Gzs(B")
+("mnomo"	"$(Gs}(B")
+("mnp"	"$AK@?V(B")
+("mnpa"	"$AQ3(B")
+("mnphh"	"$(H'L(B")
+("mnr"	"$A?I(B")
+("mnrbc"	"$(HK.(B")
+("mnrrj"	"$(HWn(B")
+("mnryo"	"$Au<(B")
+("mntlj"	"$(Gom(B")
+("mntlm"	"$(HQ;(B")
+("mnv"	"$(H)v(B")
+("mnwot"	"$(HK/(B")
+("mnyfu"	"$(HWl(B")
+("mnyhv"	"$AAQ(B")
+("mnytr"	"$(H=&(B")
+("mo"	"$AXF(B")
+("moau"	"$(H9S(B")
+("moav"	"$(HG\(B")
+("mob"	"$A1{(B")
+("mobuu"	"$(HN,(B")
+("mobvk"	"$(H_a(B")
+("mof"	"$Al^(B")
+("mogbt"	"$(Hg1(B")
+("mohaf"	"$(Ho|(B")
+("mohf"	"$(HV8(B")
+("mohoo"	"$(HcZ(B")
+("mohsn"	"$(H@K(B")
+("mojka"	"$(Go)(B")
+("mojtc"	"$(Hg2(B")
+("moju"	"$(H%Y(B")
+("mok"	"$A9%(B")
+("mokkb"	"$(HN9(B")
+("molmi"	"$(Hc;(B")
+("moln"	"$AXc(B")
+("momhf"	"$(H__(B")
+("momso"	"$(HN:(B")
+("momt"	"$(H9R(B")
+("moo"	"$ANW(B")
+("moog"	"$AQc(B")
+("morye"	"$(GrH(B")
+("mowot"	"$(H_`(B")
+("moyvo"	"$(HG[(B")
+("mphaf"	"$(Hr=(B")
+("mpnl"	"$(G{z(B")
+("mpylm"	"$ANd(B")
+("mr"	"$AJ/(B")
+("mramh"	"$(HL6(B")
+("mrapv"	"$AmY(B")
+("mrav"	"$(H7Y(B")
+("mrbb"	"$AEp(B")
+("mrbbr"	"$(HL>(B")
+("mrbgr"	"$A5o(B")
+("mrbj"	"$(Hgm(B")
+("mrbl"	"$AX*(B")
+("mrbm"	"$(GW&(B")
+("mrbmr"	"$AmO(B")
+("mrbsd"	"$(HEV(B")
+("mrbtu"	"$(HEU(B")
+("mrbuu"	"$(G`~(B")
+("mrbvk"	"$(HRM(B")
+("mrby"	"$(H,T(B")
+("mrcsh"	"$(H,Q(B")
+("mrcwa"	"$(H]o(B")
+("mrdam"	"$A2j(B")
+("mrdci"	"$(HET(B")
+("mrdd"	"$(HEN(B")
+("mrddo"	"$(Gvp(B")
+("mrdhe"	"$AFF(B")
+("mrdm"	"$(H1?(B")
+("mre"	"$A1C$(H,O(B")
+("mreed"	"$Am_(B")
+("mresd"	"$Ama(B")
+("mrfb"	"$AOu(B")
+("mrfbw"	"$(HbI(B")
+("mrfdq"	"$AAW(B")
+("mrfff"	"$(Hkq(B")
+("mrfh"	"$AI0(B")
+("mrgg"	"$A9h(B")
+("mrggu"	"$(H]p(B")
+("mrgi"	"$Am@(B")
+("mrgit"	"$A?D(B")
+("mrgr"	"$(H7V(B")
+("mrgrr"	"$(H]q(B")
+("mrgsk"	"$(HXl(B")
+("mrhdw"	"$(H]r(B")
+("mrher"	"$AmQ(B")
+("mrhgr"	"$(H>T(B")
+("mrhhj"	"$A1.(B")
+("mrhi"	"$(HRO(B")
+("mrhio"	"$Am>(B")
+("mrhjd"	"$(G\>(B")
+("mrhje"	"$(HL9(B")
+("mrhjm"	"$(HL8(B")
+("mrhkb"	"$(H]y(B")
+("mrhlc"	"$(HiM(B")
+("mrhml"	"$Am=(B")
+("mrhne"	"$(H,U(B")
+("mrhp"	"$(H(@(B")
+("mrhpm"	"$AmF(B")
+("mrhqi"	"$AmR(B")
+("mrhs"	"$AmD(B")
+("mrhsb"	"$Am\(B")
+("mrhsk"	"$(HbF(B")
+("mrhsn"	"$(H1A(B")
+("mrhuc"	"$(HpC(B")
+("mrhyu"	"$(HRP(B")
+("mriav"	"$(H>I(B")
+("mrie"	"$(H1@(B")
+("mrihf"	"$(HXm(B")
+("mriih"	"$(HXq(B")
+("mrilr"	"$(HRQ(B")
+("mritc"	"$(Gy|(B")
+("mriuh"	"$(H>K(B")
+("mrjbc"	"$(HRK(B")
+("mrjcm"	"$(GeX(B")
+("mrjii"	"$(GqT(B")
+("mrjmc"	"$(Hf-(B")
+("mrjmo"	"$AmV(B")
+("mrjnu"	"$AMk(B")
+("mrjp"	"$AmH(B")
+("mrjqr"	"$(HRH(B")
+("mrjwj"	"$(H>S(B")
+("mrkkk"	"$(HXt(B")
+("mrkmr"	"$(HEO(B")
+("mrkoo"	"$(H>J(B")
+("mrlln"	"$AmI(B")
+("mrlq"	"$(H7X(B")
+("mrlwl"	"$AIi(B")
+("mrm"	"$(H(=(B")
+("mrmbb"	"$(Hf)(B")
+("mrmbc"	"$(Giz(B")
+("mrmbg"	"$(Hko(B")
+("mrmbu"	"$(Hmd(B")
+("mrmbw"	"$(HbC(B")
+("mrmcw"	"$ANx(B")
+("mrmfj"	"$AEi(B")
+("mrmgi"	"$(H1D(B")
+("mrmj"	"$Am7(B")
+("mrmlk"	"$AS2(B")
+("mrmnr"	"$(H1>(B")
+("mrmpm"	"$(HEL(B")
+("mrmr"	"$(H1F(B")
+("mrmrr"	"$A@Z(B")
+("mrmt"	"$AQP(B")
+("mrmtb"	"$(Gy}(B")
+("mrmtn"	"$AmJ(B")
+("mrmu"	"$(H(>(B")
+("mrmvb"	"$(HXu(B")
+("mrmvh"	"$Am<(B")
+("mrmvm"	"$(H>L(B")
+("mrmwj"	"$(H]w(B")
+("mrmwm"	"$Amd(B")
+("mrnbg"	"$AH7(B")
+("mrnd"	"$(H(A(B")
+("mrnhe"	"$(H,P(B")
+("mrni"	"$ANy(B")
+("mrnl"	"$(H39$A[9(B")
+("mrnmu"	"$(H7Z(B")
+("mrno"	"$A?38h(B")
+("mrnot"	"$Amc(B")
+("mrnqd"	"$Am](B")
+("mrnr"	"$A8g(B")
+("mrobg"	"$(Gm}(B")
+("mrog"	"$AmT(B")
+("mrogd"	"$(H]s(B")
+("mrogf"	"$A=8(B")
+("mroii"	"$(H1H(B")
+("mrok"	"$(GZz(B")
+("mroll"	"$(H,R(B")
+("mromb"	"$(HEW(B")
+("mromd"	"$(H>U(B")
+("mron"	"$(H(?(B")
+("mrpko"	"$(GxU(B")
+("mrpp"	"$AEx(B")
+("mrpru"	"$(GW((B")
+("mrpsh"	"$AFv(B")
+("mrptd"	"$A5z(B")
+("mrqmb"	"$(HES(B")
+("mrqmc"	"$(GqV(B")
+("mrqmy"	"$AmX(B")
+("mrqo"	"$(H,L(B")
+("mrrrj"	"$(H]x(B")
+("mrrrk"	"$(Hq*(B")
+("mrrye"	"$(HL=(B")
+("mrsec"	"$(HiH(B")
+("mrsit"	"$(Hf*(B")
+("mrslb"	"$ATR(B")
+("mrsmh"	"$(HXv(B")
+("mrsqf"	"$(Gn#(B")
+("mrsrj"	"$(HbE(B")
+("mrstv"	"$ADk(B")
+("mrt"	"$A69(B")
+("mrta"	"$(HEM(B")
+("mrtbc"	"$A5b(B")
+("mrtbf"	"$Ame(B")
+("mrtbo"	"$Amf(B")
+("mrtgi"	"$(HbH(B")
+("mrtii"	"$Amg(B")
+("mrtlk"	"$(HL?(B")
+("mrtmc"	"$A;G(B")
+("mrtmv"	"$(HL4(B")
+("mrtqm"	"$A4h(B")
+("mrttc"	"$AEv(B")
+("mrtvi"	"$A4E(B")
+("mrtvs"	"$(HXs(B")
+("mrtwi"	"$(HiI(B")
+("mrtxc"	"$(HRJ(B")
+("mrtyv"	"$AmK(B")
+("mrubb"	"$(HXp(B")
+("mrumf"	"$AL<(B")
+("mrumt"	"$(HRL(B")
+("mruog"	"$(HXo(B")
+("mrvid"	"$(Gz!(B")
+("mrvii"	"$(GtP(B")
+("mrvne"	"$AB5(B")
+("mrwd"	"$(H>N(B")
+("mrwhd"	"$(HEP(B")
+("mrwmv"	"$(HL7(B")
+("mrwvf"	"$(HXn(B")
+("mrwww"	"$(HiJ(B")
+("mrwyi"	"$(H1G(B")
+("mrybb"	"$AmZ(B")
+("mrybs"	"$A0u(B")
+("mrydk"	"$Amb(B")
+("mryg"	"$(H1C(B")
+("mryiu"	"$AAr(B")
+("mryoj"	"$AKi(B")
+("mryr"	"$AUh(B")
+("mryrb"	"$(HRI(B")
+("mryrn"	"$(HL<(B")
+("mryt"	"$AmG(B")
+("mrytr"	"$AmU(B")
+("mrywi"	"$(HXw(B")
+("ms"	"$AMr(B")
+("msho"	"$Au9(B")
+("msko"	"$(H(k(B")
+("msnl"	"$(HNR(B")
+("msok"	"$(H"M(B")
+("msu"	"$A6r(B")
+("mt"	"$(H";(B")
+("mta"	"$AXH(B")
+("mthaf"	"$(HV1(B")
+("mthhh"	"$APN(B")
+("mthhj"	"$(HTO(B")
+("mtje"	"$Aty(B")
+("mtjnu"	"$AMc(B")
+("mtln"	"$APL(B")
+("mtm"	"$Atx(B")
+("mtmbc"	"$(Gs$(B")
+("mtnl"	"$APO$(H36(B")
+("mtog"	"$(HAK(B")
+("mtq"	"$(HB}(B")
+("mttxc"	"$(H_](B")
+("mtuo"	"$AXJ(B")
+("mtwb"	"$(Gl0(B")
+("mu"	"$AX#X#(B")
+("mua"	"$(H<L(B")
+("muali"	"$(G|f(B")
+("mub"	"$(H"p(B")
+("muhe"	"$AOD(B")
+("mui"	"$Aj)(B")
+("mukll"	"$(H:v(B")
+("mulmi"	"$Ar3(B")
+("muln"	"$(H!|(B")
+("mumbc"	"$(Gg`(B")
+("mumrb"	"$(Hdi(B")
+("mumso"	"$(H3#(B")
+("munl"	"$(H%+(B")
+("munmu"	"$(H)7(B")
+("mv"	"$AXN(B")
+("mvb"	"$(G\j(B")
+("mvdh"	"$AQ@(B")
+("mvdi"	"$AHh(B")
+("mvku"	"$(H!>(B")
+("mvlmi"	"$ArW(B")
+("mvni"	"$AM_(B")
+("mvnm"	"$A;%(B")
+("mvphh"	"$(HGA(B")
+("mvr"	"$A4=(B")
+("mvvm"	"$(H#j(B")
+("mwahm"	"$APQ(B")
+("mwaj"	"$Aq{(B")
+("mwamo"	"$Au.(B")
+("mwbdi"	"$Au*(B")
+("mwbmr"	"$AM*(B")
+("mwbuc"	"$(Gfr(B")
+("mwbuu"	"$(Gr|(B")
+("mwbwi"	"$(HpW(B")
+("mwcsh"	"$A7S(B")
+("mwd"	"$A@u(B")
+("mwdd"	"$(HU)(B")
+("mwdi"	"$At|(B")
+("mweee"	"$(HU'(B")
+("mwfd"	"$AKZ(B")
+("mwg"	"$A@e$(H)Y(B")
+("mwhaf"	"$(Hk*(B")
+("mwhd"	"$AKV(B")
+("mwher"	"$A@R(B")
+("mwhgf"	"$Au8(B")
+("mwhgr"	"$A?a(B")
+("mwhi"	"$(Guk(B")
+("mwhio"	"$(H9H(B")
+("mwhne"	"$(H9v(B")
+("mwhoe"	"$A82(B")
+("mwhqu"	"$(H9y(B")
+("mwhs"	"$Au!(B")
+("mwhsk"	"$(Hf}(B")
+("mwhxe"	"$(H_t(B")
+("mwice"	"$AKa(B")
+("mwidd"	"$(HpU(B")
+("mwii"	"$(HU&(B")
+("mwijb"	"$(HNZ(B")
+("mwill"	"$A3j(B")
+("mwilr"	"$Au1(B")
+("mwjcs"	"$(H_v(B")
+("mwjka"	"$(H[*(B")
+("mwjkd"	"$A=M(B")
+("mwjp"	"$Au"(B")
+("mwjr"	"$At~(B")
+("mwjrb"	"$Au-(B")
+("mwklu"	"$(GoW(B")
+("mwkrt"	"$Au0(B")
+("mwlbu"	"$(H9u(B")
+("mwlii"	"$(Hl2(B")
+("mwlkt"	"$(H_x(B")
+("mwln"	"$A81(B")
+("mwlut"	"$(H[&(B")
+("mwmbb"	"$(HlL(B")
+("mwmbr"	"$(HpV(B")
+("mwmj"	"$At{(B")
+("mwmmf"	"$AF1(B")
+("mwmmp"	"$(Hq`(B")
+("mwmn"	"$Atz(B")
+("mwmnr"	"$(HA((B")
+("mwmwf"	"$(Hcy(B")
+("mwmwj"	"$(HgJ(B")
+("mwnir"	"$Au$(B")
+("mwnob"	"$Au/(B")
+("mwnoe"	"$(Gy3(B")
+("mwog"	"$(HU+(B")
+("mwogf"	"$Au4(B")
+("mwomd"	"$Au)(B")
+("mwpa"	"$Au%(B")
+("mwpd"	"$At}(B")
+("mwpi"	"$AWC(B")
+("mwpou"	"$(HU*(B")
+("mwrhg"	"$Au((B")
+("mwrrk"	"$(G}<(B")
+("mwsmh"	"$Au2(B")
+("mwsrr"	"$(Hcz(B")
+("mwsu"	"$AEd(B")
+("mwta"	"$A4W(B")
+("mwtco"	"$Au3(B")
+("mwtlf"	"$(HoW(B")
+("mwtm"	"$A:((B")
+("mwtog"	"$AH)(B")
+("mwtqm"	"$(H_w(B")
+("mwtwt"	"$Au7(B")
+("mwtwv"	"$(Hj3(B")
+("mwuk"	"$APo(B")
+("mwv"	"$AR*(B")
+("mwvib"	"$(HN](B")
+("mwvne"	"$(HU((B")
+("mwwlj"	"$(Hj4(B")
+("mwwot"	"$(Guj(B")
+("mwyfd"	"$ACQ(B")
+("mwyl"	"$ACf(B")
+("mwyoj"	"$AWm(B")
+("mwypo"	"$Au6(B")
+("mwyr"	"$(HA&(B")
+("mwyrd"	"$A4<(B")
+("mwyrv"	"$(G|n(B")
+("mwytp"	"$(Hj1(B")
+("mwytr"	"$Au,(B")
+("mwyub"	"$(Hcx(B")
+("mwyut"	"$Au5(B")
+("my"	"$AOB(B")
+("mylf"	"$AQI(B")
+("mylm"	"$AU}(B")
+("myp"	"$Al}(B")
+("mytj"	"$(H)8(B")
+("myvs"	"$AX$(B")
+("n"	"$A9-(B")
+("nahu"	"$ACb(B")
+("napo"	"$AOs(B")
+("nau"	"$AI+$(H#s(B")
+("nbam"	"$(H@;(B")
+("nbb"	"$(H51(B")
+("nbbue"	"$(HPg(B")
+("nbdk"	"$Au{(B")
+("nbdl"	"$Av"(B")
+("nbfmu"	"$Av!(B")
+("nbg"	"$A=G$(GlD(B")
+("nbgg"	"$(HGC(B")
+("nbhaf"	"$(Hot(B")
+("nbher"	"$(HGF(B")
+("nbhpm"	"$(H@9(B")
+("nbhqu"	"$(HWq(B")
+("nbhvo"	"$Au}(B")
+("nbhxu"	"$(HT<(B")
+("nbije"	"$(HN/(B")
+("nbjka"	"$(HT;(B")
+("nbk"	"$(GPY(B")
+("nbkmr"	"$(HT:(B")
+("nbks"	"$ASB$(GSR(B")
+("nblmi"	"$A4%(B")
+("nbln"	"$(HI((B")
+("nbme"	"$(HN1(B")
+("nbmgi"	"$(Hm_(B")
+("nbnbe"	"$(G{s(B")
+("nbnhe"	"$(H9J(B")
+("nbnmu"	"$(HGE(B")
+("nboah"	"$(Gw=(B")
+("nbop"	"$AcD(B")
+("nbp"	"$ASA(B")
+("nbrrj"	"$(Hg"(B")
+("nbshq"	"$A=b(B")
+("nbtgq"	"$(H_J(B")
+("nbtlf"	"$(HoM(B")
+("nbu"	"$(HP6(B")
+("nbuc"	"$(GSW(B")
+("nbue"	"$(Ho'(B")
+("nbuob"	"$(Hq;(B")
+("nbvid"	"$(Hn$(B")
+("nbvl"	"$(H-P(B")
+("nbwli"	"$(Gz=(B")
+("nbyj"	"$Auz(B")
+("nc"	"$AP!(B")
+("ncymr"	"$AU2(B")
+("nd"	"$AWS(B")
+("ndbt"	"$ACO(B")
+("ndhaf"	"$(Hk0(B")
+("ndhvf"	"$(GU!(B")
+("ndhvo"	"$A9B(B")
+("ndjmf"	"$(H4s(B")
+("ndlmt"	"$(H\c(B")
+("ndmbb"	"$AHf(B")
+("ndmlm"	"$(H4r(B")
+("ndnd"	"$(H"3(B")
+("ndok"	"$AWN(B")
+("ndpru"	"$Af_(B")
+("ndu"	"$A?W(B")
+("ndyvo"	"$A:"(B")
+("ne"	"$(H!`(B")
+("nem"	"$AX)(B")
+("nemb"	"$(H23(B")
+("nemf"	"$(H0P(B")
+("nemsu"	"$(H*0(B")
+("nfaa"	"$(GyU(B")
+("nfagi"	"$(Hly(B")
+("nfail"	"$(Gx"(B")
+("nfamo"	"$(Hjz(B")
+("nfapp"	"$(Hh8(B")
+("nfasm"	"$(Hlz(B")
+("nfawe"	"$(G|-(B")
+("nfb"	"$(H.|(B")
+("nfbgr"	"$(GyW(B")
+("nfbmr"	"$(H`z(B")
+("nfbof"	"$(Hnc(B")
+("nfbou"	"$(Hl{(B")
+("nfcru"	"$(Hdr(B")
+("nfcsh"	"$(HV*(B")
+("nfdn"	"$AV`(B")
+("nfdoo"	"$(Hh6(B")
+("nffb"	"$(Hdw(B")
+("nffba"	"$(HqI(B")
+("nffdq"	"$(G|X(B")
+("nffh"	"$(HV((B")
+("nfgce"	"$(Hh4(B")
+("nfgcg"	"$(HhA(B")
+("nfgg"	"$(Gv0(B")
+("nfggu"	"$(Hol(B")
+("nfgi"	"$(H\$(B")
+("nfgr"	"$(H`v(B")
+("nfhag"	"$(Hk&(B")
+("nfhd"	"$(Gq[(B")
+("nfhdd"	"$(HhD(B")
+("nfhdf"	"$(GzZ(B")
+("nfhdw"	"$(Hok(B")
+("nfhe"	"$(HV.(B")
+("nfher"	"$(H`|(B")
+("nfhhw"	"$(Hl}(B")
+("nfhir"	"$(Hqj(B")
+("nfhjd"	"$(Ha!(B")
+("nfhkb"	"$(Hon(B")
+("nfhor"	"$(Hh9(B")
+("nfhp"	"$(HOG(B")
+("nfhrb"	"$(Hl|(B")
+("nfhs"	"$(H\((B")
+("nfhvf"	"$(Gx$(B")
+("nfhxc"	"$(HqJ(B")
+("nfhxh"	"$(Hdt(B")
+("nfhxu"	"$(Hh:(B")
+("nfihr"	"$(Hk%(B")
+("nfijb"	"$(Hdn(B")
+("nfije"	"$(Hdv(B")
+("nfiku"	"$(Gp&(B")
+("nfir"	"$(H\*(B")
+("nfjcr"	"$(Hlu(B")
+("nfjd"	"$(H\#(B")
+("nfjii"	"$(HnZ(B")
+("nfjmu"	"$(Hdm(B")
+("nfjp"	"$(H\!(B")
+("nfjpa"	"$(G{K(B")
+("nfjr"	"$(H\,(B")
+("nfjrb"	"$(Hk$(B")
+("nfkb"	"$(Gv/(B")
+("nflmo"	"$(H`{(B")
+("nflmy"	"$(HhC(B")
+("nflx"	"$(Hog(B")
+("nfm"	"$(HOI(B")
+("nfmbl"	"$(H`x(B")
+("nfmbm"	"$(HnX(B")
+("nfmfm"	"$(H\%(B")
+("nfmgr"	"$(G}@(B")
+("nfmlk"	"$(Hdq(B")
+("nfmmp"	"$(Hr<(B")
+("nfmmr"	"$(Hdo(B")
+("nfmnr"	"$(H\+(B")
+("nfmtb"	"$(Hqi(B")
+("nfmto"	"$(G|Y(B")
+("nfmvm"	"$(HV'(B")
+("nfmwf"	"$(G|,(B")
+("nfnao"	"$(Hom(B")
+("nfnau"	"$(Hds(B")
+("nfnhb"	"$(Hoh(B")
+("nfnhd"	"$(Hk!(B")
+("nfnkq"	"$(Hk"(B")
+("nfnmu"	"$(Ha"(B")
+("nfnoe"	"$(Hoi(B")
+("nfoae"	"$(Hj|(B")
+("nfob"	"$(HV)(B")
+("nfodi"	"$(H\)(B")
+("nfoip"	"$(Hh;(B")
+("nfold"	"$(Hn_(B")
+("nfoma"	"$(Hpi(B")
+("nfomd"	"$(Hdx(B")
+("nfomr"	"$(Ha#(B")
+("nfonk"	"$(Hj}(B")
+("nfop"	"$(HV-(B")
+("nfp"	"$(HJ9(B")
+("nfpa"	"$(H`w(B")
+("nfph"	"$(H\"(B")
+("nfpi"	"$(HOH(B")
+("nfpr"	"$(H\.(B")
+("nfpru"	"$(Gs5(B")
+("nfptd"	"$(Hjy(B")
+("nfpu"	"$(HV,(B")
+("nfqka"	"$(Hk#(B")
+("nfqmb"	"$(GyV(B")
+("nfqmc"	"$(HnY(B")
+("nfrrd"	"$(Hpg(B")
+("nfrxu"	"$(Hpf(B")
+("nfsav"	"$(Hjx(B")
+("nfseg"	"$(Hn[(B")
+("nfsh"	"$(HHp(B")
+("nfsje"	"$(Hh5(B")
+("nfsju"	"$(Hdp(B")
+("nfskr"	"$(Hdu(B")
+("nfsma"	"$(Hn^(B")
+("nfsmb"	"$(Hh7(B")
+("nfsmi"	"$(Hof(B")
+("nftgr"	"$(G|W(B")
+("nftjs"	"$(Hn\(B")
+("nftm"	"$(H\-(B")
+("nftmc"	"$(HhB(B")
+("nftq"	"$(Gv-(B")
+("nftrg"	"$(Hr8(B")
+("nftwa"	"$(Hnb(B")
+("nftwi"	"$(Hoeqg(B")
+("nftwt"	"$(Hpe(B")
+("nftxc"	"$(Hlw(B")
+("nfvid"	"$(Hqh(B")
+("nfvvw"	"$(Hh<(B")
+("nfwg"	"$(Gx!(B")
+("nfwl"	"$(H\&(B")
+("nfwlb"	"$(Hj{(B")
+("nfwle"	"$(G{L(B")
+("nfwlv"	"$(Hph(B")
+("nfwo"	"$(H\'(B")
+("nfwp"	"$(GzY(B")
+("nfyck"	"$(Gv.(B")
+("nfyhn"	"$(HV%(B")
+("nfyhs"	"$(HV&(B")
+("nfyjj"	"$(G|+(B")
+("nfyk"	"$(HV+(B")
+("nfymf"	"$(H`y(B")
+("nfymo"	"$(Hn](B")
+("nfypk"	"$(Hlx(B")
+("nfypm"	"$(Hoj(B")
+("nfypt"	"$(G}A(B")
+("nfyrb"	"$(Hlv(B")
+("nfyrd"	"$(Hh@(B")
+("nfyrf"	"$(GyT(B")
+("nfytj"	"$(HnW(B")
+("nfytv"	"$(Hh?(B")
+("nfywm"	"$(Hpd(B")
+("nfyx"	"$(HqK(B")
+("ng"	"$A3s(B")
+("ngmbc"	"$(H[g(B")
+("ngmwm"	"$A=.(B")
+("nhbcr"	"$(H>G(B")
+("nhd"	"$AHa(B")
+("nhe"	"$A<0(B")
+("nhli"	"$AJ-(B")
+("nhlii"	"$As1(B")
+("nhoin"	"$Aqf(B")
+("nhoks"	"$(GY-(B")
+("nhpm"	"$(H&T(B")
+("nhs"	"$ADK(B")
+("nhsqf"	"$(Hjq(B")
+("nhta"	"$(HEI(B")
+("nhvo"	"$A;!(B")
+("ni"	"$AO&:k(B")
+("nibq"	"$Ap.(B")
+("nihaf"	"$(HhS(B")
+("nijmc"	"$Ab9(B")
+("nili"	"$(GZ0(B")
+("niln"	"$(He9(B")
+("ninh"	"$AC,(B")
+("nini"	"$A6`(B")
+("ninl"	"$(Hj0(B")
+("ninn"	"$ASh(B")
+("nioiv"	"$Ab8(B")
+("niq"	"$Ab6(B")
+("nir"	"$AC{(B")
+("nisu"	"$(H!Q(B")
+("niy"	"$AMb(B")
+("niymr"	"$(HcW(B")
+("njhaf"	"$(HOL(B")
+("njlii"	"$(Gng(B")
+("nk"	"$ASV(B")
+("nkbu"	"$An&(B")
+("nkc"	"$AvJ(B")
+("nkd"	"$(HCl(B")
+("nkf"	"$AI7(B")
+("nkg"	"$(H:j(B")
+("nkhaf"	"$(Hk;(B")
+("nkhg"	"$AM"(B")
+("nkhml"	"$(H9q(B")
+("nkhym"	"$AQS(B")
+("nki"	"$(HBz(B")
+("nklmi"	"$Arz(B")
+("nklq"	"$A=((B")
+("nknl"	"$(H@z(B")
+("nksqf"	"$(GyQ(B")
+("nktlj"	"$(HdJ(B")
+("nkv"	"$AfD(B")
+("nl"	"$(GE>$AR}(B")
+("nlamh"	"$(Gbl(B")
+("nlamo"	"$(Gbq(B")
+("nlav"	"$AO^(B")
+("nlavf"	"$AZt(B")
+("nlbm"	"$AWh(B")
+("nlbmp"	"$(Gv!(B")
+("nlbof"	"$(Gkc(B")
+("nlbt"	"$(H,A(B")
+("nldhe"	"$AZi(B")
+("nldw"	"$(G]s(B")
+("nldwk"	"$(HPd(B")
+("nlfhf"	"$AO6(B")
+("nlgce"	"$AAj(B")
+("nlgcg"	"$(G]t(B")
+("nlggu"	"$(HUT(B")
+("nlgi"	"$(H(x(B")
+("nlgsk"	"$(HO#(B")
+("nlgyo"	"$A68(B")
+("nlhag"	"$AZr(B")
+("nlhbk"	"$(H[[(B")
+("nlhe"	"$AZf(B")
+("nlhem"	"$AB!(B")
+("nlheq"	"$A=5(B")
+("nlhhj"	"$AZp(B")
+("nlhi"	"$AZs(B")
+("nlhj"	"$AZd(B")
+("nlhjd"	"$(H-h(B")
+("nlhjg"	"$(HAH(B")
+("nlhjm"	"$AZo(B")
+("nlhpm"	"$(H({(B")
+("nlhs"	"$AZh(B")
+("nlhtg"	"$(GXh(B")
+("nlhxg"	"$(HAF(B")
+("nlihu"	"$(H%0(B")
+("nlihv"	"$(HAC(B")
+("nljka"	"$(H:+(B")
+("nljmu"	"$AT:(B")
+("nljp"	"$AMS(B")
+("nljwj"	"$(GXb(B")
+("nlkb"	"$(H-d(B")
+("nlkmb"	"$AKe(B")
+("nlkmm"	"$(HHX(B")
+("nlkmr"	"$(H:,(B")
+("nlkms"	"$(H-f(B")
+("nlkoo"	"$(GXe$(H3H(B")
+("nlks"	"$(H!i(B")
+("nllmc"	"$(HUS(B")
+("nllmy"	"$(H:-(B")
+("nlma"	"$AD0(B")
+("nlmbk"	"$(HAD(B")
+("nlmbl"	"$(H-e(B")
+("nlmbv"	"$AB*(B")
+("nlmfb"	"$(H`C(B")
+("nlmmu"	"$AHn(B")
+("nlmnr"	"$A0"(B")
+("nlmob"	"$(H(|(B")
+("nlmrb"	"$A8t(B")
+("nlmsu"	"$(H%.(B")
+("nlmu"	"$AZc(B")
+("nlmvm"	"$(GXg(B")
+("nlnhx"	"$AO](B")
+("nlnin"	"$(H-g(B")
+("nlnj"	"$(H"x(B")
+("nlodi"	"$A8=(B")
+("nloii"	"$(G]u(B")
+("nlomb"	"$(H:/(B")
+("nlomd"	"$A3}(B")
+("nlomn"	"$(HAG(B")
+("nlomo"	"$(Grr(B")
+("nlon"	"$(H"y(B")
+("nlpd"	"$(H"w(B")
+("nlpfd"	"$(H:.(B")
+("nlpou"	"$ALU(B")
+("nlpp"	"$(H%-(B")
+("nlppa"	"$(Gbj(B")
+("nlppg"	"$A1](B")
+("nlrbc"	"$(GgS(B")
+("nlsje"	"$AZn(B")
+("nltct"	"$A0/(B")
+("nltpo"	"$(Gbi(B")
+("nltt"	"$AZe(B")
+("nltxc"	"$(HHW(B")
+("nlumt"	"$(HHY(B")
+("nlwlb"	"$ASg(B")
+("nlwmv"	"$AZq(B")
+("nlybp"	"$(GyD(B")
+("nlyhm"	"$(HO$(B")
+("nlyhn"	"$(GKc(B")
+("nlyhs"	"$A7@(B")
+("nlykb"	"$(Grq(B")
+("nlylh"	"$AZl(B")
+("nlylm"	"$(H%/(B")
+("nlyr"	"$AZg(B")
+("nlytj"	"$AUO(B")
+("nlyto"	"$AKm(B")
+("nlytr"	"$AEc(B")
+("nlyvo"	"$AZk(B")
+("nlyx"	"$(H`A(B")
+("nman"	"$Aev(B")
+("nmfb"	"$(GsZ(B")
+("nmlmi"	"$(HM{(B")
+("nmnim"	"$AHu(B")
+("nmnmf"	"$(G{P(B")
+("nmsu"	"$AN#(B")
+("nmvm"	"$(H.{(B")
+("nmwm"	"$(GpS(B")
+("nmyiu"	"$AJh(B")
+("nn"	"$AAK(B")
+("nnm"	"$Af](B")
+("nnmbc"	"$(Gg_(B")
+("nnmrb"	"$Aew(B")
+("nnnao"	"$AT%(B")
+("nno"	"$Af^(B")
+("nnpr"	"$(GY\(B")
+("nnqo"	"$A3P(B")
+("nnsmm"	"$(H?)(B")
+("nnvvu"	"$(H["(B")
+("no"	"$A>CG7(B")
+("nob"	"$Aqc(B")
+("noc"	"$(HjR(B")
+("nodi"	"$(H&S(B")
+("nof"	"$A>D(B")
+("nog"	"$(GlC$(HOw(B")
+("nohne"	"$(H,@(B")
+("nohto"	"$(GSy(B")
+("nolmi"	"$A50(B")
+("nomk"	"$A9o(B")
+("nomrn"	"$A5J(B")
+("nomrt"	"$A5G(B")
+("nonhe"	"$(G`u(B")
+("npd"	"$A3Z(B")
+("nq"	"$(H!0(B")
+("nqd"	"$Ahn(B")
+("nqlmi"	"$AP7(B")
+("nrmvn"	"$(Hb5(B")
+("nrppi"	"$(Gs~(B")
+("nrrj"	"$(Gl_(B")
+("nsbt"	"$AS/(B")
+("nsbul"	"$AX>(B")
+("nsd"	"$(H]-(B")
+("nse"	"$(H!:(B")
+("nsf"	"$AfX(B")
+("nshr"	"$(H&Q(B")
+("nsj"	"$Aet(B")
+("nsmv"	"$(GZ/(B")
+("nsnd"	"$ATP(B")
+("nsp"	"$A<1(B")
+("nsrr"	"$(HJ%(B")
+("nti"	"$Aj.(B")
+("ntmc"	"$(HP?(B")
+("ntnl"	"$(GoR(B")
+("nu"	"$ARR(B")
+("nubu"	"$Ams(B")
+("nue"	"$A:/$(H&R(B")
+("nuhaf"	"$(Gs;(B")
+("nui"	"$AMC(B")
+("nuks"	"$ACc(B")
+("numbc"	"$(HUd`R(B")
+("nup"	"$AT9(B")
+("nusqf"	"$(HUz(B")
+("nuv"	"$(H&4(B")
+("nwf"	"$(G^#(B")
+("nwfa"	"$(Gp'(B")
+("nwlmi"	"$(H_8(B")
+("nwlv"	"$(HV~(B")
+("nwtj"	"$(HJ&(B")
+("nx"	"$(H"#(B")
+("nxff"	"$(Gq@(B")
+("nxno"	"$(H=!(B")
+("nxu"	"$(Gs?(B")
+("nyo"	"$Aqb(B")
+("nyrf"	"$(H50(B")
+("nyvi"	"$AOR(B")
+("o"	"$AHK(B")
+("oaa"	"$A3+(B")
+("oahe"	"$A84(B")
+("oaln"	"$(Gl.(B")
+("oam"	"$A5+(B")
+("oamo"	"$(H3Y(B")
+("oan"	"$(GT/(B")
+("oanb"	"$(Gg}(B")
+("oanl"	"$(H[%(B")
+("oapp"	"$(H-}(B")
+("oapv"	"$AYJ(B")
+("oasm"	"$(H:>(B")
+("oate"	"$(H\H(B")
+("oav"	"$(H%<(B")
+("oavf"	"$(HVC(B")
+("oawe"	"$(HA`(B")
+("ob"	"$(GDy$(H!y(B")
+("obau"	"$(H-v(B")
+("obb"	"$(H-w(B")
+("obbe"	"$(HOU(B")
+("obch"	"$(H\J(B")
+("obcn"	"$(GY!(B")
+("obgb"	"$(H3Z(B")
+("obgr"	"$AYC(B")
+("obhaf"	"$(Hr4(B")
+("obhd"	"$(Hn|(B")
+("obhu"	"$(H!n(B")
+("obmc"	"$A>c(B")
+("obmr"	"$A61(B")
+("obnd"	"$A7}(B")
+("obo"	"$AHb(B")
+("obof"	"$AYQ(B")
+("obou"	"$(H:@(B")
+("obp"	"$(GpW(B")
+("obppa"	"$(Hqo(B")
+("obq"	"$AS6(B")
+("obuu"	"$(H)&(B")
+("obv"	"$(H)/(B")
+("obvk"	"$(H:A(B")
+("oc"	"$(H!4(B")
+("ocb"	"$AY+(B")
+("oci"	"$(H!p(B")
+("ocor"	"$AKW(B")
+("ocru"	"$(H))(B")
+("ocsh"	"$A7](B")
+("ocwa"	"$AI.(B")
+("od"	"$AP](B")
+("odc"	"$(Hga(B")
+("odci"	"$(H-|(B")
+("oddf"	"$(HOQ(B")
+("oddo"	"$(HOY(B")
+("odf"	"$(H0QDP(B")
+("odg"	"$A1$(B")
+("odhf"	"$(Ha.(B")
+("odi"	"$A86(B")
+("odm"	"$ALe(B")
+("odmq"	"$(GXy(B")
+("odog"	"$(HUU(B")
+("odok"	"$(GZx(B")
+("odp"	"$(H*A(B")
+("odsmg"	"$(Hmm(B")
+("odyj"	"$AP1(B")
+("oe"	"$AY`(B")
+("of"	"$A;o$(H!U(B")
+("ofb"	"$AGN(B")
+("ofbc"	"$(GsA(B")
+("ofbf"	"$(G{X(B")
+("ofbr"	"$ALH(B")
+("ofbw"	"$(Gl((B")
+("ofdq"	"$(HI$(B")
+("off"	"$(H-l(B")
+("offs"	"$(HHx(B")
+("ofhaf"	"$(Howoy(B")
+("ofhu"	"$(H3i(B")
+("ofln"	"$AXd(B")
+("ofmvn"	"$(H]](B")
+("ofnl"	"$(HU#(B")
+("ofp"	"$ADz(B")
+("ofq"	"$A0i(B")
+("ofqu"	"$A>k(B")
+("og"	"$AJKv?(B")
+("ogbuc"	"$(Gfu(B")
+("ogce"	"$(H-n(B")
+("ogd"	"$A</$(H/v(B")
+("ogdi"	"$AJL(B")
+("oge"	"$(GXiwd(B")
+("ogf"	"$A=9(B")
+("ogg"	"$A<Q(B")
+("oggu"	"$(Ggt(B")
+("oghaf"	"$(G{N$(Ha2(B")
+("oghq"	"$(Hi;(B")
+("ogi"	"$(H"}(B")
+("ogj"	"$Av@(B")
+("oglms"	"$(GgU(B")
+("ogln"	"$(H)3(B")
+("ogni"	"$(Gp2(B")
+("ogog"	"$(H[\(B")
+("ogogg"	"$(Hp[(B")
+("ogp"	"$Am%(B")
+("ogr"	"$AJ[Y%(B")
+("ogrg"	"$(HV@(B")
+("ogrr"	"$AYR(B")
+("ogsk"	"$A0A(B")
+("ogtj"	"$(GT)(B")
+("ogwc"	"$(H\F(B")
+("ogyrg"	"$(HoO(B")
+("oh"	"$AHk(B")
+("oha"	"$A2.(B")
+("ohag"	"$(H3`(B")
+("ohbt"	"$(H%D(B")
+("ohby"	"$(H%E(B")
+("ohce"	"$AI5(B")
+("ohdf"	"$(H3](B")
+("ohdi"	"$(H)1(B")
+("ohdn"	"$A@~(B")
+("ohdp"	"$(HAc(B")
+("ohdv"	"$AYA(B")
+("ohdw"	"$(HI&(B")
+("oher"	"$(H%K(B")
+("ohey"	"$AY!(B")
+("ohfp"	"$(HOX(B")
+("ohg"	"$AHN(B")
+("ohgu"	"$(H%B(B")
+("ohhj"	"$AYB(B")
+("ohi"	"$A?~(B")
+("ohj"	"$AG*(B")
+("ohjd"	"$AY*(B")
+("ohjg"	"$(H3_(B")
+("ohjm"	"$(H3^(B")
+("ohjr"	"$(H%C(B")
+("ohjx"	"$(H3[(B")
+("ohkb"	"$(Ggz(B")
+("ohlb"	"$(H3\(B")
+("ohml"	"$(H!z(B")
+("ohn"	"$AXk(B")
+("ohnb"	"$AEe(B")
+("ohni"	"$(H3j(B")
+("ohoa"	"$(GXr(B")
+("ohoi"	"$(H3b(B")
+("ohoo"	"$(HAe(B")
+("ohpm"	"$A5M(B")
+("ohq"	"$A<~(B")
+("ohqi"	"$A6m(B")
+("ohqo"	"$AX}(B")
+("ohs"	"$AWw(B")
+("ohsb"	"$AF+(B")
+("ohsg"	"$(Gg{(B")
+("ohsk"	"$(HOW(B")
+("ohuc"	"$(HkO(B")
+("ohvf"	"$(GO{(B")
+("ohvl"	"$AQv(B")
+("ohwp"	"$(Gc4(B")
+("ohxu"	"$AD_(B")
+("ohyu"	"$(H:B(B")
+("oi"	"$A7%(B")
+("oiamh"	"$(H`[(B")
+("oiapp"	"$(Gs*(B")
+("oiapv"	"$(H`\(B")
+("oiar"	"$(GT?(B")
+("oiav"	"$AJ3$(H(}(B")
+("oiawe"	"$(GyO(B")
+("oibi"	"$A85(B")
+("oibjj"	"$(H`X(B")
+("oibmr"	"$(HO8(B")
+("oibv"	"$(Got(B")
+("oice"	"$A?!(B")
+("oicyo"	"$(H[k(B")
+("oidl"	"$(HUm(B")
+("oieee"	"$(H[i(B")
+("oifbd"	"$(Hjg(B")
+("oiff"	"$(H[h(B")
+("oigbt"	"$(Hjb(B")
+("oiggu"	"$(GzR(B")
+("oigit"	"$(HdV(B")
+("oigrr"	"$(Hjc(B")
+("oihaf"	"$(Gs:(B")
+("oihag"	"$(H`^(B")
+("oihbr"	"$(Gkq(B")
+("oihdv"	"$(H[j(B")
+("oihe"	"$(Gc!(B")
+("oihf"	"$(HAh(B")
+("oihg"	"$(Gb~(B")
+("oihhl"	"$(HHi(B")
+("oihhw"	"$(Gwr(B")
+("oihi"	"$(Gwt(B")
+("oihjr"	"$(HO6(B")
+("oihk"	"$(HAS(B")
+("oihn"	"$(GXj(B")
+("oihon"	"$(H``(B")
+("oihp"	"$(H%I:3(B")
+("oihq"	"$AY0(B")
+("oihqi"	"$(Gos(B")
+("oihuc"	"$(Hr!(B")
+("oihxe"	"$(Gws(B")
+("oii"	"$(H-q(B")
+("oiibi"	"$(HdX(B")
+("oiice"	"$(HUn(B")
+("oiii"	"$(Gs)(B")
+("oiijb"	"$(HUk(B")
+("oiir"	"$(Ggf(B")
+("oijbd"	"$(HUj(B")
+("oije"	"$AY4(B")
+("oijrb"	"$(H`Y(B")
+("oijrr"	"$(Gs((B")
+("oijtc"	"$(Hjd(B")
+("oik"	"$A7|(B")
+("oikf"	"$(GXs(B")
+("oikkb"	"$(Gs,(B")
+("oiku"	"$ASE(B")
+("oilb"	"$(Gc+(B")
+("oilmc"	"$(Hjf(B")
+("oilmi"	"$(Gjs(B")
+("oilmm"	"$(H`P(B")
+("oimbc"	"$(Gkk(B")
+("oimbk"	"$(H`Z(B")
+("oimn"	"$(H3K(B")
+("oimo"	"$(H%5(B")
+("oimrt"	"$(HUl(B")
+("oimvn"	"$Aj2(B")
+("oin"	"$A=q(B")
+("oinc"	"$(G]M(B")
+("oinhx"	"$(Gs+(B")
+("oini"	"$AAn(B")
+("oino"	"$(Gc#(B")
+("oinp"	"$ADn(B")
+("oinr"	"$A:,(B")
+("oinri"	"$(G}.(B")
+("oint"	"$(HXa(B")
+("oinv"	"$At@(B")
+("oinw"	"$(H9x(B")
+("oioi"	"$A8)(B")
+("oiok"	"$AY9(B")
+("oioks"	"$(Gc$(B")
+("oiolb"	"$(Ggh(B")
+("oiomd"	"$(Gou(B")
+("oiond"	"$(HdW(B")
+("oionk"	"$(H`_(B")
+("oip"	"$A4z$(H*N(B")
+("oipf"	"$(H\E(B")
+("oiph"	"$(HHh(B")
+("oipru"	"$(Ggg(B")
+("oipu"	"$(Gc"(B")
+("oir"	"$(H#&(B")
+("oiruc"	"$(Hje(B")
+("oisj"	"$(Gkp(B")
+("oismm"	"$Ata(B")
+("oismr"	"$(Gge(B")
+("oisrr"	"$(Hg{(B")
+("oitak"	"$(Hg|(B")
+("oitbo"	"$(HnF(B")
+("oitk"	"$(HO7(B")
+("oitlm"	"$(GyP(B")
+("oitqg"	"$(Hgz(B")
+("oitt"	"$(Gko(B")
+("oiv"	"$(H&5(B")
+("oivii"	"$(GzS(B")
+("oivno"	"$(H`](B")
+("oiwmv"	"$(Gv*(B")
+("oiyck"	"$(Gkn(B")
+("oiymh"	"$(Hle(B")
+("oiyrv"	"$(HqH(B")
+("oiywm"	"$(Hld(B")
+("oj"	"$AJ2Ng(B")
+("ojb"	"$(H!t(B")
+("ojbc"	"$(H:=(B")
+("ojbm"	"$AV5(B")
+("ojcm"	"$AYE(B")
+("ojcr"	"$(H:5(B")
+("oje"	"$A<?(B")
+("ojhp"	"$(H%2(B")
+("ojii"	"$(Gc.(B")
+("ojk"	"$AUL(B")
+("ojkp"	"$A@P(B")
+("ojlk"	"$AJ9(B")
+("ojln"	"$(H-r(B")
+("ojlo"	"$(H-m(B")
+("ojmc"	"$(Gp3(B")
+("ojmf"	"$(H-z(B")
+("ojmmr"	"$(H4'(B")
+("ojmn"	"$(GHo(B")
+("ojmo"	"$(G^)(B")
+("ojnu"	"$(H-k(B")
+("ojp"	"$AY"(B")
+("ojpn"	"$(HV?(B")
+("ojr"	"$A9@(B")
+("ojrk"	"$AWv(B")
+("ojrr"	"$AYD(B")
+("ojtc"	"$(HHy(B")
+("ojtg"	"$(HON(B")
+("oju"	"$As>(B")
+("ojv"	"$(H%H(B")
+("ok"	"$AJ8(B")
+("okb"	"$AY'(B")
+("okcf"	"$AAE(B")
+("okcwa"	"$(H]n(B")
+("okf"	"$(H6}(B")
+("okhae"	"$(Hi4(B")
+("okhaf"	"$(H\9(B")
+("okhdv"	"$A0+(B")
+("okhg"	"$(H),(B")
+("okhk"	"$(H,K(B")
+("okhkb"	"$(GtL(B")
+("okkb"	"$(H)((B")
+("okkk"	"$(HAi(B")
+("oklb"	"$(GI)(B")
+("oklu"	"$A03(B")
+("okm"	"$AWt(B")
+("okmf"	"$(H-s(B")
+("okmr"	"$ARP(B")
+("okmrt"	"$A6L(B")
+("okms"	"$AY((B")
+("okn"	"$A3p$(H%7(B")
+("oknl"	"$Aor(B")
+("okog"	"$Aot(B")
+("okoo"	"$(GOn(B")
+("okoog"	"$Aos(B")
+("okp"	"$ASF(B")
+("okr"	"$ASSV*(B")
+("okryo"	"$(HNI(B")
+("oks"	"$AXl(B")
+("oksr"	"$AY$(B")
+("okss"	"$A>X(B")
+("oktoe"	"$(Hf((B")
+("okvif"	"$A71(B")
+("okwlp"	"$(HiG(B")
+("ol"	"$AVY(B")
+("olbk"	"$(H#$(B")
+("oll"	"$A=i(B")
+("olln"	"$A7p(B")
+("olmc"	"$(HI!(B")
+("olmo"	"$AY,(B")
+("olmt"	"$(Gp1(B")
+("olmy"	"$AY=(B")
+("olnk"	"$A:r(B")
+("olob"	"$(G\l(B")
+("olod"	"$(G[>(B")
+("olof"	"$(Gesx#$(He8(B")
+("oloh"	"$AP^(B")
+("oloj"	"$(H[a(B")
+("olok"	"$AX|Y?(B")
+("olom"	"$(HF6(B")
+("olpb"	"$(H3V(B")
+("olwl"	"$AIl(B")
+("olws"	"$AY7(B")
+("olwv"	"$(HAa(B")
+("om"	"$AGp$(H!F$AYZ(B")
+("oma"	"$A0[(B")
+("ombb"	"$AHe(B")
+("ombe"	"$(Gs@(B")
+("ombl"	"$(H%J(B")
+("ombn"	"$ASa(B")
+("ombp"	"$ASz(B")
+("ombt"	"$(GK{(B")
+("omc"	"$A1x(B")
+("omd"	"$AS`(B")
+("omdm"	"$ANi$(HaE(B")
+("omdp"	"$(H57(B")
+("omdu"	"$(H.tBY(B")
+("omdw"	"$(H>2(B")
+("omf"	"$(H!w(B")
+("omfj"	"$(H"{(B")
+("omfm"	"$(H#"(B")
+("omfr"	"$(H)-(B")
+("omg"	"$AH+(B")
+("omgn"	"$A59(B")
+("omh"	"$AF9(B")
+("omi"	"$AER(B")
+("omig"	"$AV6(B")
+("omjr"	"$AIa(B")
+("omlb"	"$(GT*(B")
+("omlk"	"$A1c(B")
+("omm"	"$AHJ(B")
+("ommf"	"$AY\(B")
+("ommi"	"$(H!s(B")
+("ommm"	"$AXm(B")
+("ommp"	"$(Gzb(B")
+("ommr"	"$(H)#(B")
+("ommv"	"$AXz$(H)"(B")
+("omn"	"$AXjFx(B")
+("omnl"	"$AGq(B")
+("omnn"	"$A@}(B")
+("omno"	"$Al((B")
+("omnr"	"$A:N(B")
+("ompm"	"$(H-{(B")
+("omr"	"$A:O(B")
+("omrb"	"$AY_(B")
+("omrl"	"$AC|(B")
+("omrm"	"$Atb(B")
+("omro"	"$(HAg(B")
+("omrp"	"$(Hn{(B")
+("omrq"	"$ADC(B")
+("omrr"	"$(HQ8(B")
+("omrt"	"$A:P$(H*<(B")
+("omrw"	"$(H3P7@(B")
+("omsl"	"$AP6(B")
+("omsp"	"$(H.m(B")
+("omtn"	"$(H%6(B")
+("omu"	"$AT@(B")
+("omua"	"$AYT(B")
+("omvh"	"$AXs(B")
+("omvm"	"$(H)!(B")
+("omvn"	"$AXt(B")
+("omwa"	"$(GdD(B")
+("omwc"	"$(Gl$(B")
+("omwd"	"$AK[(B")
+("omwf"	"$(HA](B")
+("omwl"	"$(GY&(B")
+("omwm"	"$A=)(B")
+("omwu"	"$(HA^(B")
+("omwv"	"$(H3S(B")
+("omyf"	"$(HAZ(B")
+("on"	"$AFr(B")
+("onao"	"$AOq(B")
+("onau"	"$(H)+(B")
+("onbc"	"$(H3a(B")
+("onbuu"	"$(Gr6(B")
+("oncr"	"$AYY(B")
+("oncsh"	"$A7U(B")
+("ond"	"$AWP(B")
+("onf"	"$ADc(B")
+("onfd"	"$(GV4(B")
+("onff"	"$A5*(B")
+("onhaf"	"$(HV6(B")
+("onhb"	"$(HH|(B")
+("onhe"	"$(GG;(B")
+("onhey"	"$Ak1(B")
+("onhqu"	"$Ak((B")
+("onhs"	"$AHT(B")
+("onib"	"$AY8(B")
+("onin"	"$A3^(B")
+("onjru"	"$Ak4(B")
+("onjv"	"$A01(B")
+("onkg"	"$(H)0(B")
+("onkl"	"$(HA!(B")
+("onkq"	"$A=!(B")
+("onl"	"$Ak-$(H!x(B")
+("onll"	"$Ak.(B")
+("onlll"	"$Ak0(B")
+("onlln"	"$A7z(B")
+("onln"	"$(H!L(B")
+("onlwl"	"$(H+M(B")
+("onmcw"	"$(H0'(B")
+("onmk"	"$A:n(B")
+("onmlm"	"$(G`*(B")
+("onmu"	"$(H%A(B")
+("onmvm"	"$(G[G(B")
+("onnhs"	"$ADJ(B")
+("onnl"	"$(HA#(B")
+("onno"	"$(HD!(B")
+("onob"	"$(H'N(B")
+("onog"	"$(HAI(B")
+("onp"	"$(H&Z(B")
+("onqd"	"$(G^-(B")
+("onqmb"	"$AGh(B")
+("onri"	"$(Gx+(B")
+("ontq"	"$AQu(B")
+("onu"	"$Ak/(B")
+("onvne"	"$ABH(B")
+("onwk"	"$Ak3(B")
+("onwot"	"$(Gi;(B")
+("onyvo"	"$A:$(B")
+("ooah"	"$(Gc2(B")
+("oobg"	"$(H:6(B")
+("oobm"	"$AY^(B")
+("oobo"	"$(H(K(B")
+("oog"	"$AWx$(H-y(B")
+("ooge"	"$(H.[(B")
+("oogf"	"$AYU(B")
+("ooic"	"$(HAf(B")
+("ooii"	"$AAf(B")
+("ooin"	"$(H!o(B")
+("ooir"	"$(G^/(B")
+("ooj"	"$AXu(B")
+("ooll"	"$A<[(B")
+("ooln"	"$(Gl-(B")
+("ooma"	"$(Gl&(B")
+("oomb"	"$(GT>(B")
+("oombc"	"$(HnC(B")
+("oomg"	"$(GL!(B")
+("oomn"	"$AM5(B")
+("oomo"	"$(Gl'(B")
+("oomr"	"$(H%L(B")
+("oon"	"$AXn(B")
+("oono"	"$(H]7(B")
+("ooog"	"$(H)*(B")
+("oooj"	"$(G^0(B")
+("oook"	"$(Gsm(B")
+("oou"	"$(H#+(B")
+("oowy"	"$ANj(B")
+("op"	"$A;/$(H!r(B")
+("opa"	"$(H%@(B")
+("opbuc"	"$(G]Lb<(B")
+("opd"	"$AK{$(H+E(B")
+("oph"	"$(H"z(B")
+("ophq"	"$Ajp(B")
+("opko"	"$(HVA(B")
+("opmc"	"$(Gc0(B")
+("opok"	"$(H<;(B")
+("opp"	"$AXr(B")
+("oppa"	"$AYI(B")
+("opr"	"$AX~(B")
+("opt"	"$(H#)(B")
+("optd"	"$(H3R(B")
+("opu"	"$Aa7$(H!u(B")
+("opwgf"	"$Awl(B")
+("opyhv"	"$A4|(B")
+("oq"	"$ADj(B")
+("oqhk"	"$(H3O(B")
+("oqka"	"$(H3e(B")
+("oqke"	"$A4v(B")
+("oqkq"	"$AY:(B")
+("oqmb"	"$AY;(B")
+("oqmc"	"$(Gc,(B")
+("oqmf"	"$(H:;(B")
+("oqmv"	"$(H-p(B")
+("oqo"	"$(GG/(B")
+("oqoa"	"$(HI%(B")
+("ora"	"$AVG(B")
+("orau"	"$(H)$(B")
+("orc"	"$(H#*(B")
+("ord"	"$A1#(B")
+("orhaf"	"$(Gv2$(Hh^m/(B")
+("orhr"	"$(GOs(B")
+("orhu"	"$AY)(B")
+("ori"	"$(HJ>(B")
+("orijb"	"$(HS.(B")
+("orln"	"$(G^6(B")
+("ormbc"	"$(Gops#(B")
+("ornin"	"$AJf(B")
+("ornl"	"$(GSi(B")
+("orno"	"$(H/z(B")
+("orrj"	"$(HH~(B")
+("orrk"	"$(G{W(B")
+("orsj"	"$(H3g(B")
+("oruc"	"$(Gg|(B")
+("orvk"	"$(H)%(B")
+("orxu"	"$(HOT(B")
+("orye"	"$A<Y$(H/P(B")
+("oryo"	"$A4Y(B")
+("osav"	"$AYH(B")
+("oshi"	"$AXp(B")
+("osj"	"$AY&(B")
+("osjr"	"$AYF(B")
+("osk"	"$ARA(B")
+("osme"	"$AGV(B")
+("osmg"	"$(H3T(B")
+("osmh"	"$(Gc5(B")
+("osmr"	"$AKE(B")
+("osmv"	"$(GT1(B")
+("osnd"	"$(HH}(B")
+("oso"	"$(H!l(B")
+("osqf"	"$(H:<(B")
+("osrj"	"$AF'(B")
+("osrr"	"$(HA_(B")
+("oss"	"$(H"|(B")
+("ossr"	"$(GP!(B")
+("ostt"	"$(H3U(B")
+("osuu"	"$A>s(B")
+("ota"	"$A=h(B")
+("otbc"	"$(H-~(B")
+("otc"	"$A9)(B")
+("otco"	"$(Ggx$(HH{(B")
+("otcw"	"$(H3d(B")
+("otdd"	"$(HWh(B")
+("otf"	"$(G`R(B")
+("otgi"	"$(Gl!(B")
+("othb"	"$(G^,(B")
+("otif"	"$(HOP(B")
+("otkr"	"$AY<(B")
+("otlk"	"$(H3f(B")
+("otlm"	"$(Gc/(B")
+("otmc"	"$(H-o(B")
+("otmv"	"$(H3Q(B")
+("otniq"	"$ANh(B")
+("otog"	"$(HkN(B")
+("otq"	"$AQp(B")
+("otqm"	"$(H:8(B")
+("otrk"	"$AYS(B")
+("otsj"	"$(H:C(B")
+("ott"	"$(GKw(B")
+("ottb"	"$(H:9(B")
+("otwa"	"$(HA\(B")
+("otwi"	"$(HHw(B")
+("otwn"	"$(HVB(B")
+("otwv"	"$(Gl%(B")
+("otxc"	"$(H:7(B")
+("ou"	"$AOI$(H!J!X(B")
+("oubb"	"$(HAb(B")
+("oudk"	"$AH1(B")
+("oudm"	"$(G\_(B")
+("ouf"	"$(H0R(B")
+("ouhmr"	"$(H?#(B")
+("oum"	"$A8W(B")
+("oumb"	"$(H3h(B")
+("oumwj"	"$(Gw'(B")
+("ouog"	"$A4_(B")
+("ouon"	"$(H).(B")
+("outrg"	"$A9^(B")
+("outt"	"$(H?"(B")
+("ouypd"	"$AsA(B")
+("ouypt"	"$(Hmp(B")
+("ovio"	"$AKF(B")
+("ovr"	"$(H%G(B")
+("ovvv"	"$(H\I(B")
+("ow"	"$A5h(B")
+("owg"	"$AY5(B")
+("owjr"	"$(GT6(B")
+("owlb"	"$AE<(B")
+("owlg"	"$(Gzc(B")
+("owlv"	"$AYX(B")
+("owmv"	"$AYK(B")
+("owp"	"$(H3W(B")
+("owr"	"$(H%?(B")
+("owwf"	"$(Hn}(B")
+("owww"	"$A@\(B")
+("owyi"	"$AC?(B")
+("owyta"	"$(HjZ(B")
+("oy"	"$AFM(B")
+("oyaj"	"$AY>(B")
+("oybc"	"$(GX~(B")
+("oybp"	"$(HaC(B")
+("oybs"	"$A0x(B")
+("oyck"	"$AY.(B")
+("oydu"	"$(HaD(B")
+("oyfe"	"$(H-u(B")
+("oyfu"	"$AYV(B")
+("oyg"	"$AW!(B")
+("oyhn"	"$AXx(B")
+("oyhs"	"$A7B(B")
+("oyhv"	"$AR@(B")
+("oyjj"	"$(HA[(B")
+("oykk"	"$(G^1(B")
+("oylm"	"$AFs(B")
+("oym"	"$(H!G(B")
+("oymp"	"$(H%=(B")
+("oymr"	"$APE(B")
+("oymy"	"$AX{(B")
+("oyoj"	"$(H-j(B")
+("oyok"	"$ACt(B")
+("oypd"	"$(H:?(B")
+("oypp"	"$(H\G(B")
+("oyr"	"$(GH|(B")
+("oyra"	"$(GsC(B")
+("oyrf"	"$(H-i(B")
+("oyrn"	"$AM#(B")
+("oyrv"	"$(GY%$(He7(B")
+("oysk"	"$(GT#(B")
+("oyt"	"$AN;(B")
+("oyta"	"$(H3c(B")
+("oytg"	"$AYW(B")
+("oytj"	"$(HAY(B")
+("oytp"	"$(Gk~(B")
+("oytr"	"$A16(B")
+("oyub"	"$AG](B")
+("oyvi"	"$(H#((B")
+("oyvo"	"$(H%4(B")
+("oywm"	"$(HOO(B")
+("oyx"	"$(Gp4(B")
+("oyyiu"	"$AX9(B")
+("p"	"$APD(B")
+("pa"	"$AV<Q.(B")
+("pahaf"	"$(Hk.(B")
+("pahm"	"$APJ(B")
+("paiu"	"$A?.(B")
+("paks"	"$(H3q(B")
+("pam"	"$Abr(B")
+("pamh"	"$(H;h(B")
+("pamj"	"$A:7(B")
+("pamo"	"$(H;q(B")
+("panb"	"$(HPN(B")
+("pank"	"$(Glo(B")
+("panl"	"$A[((B")
+("paph"	"$ALh(B")
+("papp"	"$(H5G(B")
+("papv"	"$(G_;(B")
+("pate"	"$(HaX(B")
+("pav"	"$A:^(B")
+("pawe"	"$AB}(B")
+("payf"	"$Ac=(B")
+("pbac"	"$(HBu(B")
+("pbbb"	"$(HBq(B")
+("pbcn"	"$(G_3(B")
+("pbg"	"$(HOv(B")
+("pbgr"	"$Ac0(B")
+("pbhx"	"$(HBs(B")
+("pbjj"	"$(H;c(B")
+("pbm"	"$(H&d(B")
+("pbme"	"$(H;s(B")
+("pbmr"	"$A62(B")
+("pbou"	"$(HBr(B")
+("pbtv"	"$Ac/(B")
+("pbue"	"$(Ho*(B")
+("pbug"	"$(Gzj(B")
+("pbvk"	"$(HBw(B")
+("pc"	"$(H5H(B")
+("pci"	"$Abl(B")
+("pcks"	"$(HI*(B")
+("pcnh"	"$Ac)(B")
+("pcru"	"$(GUP(B")
+("pcwa"	"$ATw(B")
+("pd"	"$AR2(B")
+("pdd"	"$(H5=(B")
+("pdhaf"	"$(HhR(B")
+("pdi"	"$Abb(B")
+("pdk"	"$A?l(B")
+("pdl"	"$Ac$(B")
+("pdlc"	"$(Gx6(B")
+("pdmbc"	"$(GqY(B")
+("peee"	"$(H5?(B")
+("peg"	"$A9V(B")
+("peii"	"$(HBo(B")
+("pembc"	"$(HQB(B")
+("pfb"	"$AGD(B")
+("pfbf"	"$(Ho)(B")
+("pfbr"	"$Ac.(B")
+("pfd"	"$(H%V(B")
+("pfdq"	"$(Gln(B")
+("pff"	"$(H5<(B")
+("pfmbc"	"$(HQj^A(B")
+("pfmu"	"$A;P(B")
+("pfq"	"$(H&l(B")
+("pfqu"	"$(H5;(B")
+("pgdi"	"$AJQ(B")
+("pggu"	"$(HPF(B")
+("pgi"	"$AGS(B")
+("pgni"	"$(H\p(B")
+("pgr"	"$(H*O(B")
+("pgth"	"$(HPG(B")
+("pgtj"	"$Ac,(B")
+("ph"	"$A1X(B")
+("pha"	"$AEB$(H'2(B")
+("phag"	"$A;L(B")
+("phbk"	"$A0C(B")
+("phbq"	"$(H,;(B")
+("phbr"	"$(H*Q(B")
+("phbt"	"$APt(B")
+("phbuu"	"$(H@6(B")
+("phcn"	"$(HaY(B")
+("phdb"	"$(HPO(B")
+("phdd"	"$A<B(B")
+("phdf"	"$Ac8(B")
+("pher"	"$Ac!(B")
+("phgr"	"$(H/0(B")
+("phgs"	"$(Ghl(B")
+("phh"	"$ANp(B")
+("phhn"	"$(H:G(B")
+("phi"	"$A@"(B")
+("phj"	"$Abc(B")
+("phjr"	"$ALq(B")
+("phkb"	"$(HPP(B")
+("phkp"	"$(H5F(B")
+("phlc"	"$(HaZ(B")
+("phln"	"$AXX(B")
+("phml"	"$APC(B")
+("phnl"	"$(H(s(B")
+("php"	"$A:v(B")
+("phpa"	"$(H5C(B")
+("phqm"	"$APT(B")
+("phqo"	"$(H&g(B")
+("phs"	"$Abt(B")
+("phsb"	"$(H;j(B")
+("phsk"	"$(H5DW,(B")
+("phvp"	"$(H$#(B")
+("phyhv"	"$(H2{(B")
+("pi"	"$AQ>IW94(B")
+("piav"	"$(H/$(B")
+("pice"	"$Ac*(B")
+("piih"	"$(Ghn(B")
+("pijb"	"$AYi(B")
+("pijc"	"$Abp(B")
+("pilb"	"$Ac<(B")
+("pile"	"$A?6(B")
+("pim"	"$(GE$(B")
+("pir"	"$Aby(B")
+("pirp"	"$A:6(B")
+("pit"	"$(H/%(B")
+("pitc"	"$(HaU(B")
+("piv"	"$(H&`(B")
+("piyr"	"$A5k(B")
+("pjbc"	"$AIw(B")
+("pjbd"	"$Ac#(B")
+("pjbo"	"$(H\o(B")
+("pjcm"	"$(H58(B")
+("pje"	"$Abe(B")
+("pjhaf"	"$(HV4(B")
+("pjhr"	"$(H;n(B")
+("pjii"	"$(HJ-(B")
+("pjip"	"$(HPI(B")
+("pjjl"	"$(Ghm(B")
+("pjkp"	"$(H*E(B")
+("pjlv"	"$(GZD(B")
+("pjmf"	"$(H59(B")
+("pjmm"	"$(H;m(B")
+("pjnu"	"$AMo(B")
+("pjpn"	"$(H\m(B")
+("pjr"	"$Abo(B")
+("pjrr"	"$(H5:(B")
+("pjsqf"	"$(HO?(B")
+("pjtc"	"$(Gls(B")
+("pk"	"$(H"@(B")
+("pkcf"	"$(HPK(B")
+("pkf"	"$A;V(B")
+("pkk"	"$A4R(B")
+("pkkb"	"$(H/+(B")
+("pkkk"	"$(HJ;(B")
+("pklb"	"$A2@(B")
+("pklq"	"$AR^(B")
+("pklu"	"$(H.1(B")
+("pkmb"	"$A6h(B")
+("pkn"	"$(H!6*D(B")
+("pknio"	"$ARI(B")
+("pksb"	"$(HBp(B")
+("pl"	"$Abg(B")
+("plbk"	"$Abs(B")
+("plbu"	"$A3@(B")
+("plln"	"$Abv(B")
+("plmc"	"$(HPM(B")
+("plmo"	"$(H*J(B")
+("plmy"	"$Ac-(B")
+("plpc"	"$(HeL(B")
+("plw"	"$(H&e(B")
+("plwv"	"$(HJ6(B")
+("pmak"	"$(H\q(B")
+("pmam"	"$A:c(B")
+("pmbb"	"$AE3(B")
+("pmbc"	"$(G^"$(HBv(B")
+("pmbe"	"$(HaV(B")
+("pmbm"	"$(GQ1(B")
+("pmcw"	"$(H*F(B")
+("pmf"	"$A;3(B")
+("pmfj"	"$(H#3$Abq(B")
+("pmfm"	"$(H&m(B")
+("pmmr"	"$ANr(B")
+("pmmu"	"$(H#z(B")
+("pmob"	"$(H&^(B")
+("pmrw"	"$AYk$(H;d(B")
+("pmua"	"$(HPJ(B")
+("pmwd"	"$(Gc~$(HPL(B")
+("pmwf"	"$(HJ0(B")
+("pmwj"	"$(HPH(B")
+("pmwl"	"$(H;p(B")
+("pmym"	"$AUz(B")
+("pn"	"$AX?(B")
+("pnau"	"$(H/-(B")
+("pnbq"	"$AP8(B")
+("pncr"	"$(HW+(B")
+("png"	"$Abn(B")
+("pnhb"	"$(HPE(B")
+("pnhe"	"$(H$!(B")
+("pnib"	"$(H/&(B")
+("pnin"	"$(H*K(B")
+("pno"	"$(H$"(B")
+("pnyi"	"$(H5>(B")
+("poae"	"$Ac9(B")
+("pod"	"$(H*P(B")
+("pog"	"$AN)(B")
+("poge"	"$(HBt(B")
+("pogf"	"$Ac>(B")
+("poii"	"$AA/(B")
+("poim"	"$(Gym(B")
+("poin"	"$(H$'(B")
+("poir"	"$(Gd#(B")
+("poj"	"$Abh(B")
+("poju"	"$(H%W(B")
+("pomb"	"$(H5I(B")
+("pomd"	"$(H/.(B")
+("pomg"	"$(H*R(B")
+("pomn"	"$ASd(B")
+("pomo"	"$(HW-(B")
+("pomr"	"$AG!(B")
+("pon"	"$(H"A(B")
+("ponbg"	"$(Hl;(B")
+("pond"	"$(Gd"(B")
+("potf"	"$(Glu(B")
+("powy"	"$A;Z(B")
+("pp"	"$A1H(B")
+("ppa"	"$(H*H$Ab~(B")
+("ppad"	"$(H;i(B")
+("ppfd"	"$(H1m(B")
+("ppg"	"$(H#O(B")
+("pph"	"$(H&[(B")
+("ppha"	"$A=T(B")
+("pphp"	"$Ac1(B")
+("pphqu"	"$(H'M(B")
+("ppp"	"$(H;_(B")
+("pppd"	"$(HW[(B")
+("pppf"	"$(Hba(B")
+("ppph"	"$A1Q(B")
+("ppr"	"$(H&i(B")
+("ppru"	"$(H&n(B")
+("pptd"	"$(H;g(B")
+("ppu"	"$(H#|(B")
+("ppuk"	"$(H*M(B")
+("pqmb"	"$AGi(B")
+("pqmf"	"$Ac:(B")
+("pr"	"$A>d(B")
+("prau"	"$Ac((B")
+("prb"	"$(H/((B")
+("prhaf"	"$(H\5(B")
+("prhg"	"$(H//(B")
+("prhml"	"$(H*j(B")
+("prhu"	"$(H&c(B")
+("prks"	"$A[>(B")
+("prno"	"$(H+F(B")
+("prog"	"$(GgW(B")
+("prrd"	"$(HW((B")
+("prrj"	"$(Glr(B")
+("prrs"	"$Ac5(B")
+("pru"	"$A0|(B")
+("prvp"	"$(H&_(B")
+("prxu"	"$(HW'(B")
+("psav"	"$(H;o(B")
+("pseg"	"$(HJ.(B")
+("psh"	"$AGPba(B")
+("pshr"	"$Abw(B")
+("psjj"	"$(Gzk(B")
+("psko"	"$(G_.(B")
+("psma"	"$(HJ4(B")
+("psmg"	"$(H*G(B")
+("psmh"	"$(HJ3(B")
+("psmi"	"$(HPR(B")
+("psmv"	"$(GZG(B")
+("psp"	"$Abu(B")
+("psrr"	"$(HJ:(B")
+("pt"	"$AJ@(B")
+("pta"	"$AO'(B")
+("ptak"	"$(HJ5(B")
+("ptbo"	"$(H\r(B")
+("ptbuc"	"$(H@P(B")
+("pthg"	"$A6.(B")
+("ptlb"	"$(HJ1(B")
+("ptlj"	"$(H;f(B")
+("ptlm"	"$(HJ2(B")
+("ptmv"	"$(H;e(B")
+("ptor"	"$(H:F(B")
+("ptov"	"$(Ha\(B")
+("ptrg"	"$(HkZ(B")
+("ptt"	"$(H*C(B")
+("ptwa"	"$(HJ/(B")
+("ptwi"	"$(HaW(B")
+("ptwu"	"$AcB(B")
+("ptxc"	"$Ac;(B")
+("ptyu"	"$A;E(B")
+("pu"	"$AMM(B")
+("puce"	"$(H;k(B")
+("pudhe"	"$(Gmt(B")
+("puf"	"$(H+r(B")
+("puhaf"	"$(Hm+(B")
+("puk"	"$APY$(H$$(B")
+("puln"	"$AEY(B")
+("pumb"	"$Ac7(B")
+("pumbc"	"$(Gga(B")
+("pumt"	"$(Gd'(B")
+("punl"	"$(Gg9(B")
+("puog"	"$(Gwe$(HJ7(B")
+("pupu"	"$(GWp(B")
+("pve"	"$(H&k(B")
+("pvis"	"$(H&j(B")
+("pvvw"	"$(G_6(B")
+("pw"	"$A5i(B")
+("pwc"	"$(H&f(B")
+("pwd"	"$Ac'$(H5A(B")
+("pwg"	"$Ac&(B")
+("pwim"	"$(HJ<(B")
+("pwjc"	"$(Ghk(B")
+("pwlj"	"$(HW*(B")
+("pwls"	"$Ac6(B")
+("pwlv"	"$(HW)(B")
+("pwmv"	"$(H;r(B")
+("pwot"	"$(Gd!(B")
+("pwr"	"$(H*I(B")
+("pyaj"	"$A5?(B")
+("pyck"	"$(H*B(B")
+("pyfu"	"$(HPD(B")
+("pyhr"	"$(HJ8(B")
+("pymr"	"$AYj(B")
+("pyoj"	"$Ac2(B")
+("pypo"	"$(HW&(B")
+("pyr"	"$(H&b(B")
+("pyrd"	"$(GZP(B")
+("pyrf"	"$A>*(B")
+("pyrv"	"$(Hhv(B")
+("pyta"	"$(H;b(B")
+("pytg"	"$Ac?(B")
+("pytj"	"$(HJ,(B")
+("pytp"	"$(GpY(B")
+("pyv"	"$AC&(B")
+("pyvw"	"$(HBl(B")
+("pywd"	"$(GpX(B")
+("pywv"	"$(Gx5(B")
+("pyx"	"$(H\n(B")
+("pyy"	"$Abm(B")
+("q"	"$AJV(B")
+("qa"	"$(H$.(B")
+("qail"	"$(H/;(B")
+("qaiu"	"$(H<'(B")
+("qamh"	"$(G_R(B")
+("qamj"	"$A:4(B")
+("qamo"	"$ALa(B")
+("qan"	"$(GZc(B")
+("qanb"	"$(HP](B")
+("qang"	"$(HP\(B")
+("qank"	"$(H/J(B")
+("qanr"	"$(Gsj(B")
+("qanw"	"$(Gyo(B")
+("qapp"	"$(H5g(B")
+("qapv"	"$A=R(B")
+("qase"	"$A4i(B")
+("qasm"	"$(HC3(B")
+("qau"	"$A0Q(B")
+("qav"	"$(H*[(B")
+("qb"	"$(H$4(B")
+("qbb"	"$(H5`(B")
+("qbbb"	"$(HC2(B")
+("qbbe"	"$AJZ(B")
+("qbbsd"	"$(Gr{(B")
+("qbbuu"	"$(HUY(B")
+("qbcd"	"$AL=(B")
+("qbcv"	"$(Hhx(B")
+("qbd"	"$(GZh(B")
+("qbdi"	"$A^[(B")
+("qbhaf"	"$(HhH(B")
+("qbhx"	"$(HC6(B")
+("qbjj"	"$(G_L(B")
+("qbjmo"	"$A5e(B")
+("qbkf"	"$(Gm)(B")
+("qbm"	"$(H&{(B")
+("qbme"	"$AT.(B")
+("qbmr"	"$(H*](B")
+("qbnau"	"$(HO&(B")
+("qbnd"	"$(H/>(B")
+("qbnl"	"$(H9s(B")
+("qbou"	"$(Gd6(B")
+("qbsd"	"$(GZg(B")
+("qbue"	"$A>p(B")
+("qbuu"	"$(H/K(B")
+("qbv"	"$(H/?(B")
+("qc"	"$A0G(B")
+("qchq"	"$Aj~(B")
+("qcks"	"$(Gc=(B")
+("qcno"	"$(Gm-(B")
+("qcru"	"$(H/@(B")
+("qcsh"	"$A0g(B")
+("qd"	"$Aqg(B")
+("qdau"	"$A0R(B")
+("qdb"	"$(H*d(B")
+("qdbms"	"$(HF8(B")
+("qdfh"	"$Aqi(B")
+("qdhe"	"$AE{(B")
+("qdhqu"	"$A:D(B")
+("qdir"	"$(H8E(B")
+("qdj"	"$AD((B")
+("qdk"	"$A>q(B")
+("qdksr"	"$(H8D(B")
+("qdlwv"	"$(H^T(B")
+("qdmbc"	"$(HUe(B")
+("qdmbe"	"$(Hk}(B")
+("qdmmi"	"$ATE(B")
+("qdmvi"	"$Aqq(B")
+("qdnd"	"$Aqh(B")
+("qdrlr"	"$Aqj(B")
+("qdss"	"$(H8C(B")
+("qdta"	"$(HM((B")
+("qdtt"	"$A8{(B")
+("qdttb"	"$Aqp(B")
+("qdwf"	"$(G_A(B")
+("qdwlb"	"$Aqn(B")
+("qdybs"	"$AEU(B")
+("qeed"	"$A^z(B")
+("qeee"	"$A6^(B")
+("qei"	"$(H"J(B")
+("qeii"	"$AI&(B")
+("qfb"	"$AIS(B")
+("qfbf"	"$(Ho+(B")
+("qfbk"	"$AF2(B")
+("qfbq"	"$(Gl}(B")
+("qfbw"	"$(Gp`(B")
+("qff"	"$(H5P(B")
+("qffs"	"$(Gl|(B")
+("qfh"	"$A3-(B")
+("qfq"	"$A0h(B")
+("qfqu"	"$(GZV(B")
+("qgb"	"$(H&}(B")
+("qgdi"	"$A3V(B")
+("qgg"	"$A9R(B")
+("qggu"	"$(Gm"(B")
+("qggy"	"$(GZb(B")
+("qgi"	"$(H&u(B")
+("qgit"	"$(HC*(B")
+("qglc"	"$(H/G(B")
+("qgni"	"$(H\u(B")
+("qgr"	"$A^W(B")
+("qgrc"	"$(GvJ(B")
+("qha"	"$AED(B")
+("qhag"	"$(H<-(B")
+("qhal"	"$(HW8(B")
+("qhau"	"$(Gd7(B")
+("qhbf"	"$A_,(B")
+("qhbk"	"$(HW9(B")
+("qhbu"	"$(G|9(B")
+("qhd"	"$(H/o(B")
+("qhdf"	"$A>>(B")
+("qhdv"	"$(H5_(B")
+("qhdw"	"$A2%(B")
+("qhe"	"$A0b$(H0A(B")
+("qhej"	"$(H/M(B")
+("qher"	"$(H*^(B")
+("qhgr"	"$(H/A(B")
+("qhhj"	"$A^c(B")
+("qhhv"	"$(H*a(B")
+("qhio"	"$(H'!(B")
+("qhj"	"$AG$(B")
+("qhjg"	"$(H<4(B")
+("qhjm"	"$A47(B")
+("qhjr"	"$A@((B")
+("qhju"	"$(H<5(B")
+("qhjx"	"$A2e(B")
+("qhk"	"$AFu$(H$5(B")
+("qhkb"	"$(HP`(B")
+("qhkp"	"$A^](B")
+("qhlmi"	"$(H?{(B")
+("qhlo"	"$AW%OF(B")
+("qhml"	"$AU[(B")
+("qhmy"	"$A2p(B")
+("qhnbg"	"$(HGH(B")
+("qhne"	"$AM6(B")
+("qhoa"	"$(H<*(B")
+("qhoo"	"$(HJS(B")
+("qhor"	"$(HPc(B")
+("qhp"	"$AMPm"(B")
+("qhpm"	"$A5V(B")
+("qhq"	"$Aj|(B")
+("qhqo"	"$(H&w(B")
+("qhrf"	"$(HC9(B")
+("qhsb"	"$A^g$(H<6(B")
+("qhsk"	"$A^f$(HW4(B")
+("qhsm"	"$(HC;(B")
+("qhuc"	"$(HmQ(B")
+("qhul"	"$A_)(B")
+("qhuo"	"$(H\x(B")
+("qhuu"	"$AGK(B")
+("qhvif"	"$(H>x(B")
+("qhvl"	"$ARV(B")
+("qhvp"	"$(H$1(B")
+("qhwp"	"$(HJR(B")
+("qhxe"	"$AKQ(B")
+("qhxm"	"$ADs(B")
+("qhxu"	"$(H5\(B")
+("qhye"	"$A0a(B")
+("qhymu"	"$(G{V(B")
+("qhyu"	"$A^u(B")
+("qi"	"$AUR(B")
+("qibi"	"$A2+(B")
+("qice"	"$(H/C(B")
+("qidy"	"$(HmO(B")
+("qihf"	"$(HC/JI(B")
+("qihu"	"$(H$3(B")
+("qiih"	"$(Gh|(B")
+("qijb"	"$A26(B")
+("qije"	"$(H/7(B")
+("qikf"	"$(H;}(B")
+("qikk"	"$A0N(B")
+("qiku"	"$AHE(B")
+("qilr"	"$ALB(B")
+("qiok"	"$A0$(B")
+("qipd"	"$(Hhw(B")
+("qipm"	"$AJC(B")
+("qir"	"$AL'(B")
+("qirm"	"$(H5R(B")
+("qirp"	"$A:3(B")
+("qit"	"$A^U(B")
+("qitc"	"$(GvD(B")
+("qitf"	"$A^}(B")
+("qixp"	"$(HJC(B")
+("qiyr"	"$A5`(B")
+("qj"	"$A7a(B")
+("qjbc"	"$(HC-(B")
+("qjbd"	"$(H/6(B")
+("qjbf"	"$A2A(B")
+("qjbj"	"$(H<0(B")
+("qjbv"	"$A_-(B")
+("qjcm"	"$A?X(B")
+("qjcn"	"$AMZ(B")
+("qjcs"	"$(Gd+(B")
+("qjcv"	"$(Hk[(B")
+("qje"	"$A<<(B")
+("qjhp"	"$(H*b(B")
+("qjhu"	"$(H&r(B")
+("qjii"	"$(HJE(B")
+("qjji"	"$(HPW(B")
+("qjjj"	"$(HC)(B")
+("qjjl"	"$(HJF(B")
+("qjk"	"$(H"I(B")
+("qjks"	"$A?=(B")
+("qjlo"	"$A=](B")
+("qjmc"	"$(H\s(B")
+("qjmm"	"$A^o(B")
+("qjmo"	"$(H5b(B")
+("qjmr"	"$Am9(B")
+("qjmu"	"$(H/5(B")
+("qjnl"	"$A0n$(Hcv(B")
+("qjnu"	"$(H5K(B")
+("qjoa"	"$(HJA(B")
+("qjpa"	"$(HC+(B")
+("qjpn"	"$(Gsg(B")
+("qjqp"	"$(HeM(B")
+("qjqr"	"$(HC'(B")
+("qjsm"	"$Aeg(B")
+("qjsmp"	"$A;[(B")
+("qjto"	"$(Hhz(B")
+("qjtv"	"$(HeN(B")
+("qjv"	"$A04(B")
+("qjwj"	"$(H/E(B")
+("qka"	"$A4:(B")
+("qkali"	"$A4@(B")
+("qkap"	"$(HBk(B")
+("qkce"	"$(HJP(B")
+("qkcf"	"$AAC(B")
+("qke"	"$AL)(B")
+("qkf"	"$(H*f(B")
+("qkhd"	"$AGX(B")
+("qkhk"	"$AW`(B")
+("qkhx"	"$At)(B")
+("qkhxp"	"$(HPB(B")
+("qkja"	"$(HJK(B")
+("qklb"	"$(H&v(B")
+("qkld"	"$(H*X(B")
+("qklu"	"$AQZ(B")
+("qkmf"	"$A^`(B")
+("qkmr"	"$A^a(B")
+("qkms"	"$A?f(B")
+("qkoo"	"$(GUW(B")
+("qkq"	"$A7n(B")
+("qks"	"$(H!^(B")
+("qksb"	"$(HC8(B")
+("qkso"	"$(HJJ(B")
+("qkss"	"$(H*\(B")
+("qkus"	"$(GMa(B")
+("qla"	"$(H5p(B")
+("qlbk"	"$(H&~(B")
+("qlbu"	"$(H$*(B")
+("qlc"	"$(HUM(B")
+("qle"	"$(H5c(B")
+("qlf"	"$(H6~(B")
+("qllmi"	"$ArX(B")
+("qlln"	"$A7w(B")
+("qlmc"	"$(HP^(B")
+("qlmo"	"$ALt(B")
+("qlmr"	"$(H>R(B")
+("qlmy"	"$AEE(B")
+("qlp"	"$(H55(B")
+("qlpb"	"$(G_S(B")
+("qlr"	"$AU\(B")
+("qlryo"	"$Au=(B")
+("qlvk"	"$(GvI(B")
+("qlw"	"$A3i(B")
+("qlwl"	"$A^S(B")
+("qlwp"	"$AW'(B")
+("qlwv"	"$(Ghv(B")
+("qlyhv"	"$(HG>(B")
+("qlymr"	"$AJD(B")
+("qm"	"$A?8(B")
+("qmak"	"$(H\v(B")
+("qmb"	"$AG`(B")
+("qmbb"	"$(H\t(B")
+("qmbc"	"$(HC((B")
+("qmbe"	"$(GvF(B")
+("qmbg"	"$A_+(B")
+("qmbs"	"$(HJD(B")
+("qmbuc"	"$(G]J(B")
+("qmbw"	"$A@^(B")
+("qmd"	"$(H"C(B")
+("qmf"	"$(H$-(B")
+("qmfj"	"$AEj(B")
+("qmgg"	"$A^_(B")
+("qmgn"	"$(H5V(B")
+("qmia"	"$(HC.(B")
+("qmig"	"$(H*Z(B")
+("qmj"	"$(H"D(B")
+("qmjk"	"$A^~(B")
+("qmlk"	"$(H/F(B")
+("qmlm"	"$(H5S(B")
+("qmmi"	"$(H$+(B")
+("qmmp"	"$(HmP(B")
+("qmmr"	"$ANf(B")
+("qmmu"	"$(H$,(B")
+("qmmv"	"$AUq(B")
+("qmn"	"$A4r(B")
+("qmr"	"$AMX(B")
+("qmrb"	"$(HC,(B")
+("qmrw"	"$(H<!(B")
+("qmsu"	"$A6s(B")
+("qmto"	"$A>o(B")
+("qmu"	"$(H"E(B")
+("qmv"	"$A1m(B")
+("qmvif"	"$AKX(B")
+("qmvm"	"$(H/H(B")
+("qmwd"	"$(HC?(B")
+("qmwf"	"$(HJH(B")
+("qmwj"	"$(Gm,(B")
+("qmwyf"	"$Atn(B")
+("qmwyi"	"$A6>(B")
+("qnau"	"$AMl(B")
+("qnbg"	"$(H/D(B")
+("qnbk"	"$(G_P(B")
+("qncr"	"$(Gpj(B")
+("qndf"	"$(HCA(B")
+("qnem"	"$AU|(B")
+("qng"	"$AE$(B")
+("qnhd"	"$AH`(B")
+("qnhe"	"$(H$/(B")
+("qnhs"	"$AHS(B")
+("qnhx"	"$AF~(B")
+("qnib"	"$AM1(B")
+("qnin"	"$AJc$(H*_(B")
+("qnkg"	"$AM&(B")
+("qnkm"	"$(H5a(B")
+("qnkq"	"$(H<&(B")
+("qnlb"	"$(HPb(B")
+("qnmm"	"$A^y(B")
+("qno"	"$(H$0(B")
+("qnob"	"$(H<((B")
+("qnoe"	"$(Gm!(B")
+("qnok"	"$A^q(B")
+("qnot"	"$(HPZ(B")
+("qnri"	"$(Gyp(B")
+("qnwa"	"$(Hac(B")
+("qo"	"$A7r(B")
+("qoa"	"$ALf(B")
+("qoah"	"$(HJY(B")
+("qobg"	"$(HC$(B")
+("qobuu"	"$(G]=(B")
+("qodi"	"$A^T(B")
+("qog"	"$AMF(B")
+("qohaf"	"$(HV0(B")
+("qohg"	"$(H*g(B")
+("qohh"	"$(H&y(B")
+("qoii"	"$AA`(B")
+("qoim"	"$(Hhy(B")
+("qoin"	"$(H$7(B")
+("qoip"	"$ADm(B")
+("qoir"	"$(Gd5(B")
+("qojwj"	"$(GoF(B")
+("qoll"	"$(H$8(B")
+("qomb"	"$(GZe(B")
+("qomd"	"$(H/N(B")
+("qomg"	"$AK)(B")
+("qomn"	"$A^m(B")
+("qomo"	"$(Gph(B")
+("qomr"	"$AJ0$(GZo(B")
+("qomt"	"$(H<+(B")
+("qon"	"$(H"H(B")
+("qonl"	"$(H%*(B")
+("qoog"	"$A4l(B")
+("qopd"	"$AMO(B")
+("qorq"	"$Ak!(B")
+("qotf"	"$(Gm((B")
+("qowy"	"$(H/B(B")
+("qoya"	"$(HJT(B")
+("qoyb"	"$AG\(B")
+("qpa"	"$AV8(B")
+("qpd"	"$(H"F(B")
+("qpfd"	"$A^d(B")
+("qpi"	"$(H"K(B")
+("qpko"	"$(Gsi(B")
+("qpmm"	"$(H;{(B")
+("qpou"	"$ALM(B")
+("qpp"	"$AEz(B")
+("qppa"	"$A?+(B")
+("qpr"	"$A>P(B")
+("qpru"	"$A1'(B")
+("qpt"	"$(H&s(B")
+("qptd"	"$A^i(B")
+("qpu"	"$(H$6(B")
+("qpuu"	"$(HC7(B")
+("qpyr"	"$(H<3(B")
+("qqhk"	"$(H;~(B")
+("qqkk"	"$AWa(B")
+("qqkq"	"$AEu(B")
+("qqmb"	"$(H5d(B")
+("qqo"	"$A7v(B")
+("qqoj"	"$(GvG(B")
+("qqou"	"$(HJW(B")
+("qqq"	"$(H;v(B")
+("qqu"	"$(H"L(B")
+("qr"	"$A?[(B")
+("qrau"	"$A^Z(B")
+("qrb"	"$A>h(B")
+("qrbc"	"$(Gd4(B")
+("qrrd"	"$A2Y(B")
+("qrrj"	"$(HP_(B")
+("qrsh"	"$A9U(B")
+("qrsj"	"$AR>(B")
+("qrsn"	"$A0F(B")
+("qruc"	"$AW+(B")
+("qrvp"	"$ACr(B")
+("qryo"	"$AW=(B")
+("qsav"	"$A^k(B")
+("qshr"	"$AUP(B")
+("qsj"	"$(H*e(B")
+("qsje"	"$(H5T(B")
+("qsjj"	"$(Gzl(B")
+("qsjl"	"$A^^(B")
+("qsjr"	"$A>](B")
+("qskr"	"$A^\(B")
+("qsll"	"$(H*W(B")
+("qsma"	"$A_!(B")
+("qsmb"	"$(GZa(B")
+("qsmg"	"$ANU_*(B")
+("qsmh"	"$(HJL(B")
+("qsmi"	"$(HP[(B")
+("qsmv"	"$(H5e(B")
+("qsp"	"$(H&z(B")
+("qsql"	"$AE2(B")
+("qsrj"	"$A_((B")
+("qsrr"	"$(HJG(B")
+("qss"	"$A>\(B")
+("qssr"	"$(H/9(B")
+("qstt"	"$A^p(B")
+("qstv"	"$A^x(B")
+("qsuu"	"$A>r(B")
+("qswu"	"$(G|_(B")
+("qsyq"	"$(HPa(B")
+("qta"	"$A4k(B")
+("qtak"	"$AC~(B")
+("qtav"	"$(HW0(B")
+("qtbc"	"$(H5[(B")
+("qtbf"	"$(Hab(B")
+("qtbk"	"$AHv(B")
+("qtbn"	"$(H;|(B")
+("qtc"	"$A90(B")
+("qtcl"	"$AK:(B")
+("qtco"	"$(Gl{(B")
+("qtct"	"$(HC&(B")
+("qtcw"	"$(H</(B")
+("qtkl"	"$(GvE(B")
+("qtm"	"$(H&t(B")
+("qtmc"	"$(H5fPY(B")
+("qtmv"	"$(H<$(B")
+("qtod"	"$A2k(B")
+("qtoe"	"$(Gsl(B")
+("qtog"	"$(G{a(B")
+("qtor"	"$A4n(B")
+("qtov"	"$(Haa(B")
+("qtpd"	"$(HW7(B")
+("qtqm"	"$A4j(B")
+("qtrk"	"$(HW2(B")
+("qtt"	"$AF4(B")
+("qttb"	"$(Gd8(B")
+("qttc"	"$(H5O(B")
+("qtub"	"$A^w(B")
+("qtw"	"$ACh(B")
+("qtwi"	"$A_$(B")
+("qtwv"	"$(HW6(B")
+("qtxc"	"$A^v(B")
+("qu"	"$ATz(B")
+("qud"	"$(HQ-(B")
+("qumb"	"$A4'(B")
+("quob"	"$(Gzm(B")
+("quog"	"$A4](B")
+("quu"	"$AW>(B")
+("quv"	"$(HI[(B")
+("qvid"	"$(Ha_(B")
+("qvis"	"$A^V(B")
+("qvno"	"$A^r(B")
+("qvoi"	"$(Hp7(B")
+("qvvd"	"$(HJZ(B")
+("qvvn"	"$A^Y(B")
+("qvvv"	"$(Ha`(B")
+("qwd"	"$A@&$(H5h(B")
+("qwg"	"$(H/I(B")
+("qwhr"	"$AAL(B")
+("qwim"	"$(Ghx(B")
+("qwjc"	"$(HJO(B")
+("qwkp"	"$A^t(B")
+("qwl"	"$AQ:(B")
+("qwli"	"$(HW3(B")
+("qwlj"	"$(Gpe(B")
+("qwlp"	"$(GvH(B")
+("qwlv"	"$A_'(B")
+("qwmv"	"$(H<2(B")
+("qwot"	"$(HC5(B")
+("qwp"	"$(H<1(B")
+("qwvf"	"$A^{(B")
+("qwwv"	"$(HeQ(B")
+("qwyi"	"$AD4(B")
+("qy"	"$AFK(B")
+("qyaj"	"$A5t(B")
+("qybb"	"$(Gpk$(H;y(B")
+("qybg"	"$(HmN(B")
+("qybk"	"$A37(B")
+("qybp"	"$(Gx9(B")
+("qybs"	"$(HC#(B")
+("qycb"	"$AU*(B")
+("qyck"	"$(H*V(B")
+("qyg"	"$AVt(B")
+("qygq"	"$(Gpa(B")
+("qyhj"	"$(HJQ(B")
+("qyhn"	"$A?9(B")
+("qyhr"	"$(HC:(B")
+("qyhv"	"$(H*c(B")
+("qyij"	"$AK$(B")
+("qyj"	"$A66(B")
+("qyjj"	"$(HJX(B")
+("qyk"	"$(GJP(B")
+("qylh"	"$(H/L(B")
+("qylm"	"$A36(B")
+("qymb"	"$(H5Z(B")
+("qyoj"	"$(H5N(B")
+("qyok"	"$AR4(B")
+("qypo"	"$(Gpc(B")
+("qypp"	"$(Ha^(B")
+("qyps"	"$(Gpd(B")
+("qypt"	"$(HeR(B")
+("qyr"	"$ADi(B")
+("qyrb"	"$A8c(B")
+("qyrf"	"$ABS(B")
+("qyrn"	"$(H;zeO(B")
+("qyrv"	"$AHA(B")
+("qysd"	"$(H<.(B")
+("qyt"	"$A@-(B")
+("qytg"	"$AW2(B")
+("qytr"	"$A^e(B")
+("qytu"	"$(HJV(B")
+("qytv"	"$A=S(B")
+("qyub"	"$(HJB(B")
+("qyvg"	"$(Gp_(B")
+("qyvw"	"$A4$(B")
+("qywm"	"$AIC(B")
+("qyx"	"$(Gsf(B")
+("qyy"	"$(H$)(B")
+("qyyb"	"$(Ha](B")
+("r"	"$A?Z(B")
+("raa"	"$A3*(B")
+("rail"	"$A_s(B")
+("ram"	"$(H%c(B")
+("ramj"	"$(H.C(B")
+("ranx"	"$(He@(B")
+("rapv"	"$A:H(B")
+("rase"	"$A`\(B")
+("rate"	"$(HaH(B")
+("rau"	"$A0IRX(B")
+("rav"	"$A_g(B")
+("raye"	"$(HCB(B")
+("rb"	"$(H$u(B")
+("rbbe"	"$(GpE(B")
+("rbbr"	"$(H:_(B")
+("rbcv"	"$(Gyc(B")
+("rbd"	"$(H4-(B")
+("rbdi"	"$(H.D(B")
+("rbgr"	"$A_z(B")
+("rbhaf"	"$(Gx%(B")
+("rbm"	"$A>W(B")
+("rbmr"	"$(H)A(B")
+("rbou"	"$(HB'(B")
+("rbsmr"	"$AKC(B")
+("rbuc"	"$(GT^$(H.<(B")
+("rbv"	"$(H.E(B")
+("rbwi"	"$A=@(B")
+("rc"	"$AV;0H(B")
+("rcim"	"$ANK(B")
+("rckn"	"$A`G(B")
+("rcks"	"$(G^:(B")
+("rcnl"	"$(HH.(B")
+("rcsh"	"$A7T(B")
+("rcwa"	"$A`a(B")
+("rd"	"$A4t(B")
+("rdam"	"$AT{(B")
+("rddf"	"$A`d(B")
+("rdhqu"	"$(H]9(B")
+("rdi"	"$(GGU(B")
+("rdk"	"$(H#9(B")
+("rdln"	"$A@.$(HOZ(B")
+("rdlo"	"$AKT(B")
+("rdm"	"$(H%k(B")
+("rdmq"	"$(H:^(B")
+("rdnl"	"$(H[$(B")
+("rdoo"	"$(H4+(B")
+("rede"	"$A`#(B")
+("reed"	"$AI$(B")
+("reee"	"$A`((B")
+("refh"	"$(H.3(B")
+("reoy"	"$A`K(B")
+("rf"	"$(H#=(B")
+("rfb"	"$AIZ(B")
+("rfba"	"$(GsG(B")
+("rfbc"	"$(HAy(B")
+("rfbw"	"$(Gp=(B")
+("rfd"	"$A_d(B")
+("rff"	"$A`"(B")
+("rffs"	"$(Gl1(B")
+("rfh"	"$A33(B")
+("rg"	"$AMB(B")
+("rgb"	"$(H%d(B")
+("rgbt"	"$AR-(B")
+("rgcc"	"$(GsI(B")
+("rgg"	"$AM[(B")
+("rggu"	"$(HOa(B")
+("rghaf"	"$(Hnr(B")
+("rgi"	"$(H%\(B")
+("rgit"	"$A`>(B")
+("rgkc"	"$(HkS(B")
+("rglc"	"$A_j(B")
+("rgnl"	"$A[+(B")
+("rgr"	"$A_R(B")
+("rgrr"	"$AN{(B")
+("rgsk"	"$A`;(B")
+("rgtj"	"$(H4)(B")
+("rgyo"	"$(H.5(B")
+("rhad"	"$(HI:(B")
+("rhaf"	"$(Gkx(B")
+("rhag"	"$(H:X(B")
+("rhaj"	"$A`F(B")
+("rhbk"	"$A`^(B")
+("rhbu"	"$AT[(B")
+("rhdf"	"$A`1(B")
+("rhdn"	"$(H.G(B")
+("rher"	"$A?)(B")
+("rhey"	"$A_K(B")
+("rhfd"	"$A:t(B")
+("rhg"	"$A3J(B")
+("rhgr"	"$(H.F(B")
+("rhhj"	"$AF!(B")
+("rhjd"	"$(H)D(B")
+("rhjm"	"$AMY(B")
+("rhjr"	"$(H)F(B")
+("rhjx"	"$(H:P(B")
+("rhkb"	"$(HOo(B")
+("rhml"	"$AL}(B")
+("rhmo"	"$AJI(B")
+("rhoa"	"$(H:W(B")
+("rhp"	"$A_8(B")
+("rhpm"	"$(H%n(B")
+("rhq"	"$(H#A(B")
+("rhqi"	"$AE6(B")
+("rhr"	"$(GIH(B")
+("rhrf"	"$(GcJ(B")
+("rhs"	"$AU&(B")
+("rhsk"	"$A`&$(HVM(B")
+("rht"	"$(H#B(B")
+("rhu"	"$APV(B")
+("rhuc"	"$(HmG(B")
+("rhuk"	"$APa(B")
+("rhvo"	"$A_I(B")
+("rhxe"	"$A`2(B")
+("rhxu"	"$(H4%(B")
+("rice"	"$AKt(B")
+("rihf"	"$A`R(B")
+("rihq"	"$A_h(B")
+("rihr"	"$A:0(B")
+("rihu"	"$AK1(B")
+("riil"	"$A`%(B")
+("rijb"	"$A28(B")
+("rijc"	"$ABo(B")
+("rik"	"$A7M(B")
+("rikf"	"$(H:O(B")
+("riog"	"$(Gv#(B")
+("riok"	"$A0&(B")
+("rir"	"$(H%h(B")
+("ritc"	"$(HaJ(B")
+("rite"	"$(H:L(B")
+("riuh"	"$(H.9(B")
+("rjal"	"$A`=(B")
+("rjbc"	"$A`A(B")
+("rjbd"	"$(H.A(B")
+("rjbf"	"$A`B`j(B")
+("rjbj"	"$A`+(B")
+("rjbo"	"$ALg(B")
+("rjbv"	"$A`l(B")
+("rjca"	"$(H\R(B")
+("rjd"	"$AN6(B")
+("rje"	"$AV((B")
+("rjhaf"	"$(Hou(B")
+("rjhr"	"$A?&(B")
+("rji"	"$Aj+$(Gp](B")
+("rjjb"	"$A30(B")
+("rjji"	"$(Gze(B")
+("rjkd"	"$AOx(B")
+("rjkp"	"$(H)M(B")
+("rjlo"	"$(H3{(B")
+("rjmm"	"$APz(B")
+("rjmmv"	"$(HgG(B")
+("rjmo"	"$A`$(B")
+("rjnl"	"$(HU"(B")
+("rjon"	"$(HI4(B")
+("rjpa"	"$AJH(B")
+("rjpn"	"$(GsF(B")
+("rjpu"	"$A`W(B")
+("rjqr"	"$(HAr(B")
+("rjr"	"$A9>(B")
+("rjstv"	"$(HmF(B")
+("rjtc"	"$(Gl;(B")
+("rka"	"$(HCI(B")
+("rkbu"	"$(HL0(B")
+("rkcf"	"$A`Z(B")
+("rki"	"$(H#8$A_>(B")
+("rkkb"	"$A_q(B")
+("rklb"	"$(H%l(B")
+("rklu"	"$(H3~(B")
+("rkn"	"$A_W(B")
+("rkoo"	"$(H.B(B")
+("rkp"	"$Am*(B")
+("rks"	"$AAm_7(B")
+("rksb"	"$(HAs(B")
+("rksr"	"$A?'(B")
+("rlb"	"$A5u(B")
+("rlln"	"$(H%`(B")
+("rlmc"	"$(HOi(B")
+("rlmo"	"$(H)C(B")
+("rlmt"	"$(H\N(B")
+("rlmy"	"$A7H(B")
+("rlwl"	"$AIk(B")
+("rlwv"	"$(Gh.(B")
+("rlx"	"$(Gl=(B")
+("rmam"	"$(H)<(B")
+("rmamh"	"$(HZo(B")
+("rmamo"	"$(HZn(B")
+("rmanw"	"$(HpT(B")
+("rmaph"	"$AL_(B")
+("rmasm"	"$AL#(B")
+("rmau"	"$(H9](B")
+("rmav"	"$A8z(B")
+("rmbb"	"$A`i(B")
+("rmbc"	"$(HAt(B")
+("rmbd"	"$A2H(B")
+("rmbe"	"$(HaF(B")
+("rmbhx"	"$A58(B")
+("rmbm"	"$(H@^(B")
+("rmbt"	"$AuG(B")
+("rmbue"	"$(Hqy(B")
+("rmbug"	"$(Hq@(B")
+("rmbvk"	"$Auh(B")
+("rmc"	"$AE?(B")
+("rmcw"	"$A_S$(H.6(B")
+("rmcwa"	"$A2d(B")
+("rmd"	"$ASu(B")
+("rmdam"	"$(HZm(B")
+("rmdhe"	"$AuK(B")
+("rmdk"	"$(H9[(B")
+("rmdm"	"$(He>(B")
+("rmea"	"$AL$(B")
+("rmf"	"$(H#?(B")
+("rmfb"	"$(HNE(B")
+("rmfbg"	"$(Hck(B")
+("rmfcb"	"$(H_i(B")
+("rmfdq"	"$(Hg<(B")
+("rmffe"	"$Aus(B")
+("rmfj"	"$(H%i(B")
+("rmfm"	"$AE^(B")
+("rmfq"	"$(H@V(B")
+("rmfqu"	"$(Go?(B")
+("rmgce"	"$(HTl(B")
+("rmgcg"	"$(HTb(B")
+("rmgdi"	"$(HGp(B")
+("rmgg"	"$(H4,$AuM(B")
+("rmggu"	"$(Gy,(B")
+("rmgni"	"$(G{/(B")
+("rmgt"	"$(H.4(B")
+("rmgyo"	"$(HNA(B")
+("rmhdf"	"$(HZs(B")
+("rmhdv"	"$(HTi(B")
+("rmhdw"	"$Aul(B")
+("rmher"	"$AB7(B")
+("rmhgu"	"$AuP(B")
+("rmhhw"	"$(H_h(B")
+("rmhjd"	"$(Gg"(B")
+("rmhjg"	"$Au`(B")
+("rmhkb"	"$(Hg@(B")
+("rmhlb"	"$Aua(B")
+("rmhlc"	"$(G{x(B")
+("rmhml"	"$(HPh(B")
+("rmhmy"	"$(H@a(B")
+("rmhnd"	"$A6e(B")
+("rmhoo"	"$(GwG$(Hcm(B")
+("rmhqo"	"$A5x(B")
+("rmhsb"	"$Aud(B")
+("rmhsk"	"$(Hj&(B")
+("rmhuc"	"$(Hq_(B")
+("rmiav"	"$AuT(B")
+("rmice"	"$(HNG(B")
+("rmig"	"$(H)?(B")
+("rmigi"	"$(Hn,(B")
+("rmii"	"$(Go9(B")
+("rmikk"	"$A0O(B")
+("rmir"	"$AuL(B")
+("rmite"	"$Aub(B")
+("rmitf"	"$(Hcd(B")
+("rmiwg"	"$Aup(B")
+("rmixp"	"$(Hce(B")
+("rmiyr"	"$AuZ(B")
+("rmjbc"	"$(H_f(B")
+("rmjcv"	"$(Hq>(B")
+("rmje"	"$(H9Z(B")
+("rmjk"	"$(HOd(B")
+("rmjkd"	"$(HNB(B")
+("rmjlo"	"$(HTa(B")
+("rmjnu"	"$(HT\(B")
+("rmjoa"	"$(Hcb(B")
+("rmjp"	"$AuI(B")
+("rmjr"	"$(H@X(B")
+("rmkmr"	"$(HTf(B")
+("rmkms"	"$A?g(B")
+("rmkn"	"$(HGn(B")
+("rmkpb"	"$(Hcj(B")
+("rmksr"	"$AuJ(B")
+("rmlb"	"$(H3|(B")
+("rmlk"	"$A_l(B")
+("rmlm"	"$(GY<(B")
+("rmlmc"	"$(Hg>(B")
+("rmlmo"	"$ALx(B")
+("rmlwp"	"$(HGs(B")
+("rmmcw"	"$(HGy(B")
+("rmmd"	"$(H3+(B")
+("rmmfb"	"$(HlD(B")
+("rmmig"	"$(HGq(B")
+("rmmp"	"$(HOb(B")
+("rmmr"	"$A_muE(B")
+("rmmrw"	"$(HZj(B")
+("rmmt"	"$AuB(B")
+("rmmto"	"$Auj(B")
+("rmn"	"$A6#(B")
+("rmnbs"	"$(GrM(B")
+("rmnhd"	"$Aue(B")
+("rmnhe"	"$AuA(B")
+("rmnib"	"$AS;(B")
+("rmnin"	"$(HGu(B")
+("rmnmu"	"$A9r(B")
+("rmnn"	"$A_V(B")
+("rmnoe"	"$(Hg=(B")
+("rmnot"	"$A5E(B")
+("rmnr"	"$A:G(B")
+("rmodi"	"$AuF(B")
+("rmog"	"$(HTk(B")
+("rmohh"	"$(H@_(B")
+("rmoip"	"$(HTm(B")
+("rmoir"	"$(H_j(B")
+("rmokr"	"$AuX(B")
+("rmomb"	"$(HTn(B")
+("rmomg"	"$(HGv(B")
+("rmomn"	"$(HZr(B")
+("rmomr"	"$(HGw(B")
+("rmon"	"$(H3*(B")
+("rmotq"	"$(HlE(B")
+("rmowy"	"$(HNF(B")
+("rmpfd"	"$(HTj(B")
+("rmpi"	"$Au@(B")
+("rmpmc"	"$(Hcg(B")
+("rmpru"	"$AE\(B")
+("rmpt"	"$(H@Y(B")
+("rmptd"	"$Au^(B")
+("rmqka"	"$(HZi(B")
+("rmqkx"	"$(Hcf(B")
+("rmqmc"	"$(GwH(B")
+("rmqo"	"$AuC(B")
+("rmrb"	"$A`C(B")
+("rmrrd"	"$ATj(B")
+("rmryo"	"$(HNJ(B")
+("rmsje"	"$(HTe(B")
+("rmsjj"	"$(G})(B")
+("rmsjr"	"$A>a(B")
+("rmsju"	"$(HN@(B")
+("rmsmg"	"$(G{0(B")
+("rmso"	"$AWD(B")
+("rmsp"	"$(H@[(B")
+("rmss"	"$A>`(B")
+("rmssr"	"$(Gk9(B")
+("rmstv"	"$(H_g(B")
+("rmsu"	"$A_@(B")
+("rmsup"	"$AuU(B")
+("rmta"	"$(HTc(B")
+("rmtag"	"$(G};(B")
+("rmtce"	"$(Hr.(B")
+("rmtco"	"$Auk(B")
+("rmtja"	"$A3y(B")
+("rmtkl"	"$(G{w(B")
+("rmtlb"	"$(GwE(B")
+("rmtmc"	"$(HTd(B")
+("rmtmv"	"$(HZk(B")
+("rmto"	"$A`Y(B")
+("rmtqa"	"$(Hq?(B")
+("rmtqm"	"$Auc(B")
+("rmtt"	"$(HGm(B")
+("rmttc"	"$(Go8(B")
+("rmtwa"	"$(Hci(B")
+("rmtwi"	"$A6W(B")
+("rmua"	"$(HOe(B")
+("rmubb"	"$A1D(B")
+("rmue"	"$A`D(B")
+("rmui"	"$A8B(B")
+("rmumb"	"$Au_(B")
+("rmvh"	"$AQ=(B")
+("rmvi"	"$(HA~(B")
+("rmvid"	"$(Hn/(B")
+("rmvim"	"$(Hn1(B")
+("rmvmi"	"$(Hcl(B")
+("rmvvv"	"$Auq(B")
+("rmwd"	"$AuW(B")
+("rmwf"	"$A`Q(B")
+("rmwg"	"$A`,(B")
+("rmwj"	"$(HOl(B")
+("rmwl"	"$(H:](B")
+("rmwli"	"$Aun(B")
+("rmwtj"	"$(GwI(B")
+("rmwv"	"$(H:Q(B")
+("rmyaj"	"$AuV(B")
+("rmybb"	"$ALc(B")
+("rmybp"	"$(HoT(B")
+("rmycb"	"$(Hcc(B")
+("rmyck"	"$AuS(B")
+("rmyf"	"$(HI/(B")
+("rmyfe"	"$(HTg(B")
+("rmyfu"	"$Aum(B")
+("rmyg"	"$(H@W(B")
+("rmygq"	"$(GzI(B")
+("rmyjj"	"$(Hch(B")
+("rmylc"	"$(Gfx(B")
+("rmylh"	"$(HNK(B")
+("rmylm"	"$AV:(B")
+("rmymp"	"$(HGr(B")
+("rmymu"	"$(Hn.(B")
+("rmyoj"	"$(HT_(B")
+("rmypo"	"$(Hj%(B")
+("rmyr"	"$(H@](B")
+("rmyrv"	"$(HpR(B")
+("rmytr"	"$Au[(B")
+("rmytv"	"$(HT^(B")
+("rmyx"	"$(G{1(B")
+("rnbg"	"$(H.H(B")
+("rnbj"	"$(HI9(B")
+("rnbk"	"$(G^P(B")
+("rnd"	"$(H"%(B")
+("rndu"	"$A:p(B")
+("rng"	"$(H#>(B")
+("rnhb"	"$(HOc(B")
+("rnhe"	"$AN|(B")
+("rnhx"	"$(GYM(B")
+("rnin"	"$A6_(B")
+("rnkm"	"$(H4$(B")
+("rnlr"	"$A0!(B")
+("rno"	"$A45(B")
+("rnri"	"$(Hhl(B")
+("rnwa"	"$(Gv<(B")
+("rob"	"$(GIQ(B")
+("rod"	"$A_](B")
+("rodi"	"$A8@(B")
+("rog"	"$AN((B")
+("roic"	"$(HI;(B")
+("roii"	"$A_J(B")
+("roin"	"$ARw(B")
+("roip"	"$(GYF(B")
+("roir"	"$(GcM$(H.@(B")
+("roj"	"$(H#@(B")
+("roll"	"$(H#E(B")
+("roma"	"$(HVN(B")
+("romd"	"$(H.I(B")
+("roml"	"$(GYJ(B")
+("romn"	"$ASw(B")
+("romo"	"$(HVO(B")
+("romr"	"$A9~I6(B")
+("romt"	"$(H:Y(B")
+("ron"	"$A3T(B")
+("ronk"	"$A:m(B")
+("roog"	"$A_r(B")
+("rop"	"$(H#:(B")
+("roq"	"$(H)E(B")
+("rosk"	"$A_^(B")
+("rotf"	"$(HOm(B")
+("royb"	"$A`_(B")
+("rp"	"$A_3(B")
+("rpa"	"$(H)P(B")
+("rph"	"$(H%[(B")
+("rphh"	"$ANG(B")
+("rpim"	"$(H#C(B")
+("rpln"	"$(H#0(B")
+("rpok"	"$(H*i(B")
+("rpou"	"$A_{(B")
+("rppa"	"$A`.(B")
+("rpr"	"$(H%f(B")
+("rpru"	"$AEX(B")
+("rptd"	"$A`)(B")
+("rpu"	"$A6V(B")
+("rpuc"	"$(Gp@(B")
+("rpuk"	"$(H)G(B")
+("rqha"	"$AE>(B")
+("rqhk"	"$(G^V(B")
+("rqhl"	"$A_n(B")
+("rqhu"	"$(Hp3(B")
+("rqjm"	"$(HI1(B")
+("rqkq"	"$A_t(B")
+("rqmc"	"$(Gh1(B")
+("rqmf"	"$A`<(B")
+("rqmn"	"$(H%^(B")
+("rqyt"	"$A@2(B")
+("rrau"	"$(H.=(B")
+("rrbyj"	"$(H<?(B")
+("rrf"	"$(H:V(B")
+("rrhaf"	"$(G|z(B")
+("rrhn"	"$AVd(B")
+("rrik"	"$A?^$(GxK(B")
+("rrikr"	"$AFw(B")
+("rrill"	"$(H:Z(B")
+("rrmcr"	"$(Gzf(B")
+("rrmmk"	"$(Gyd(B")
+("rrmms"	"$(H)L(B")
+("rrms"	"$(H%b(B")
+("rrnl"	"$(H3=(B")
+("rrr"	"$AF7(B")
+("rrrd"	"$ATk$(HAz(B")
+("rrrj"	"$(HOj(B")
+("rrrr"	"$(HL:(B")
+("rrru"	"$(H:[;I(B")
+("rrslr"	"$(HaI(B")
+("rruc"	"$(HOh(B")
+("rrvlr"	"$(HI7(B")
+("rrvp"	"$(H%j(B")
+("rrwj"	"$(G^L(B")
+("rrwmu"	"$(HqT(B")
+("rryo"	"$(H.>(B")
+("rsbn"	"$A`'(B")
+("rsh"	"$A_6(B")
+("rshaf"	"$(H\2k5(B")
+("rsit"	"$(H\S(B")
+("rsj"	"$(H)=)I(B")
+("rsjj"	"$(Gzd(B")
+("rsl"	"$A_5(B")
+("rslb"	"$A_F(B")
+("rsln"	"$(GI1(B")
+("rsm"	"$A5p(B")
+("rsmbc"	"$(Gwo(B")
+("rsme"	"$(H.:(B")
+("rsmg"	"$A`8$(H\U(B")
+("rsmh"	"$(Gh4(B")
+("rsmi"	"$(HOg(B")
+("rsmj"	"$(H\T(B")
+("rsnl"	"$A6u(B")
+("rso"	"$(GIB(B")
+("rsp"	"$ADX(B")
+("rsqf"	"$(GcC(B")
+("rsql"	"$ADD(B")
+("rsrr"	"$(Gh+(B")
+("rsuu"	"$(H4"(B")
+("rsyi"	"$(G|](B")
+("rsypu"	"$(Gf@(B")
+("rta"	"$(H3}(B")
+("rtak"	"$(HI2(B")
+("rtav"	"$A8A(B")
+("rtc"	"$A:e(B")
+("rtcl"	"$AK;(B")
+("rtco"	"$A`[(B")
+("rtct"	"$A`I(B")
+("rtgi"	"$(G{Y(B")
+("rtgu"	"$(H3y(B")
+("rtk"	"$A0%(B")
+("rtkr"	"$A_v(B")
+("rtlf"	"$(Gx,(B")
+("rtlo"	"$(Gh,(B")
+("rtm"	"$(H%](B")
+("rtmc"	"$(H4*(B")
+("rtmj"	"$(Gl7(B")
+("rtmv"	"$(H:\(B")
+("rtnd"	"$(G|4(B")
+("rtod"	"$(HA}(B")
+("rtoe"	"$(H\P(B")
+("rtor"	"$A`*(B")
+("rtq"	"$A_c(B")
+("rtqm"	"$A`5(B")
+("rtrg"	"$(HkT(B")
+("rtub"	"$A`J(B")
+("rtw"	"$A_w(B")
+("rtwa"	"$A`P(B")
+("rtwi"	"$(HO_mE(B")
+("rtwv"	"$(GpC(B")
+("rtxc"	"$(HAp(B")
+("rtyb"	"$A`c(B")
+("ru"	"$AKH(B")
+("rumb"	"$A4-(B")
+("rumi"	"$A`M(B")
+("runl"	"$(H[#(B")
+("ruog"	"$(HI8(B")
+("ruoiv"	"$AwR(B")
+("rutc"	"$AYc(B")
+("ruu"	"$A_M(B")
+("rve"	"$A_N(B")
+("rvfi"	"$(G^O(B")
+("rvi"	"$A_:(B")
+("rvii"	"$(Gl>(B")
+("rvis"	"$A_O(B")
+("rvl"	"$A=P(B")
+("rvnk"	"$(GIF(B")
+("rvno"	"$A`9(B")
+("rvp"	"$ACq(B")
+("rvvu"	"$(HB#(B")
+("rwb"	"$A`0(B")
+("rwc"	"$(H%e(B")
+("rwg"	"$AA((B")
+("rwgf"	"$A:Y(B")
+("rwgg"	"$(HaG(B")
+("rwim"	"$(HI6(B")
+("rwk"	"$AQJ(B")
+("rwkp"	"$A`E(B")
+("rwl"	"$A_H(B")
+("rwlb"	"$A`/(B")
+("rwlc"	"$(HOn(B")
+("rwlg"	"$(G{[(B")
+("rwli"	"$(HVL(B")
+("rwlv"	"$(HVI(B")
+("rwmv"	"$AN9(B")
+("rwnl"	"$A1I(B")
+("rwot"	"$(HB!(B")
+("rwtj"	"$(Gh5(B")
+("rwyi"	"$(H%m(B")
+("rxu"	"$(HHu(B")
+("ryaj"	"$(H4#(B")
+("ryao"	"$(HVP(B")
+("rybb"	"$ALd(B")
+("rybp"	"$(Gx-(B")
+("rybs"	"$(HB&(B")
+("rycb"	"$A`V(B")
+("ryck"	"$AR'(B")
+("rydg"	"$(HkR(B")
+("rydu"	"$(He<(B")
+("ryfu"	"$(HO^(B")
+("rygq"	"$(HVH(B")
+("ryhc"	"$(HeA(B")
+("ryhh"	"$(H:M(B")
+("ryhn"	"$A?T(B")
+("ryib"	"$A`!(B")
+("ryjj"	"$(HI<(B")
+("ryk"	"$(H#<(B")
+("rymb"	"$A?P(B")
+("rymh"	"$(HVK(B")
+("rymp"	"$A_Z(B")
+("rymr"	"$AQd(B")
+("rymu"	"$(HaK(B")
+("ryo"	"$AWc(B")
+("ryoj"	"$A_}(B")
+("rypb"	"$AWl(B")
+("rypd"	"$(HA|(B")
+("rypk"	"$(HVJ(B")
+("rypm"	"$(Gl8(B")
+("rypo"	"$A`e(B")
+("rypt"	"$(He?(B")
+("rypu"	"$A;#(B")
+("ryr"	"$(H%a(B")
+("ryrb"	"$(HAo(B")
+("ryrd"	"$(H3w(B")
+("ryrn"	"$A:_(B")
+("ryro"	"$A:?(B")
+("ryru"	"$(H:K(B")
+("ryrv"	"$AHB(B")
+("rysk"	"$A`U(B")
+("rysy"	"$(H4((B")
+("ryta"	"$A`3(B")
+("rytp"	"$A`f(B")
+("rytv"	"$A_~(B")
+("ryvg"	"$(HVG(B")
+("ryvo"	"$A?H(B")
+("rywe"	"$(H\Q(B")
+("ryx"	"$(H\M(B")
+("s"	"$AJ,(B")
+("sahaf"	"$(Hnq(B")
+("sahni"	"$(Hj`(B")
+("sammu"	"$(HR~(B")
+("sav"	"$(H)6(B")
+("sbcc"	"$(Hp6(B")
+("sbhg"	"$(HJb(B")
+("sbln"	"$AK"(B")
+("sbug"	"$(Hhj(B")
+("sc"	"$AF%(B")
+("schaf"	"$(HV:(B")
+("schne"	"$A5n(B")
+("scwa"	"$(GlR(B")
+("se"	"$ADr(B")
+("seb"	"$(GaM$AMN(B")
+("sebuc"	"$(Go0$(Hca(B")
+("sec"	"$(H[P(B")
+("sed"	"$(H<h(B")
+("sef"	"$(H=b(B")
+("seg"	"$(GYR$(HVX(B")
+("sehaf"	"$(Hnp(B")
+("selmi"	"$(HMw(B")
+("semcw"	"$(GwP(B")
+("semgi"	"$(HXN(B")
+("semoo"	"$(Hau(B")
+("semr"	"$(HEX(B")
+("semrt"	"$(Go((B")
+("seog"	"$(Gc>(B")
+("seooo"	"$A>[(B")
+("seq"	"$(H;u(B")
+("sesmm"	"$Ath(B")
+("sev"	"$AH"$(H4qI](B")
+("sevif"	"$(Gj;$(H^L(B")
+("sewgf"	"$(Hp'(B")
+("sfa"	"$(HO<(B")
+("sfajv"	"$(Hji(B")
+("sfamj"	"$(H`k(B")
+("sfamo"	"$(Hh((B")
+("sfapp"	"$(Hd[(B")
+("sfapv"	"$(Hh-(B")
+("sfb"	"$AP<(B")
+("sfbbr"	"$(Hh)(B")
+("sfbgr"	"$(Hdb(B")
+("sfbm"	"$(HUs(B")
+("sfbmr"	"$(H[u(B")
+("sfbr"	"$(HUu(B")
+("sfbvk"	"$(Hjj(B")
+("sfcru"	"$(H`m(B")
+("sfcwa"	"$(HnH(B")
+("sfd"	"$AJ:(B")
+("sfdi"	"$AN>(B")
+("sfdk"	"$(HO;(B")
+("sfdl"	"$(H`g(B")
+("sfdoo"	"$(HdZ(B")
+("sfe"	"$(Gc&(B")
+("sfeii"	"$(GzW(B")
+("sffdq"	"$(HnG(B")
+("sfggu"	"$(G|'(B")
+("sfhag"	"$(Hh,(B")
+("sfhdp"	"$(Hjk(B")
+("sfher"	"$(Gs/(B")
+("sfhgu"	"$(H[s(B")
+("sfhhw"	"$(Hjo(B")
+("sfhi"	"$(Hjn(B")
+("sfhkb"	"$(G|&(B")
+("sfhni"	"$(Hgv(B")
+("sfhp"	"$(HHk(B")
+("sfhsb"	"$(GyR(B")
+("sfhsm"	"$(Hjp(B")
+("sfhwp"	"$(Hli(B")
+("sfhxe"	"$(Hjl(B")
+("sfiav"	"$(H`e(B")
+("sfice"	"$(Gv,(B")
+("sfihu"	"$(HO=(B")
+("sfiih"	"$(Hlj(B")
+("sfij"	"$(H[o(B")
+("sfiok"	"$(H`o(B")
+("sfir"	"$(HUw(B")
+("sfit"	"$(H`f(B")
+("sfiuh"	"$(H`h(B")
+("sfjig"	"$(Ho`(B")
+("sfjmc"	"$(Hpa(B")
+("sfjp"	"$(Gov(B")
+("sfk"	"$(Ggj(B")
+("sfkk"	"$(Gkr(B")
+("sfkmr"	"$(Gww(B")
+("sfl"	"$(HO@(B")
+("sflk"	"$(Goy(B")
+("sflll"	"$(Ggk(B")
+("sflmo"	"$(H[r(B")
+("sflmy"	"$(Hd^(B")
+("sflpc"	"$(G}8(B")
+("sflw"	"$(HUt(B")
+("sflws"	"$(Gv+(B")
+("sflx"	"$(HnJ(B")
+("sfmbu"	"$(Hr$(B")
+("sfmfj"	"$(HUp(B")
+("sfmfm"	"$(HUr(B")
+("sfmhf"	"$(GzX(B")
+("sfmig"	"$(H[p(B")
+("sfmj"	"$(HHj(B")
+("sfmmp"	"$(G}G(B")
+("sfmwf"	"$(G{E(B")
+("sfmwj"	"$(HnI(B")
+("sfmwv"	"$(Hh"(B")
+("sfnhb"	"$(HnL(B")
+("sfnhd"	"$(Hh#(B")
+("sfnhe"	"$(HO>(B")
+("sfnkq"	"$(Hh$(B")
+("sfnok"	"$(Hh%(B")
+("sfnoo"	"$(Hh&(B")
+("sfodi"	"$(Go}(B")
+("sfog"	"$(Hd`(B")
+("sfohh"	"$(HUy(B")
+("sfoii"	"$(HUv(B")
+("sfok"	"$(HOA(B")
+("sfomd"	"$(H`n(B")
+("sfomg"	"$(H[t(B")
+("sfomo"	"$(G|S(B")
+("sfomr"	"$(Hda(B")
+("sfpd"	"$(Ggi(B")
+("sfph"	"$(HUo(B")
+("sfpi"	"$(HHl(B")
+("sfpou"	"$(Hd_(B")
+("sfpr"	"$(Go|(B")
+("sfpuu"	"$(Hjm(B")
+("sfqjr"	"$(Hh+(B")
+("sfrb"	"$(H`l(B")
+("sfrrj"	"$(HnO(B")
+("sfrye"	"$(Hh'(B")
+("sfseo"	"$(G|u(B")
+("sfsff"	"$(Hr;(B")
+("sfshr"	"$(HUx(B")
+("sfsj"	"$(H[n(B")
+("sfsma"	"$(Hlg(B")
+("sfsme"	"$(H`i(B")
+("sfsnd"	"$(HnK(B")
+("sfsrr"	"$(G{D(B")
+("sfss"	"$(HUq(B")
+("sfssr"	"$(H`j(B")
+("sft"	"$(HHm(B")
+("sftaj"	"$(Hjh(B")
+("sftbn"	"$(Hh!(B")
+("sftjd"	"$(Hr%(B")
+("sftlf"	"$(Hqe(B")
+("sftlm"	"$(Hlf(B")
+("sftmc"	"$(HdY(B")
+("sftmj"	"$(HnM(B")
+("sftrg"	"$(Hr2(B")
+("sftt"	"$(Gs.(B")
+("sfuce"	"$(Hh*(B")
+("sfuob"	"$(Hr3(B")
+("sfvne"	"$(Hd](B")
+("sfwc"	"$(Gox(B")
+("sfwd"	"$(Hd\(B")
+("sfwk"	"$(H[q(B")
+("sfwlj"	"$(G|R(B")
+("sfwtj"	"$(Hlh(B")
+("sfwvf"	"$(G{G(B")
+("sfyck"	"$(H[m(B")
+("sfydk"	"$(HnP(B")
+("sfyg"	"$(Gow(B")
+("sfyhv"	"$(HZC(B")
+("sfypm"	"$(HnN(B")
+("sfypt"	"$(G}7(B")
+("sfyrv"	"$(Hr#(B")
+("sfytj"	"$(H`dlm(B")
+("sfyvo"	"$(Gs-(B")
+("sfywm"	"$(Hoa(B")
+("sghaf"	"$(HqN(B")
+("sgi"	"$A4A(B")
+("sgjwp"	"$(G{o(B")
+("sgks"	"$(GL4(B")
+("sgln"	"$(H3m(B")
+("sh"	"$A56(B")
+("shaf"	"$(HOK(B")
+("shaph"	"$(Hdf(B")
+("shawe"	"$(Hlq(B")
+("shbb"	"$(Hdg(B")
+("shbt"	"$(HVE(B")
+("shcwa"	"$(HnR(B")
+("shdbn"	"$(Hh1(B")
+("shdci"	"$(Gwz(B")
+("shdhe"	"$(HV!(B")
+("shfb"	"$(H`q(B")
+("shfqu"	"$Aw\(B")
+("shgb"	"$AwW(B")
+("shgr"	"$AwY(B")
+("shhaf"	"$(HHrng(B")
+("shhdn"	"$(H`s(B")
+("shhej"	"$(H`t(B")
+("shhhc"	"$(G|)(B")
+("shhjr"	"$(H[{(B")
+("shhqu"	"$AwV(B")
+("shi"	"$AHPB>(B")
+("shiih"	"$(Hlr(B")
+("shikk"	"$(Gp!(B")
+("shjbc"	"$(Hjv(B")
+("shjmc"	"$(G|v(B")
+("shjmf"	"$AWW(B")
+("shjpa"	"$(Hju(B")
+("shjrb"	"$(GyS(B")
+("shkmb"	"$(Hh2(B")
+("shlbu"	"$(HOD(B")
+("shmbc"	"$(Hj_(B")
+("shmfm"	"$(HU|(B")
+("shml"	"$A=3(B")
+("shmu"	"$AwU(B")
+("shnih"	"$(HU~(B")
+("shnl"	"$(HNU(B")
+("shob"	"$(HaN(B")
+("shod"	"$(HP*$Aw[(B")
+("shoe"	"$AelBD(B")
+("shog"	"$(Hgf(B")
+("shoma"	"$(Hod(B")
+("shoo"	"$Aeo(B")
+("shoog"	"$(H`r(B")
+("shot"	"$(GYt(B")
+("shov"	"$(GsT(B")
+("shpru"	"$(HV"(B")
+("shqka"	"$(Hh0(B")
+("shqu"	"$AN2(B")
+("shr"	"$AUY(B")
+("shsb"	"$AXR(B")
+("shshr"	"$AwX(B")
+("shsj"	"$(H[z(B")
+("shtak"	"$(Hlo(B")
+("shtbn"	"$(Hh/(B")
+("shtlb"	"$(Hlp(B")
+("shtw"	"$(H[}(B")
+("shtwv"	"$(Hob(B")
+("shtxc"	"$(Hjw(B")
+("shvvv"	"$Aw`(B")
+("shwlv"	"$Aw_(B")
+("shyhs"	"$(HOC(B")
+("shymp"	"$AwZ(B")
+("shyrv"	"$(Hr&(B")
+("sibt"	"$(Giq(B")
+("sif"	"$AlY(B")
+("sihhh"	"$AwT(B")
+("sihk"	"$(H:((B")
+("sihml"	"$(Hp~(B")
+("sihq"	"$(HQ|(B")
+("sihqo"	"$(HA?(B")
+("sikcf"	"$(Hgc(B")
+("silq"	"$AKA(B")
+("sinl"	"$(HT~(B")
+("sip"	"$AHLN?(B")
+("sisuu"	"$(HUN(B")
+("siyhv"	"$(GuE(B")
+("sj"	"$A6z(B")
+("sjb"	"$A1[(B")
+("sjc"	"$(H&:(B")
+("sjcim"	"$(HYS(B")
+("sjd"	"$Ai^(B")
+("sje"	"$AH!(B")
+("sjenl"	"$(H9m(B")
+("sjf"	"$A9"(B")
+("sjfd"	"$(Hf8(B")
+("sjg"	"$A1Z(B")
+("sjgb"	"$Aqu(B")
+("sjgr"	"$(H?,(B")
+("sjhaf"	"$(Hps(B")
+("sjhhl"	"$AAD(B")
+("sjhjr"	"$Aqx(B")
+("sjhqu"	"$(H0!(B")
+("sjhwp"	"$(Gty(B")
+("sjirm"	"$(HM)(B")
+("sjjcm"	"$(HM*(B")
+("sjjn"	"$(H3r(B")
+("sjjpn"	"$(Hi_(B")
+("sjka"	"$AM@(B")
+("sjkf"	"$(HaO(B")
+("sjki"	"$(H2+(B")
+("sjlb"	"$(HVw(B")
+("sjlbu"	"$A5"(B")
+("sjlmc"	"$(Hbh(B")
+("sjln"	"$(H%P(B")
+("sjlws"	"$AF8(B")
+("sjmbc"	"$(Hq|(B")
+("sjmbl"	"$(H?+(B")
+("sjmgi"	"$Ah5(B")
+("sjmn"	"$Aqt(B")
+("sjmvn"	"$Aj6(B")
+("sjmym"	"$(H8F(B")
+("sjncr"	"$(HfJ(B")
+("sjnl"	"$AR.(B")
+("sjnok"	"$(HS&(B")
+("sjoii"	"$Aqv(B")
+("sjoin"	"$(H2,(B")
+("sjp"	"$(GUD$(H\k(B")
+("sjq"	"$Ak"(B")
+("sjr"	"$A>S(B")
+("sjrxu"	"$(Hqn(B")
+("sjryo"	"$(Hj'(B")
+("sjsh"	"$AE|(B")
+("sjsj"	"$(H?*(B")
+("sjsjj"	"$(Gw+(B")
+("sju"	"$(H$s(B")
+("sjv"	"$AfT(B")
+("sjvif"	"$(HfA(B")
+("sjvis"	"$(H8H(B")
+("sjvit"	"$(Gtz(B")
+("sjyhv"	"$AtE(B")
+("sjyia"	"$(Gw*(B")
+("sjymr"	"$AF)(B")
+("sjyrn"	"$(HS%(B")
+("sk"	"$AR|(B")
+("skn"	"$Aej(B")
+("skr"	"$A>}(B")
+("slb"	"$ATQ(B")
+("slmbc"	"$(Gs&(B")
+("slmc"	"$(Gh$(B")
+("slmy"	"$A7K$(GYu(B")
+("slo"	"$(GO:(B")
+("slorr"	"$(Gu'(B")
+("slqmc"	"$(Hc^(B")
+("slsl"	"$A3<(B")
+("slsll"	"$(H?7(B")
+("slwv"	"$(GhX(B")
+("sm"	"$A5s(B")
+("smamo"	"$(HS$(B")
+("smbjj"	"$(HS"(B")
+("smblb"	"$AVc(B")
+("smcsh"	"$(H2((B")
+("smdhe"	"$(H8=(B")
+("smg"	"$A?o(B")
+("smha"	"$(G\d(B")
+("smhaf"	"$(Ha4(B")
+("smhqo"	"$(H8>(B")
+("smhqu"	"$(H0$(B")
+("smig"	"$AN](B")
+("smikk"	"$(H8@(B")
+("smkoo"	"$(HF7(B")
+("sml"	"$(H2)(B")
+("smm"	"$(H,q(B")
+("smmbc"	"$(HUc(B")
+("smmri"	"$(G^r(B")
+("smnp"	"$(GPo(B")
+("smog"	"$A5T(B")
+("smohh"	"$(H8A(B")
+("smonk"	"$(HR}(B")
+("smpr"	"$(H8?(B")
+("smr"	"$AK>(B")
+("smsim"	"$ASp(B")
+("smt"	"$At`(B")
+("smuce"	"$(HS!(B")
+("smv"	"$(GO[(B")
+("smwtc"	"$ARm(B")
+("smyjj"	"$(H^R(B")
+("smyoj"	"$A4d(B")
+("smyrb"	"$(HYP(B")
+("smyrf"	"$(HM'(B")
+("smyt"	"$ARn$(H8<(B")
+("smytv"	"$(HM%(B")
+("sndd"	"$Aen(B")
+("snlr"	"$Aem(B")
+("so"	"$A3_(B")
+("somr"	"$(H%X(B")
+("sonl"	"$A[8(B")
+("sorc"	"$Aek(B")
+("sp"	"$ADa(B")
+("spd"	"$(H!M(B")
+("sphaf"	"$(Hd~(B")
+("sphh"	"$(H"!(B")
+("spp"	"$AF((B")
+("sqnl"	"$ADG(B")
+("sqsf"	"$(GXk(B")
+("sr"	"$AXO(B")
+("srbt"	"$(Hb@(B")
+("srbuu"	"$(H@8(B")
+("srf"	"$(H6r(B")
+("srhaf"	"$(G|/$(He(hN(B")
+("srhg"	"$(Ge{(B")
+("srhne"	"$(GmH(B")
+("srks"	"$A[?(B")
+("srlb"	"$(H)y(B")
+("srmbc"	"$(H[e(B")
+("srmvn"	"$(GqH(B")
+("srnl"	"$AI[?$(B")
+("srno"	"$(GmD(B")
+("srp"	"$Am+(B")
+("srrj"	"$(HI,(B")
+("srrr"	"$(GY4(B")
+("srsl"	"$(H#5(B")
+("srtq"	"$AH:(B")
+("srye"	"$(HPe(B")
+("srytj"	"$A1Y(B")
+("ss"	"$A>^(B")
+("ssf"	"$(HXD(B")
+("sskll"	"$(H^\(B")
+("sslii"	"$(H_9(B")
+("ssr"	"$A>V(B")
+("ssu"	"$A0<(B")
+("stkr"	"$ADd(B")
+("stqq"	"$Aeq(B")
+("stt"	"$AFA(B")
+("stv"	"$AU9(B")
+("su"	"$A<:RQ(B")
+("suf"	"$ANu(B")
+("sug"	"$(GM#(B")
+("suhaf"	"$(HhO(B")
+("suhu"	"$AYn(B")
+("sund"	"$(GU"(B")
+("sunl"	"$(H"u(B")
+("suok"	"$A8D(B")
+("sup"	"$A<I(B")
+("sut"	"$ARl(B")
+("suu"	"$AG|(B")
+("suv"	"$(H",BM(B")
+("svhaf"	"$(Hk/(B")
+("svnl"	"$A[1(B")
+("sw"	"$(H&;(B")
+("swbt"	"$(G||(B")
+("swbuu"	"$(G{*(B")
+("swc"	"$(G{}(B")
+("swl"	"$AO;(B")
+("syhn"	"$(H""(B")
+("sytj"	"$(H.l(B")
+("syyi"	"$(Gzh(B")
+("syyq"	"$AO,(B")
+("t"	"$AX%(B")
+("ta"	"$ANt(B")
+("taa"	"$A]E(B")
+("tab"	"$ACH(B")
+("tabu"	"$(HFe(B")
+("tadhe"	"$(HE<(B")
+("tagi"	"$(HMI(B")
+("tahaf"	"$(GyZ(B")
+("tahml"	"$(H<A(B")
+("tahs"	"$(HFh(B")
+("taiu"	"$(HFb(B")
+("taj"	"$A2](B")
+("tak"	"$AD*(B")
+("taka"	"$AD:(B")
+("takb"	"$AD;(B")
+("takf"	"$(G{F(B")
+("takg"	"$AD9(B")
+("takp"	"$AD=(B")
+("takq"	"$AD!(B")
+("taks"	"$AD<(B")
+("taln"	"$(H.+(B")
+("tan"	"$(H?s(B")
+("tanb"	"$(HYq(B")
+("tang"	"$(Gz4(B")
+("tanp"	"$(HYp(B")
+("tanw"	"$(G{"(B")
+("tapp"	"$(H?Y(B")
+("tapv"	"$A8p(B")
+("tase"	"$A^)(B")
+("tau"	"$A0E(B")
+("tav"	"$A]"(B")
+("tawe"	"$AB{(B")
+("tbac"	"$(HM9(B")
+("tbau"	"$(H?](B")
+("tbbb"	"$(HMJ(B")
+("tbbe"	"$(H^u(B")
+("tbbq"	"$(HYs(B")
+("tbbr"	"$(Gf8(B")
+("tbbu"	"$(H^v(B")
+("tbbuu"	"$(H_H(B")
+("tbc"	"$A5d(B")
+("tbcn"	"$(HFf(B")
+("tbcsh"	"$(H\B(B")
+("tbcv"	"$(Hl*(B")
+("tbd"	"$A2KiC(B")
+("tbfe"	"$ALY(B")
+("tbg"	"$AK\(B")
+("tbhg"	"$(Hb~(B")
+("tbhs"	"$(HG#(B")
+("tbhu"	"$ACj(B")
+("tbijb"	"$Amk(B")
+("tbikk"	"$Amj(B")
+("tbjj"	"$(Gf.(B")
+("tbks"	"$(HO\(B")
+("tbli"	"$(Gx`(B")
+("tbln"	"$AG0Xa(B")
+("tbm"	"$A\Z(B")
+("tbmbc"	"$(Hgrj](B")
+("tbme"	"$(HFj(B")
+("tbmo"	"$ACI(B")
+("tbmr"	"$A\m(B")
+("tbms"	"$(H8{(B")
+("tbmw"	"$(HFS(B")
+("tbnd"	"$A]3(B")
+("tbnf"	"$A<e(B")
+("tbnh"	"$A<t(B")
+("tbni"	"$(HM:(B")
+("tbnm"	"$Ate(B")
+("tbof"	"$A2L(B")
+("tbok"	"$AI"(B")
+("tbp"	"$(HJ)(B")
+("tbpr"	"$(HFn(B")
+("tbse"	"$A]J(B")
+("tbtv"	"$(H?[(B")
+("tbu"	"$A\Y(B")
+("tbud"	"$(HST(B")
+("tbuk"	"$(Hb{(B")
+("tbul"	"$(H^o(B")
+("tbut"	"$(H?r(B")
+("tbuu"	"$(G]'(B")
+("tbv"	"$A]4(B")
+("tbyj"	"$(HJ\(B")
+("tc"	"$A92$(H?c(B")
+("tca"	"$AFU(B")
+("tcb"	"$AFZ(B")
+("tcbt"	"$ARf(B")
+("tcfb"	"$Ami(B")
+("tcg"	"$A;y(B")
+("tchaf"	"$(Hm"o}(B")
+("tche"	"$AYg(B")
+("tchml"	"$AK9(B")
+("tcim"	"$A]n(B")
+("tcjwj"	"$(HH#(B")
+("tclmi"	"$(H@!(B")
+("tcmr"	"$(IC7(B")
+("tcno"	"$AF[G8(B")
+("tcp"	"$A9'$(H;`(B")
+("tcq"	"$(H/3(B")
+("tcru"	"$AOo$(H8n(B")
+("tcsd"	"$(G_~(B")
+("tcsh"	"$A7R(B")
+("tcst"	"$(HG((B")
+("tctd"	"$(GdF(B")
+("tcte"	"$(Gv;(B")
+("tcvif"	"$Atk(B")
+("tcwm"	"$AGu(B")
+("tcyg"	"$(Ha:(B")
+("tcyj"	"$(HW=(B")
+("tcymr"	"$(HTH(B")
+("tdb"	"$(H2@(B")
+("tdbb"	"$(HYk(B")
+("tdbk"	"$(HMX(B")
+("tdbn"	"$(H?Q(B")
+("tdbu"	"$A]Y(B")
+("tdci"	"$A]?(B")
+("tdd"	"$(H?o(B")
+("tdhaf"	"$(Hnh(B")
+("tdhl"	"$A]>(B")
+("tdj"	"$A\T(B")
+("tdk"	"$(H(X(B")
+("tdlc"	"$(Hig(B")
+("tdlo"	"$A]x(B")
+("tdm"	"$A1=(B")
+("tdmq"	"$(Gf2(B")
+("tdnl"	"$(Gr](B")
+("tdoo"	"$(Gab(B")
+("tdr"	"$(H8g(B")
+("tdsr"	"$(HfZ(B")
+("tdw"	"$(H?n(B")
+("tdwf"	"$(HFZ(B")
+("teah"	"$(Gr$(B")
+("tebm"	"$A]O(B")
+("tec"	"$(G}D(B")
+("ted"	"$(H8u(B")
+("tede"	"$A2$(B")
+("tefh"	"$AI/(B")
+("tege"	"$(Gn`(B")
+("tehr"	"$ABd$(HFO(B")
+("tehv"	"$A]e(B")
+("tehw"	"$A7*(B")
+("teib"	"$AFQ(B")
+("teii"	"$A1!(B")
+("teiv"	"$A]u(B")
+("telu"	"$(H8](B")
+("tem"	"$A\|(B")
+("temf"	"$(Hc#(B")
+("temj"	"$AF<$(HfQ(B")
+("temr"	"$A:J(B")
+("tene"	"$(H8v(B")
+("teod"	"$(HM4(B")
+("teom"	"$(HpJ(B")
+("teon"	"$(HYg(B")
+("teot"	"$(Gja(B")
+("terd"	"$ATe(B")
+("tesd"	"$A^!(B")
+("tesr"	"$(H?l(B")
+("tess"	"$(H?k(B")
+("tesu"	"$A76(B")
+("tett"	"$(HFN(B")
+("tewb"	"$(HYe(B")
+("tewt"	"$(H^a(B")
+("teyb"	"$(H^`(B")
+("teye"	"$(HSd(B")
+("teyu"	"$(HFy(B")
+("teyv"	"$AC#(B")
+("tf"	"$(H(b(B")
+("tfaj"	"$(HS>(B")
+("tfb"	"$(H8z(B")
+("tfbk"	"$A1N(B")
+("tfbn"	"$(HFd(B")
+("tff"	"$(H?J(B")
+("tfff"	"$(Hbp(B")
+("tfkc"	"$(HoC(B")
+("tfku"	"$(Hr-(B")
+("tfmc"	"$(H^e(B")
+("tfmu"	"$(H2F(B")
+("tfnl"	"$(HgH(B")
+("tfqu"	"$(H?I(B")
+("tg"	"$A\6(B")
+("tgb"	"$A\[(B")
+("tgbuu"	"$(G}((B")
+("tgce"	"$AAb(B")
+("tgdi"	"$(GhW(B")
+("tgeno"	"$(Gey(B")
+("tgf"	"$A8a(B")
+("tgftk"	"$A8~(B")
+("tgg"	"$(H2<(B")
+("tggi"	"$A]W$(HSC(B")
+("tggu"	"$(HYj(B")
+("tghaf"	"$(G}I(B")
+("tghds"	"$AtK(B")
+("tghni"	"$(Hq~(B")
+("tghqi"	"$(Gex(B")
+("tghu"	"$AG<(B")
+("tgif"	"$(Heu(B")
+("tgii"	"$(Gxk(B")
+("tgimo"	"$AO[(B")
+("tgine"	"$(H87(B")
+("tgit"	"$(Gjd(B")
+("tgje"	"$(HZ"(B")
+("tgji"	"$(HSA(B")
+("tgk"	"$AC@(B")
+("tgks"	"$(Gya(B")
+("tglln"	"$(H8:(B")
+("tgmbc"	"$(Hq}(B")
+("tgni"	"$(Hbt(B")
+("tgnl"	"$(HlJ(B")
+("tgno"	"$(G{c$(H,o$A]((B")
+("tgobo"	"$(Hq3(B")
+("tgow"	"$(Gu/(B")
+("tgp"	"$Am&$(Ho((B")
+("tgpm"	"$(H8a(B")
+("tgrg"	"$A^7(B")
+("tgsk"	"$(HS@(B")
+("tgte"	"$(H^g(B")
+("tgtr"	"$AIF(B")
+("tgv"	"$A=*(B")
+("tgwc"	"$(HfW(B")
+("tgyv"	"$(HoE(B")
+("thaf"	"$(HS[c"(B")
+("thag"	"$(HFr(B")
+("thai"	"$(H?b(B")
+("thau"	"$A]b(B")
+("thbh"	"$(Hr5(B")
+("thbk"	"$(H^y(B")
+("thbu"	"$AJW(B")
+("thcn"	"$(Hfa(B")
+("thda"	"$(HG$(B")
+("thdb"	"$(HYv(B")
+("thde"	"$(H_#(B")
+("thdf"	"$(HFl(B")
+("thdh"	"$(H?_Yu(B")
+("thdm"	"$(HMM(B")
+("thdn"	"$A@r(B")
+("thds"	"$A],(B")
+("thdv"	"$AN.$(Hc!(B")
+("thdw"	"$A^,(B")
+("ther"	"$(H2J(B")
+("they"	"$(H-E(B")
+("thgf"	"$A^9(B")
+("thhaf"	"$(Hk1(B")
+("thhc"	"$(HY~(B")
+("thhd"	"$(HYt(B")
+("thhe"	"$A^<(B")
+("thhj"	"$A]I(B")
+("thhl"	"$A\b(B")
+("thi"	"$(Gjh(B")
+("thj"	"$A\7(B")
+("thjd"	"$A\oDu(B")
+("thje"	"$(HG'(B")
+("thjg"	"$A6-(B")
+("thjm"	"$(HFm(B")
+("thjo"	"$(HpS(B")
+("thk"	"$(H(](B")
+("thkb"	"$(HYw(B")
+("thkp"	"$(H?t(B")
+("thlb"	"$(HFq(B")
+("thlf"	"$(Hin(B")
+("thmb"	"$(Hmw(B")
+("thml"	"$AG[(B")
+("thmr"	"$(H2O(B")
+("thne"	"$A\O(B")
+("thni"	"$(H%"(B")
+("thoe"	"$(HY{(B")
+("thok"	"$A^1$(Hfe(B")
+("thol"	"$(HS`(B")
+("thon"	"$A\t^?(B")
+("thoo"	"$(HMSMU$A]{$(HS_(B")
+("thoq"	"$(HFu(B")
+("thqi"	"$A]-(B")
+("thqo"	"$(H-<(B")
+("thqu"	"$(H([(B")
+("thrj"	"$AQ&(B")
+("ths"	"$(H-;(B")
+("thsb"	"$(H?eFt(B")
+("thse"	"$(HMZ(B")
+("thsk"	"$(H^{(B")
+("thsu"	"$(HSc(B")
+("thup"	"$(HMT(B")
+("thvi"	"$(Hmy(B")
+("thwp"	"$(Gn^$A1M(B")
+("thxc"	"$(Hbv(B")
+("thxf"	"$(HYx(B")
+("thxo"	"$A]G(B")
+("thye"	"$(HMY(B")
+("tiav"	"$A]9(B")
+("tibi"	"$(HMA(B")
+("tice"	"$(H8s(B")
+("tidq"	"$(Hfb(B")
+("tidr"	"$AD"(B")
+("tidy"	"$A^B(B")
+("tih"	"$AC/(B")
+("tihaf"	"$(Hop(B")
+("tihc"	"$(HYl(B")
+("tihm"	"$(H?H(B")
+("tihr"	"$(HF_MF(B")
+("tihs"	"$(H8y(B")
+("tihv"	"$A]Z(B")
+("tiih"	"$(HSa(B")
+("tij"	"$(H2:(B")
+("tijb"	"$AFN(B")
+("tije"	"$(H8`(B")
+("tikf"	"$(HFT(B")
+("tikk"	"$A\X(B")
+("tikt"	"$AC'(B")
+("tilo"	"$(H?m(B")
+("tilr"	"$(HM8(B")
+("timo"	"$A4D(B")
+("tims"	"$A2X(B")
+("tino"	"$AV%(B")
+("tioc"	"$(H^f(B")
+("tip"	"$(H${aT(B")
+("tipd"	"$(Hl"(B")
+("tipf"	"$(HfV(B")
+("tir"	"$AL&(B")
+("titb"	"$(Gj^(B")
+("titc"	"$(H^d(B")
+("titf"	"$AUa(B")
+("tixf"	"$(Gu5(B")
+("tixp"	"$(HS<(B")
+("tj"	"$AX&(B")
+("tjam"	"$Aw0(B")
+("tjamo"	"$(HdF(B")
+("tjapv"	"$(HdG(B")
+("tjau"	"$A0P(B")
+("tjav"	"$(HU[(B")
+("tjavf"	"$(Ho^(B")
+("tjb"	"$A\@(B")
+("tjbd"	"$A])(B")
+("tjbj"	"$(HF~(B")
+("tjbm"	"$(H?iO-(B")
+("tjck"	"$(HFP(B")
+("tjcn"	"$(HfS(B")
+("tjcr"	"$AHX(B")
+("tjdhe"	"$(HO/(B")
+("tjdj"	"$(HO((B")
+("tjds"	"$(HFY(B")
+("tje"	"$A\A(B")
+("tjea"	"$(H`K(B")
+("tjef"	"$(HoD(B")
+("tjfb"	"$AGJ(B")
+("tjfbr"	"$(H`M(B")
+("tjfq"	"$(HO'(B")
+("tjgg"	"$AP,(B")
+("tjgr"	"$(HUZ(B")
+("tjgwc"	"$(Hp_(B")
+("tjhaf"	"$(Hp"(B")
+("tjhd"	"$(HO,(B")
+("tjhdf"	"$(Gwi(B")
+("tjhhj"	"$(H`L(B")
+("tjhml"	"$A=y(B")
+("tjii"	"$(HSF(B")
+("tjip"	"$A^%(B")
+("tjjcm"	"$(H`I(B")
+("tjjj"	"$(HMW(B")
+("tjjl"	"$(HSG(B")
+("tjjv"	"$A00(B")
+("tjka"	"$AVx(B")
+("tjkp"	"$(H2=(B")
+("tjks"	"$A@U(B")
+("tjlbk"	"$Aw1(B")
+("tjlo"	"$(H?L(B")
+("tjlv"	"$A]B(B")
+("tjlwv"	"$(HjY(B")
+("tjmc"	"$(HS9(B")
+("tjme"	"$A^"(B")
+("tjmj"	"$(HAN(B")
+("tjmm"	"$A]f(B")
+("tjmn"	"$(GS5$(H:1(B")
+("tjmo"	"$(H?D(B")
+("tjmr"	"$A]P(B")
+("tjmu"	"$A]8$(HAO(B")
+("tjmwm"	"$(G|#(B")
+("tjnau"	"$Aw4(B")
+("tjnhd"	"$Aw7(B")
+("tjnhe"	"$(HHb(B")
+("tjni"	"$(HO*(B")
+("tjnkq"	"$(HdE(B")
+("tjnl"	"$(HHagI(B")
+("tjnu"	"$A]R(B")
+("tjoa"	"$A^#(B")
+("tjoin"	"$(HHc(B")
+("tjomk"	"$A1^(B")
+("tjomr"	"$(HU\(B")
+("tjomt"	"$(HdL(B")
+("tjop"	"$AQ%(B")
+("tjpa"	"$A]i(B")
+("tjpfd"	"$A>O(B")
+("tjpi"	"$(HAP(B")
+("tjpn"	"$(Hbn(B")
+("tjpru"	"$(HO.(B")
+("tjpt"	"$(HO)(B")
+("tjptd"	"$(HdK(B")
+("tjpu"	"$(HS5(B")
+("tjpyr"	"$Aw6(B")
+("tjqyt"	"$(H`J(B")
+("tjr"	"$A?`(B")
+("tjrb"	"$A:y$(H[`(B")
+("tjrr"	"$A]Q(B")
+("tjshr"	"$(HO+(B")
+("tjtc"	"$(HYi(B")
+("tjtif"	"$(G}6(B")
+("tjtoe"	"$(Ho](B")
+("tjtor"	"$(Hgl(B")
+("tjtq"	"$(Hbo(B")
+("tjv"	"$(H2R(B")
+("tjvii"	"$(Hl^(B")
+("tjvis"	"$(HO0(B")
+("tjwj"	"$(H8w(B")
+("tjydl"	"$(HjX(B")
+("tjygq"	"$(G|"(B")
+("tjymu"	"$(G|s(B")
+("tk"	"$A0,(B")
+("tkce"	"$(HSZ(B")
+("tkd"	"$AiQ(B")
+("tke"	"$(H(d(B")
+("tkhaf"	"$(Ha*k>(B")
+("tkhf"	"$A]6(B")
+("tkhg"	"$(H8t(B")
+("tkhi"	"$(HfR(B")
+("tkhw"	"$(HYz(B")
+("tkkb"	"$(H8m(B")
+("tkld"	"$A<v(B")
+("tklg"	"$A2g(B")
+("tklmi"	"$(Hfo(B")
+("tklu"	"$(Ga`(B")
+("tkms"	"$(H2C(B")
+("tkn"	"$A\4\h(B")
+("tkni"	"$A\9(B")
+("tknl"	"$(GoQ$(HNV(B")
+("tkok"	"$A]p(B")
+("tkoo"	"$(G\x(B")
+("tkp"	"$(H\l(B")
+("tkpb"	"$(HSI(B")
+("tkq"	"$AGf(B")
+("tkr"	"$AHt(B")
+("tkrp"	"$AHG(B")
+("tksqf"	"$(G|Q(B")
+("tksr"	"$AGQ(B")
+("tkss"	"$A@s(B")
+("tkymr"	"$A>/(B")
+("tlbk"	"$AS"(B")
+("tlj"	"$A8o(B")
+("tllmi"	"$(Hc:(B")
+("tlln"	"$(H-3(B")
+("tlmc"	"$(HYo(B")
+("tlmi"	"$A<k(B")
+("tlmt"	"$(Hbz(B")
+("tlmy"	"$A7F(B")
+("tlpf"	"$AQ`$(Ho{(B")
+("tlqm"	"$A]@(B")
+("tlvk"	"$(Gxl(B")
+("tlw"	"$(H-7(B")
+("tlwv"	"$(HSX(B")
+("tlx"	"$(Gr'(B")
+("tm"	"$A8J(B")
+("tmam"	"$(H2?(B")
+("tmbb"	"$A^8(B")
+("tmbg"	"$A^=(B")
+("tmbi"	"$(HYh_!(B")
+("tmbl"	"$(H2V(B")
+("tmbr"	"$(Hl#(B")
+("tmbuu"	"$(Gw<(B")
+("tmbw"	"$A@Y(B")
+("tmcw"	"$A\g$(H8c(B")
+("tmd"	"$ASsD3(B")
+("tmdm"	"$(Hij(B")
+("tmf"	"$(GOI(B")
+("tmfb"	"$(Hc%(B")
+("tmff"	"$AKb(B")
+("tmfj"	"$AF;(B")
+("tmfm"	"$A\V(B")
+("tmgf"	"$AU:(B")
+("tmgn"	"$(H?Vbu(B")
+("tmgr"	"$(Hif(B")
+("tmhf"	"$(HME(B")
+("tmhg"	"$(HZ#(B")
+("tmhml"	"$(HPi(B")
+("tmig"	"$(H2D(B")
+("tmks"	"$AGZ(B")
+("tmlm"	"$(H?O(B")
+("tmmc"	"$AFd(B")
+("tmmi"	"$A\?(B")
+("tmms"	"$(HFa(B")
+("tmmu"	"$A\>(B")
+("tmmv"	"$AIu(B")
+("tmn"	"$(H"k(B")
+("tmnh"	"$(H^j(B")
+("tmnj"	"$(H2>(B")
+("tmnl"	"$A[4:*(B")
+("tmnm"	"$A^/(B")
+("tmnn"	"$(H2B(B")
+("tmnr"	"$A?A(B")
+("tmnv"	"$(HFX^k(B")
+("tmoa"	"$(Hf[(B")
+("tmob"	"$(H-A(B")
+("tmom"	"$A^((B")
+("tmoo"	"$(H8f(B")
+("tmpt"	"$ATa(B")
+("tmrb"	"$(HMB(B")
+("tmrr"	"$(Hfd(B")
+("tmrt"	"$(H8b(B")
+("tmrw"	"$(HF[(B")
+("tmtj"	"$(Ga^(B")
+("tmtn"	"$(GWt(B")
+("tmto"	"$A^'(B")
+("tmvh"	"$AQ?(B")
+("tmvi"	"$A]j(B")
+("tmvm"	"$(G\y(B")
+("tmwc"	"$(Gc'(B")
+("tmwf"	"$(HSD(B")
+("tmwj"	"$A^&(B")
+("tmwm"	"$(Gu.(B")
+("tmwv"	"$(HF\(B")
+("tmy"	"$(H$y(B")
+("tmyf"	"$ADh(B")
+("tmymu"	"$(HqY(B")
+("tn"	"$A\:(B")
+("tnbc"	"$(HFo(B")
+("tnbe"	"$(Hf`(B")
+("tnbq"	"$(H^z(B")
+("tncr"	"$(H^x(B")
+("tnd"	"$(H$~(B")
+("tndf"	"$(Gjf(B")
+("tndo"	"$A]T(B")
+("tndu"	"$A\R(B")
+("tnef"	"$AUt(B")
+("tnfd"	"$(Gz7(B")
+("tnfn"	"$(Gu4(B")
+("tnfq"	"$(G{#(B")
+("tnhd"	"$(HF|(B")
+("tnhe"	"$A\8(B")
+("tnhs"	"$A\5$(HSP(B")
+("tnhx"	"$A]L(B")
+("tni"	"$(H-@(B")
+("tnih"	"$AC)(B")
+("tnin"	"$(H(Y2K(B")
+("tniq"	"$(H2X(B")
+("tnir"	"$A\x(B")
+("tniu"	"$AT7(B")
+("tniv"	"$(HYy(B")
+("tnkg"	"$A\p(B")
+("tnkm"	"$(H?j(B")
+("tnlc"	"$(HfY(B")
+("tnld"	"$(HMH(B")
+("tnli"	"$(GnW(B")
+("tnlm"	"$(Gw0(B")
+("tnlp"	"$(Hl$(B")
+("tnlw"	"$(HSf(B")
+("tnmm"	"$(HMG(B")
+("tnmu"	"$AJ_(B")
+("tnnc"	"$(H^l(B")
+("tnnl"	"$(H_p(B")
+("tno"	"$A\M(B")
+("tnok"	"$A?{(B")
+("tnsj"	"$(HFc(B")
+("tntg"	"$(Hq5(B")
+("tnue"	"$A]U(B")
+("tnui"	"$A]K(B")
+("tnup"	"$(HG"(B")
+("tnus"	"$(HFp(B")
+("toav"	"$(Gu)(B")
+("tob"	"$A\G(B")
+("tobg"	"$(HM;(B")
+("tod"	"$A2h$(H2L(B")
+("todi"	"$A\^(B")
+("tof"	"$(H-?(B")
+("tog"	"$A\]]H$(HAJ(B")
+("togf"	"$A=6(B")
+("togx"	"$(Gw.(B")
+("tohaf"	"$(HqO(B")
+("tohg"	"$A\s(B")
+("tohqu"	"$(Hav(B")
+("tohs"	"$(H8r(B")
+("toi"	"$(H2M(B")
+("toiav"	"$(Gor(B")
+("toie"	"$(HFs(B")
+("toii"	"$A\_(B")
+("toik"	"$A\r(B")
+("toin"	"$A\K(B")
+("toir"	"$(Gji(B")
+("tokf"	"$A^@(B")
+("tokg"	"$(H^w(B")
+("tolb"	"$(HS](B")
+("told"	"$(HS\(B")
+("toll"	"$A=f(B")
+("toma"	"$(H^|(B")
+("tomb"	"$(H?dl.(B")
+("tomd"	"$A]1(B")
+("tomg"	"$A\u(B")
+("tomm"	"$(H(f(B")
+("tomn"	"$(H(\(B")
+("tomo"	"$(H_$(B")
+("tomr"	"$A:I$(H2Q(B")
+("tonk"	"$(HG&(B")
+("tono"	"$(GmE(B")
+("tonwf"	"$(Hh=(B")
+("tooe"	"$(HMK(B")
+("toog"	"$(GyE$(H8o(B")
+("took"	"$(Hl-(B")
+("toom"	"$(HFk(B")
+("top"	"$A;((B")
+("toqb"	"$(HMO(B")
+("tord"	"$A]a(B")
+("tose"	"$(HG%(B")
+("totf"	"$(Gr((B")
+("touk"	"$(HML(B")
+("towy"	"$A].(B")
+("toyr"	"$A]m(B")
+("tp"	"$AP>(B")
+("tpa"	"$A\w(B")
+("tpfd"	"$A>U(B")
+("tph"	"$(H-/(B")
+("tphh"	"$A\L(B")
+("tpi"	"$AIV$(H(e(B")
+("tpib"	"$AFO(B")
+("tpko"	"$(Hbx(B")
+("tpmw"	"$(Gn\(B")
+("tpou"	"$ALQ(B")
+("tpp"	"$A\E(B")
+("tppp"	"$AHo(B")
+("tpr"	"$A96$(H)B(B")
+("tpru"	"$A0z(B")
+("tptd"	"$(Gf4(B")
+("tpu"	"$(H(U(B")
+("tpyv"	"$(HoA(B")
+("tq"	"$AQr(B")
+("tqapv"	"$AtI(B")
+("tqcsh"	"$(H2&(B")
+("tqda"	"$A=e(B")
+("tqdb"	"$AE:(B")
+("tqfh"	"$(H8e(B")
+("tqhdw"	"$(Hbe(B")
+("tqhne"	"$(H2%(B")
+("tqhpm"	"$AtF(B")
+("tqhr"	"$(HFW(B")
+("tqib"	"$(HMC(B")
+("tqice"	"$AtH(B")
+("tqihr"	"$(HRz(B")
+("tqij"	"$(H?&(B")
+("tqik"	"$A]C(B")
+("tqixe"	"$(Hk|(B")
+("tqjm"	"$(HS?(B")
+("tqjmn"	"$(H88(B")
+("tqjmu"	"$(HF3(B")
+("tqjtc"	"$(Hbd(B")
+("tqka"	"$(HF}(B")
+("tqkd"	"$A]h(B")
+("tqkn"	"$(H?'(B")
+("tqkq"	"$(H?K(B")
+("tqlw"	"$(H?p(B")
+("tqm"	"$A2n(B")
+("tqmb"	"$A]<(B")
+("tqmbb"	"$(Hi](B")
+("tqmhf"	"$(HYO(B")
+("tqmvm"	"$(HF4(B")
+("tqng"	"$AP_(B")
+("tqo"	"$A\=(B")
+("tqog"	"$(HSJ(B")
+("tqoii"	"$AAg(B")
+("tqomn"	"$(HR|(B")
+("tqomo"	"$(HfG(B")
+("tqpu"	"$(H?q(B")
+("tqqo"	"$(H8d(B")
+("tqsmm"	"$AOh(B")
+("tqumf"	"$AtJ(B")
+("tqwj"	"$(Hii(B")
+("tqyt"	"$(H?N(B")
+("tqywm"	"$(Gxf(B")
+("trhr"	"$A\l(B")
+("trjd"	"$(H?X(B")
+("trji"	"$A^*(B")
+("trjl"	"$(Hik(B")
+("trmr"	"$(H^r(B")
+("trnl"	"$(H@~$A[7(B")
+("trog"	"$(HSY(B")
+("trok"	"$A>4(B")
+("tron"	"$(H8}(B")
+("trrg"	"$(Hd=(B")
+("trrj"	"$(HYr(B")
+("trrr"	"$(Hq6(B")
+("trrs"	"$A]`(B")
+("trsj"	"$A]](B")
+("trvp"	"$A\e(B")
+("trye"	"$A]g(B")
+("tsem"	"$(Hl'(B")
+("tseo"	"$(Hbr(B")
+("tsfi"	"$AN5(B")
+("tsh"	"$(H"l(B")
+("tshr"	"$A\f(B")
+("tsic"	"$A^.(B")
+("tsip"	"$(H8ifc(B")
+("tsiq"	"$(H^m(B")
+("tsit"	"$(Gw1(B")
+("tsj"	"$AHW(B")
+("tsja"	"$(Hmu(B")
+("tsjd"	"$(G{!(B")
+("tsje"	"$(H?M(B")
+("tsk"	"$(H(W(B")
+("tskr"	"$(H8h(B")
+("tsle"	"$(H?P(B")
+("tsll"	"$(H2T(B")
+("tsmg"	"$(Hby(B")
+("tsmh"	"$A^$(B")
+("tsmi"	"$(HYn(B")
+("tsmv"	"$(Gam(B")
+("tsp"	"$(H-2\j(B")
+("tsrf"	"$(HSN(B")
+("tsrj"	"$A^5(B")
+("tsrr"	"$(HSH(B")
+("tss"	"$A\D(B")
+("tsu"	"$A\;(B")
+("tt"	"$A>.2"$(H!N(B")
+("ttbn"	"$(HFU(B")
+("ttc"	"$(GKd(B")
+("ttcf"	"$(Hbw(B")
+("ttcg"	"$(Hl%mv(B")
+("ttgb"	"$(H.#(B")
+("ttgf"	"$(HMV(B")
+("ttgi"	"$(Hb}(B")
+("tthaf"	"$(Ha&m#(B")
+("tti"	"$(H!D(B")
+("ttjd"	"$(Hl&(B")
+("ttlm"	"$(HSL(B")
+("ttmbc"	"$(HUb(B")
+("ttmc"	"$A]=(B")
+("ttmv"	"$A]X(B")
+("ttmvn"	"$AF?(B")
+("ttnau"	"$(H?@(B")
+("ttnl"	"$(H-X(B")
+("ttqm"	"$(HM<(B")
+("ttshi"	"$(H%T(B")
+("ttt"	"$(H2S(B")
+("ttub"	"$A]t(B")
+("ttvb"	"$(Hih(B")
+("ttwli"	"$AnC(B")
+("ttxc"	"$A]s(B")
+("tub"	"$AK7(B")
+("tuirm"	"$AYe(B")
+("tujt"	"$(Hmt(B")
+("tuu"	"$AWB(B")
+("tvff"	"$(HZ$(B")
+("tvfh"	"$(HMR(B")
+("tvfi"	"$(HFx(B")
+("tvfm"	"$(HFw(B")
+("tvft"	"$(Gz8(B")
+("tvfu"	"$(HZ!(B")
+("tvfy"	"$(HSb(B")
+("tvhl"	"$(HY}(B")
+("tvi"	"$Aj,(B")
+("tvid"	"$Af\$(Gxo(B")
+("tvif"	"$(Hk:(B")
+("tvii"	"$(GW{(B")
+("tvio"	"$A\S(B")
+("tvip"	"$A4H(B")
+("tvis"	"$(H-F(B")
+("tvjr"	"$A9=(B")
+("tvks"	"$A?1(B")
+("tvlk"	"$(H2I(B")
+("tvmg"	"$(G\}(B")
+("tvmi"	"$(GnZ$A^6(B")
+("tvmw"	"$(Hl+(B")
+("tvne"	"$(H?\(B")
+("tvno"	"$(HD"(B")
+("tvr"	"$AHc(B")
+("tvrf"	"$(HY|(B")
+("tvrq"	"$(HMQ(B")
+("tvvv"	"$(HFv(B")
+("tvvw"	"$(H?g(B")
+("tvyj"	"$AUe(B")
+("tw"	"$AGzCg(B")
+("twa"	"$A2\(B")
+("twbi"	"$(Hfn(B")
+("twbo"	"$(GzF(B")
+("twcb"	"$(H8j(B")
+("twdi"	"$AWp(B")
+("twfu"	"$(HSS(B")
+("twhd"	"$A>z(B")
+("twik"	"$Ai`(B")
+("twim"	"$(HSU(B")
+("twk"	"$ARp5l(B")
+("twks"	"$(H8|(B")
+("twla"	"$AJm(B")
+("twlb"	"$(Ge\(B")
+("twle"	"$(Hil(B")
+("twlg"	"$(G|F(B")
+("twli"	"$ACo$(H^s(B")
+("twlii"	"$(Hl3(B")
+("twln"	"$(GhB$A]y$(Hb|l)(B")
+("twlp"	"$A^0$(Hf^(B")
+("twlu"	"$A^+(B")
+("twmmv"	"$(Gg)(B")
+("twmrt"	"$(HGZ(B")
+("twmv"	"$(HG!(B")
+("two"	"$(H-9(B")
+("twp"	"$A]_(B")
+("twr"	"$A\n(B")
+("twtj"	"$(HSW(B")
+("twvf"	"$(HSV(B")
+("twwf"	"$(Hq4(B")
+("twwg"	"$(Hmx(B")
+("twww"	"$(Hf](B")
+("twyi"	"$(H-D(B")
+("txc"	"$A<f(B")
+("tybb"	"$A5Y$(H^t(B")
+("tybg"	"$(Ho?(B")
+("tybo"	"$(Hbq(B")
+("tybp"	"$(Hid(B")
+("tybs"	"$A]r(B")
+("tycb"	"$(HS7(B")
+("tyck"	"$A\z(B")
+("tycu"	"$(H?G(B")
+("tycv"	"$(HS;(B")
+("tydl"	"$AP=(B")
+("tydo"	"$(HfX(B")
+("tydu"	"$(Hio(B")
+("tyfe"	"$A]D(B")
+("tygq"	"$(H_"(B")
+("tygv"	"$(Hbs(B")
+("tyhc"	"$(Gz6(B")
+("tyhj"	"$AEn(B")
+("tyhn"	"$(H(S(B")
+("tyhs"	"$A7<(B")
+("tyiu"	"$A\{(B")
+("tyjj"	"$(GnU(B")
+("tyk"	"$(H(R(B")
+("tylm"	"$A\F(B")
+("tymh"	"$(H^n(B")
+("tymo"	"$(HSK(B")
+("tymp"	"$A\k(B")
+("tynb"	"$(HSO(B")
+("tyoe"	"$(HfT(B")
+("tyoj"	"$A]M(B")
+("typm"	"$(HSQ(B")
+("typp"	"$(Hf\(B")
+("typt"	"$(Gz5(B")
+("tyr"	"$AI;(B")
+("tyra"	"$(Gxp(B")
+("tyrb"	"$A]o(B")
+("tyre"	"$(HS:^q(B")
+("tyrl"	"$(HS8(B")
+("tyrn"	"$A]c(B")
+("tyrp"	"$(H^c(B")
+("tyrv"	"$(Gz2$(Hl!(B")
+("tysd"	"$(HFR(B")
+("tysk"	"$A]}(B")
+("tysm"	"$(Ho@(B")
+("tyso"	"$(HSe(B")
+("tysy"	"$A]N(B")
+("tyt"	"$(H-.(B")
+("tyta"	"$(HF{(B")
+("tytg"	"$(HYf(B")
+("tytj"	"$A]7(B")
+("tytp"	"$A^2(B")
+("tytr"	"$AFP$(HM6(B")
+("tytv"	"$(H?F(B")
+("tyv"	"$AC"(B")
+("tyvg"	"$A^3(B")
+("tyvo"	"$(H29(B")
+("tyvp"	"$(H8^(B")
+("tyvu"	"$A;D(B")
+("tyvw"	"$APn(B")
+("tywi"	"$(HSR(B")
+("tywv"	"$AKr(B")
+("tyx"	"$(Gw5(B")
+("tyyb"	"$(HfU(B")
+("tyyo"	"$A^>(B")
+("u"	"$AI=(B")
+("uahu"	"$AaR(B")
+("uamh"	"$(H;C(B")
+("uamo"	"$(H;Q(B")
+("uapp"	"$(GY|(B")
+("uapv"	"$(H;D(B")
+("uav"	"$(H*-(B")
+("ubb"	"$A1@(B")
+("ubcn"	"$(H;K(B")
+("ubln"	"$(H3nAm(B")
+("ubm"	"$(H&A(B")
+("ubmbc"	"$(Gwp(B")
+("ubmr"	"$Aa<(B")
+("ubnl"	"$(HlK(B")
+("ubno"	"$(HC~(B")
+("ubsd"	"$(GY{(B")
+("ubtu"	"$(GZ$(B")
+("ubuu"	"$(GU7(B")
+("uc"	"$(H5'(B")
+("ucno"	"$(GlU(B")
+("ucor"	"$ASx(B")
+("ucwa"	"$(HP.(B")
+("udci"	"$AaB(B")
+("udhe"	"$(H&J(B")
+("udoo"	"$(H4~(B")
+("udsmg"	"$(Hq-(B")
+("udw"	"$(H4{(B")
+("udyg"	"$(H;T(B")
+("ufb"	"$AGM(B")
+("ufdq"	"$AaW(B")
+("uffd"	"$(GsX(B")
+("uffr"	"$(Hhp(B")
+("uffs"	"$(HP,(B")
+("ufgi"	"$(HaP(B")
+("ugce"	"$(H4z(B")
+("ugdi"	"$AVE(B")
+("uggi"	"$(H;S(B")
+("uggu"	"$(HP/(B")
+("ugno"	"$(GU6(B")
+("uh"	"$AX0(B")
+("uha"	"$(H&K(B")
+("uhag"	"$(H;R(B")
+("uhdj"	"$(H;L(B")
+("uhdp"	"$AaS(B")
+("uhdv"	"$(H5&(B")
+("uhdw"	"$(HP0(B")
+("uhej"	"$A7e(B")
+("uher"	"$(H*$*+(B")
+("uhhj"	"$(H5"(B")
+("uhhw"	"$(HB[(B")
+("uhi"	"$AaM(B")
+("uhk"	"$(H#g(B")
+("uhkb"	"$(HP2(B")
+("uhmb"	"$(HkW(B")
+("uhml"	"$(H#h(B")
+("uhni"	"$(G^u(B")
+("uhoo"	"$(HIn(B")
+("uhoq"	"$(H;M(B")
+("uhpa"	"$(H5#(B")
+("uhqi"	"$A6k(B")
+("uhrf"	"$(HBZ(B")
+("uhrj"	"$(HVr(B")
+("uhs"	"$(H&I(B")
+("uhuc"	"$(HmL(B")
+("uhud"	"$(HBW(B")
+("uhvi"	"$AN!(B")
+("uhxc"	"$(GsU(B")
+("uiav"	"$(H.s(B")
+("uice"	"$A>~(B")
+("uihr"	"$(H;U(B")
+("uihs"	"$(H*/(B")
+("uihv"	"$AaK(B")
+("uiih"	"$(HIr(B")
+("uijb"	"$(H.n(B")
+("uilr"	"$(HBT(B")
+("uip"	"$A[K(B")
+("ujc"	"$(H&=(B")
+("ujcc"	"$(G{](B")
+("ujcm"	"$AaG(B")
+("ujcr"	"$(HBS(B")
+("ujd"	"$(Hi&(B")
+("uje"	"$Aa*(B")
+("ujfd"	"$(Hmn(B")
+("ujjl"	"$(GhY(B")
+("ujkp"	"$(H*)(B")
+("ujlmi"	"$(Hm~(B")
+("ujlo"	"$(H4}(B")
+("ujmf"	"$A3g(B")
+("ujmrt"	"$(GwB(B")
+("ujp"	"$(H&<(B")
+("ujr"	"$Aa2(B")
+("ujv"	"$(H*'(B")
+("uk"	"$APW(B")
+("ukb"	"$(H*.(B")
+("ukcf"	"$(HP5(B")
+("ukg"	"$(H*#(B")
+("ukhk"	"$(GsW(B")
+("ukhu"	"$(GG=(B")
+("ukjj"	"$(HH$(B")
+("ukkb"	"$AaE(B")
+("uklu"	"$AaC(B")
+("ukmr"	"$AFi(B")
+("ukn"	"$(H*((B")
+("ukoo"	"$(GU0(B")
+("ukpb"	"$(HIj(B")
+("uks"	"$(H!W(B")
+("ul"	"$Aex(B")
+("ulbk"	"$(H&C(B")
+("ulln"	"$(H&G(B")
+("ulw"	"$Aa6(B")
+("ulwv"	"$(HIm(B")
+("umam"	"$(H){(B")
+("umbc"	"$(H;P(B")
+("umbl"	"$(GS%$(H**(B")
+("umbs"	"$(HIi(B")
+("umf"	"$AL?(B")
+("umfm"	"$(H&@(B")
+("umgg"	"$AQB(B")
+("umig"	"$(H)|(B")
+("umli"	"$Ar?(B")
+("ummj"	"$A06(B")
+("ummr"	"$(H.o(B")
+("ummu"	"$(H#a(B")
+("umnc"	"$(HIv(B")
+("umnn"	"$(H*!(B")
+("umnr"	"$Aa3(B")
+("umoo"	"$AaY(B")
+("umr"	"$AQR(B")
+("umrt"	"$(GX?(B")
+("umt"	"$Aa)(B")
+("umtj"	"$(H4x(B")
+("umto"	"$(HP4(B")
+("umu"	"$(H"6(B")
+("umua"	"$(HP3(B")
+("umvh"	"$Aa,(B")
+("unbq"	"$(HVm(B")
+("unhe"	"$Aa'$(H#c(B")
+("unii"	"$(HIu(B")
+("unmu"	"$(H)}*"(B")
+("unot"	"$AaX(B")
+("unqd"	"$(HBV(B")
+("unri"	"$(Gyk(B")
+("uog"	"$A4^(B")
+("uogb"	"$(Hd>d?(B")
+("uogf"	"$(HP1(B")
+("uogs"	"$(HVq(B")
+("uoic"	"$(GsV(B")
+("uoii"	"$AAk(B")
+("uoin"	"$Aa/$(H#e(B")
+("uoir"	"$(HB\(B")
+("uoll"	"$(H#i(B")
+("uomb"	"$(GZ!(B")
+("uomn"	"$(H;G(B")
+("uomo"	"$(HVn(B")
+("uomr"	"$(H*%*,(B")
+("uon"	"$ARY(B")
+("upa"	"$Aa>(B")
+("uphh"	"$(H#d(B")
+("upko"	"$AaZ(B")
+("upr"	"$Aa8(B")
+("uqmb"	"$(H4y(B")
+("uqog"	"$(HIo(B")
+("urji"	"$(HVs(B")
+("urog"	"$(HIp(B")
+("urrk"	"$(G|5(B")
+("urrs"	"$(H;B(B")
+("urvp"	"$Aa:(B")
+("ushi"	"$(H"8(B")
+("ushr"	"$(H&H(B")
+("usjr"	"$(H4|(B")
+("uskr"	"$(H.p(B")
+("usma"	"$(HIt(B")
+("usmh"	"$(HIl(B")
+("usrr"	"$(GhZ(B")
+("uss"	"$(H&>(B")
+("usu"	"$Aa((B")
+("usuu"	"$AaH(B")
+("utav"	"$(HVi(B")
+("utbuu"	"$(GuF(B")
+("utcd"	"$(HVo(B")
+("utcw"	"$(H;=(B")
+("utgi"	"$(HVh(B")
+("utgit"	"$(G}C(B")
+("uthn"	"$(G^3(B")
+("uthni"	"$(Hgw(B")
+("uthv"	"$(HmK(B")
+("utik"	"$(HKp(B")
+("utln"	"$(G^5(B")
+("utmbc"	"$(Hgu(B")
+("utmo"	"$AG6(B")
+("utmv"	"$(H;@(B")
+("utnau"	"$(G|l(B")
+("utnl"	"$A[:(B")
+("utok"	"$(HJ[(B")
+("utqm"	"$AaO(B")
+("utrg"	"$(HkX(B")
+("utvi"	"$AaQ(B")
+("utwa"	"$(HIk(B")
+("utwi"	"$(HP-(B")
+("utwv"	"$(HVj(B")
+("uu"	"$A3v$(H"9"j(B")
+("uuce"	"$(H;F(B")
+("uummf"	"$AKn(B")
+("uuu"	"$(H--(B")
+("uuuu"	"$(H?A(B")
+("uvii"	"$ASD(B")
+("uvis"	"$(H&L(B")
+("uvmi"	"$(HIq(B")
+("uvvw"	"$(H5$(B")
+("uwjr"	"$AaD(B")
+("uwl"	"$Aa5(B")
+("uwlb"	"$(H;E(B")
+("uwlj"	"$(HVk(B")
+("uwly"	"$(HVl(B")
+("uwp"	"$AaL(B")
+("uybb"	"$(H;N(B")
+("uybk"	"$(Ho%(B")
+("uybp"	"$(HeI(B")
+("uyhh"	"$(H;>(B")
+("uyhm"	"$(HIs(B")
+("uyoj"	"$(H5%(B")
+("uyrb"	"$AaT(B")
+("uyrd"	"$AaF(B")
+("uyrn"	"$(H;O(B")
+("uysd"	"$(H;H(B")
+("uyt"	"$(H&M(B")
+("uyti"	"$(Hhq(B")
+("uytj"	"$(H.r$AaV(B")
+("uyvo"	"$(H)z(B")
+("v"	"$AE.(B")
+("vaa"	"$Af=(B")
+("vabu"	"$(H:{(B")
+("vahu"	"$ACD(B")
+("vam"	"$Af'(B")
+("vamh"	"$(H:}(B")
+("vamo"	"$(H:|(B")
+("vand"	"$(GlI(B")
+("vawe"	"$(HIW(B")
+("vbac"	"$(HB:(B")
+("vbbe"	"$(HV^(B")
+("vbbr"	"$(G^j(B")
+("vbd"	"$(H4m(B")
+("vbgr"	"$(H4^(B")
+("vbhg"	"$(H4\(B")
+("vbhx"	"$(HBK(B")
+("vbm"	"$A=c(B")
+("vbme"	"$AfB(B")
+("vbmr"	"$(H)p(B")
+("vbou"	"$(HB?(B")
+("vbt"	"$(GLm(B")
+("vbuu"	"$(H.d(B")
+("vbv"	"$(H.e(B")
+("vci"	"$(H#X(B")
+("vcnh"	"$Af7(B")
+("vcsh"	"$(H#W(B")
+("vdj"	"$(H&&(B")
+("vdks"	"$(Gc:(B")
+("vdl"	"$(H.a(B")
+("vdlc"	"$(HeG(B")
+("vdlk"	"$AD[(B")
+("vdln"	"$A=K(B")
+("vdnl"	"$(HNY(B")
+("ve"	"$AE+(B")
+("vebt"	"$(HE=(B")
+("veks"	"$AE,(B")
+("velb"	"$A`{(B")
+("veln"	"$(GTL(B")
+("vemr"	"$(H1B(B")
+("ven"	"$Aes(B")
+("vend"	"$Af[(B")
+("vep"	"$AE-(B")
+("veq"	"$(H*U(B")
+("vesqf"	"$(Goz(B")
+("vfa"	"$(Ho.(B")
+("vfamo"	"$(GnF(B")
+("vfaph"	"$(HLt(B")
+("vfapp"	"$(HLs(B")
+("vfase"	"$(Hbc(B")
+("vfawe"	"$(Gtq(B")
+("vfbb"	"$AfO(B")
+("vfbbb"	"$(HY?(B")
+("vfbbe"	"$(GjG(B")
+("vfbbr"	"$(HRr(B")
+("vfbcv"	"$(G|A(B")
+("vfbd"	"$(GjB(B")
+("vfbgr"	"$(Gj@(B")
+("vfbhx"	"$(HYB(B")
+("vfbjj"	"$(HRk(B")
+("vfbm"	"$(G\Z(B")
+("vfbme"	"$(GnB(B")
+("vfbmr"	"$(H>t(B")
+("vfbnd"	"$(HF-(B")
+("vfbof"	"$(H^G(B")
+("vfbr"	"$(H8,(B")
+("vfbsh"	"$(HF((B")
+("vfbtu"	"$(Gj>(B")
+("vfbtv"	"$(Gj=(B")
+("vfbu"	"$(HpB(B")
+("vfbuh"	"$(GnE(B")
+("vfbuo"	"$(H^D(B")
+("vfbv"	"$(Ger(B")
+("vfc"	"$(G}>(B")
+("vfcnh"	"$(HE|(B")
+("vfcor"	"$(HF)(B")
+("vfcsh"	"$(GWL(B")
+("vfcwa"	"$(Gw%(B")
+("vfd"	"$(Ho0(B")
+("vfdbu"	"$(HRo(B")
+("vfdd"	"$(HLq(B")
+("vfdi"	"$(GRw(B")
+("vfdl"	"$(HE~(B")
+("vfdm"	"$(H83(B")
+("vfdmq"	"$(Gn9(B")
+("vfdwf"	"$(Gn8(B")
+("vfeed"	"$(HYH(B")
+("vfeee"	"$(Gj<(B")
+("vff"	"$(H4b(B")
+("vffb"	"$(HF'(B")
+("vffdq"	"$(Hbb(B")
+("vfff"	"$(HLk(B")
+("vffh"	"$(GW@(B")
+("vffmu"	"$(H>s(B")
+("vffq"	"$(G\Q(B")
+("vffqu"	"$(HLl(B")
+("vfgce"	"$(Gj9(B")
+("vfgg"	"$(H>r(B")
+("vfggu"	"$(Gw"(B")
+("vfgi"	"$(H8*(B")
+("vfgr"	"$(Ga8(B")
+("vfgrc"	"$(Hkw(B")
+("vfgwc"	"$(Gz}(B")
+("vfh"	"$ACn(B")
+("vfhab"	"$(GjA(B")
+("vfhae"	"$(Gn@(B")
+("vfhaf"	"$(G|Z}J(B")
+("vfhce"	"$(H^H(B")
+("vfhdv"	"$(HLv(B")
+("vfhdw"	"$(Gw&(B")
+("vfheq"	"$(GaB(B")
+("vfher"	"$(Ga>(B")
+("vfhey"	"$(G\\(B")
+("vfhg"	"$(H1s(B")
+("vfhgf"	"$(Hi[(B")
+("vfhhj"	"$(HLz(B")
+("vfhjd"	"$(H>}(B")
+("vfhje"	"$(GnA(B")
+("vfhjg"	"$(HRx(B")
+("vfhjm"	"$(GnC(B")
+("vfhkb"	"$(Hb`(B")
+("vfhon"	"$(H?!(B")
+("vfhoo"	"$(Gtk$(H^I(B")
+("vfhor"	"$(HLx(B")
+("vfhqo"	"$(H8.(B")
+("vfhsb"	"$(Gn>(B")
+("vfhsk"	"$(Gxd$(HL{(B")
+("vfhuc"	"$(Hq/(B")
+("vfhvp"	"$(GWK(B")
+("vfhwp"	"$(Gtj(B")
+("vfibi"	"$(Gqk(B")
+("vfihr"	"$(Gn;(B")
+("vfiih"	"$(Gtr(B")
+("vfij"	"$(Ga9(B")
+("vfije"	"$(HF"(B")
+("vfik"	"$(H,m1u(B")
+("vfikk"	"$(G\^(B")
+("vfiku"	"$(H1|(B")
+("vfill"	"$(H>z(B")
+("vfimo"	"$(H>o(B")
+("vfir"	"$(H82(B")
+("vfirm"	"$(HLr(B")
+("vfitc"	"$(Hku(B")
+("vfiwg"	"$(Gz|(B")
+("vfjbc"	"$(Gqn(B")
+("vfjbd"	"$(HF!(B")
+("vfjii"	"$(H^@(B")
+("vfjip"	"$(HbZ(B")
+("vfjka"	"$(GjE(B")
+("vfjlo"	"$(HLn(B")
+("vfjlv"	"$(HLo(B")
+("vfjmc"	"$(Gtsz*(B")
+("vfjmf"	"$(Gj7(B")
+("vfjmn"	"$(H8'(B")
+("vfjmo"	"$(Gj5(B")
+("vfjmu"	"$(HF+(B")
+("vfjnu"	"$(HL~(B")
+("vfjoa"	"$(Gtc(B")
+("vfjp"	"$(H8((B")
+("vfjqr"	"$(HYF(B")
+("vfjrr"	"$(Gj6(B")
+("vfjyj"	"$(HY9(B")
+("vfk"	"$(HmH(B")
+("vfkcf"	"$(Gw#(B")
+("vfki"	"$(H1v(B")
+("vfkkb"	"$(HF$(B")
+("vfkmr"	"$(Gj?(B")
+("vfkni"	"$(H,l(B")
+("vflbk"	"$(H84(B")
+("vflbu"	"$(H1r(B")
+("vflgm"	"$(Hb\(B")
+("vflll"	"$(H,k(B")
+("vflln"	"$(G\V(B")
+("vflmc"	"$(Hb^(B")
+("vflmi"	"$(G}'(B")
+("vflmo"	"$(H>|(B")
+("vflmy"	"$(HLu(B")
+("vflw"	"$(H8-(B")
+("vflwl"	"$(G\Y(B")
+("vflwp"	"$(H>v(B")
+("vflwv"	"$(Gtf(B")
+("vflx"	"$(Gw$(B")
+("vfm"	"$(GRx(B")
+("vfma"	"$(H>{(B")
+("vfmbb"	"$(HiY(B")
+("vfmbe"	"$(Hkx(B")
+("vfmbk"	"$(HRl(B")
+("vfmd"	"$(GR}(B")
+("vfmf"	"$(H1t(B")
+("vfmgk"	"$(Gn:(B")
+("vfmhf"	"$(HY>(B")
+("vfmia"	"$(Gqo(B")
+("vfmig"	"$(GaA(B")
+("vfmlb"	"$(HM"(B")
+("vfmlk"	"$(HE}(B")
+("vfmmi"	"$(GWI(B")
+("vfmmp"	"$(Hq.(B")
+("vfmn"	"$(H(I(B")
+("vfmvi"	"$(HY<(B")
+("vfmvm"	"$(Gen(B")
+("vfmwf"	"$(Gto(B")
+("vfmwl"	"$(Gn<(B")
+("vfn"	"$(G{_(B")
+("vfnau"	"$(HF&(B")
+("vfnbq"	"$(Hf@(B")
+("vfnd"	"$(G{\(B")
+("vfng"	"$(GWF(B")
+("vfnhb"	"$(Hb](B")
+("vfnhe"	"$(GWH(B")
+("vfnii"	"$(Gtp(B")
+("vfnin"	"$(H1x(B")
+("vfnkf"	"$(Hf?(B")
+("vfnkg"	"$(HF%(B")
+("vfnkm"	"$(HLy(B")
+("vfnl"	"$(H1w(B")
+("vfnob"	"$(HRq(B")
+("vfnri"	"$(G|C(B")
+("vfoae"	"$(HRw(B")
+("vfob"	"$(GWJ(B")
+("vfobo"	"$(Hq2(B")
+("vfodi"	"$(H85(B")
+("vfog"	"$(GjD(B")
+("vfohh"	"$(H81(B")
+("vfoim"	"$(G|B(B")
+("vfoin"	"$(H1y(B")
+("vfok"	"$(G|H(B")
+("vfoll"	"$(H1z(B")
+("vfoma"	"$(Gxc(B")
+("vfomb"	"$(GjC(B")
+("vfomg"	"$(H>~(B")
+("vfomk"	"$(HRt(B")
+("vfomn"	"$(HRv(B")
+("vfomr"	"$(Ga?(B")
+("vfon"	"$(GR{(B")
+("vfonk"	"$(HRu(B")
+("vfopd"	"$(H8/(B")
+("vfoto"	"$(Hi\(B")
+("vfp"	"$(G|6(B")
+("vfpa"	"$(Ga@(B")
+("vfpi"	"$(GR|(B")
+("vfpmm"	"$(HRm(B")
+("vfpou"	"$(HLw(B")
+("vfpp"	"$(GWG(B")
+("vfpr"	"$(H80(B")
+("vfpt"	"$(G\](B")
+("vfpu"	"$(GWE(B")
+("vfpuu"	"$(Gqp(B")
+("vfq"	"$(GLt|7(B")
+("vfqjl"	"$(Geq(B")
+("vfqkd"	"$(HYI(B")
+("vfqmb"	"$(HLm(B")
+("vfqmc"	"$(Gtd(B")
+("vfqmf"	"$(HYJ(B")
+("vfqu"	"$(H4R(B")
+("vfr"	"$(G{y(B")
+("vfrb"	"$(Geo(B")
+("vfrbc"	"$(HY@(B")
+("vfrhr"	"$(HF,(B")
+("vfrpa"	"$(HRp(B")
+("vfrrd"	"$(Hf<(B")
+("vfrrj"	"$(Hb_(B")
+("vfrsj"	"$(Gn=(B")
+("vfrxu"	"$(Gxb(B")
+("vfshi"	"$(GRz(B")
+("vfshr"	"$(G\U(B")
+("vfshu"	"$(Ga:(B")
+("vfsje"	"$(HLp(B")
+("vfsme"	"$(HF#(B")
+("vfsmh"	"$(Gte(B")
+("vfsu"	"$(GRy(B")
+("vfswu"	"$(G}9(B")
+("vftak"	"$(H^B(B")
+("vftbk"	"$(Hb[(B")
+("vftct"	"$(Gqh(B")
+("vftcw"	"$(HRn(B")
+("vftgr"	"$(Gw!(B")
+("vftlj"	"$(GnD(B")
+("vftm"	"$(H8+(B")
+("vftqm"	"$(HY8(B")
+("vftt"	"$(H>q(B")
+("vftwi"	"$(HbY(B")
+("vftwv"	"$(Hf=(B")
+("vftxc"	"$(Gqi(B")
+("vfu"	"$(G{^(B")
+("vfubb"	"$(Gth(B")
+("vfuob"	"$(HpG(B")
+("vfuog"	"$(H^E(B")
+("vfuu"	"$(G\W(B")
+("vfv"	"$(HmJ(B")
+("vfvif"	"$(Ga=(B")
+("vfvl"	"$(GO+(B")
+("vfvne"	"$(Gj:(B")
+("vfvno"	"$(Gn?(B")
+("vfvvd"	"$(Gtl(B")
+("vfvvi"	"$(Gz+(B")
+("vfvvw"	"$(GjF(B")
+("vfw"	"$(G\X(B")
+("vfwd"	"$(Gep(B")
+("vfwgg"	"$(Hky(B")
+("vfwk"	"$(H>u(B")
+("vfwlg"	"$(Hq1(B")
+("vfwlj"	"$(Gxa(B")
+("vfwlv"	"$(Hf>(B")
+("vfwot"	"$(HYA(B")
+("vfwp"	"$(HRs(B")
+("vfwtj"	"$(H^C(B")
+("vfwvf"	"$(Gtg(B")
+("vfyaj"	"$(Gj8(B")
+("vfybb"	"$(Gn7(B")
+("vfybs"	"$(HYG(B")
+("vfyck"	"$(Ga7(B")
+("vfyg"	"$(H8)(B")
+("vfygq"	"$(HfB(B")
+("vfyhj"	"$(Gti(B")
+("vfyhr"	"$(HYD(B")
+("vfyhs"	"$(GW?(B")
+("vfyia"	"$(Gv~(B")
+("vfyij"	"$(H^?(B")
+("vfyiu"	"$(G\S(B")
+("vfyj"	"$(H1{(B")
+("vfyjj"	"$(H^M(B")
+("vfyk"	"$(GWA(B")
+("vfylr"	"$(HiZ(B")
+("vfyoj"	"$(HLj(B")
+("vfypt"	"$(Hmo(B")
+("vfyrb"	"$(Gqm(B")
+("vfyrd"	"$(HLi(B")
+("vfyrf"	"$(HM!(B")
+("vfyrv"	"$(Ho=(B")
+("vfyso"	"$(H^>(B")
+("vfyto"	"$(Hf;(B")
+("vfytp"	"$(Hf9(B")
+("vfytu"	"$(HY;(B")
+("vfyub"	"$(H^=(B")
+("vfyvi"	"$(G\R(B")
+("vfyvo"	"$(H>p(B")
+("vfyvq"	"$(Gtn(B")
+("vfywm"	"$(Hf:(B")
+("vfywv"	"$(HY:(B")
+("vgb"	"$(H&*(B")
+("vgce"	"$(H4e(B")
+("vgf"	"$(H6|(B")
+("vgg"	"$AM^(B")
+("vggu"	"$(GlM(B")
+("vgk"	"$A^J$(H.\(B")
+("vgni"	"$(H\`(B")
+("vgow"	"$(HV\(B")
+("vgr"	"$(H)d(B")
+("vgrg"	"$(H\a(B")
+("vgrr"	"$AfR(B")
+("vgrv"	"$(HBI(B")
+("vgtj"	"$(H4U(B")
+("vgyhv"	"$(GfR(B")
+("vhab"	"$(H4p(B")
+("vhag"	"$(H;2(B")
+("vhav"	"$(GpN(B")
+("vhbr"	"$(H)t(B")
+("vhcn"	"$(HaM(B")
+("vhd"	"$(H&2(B")
+("vhdn"	"$(H.f(B")
+("vhdv"	"$(H4n(B")
+("vhdw"	"$(HP)(B")
+("vhg"	"$AHQ(B")
+("vhgu"	"$(H)i(B")
+("vhhj"	"$Af>(B")
+("vhhw"	"$(HBL(B")
+("vhi"	"$(HBB(B")
+("vhiil"	"$(GbT(B")
+("vhj"	"$(H"1(B")
+("vhjd"	"$Af-(B")
+("vhjm"	"$(H;&(B")
+("vhjr"	"$(H)c(B")
+("vhk"	"$AQ}(B")
+("vhkb"	"$(GlL(B")
+("vhkp"	"$(H4o(B")
+("vhml"	"$(H#[(B")
+("vhmr"	"$(H)m(B")
+("vhnb"	"$(H)s(B")
+("vhp"	"$(H"-(B")
+("vhpa"	"$A;i(B")
+("vhqi"	"$A6p(B")
+("vhqm"	"$APU(B")
+("vhs"	"$A6J(B")
+("vhsb"	"$(H;"(B")
+("vhsk"	"$(HV`(B")
+("vhup"	"$AO1(B")
+("vhwp"	"$AfG(B")
+("vhxe"	"$AI)(B")
+("vhxu"	"$(H4_(B")
+("viav"	"$ADo(B")
+("vid"	"$(Gm?m@(B")
+("vidi"	"$(GsQ(B")
+("vie"	"$(GmI(B")
+("vif"	"$Ati(B")
+("vig"	"$(HIO(B")
+("vihi"	"$(G^}(B")
+("vihml"	"$(GvK(B")
+("viik"	"$(Gmd(B")
+("vij"	"$(H)f(B")
+("vikf"	"$(H:w(B")
+("viks"	"$ASW(B")
+("viksf"	"$(H\7(B")
+("vilb"	"$(HI_(B")
+("vile"	"$(HI`(B")
+("vilmi"	"$(H_:(B")
+("viln"	"$(Hn~(B")
+("vimcw"	"$(GwQ(B")
+("vio"	"$ART(B")
+("viok"	"$(H._(B")
+("vir"	"$AJ<(B")
+("vis"	"$A;C(B")
+("vitc"	"$(HVd(B")
+("vitf"	"$(HI^(B")
+("viuh"	"$(H.b(B")
+("viw"	"$Ag\(B")
+("vjbj"	"$(H;-(B")
+("vjcr"	"$(HBE(B")
+("vjd"	"$ACC(B")
+("vje"	"$A<K(B")
+("vjhw"	"$(Gv@(B")
+("vjii"	"$(HIT(B")
+("vjka"	"$(H4f(B")
+("vjkp"	"$A@Q(B")
+("vjlo"	"$Af<(B")
+("vjmc"	"$(GsP(B")
+("vjmf"	"$(H4`(B")
+("vjmm"	"$(H;)(B")
+("vjmo"	"$A<^$(H4a(B")
+("vjnu"	"$AMq(B")
+("vjpn"	"$(H\](B")
+("vjr"	"$A9C(B")
+("vjrb"	"$(H;,(B")
+("vjrj"	"$(HO|(B")
+("vjrr"	"$(H4Q(B")
+("vjv"	"$(H)n(B")
+("vkb"	"$(H)o(B")
+("vkbt"	"$(HiB(B")
+("vkcf"	"$(HO}(B")
+("vkmr"	"$(H4h(B")
+("vkms"	"$(H)g(B")
+("vkn"	"$ARL(B")
+("vkok"	"$A<5(B")
+("vl"	"$A[I(B")
+("vlbk"	"$(H&((B")
+("vlgm"	"$(HO{(B")
+("vlhbr"	"$(Gv=(B")
+("vlllm"	"$(H!C(B")
+("vllmi"	"$(Hc9(B")
+("vlm"	"$Ac](B")
+("vlmc"	"$(HP'(B")
+("vlmo"	"$AR&(B")
+("vlmt"	"$(H\_(B")
+("vloiv"	"$(G{C(B")
+("vlok"	"$AJU(B")
+("vlw"	"$Af((B")
+("vlwl"	"$(H&1(B")
+("vlws"	"$Af3(B")
+("vlxh"	"$Af"(B")
+("vlyta"	"$(G{@(B")
+("vm"	"$(H".(B")
+("vmam"	"$(H)e(B")
+("vmbb"	"$(H\^(B")
+("vmbdi"	"$(GYr(B")
+("vmbs"	"$(HIS(B")
+("vmbu"	"$AfW(B")
+("vmbwd"	"$(Gcp(B")
+("vmfb"	"$(H\Z(B")
+("vmfft"	"$(GvA(B")
+("vmg"	"$(GIg(B")
+("vmgg"	"$(H4g(B")
+("vmgow"	"$(Gt;(B")
+("vmhf"	"$(HB;(B")
+("vmhml"	"$(H'#(B")
+("vmi"	"$Ac^(B")
+("vmig"	"$(GPa(B")
+("vmik"	"$(GNm(B")
+("vmj"	"$A<i(B")
+("vmlii"	"$(Hqv(B")
+("vmlm"	"$(H4X(B")
+("vmmi"	"$(H#S(B")
+("vmmnr"	"$(H+w(B")
+("vmmp"	"$(HmI(B")
+("vmmu"	"$(H#Z(B")
+("vmmv"	"$AIo(B")
+("vmoir"	"$(HKk(B")
+("vmpop"	"$Aei(B")
+("vmt"	"$Ae{(B")
+("vmtq"	"$(H0`(B")
+("vmv"	"$(GIi(B")
+("vmvi"	"$(HBF(B")
+("vmvm"	"$(H.](B")
+("vmwf"	"$AfN(B")
+("vmwl"	"$(H:x(B")
+("vmyf"	"$AfL(B")
+("vmym"	"$(H&.(B")
+("vnau"	"$ACd(B")
+("vnd"	"$A:C(B")
+("vnf"	"$(GLr(B")
+("vng"	"$Af$(B")
+("vnhd"	"$(H;*(B")
+("vnhs"	"$ADL(B")
+("vnin"	"$Af%$(H)k(B")
+("vnir"	"$(H)r(B")
+("vnkg"	"$(H.c(B")
+("vnlb"	"$(HO~(B")
+("vnlr"	"$Af9(B")
+("vnme"	"$(H&U(B")
+("vnmm"	"$(HB<(B")
+("vnmo"	"$Aeh(B")
+("vnmu"	"$(H)j(B")
+("vnob"	"$APv(B")
+("vnot"	"$(HP&(B")
+("vnum"	"$(HV_(B")
+("vnyi"	"$(H4i(B")
+("vob"	"$(H#T(B")
+("voge"	"$(HkV(B")
+("vogf"	"$(HP!(B")
+("vohaf"	"$(Hk7(B")
+("voii"	"$(H&3(B")
+("voim"	"$(Hho(B")
+("voin"	"$Af!(B")
+("volii"	"$As;(B")
+("voll"	"$(H#V(B")
+("vomg"	"$(H)u(B")
+("vomn"	"$(H;%(B")
+("vomo"	"$(HVa(B")
+("vomr"	"$(H)l(B")
+("vomt"	"$(H;$(B")
+("voq"	"$(H)q(B")
+("vord"	"$(H;#(B")
+("votf"	"$(GlK(B")
+("vpd"	"$AK}(B")
+("vph"	"$(H&-(B")
+("vpi"	"$Aey(B")
+("vpp"	"$Ae~(B")
+("vpr"	"$(H&+(B")
+("vptd"	"$(H:y(B")
+("vpuu"	"$(HBA(B")
+("vqj"	"$(H#R(B")
+("vqka"	"$(H;+(B")
+("vqkd"	"$(HBG(B")
+("vqmb"	"$Af:(B")
+("vqmf"	"$(HBH(B")
+("vqmv"	"$Af;(B")
+("vr"	"$AHg(B")
+("vrb"	"$A>j(B")
+("vrhaf"	"$(Ha3(B")
+("vrlb"	"$(H*5(B")
+("vrp"	"$AK!(B")
+("vrq"	"$(H/4(B")
+("vrrd"	"$(HVe(B")
+("vrrj"	"$(GlJ(B")
+("vrrk"	"$(Ho$(B")
+("vrvif"	"$APu(B")
+("vrvk"	"$(GTv(B")
+("vrye"	"$(H;.(B")
+("vryo"	"$(H.^(B")
+("vshaf"	"$(Hm2(B")
+("vshr"	"$(H&0(B")
+("vshu"	"$Af8(B")
+("vsje"	"$(H4W(B")
+("vskp"	"$(HIU(B")
+("vsll"	"$A<'(B")
+("vsmb"	"$(GYa(B")
+("vsmg"	"$(H\[(B")
+("vsmh"	"$(HIV(B")
+("vsp"	"$AD](B")
+("vsqf"	"$(Gcd(B")
+("vsql"	"$ADH(B")
+("vsrr"	"$(GhI(B")
+("vss"	"$(H&/(B")
+("vstr"	"$(HIc(B")
+("vsu"	"$Aez(B")
+("vsyi"	"$(Hp5(B")
+("vtak"	"$AfF(B")
+("vtbc"	"$(H4k(B")
+("vtbn"	"$(H;((B")
+("vtgk"	"$(H;'(B")
+("vtgr"	"$(HP#(B")
+("vthg"	"$(HVf(B")
+("vtkr"	"$(H;!(B")
+("vtlf"	"$(HeH(B")
+("vtlo"	"$(HIb(B")
+("vtm"	"$(H&'(B")
+("vtmc"	"$(H4VP%(B")
+("vtmd"	"$AC=(B")
+("vtmj"	"$(HP((B")
+("vtsj"	"$(HBJ(B")
+("vtt"	"$Af0(B")
+("vttb"	"$AfE(B")
+("vtvp"	"$(HVc(B")
+("vtw"	"$(H;/(B")
+("vtxc"	"$AOS(B")
+("vu"	"$(H"0(B")
+("vumb"	"$(H;1(B")
+("vumi"	"$AfJ(B")
+("vumj"	"$(H4l(B")
+("vuob"	"$(HkU(B")
+("vuog"	"$(HdA(B")
+("vuuk"	"$(HB=(B")
+("vv"	"$(H"/(B")
+("vvf"	"$(GK$(B")
+("vvio"	"$Af&(B")
+("vvrau"	"$Ag_(B")
+("vvv"	"$(GPc(B")
+("vvw"	"$Ag^(B")
+("vvwd"	"$A32(B")
+("vwb"	"$(H:~(B")
+("vwd"	"$(H4Y(B")
+("vwg"	"$Af2(B")
+("vwhaf"	"$(HhV(B")
+("vwjlo"	"$(HXV(B")
+("vwjr"	"$(H4Z(B")
+("vwk"	"$ARv(B")
+("vwlk"	"$(HeF(B")
+("vwlv"	"$(HV](B")
+("vwot"	"$(Gce(B")
+("vwvf"	"$AfP(B")
+("vwyi"	"$AD7(B")
+("vyaj"	"$(H4[(B")
+("vybc"	"$(H;0(B")
+("vycb"	"$A5U(B")
+("vyck"	"$Af/(B")
+("vyfe"	"$(H4j(B")
+("vyg"	"$(H&%(B")
+("vyhs"	"$A7A(B")
+("vyia"	"$(HP$(B")
+("vyk"	"$(H#Y(B")
+("vymr"	"$(H.`(B")
+("vypd"	"$(HIX(B")
+("vyrf"	"$(H4d(B")
+("vyrn"	"$AfC(B")
+("vyrv"	"$(Gyh(B")
+("vyso"	"$(HIa(B")
+("vytj"	"$AfQ(B")
+("vytr"	"$(H4c(B")
+("vyvi"	"$(H&,(B")
+("vywm"	"$AfS(B")
+("w"	"$ALo(B")
+("wb"	"$AN8(B")
+("wbmbc"	"$(HdT(B")
+("wbp"	"$AS^(B")
+("wc"	"$AKD(B")
+("wcb"	"$(H#H(B")
+("wchaf"	"$(Hov(B")
+("wche"	"$(H1%(B")
+("wd"	"$A@'9{(B")
+("wdhv"	"$(H@4(B")
+("wdmbc"	"$(Gv((B")
+("wdmq"	"$(G^X(B")
+("wdnin"	"$Ab7(B")
+("wdye"	"$(H<:(B")
+("weee"	"$(HE"E+(B")
+("wfdq"	"$(H]_(B")
+("wfgr"	"$Awo(B")
+("wfgwc"	"$(G}B(B")
+("wfiih"	"$(Hp&(B")
+("wfik"	"$AD,(B")
+("wfip"	"$(HV<(B")
+("wfjbc"	"$(Hnu(B")
+("wfjnu"	"$(HkE(B")
+("wfklu"	"$(HkC(B")
+("wflbu"	"$(H\@(B")
+("wfmvu"	"$(H\A(B")
+("wfmwg"	"$(Hm9(B")
+("wfncr"	"$(HqS(B")
+("wfnin"	"$Awp(B")
+("wfoin"	"$AG-(B")
+("wfomt"	"$(Hm;(B")
+("wfq"	"$AEO(B")
+("wfqu"	"$AH&(B")
+("wftm"	"$(Ha;(B")
+("wftmv"	"$(Hm:(B")
+("wfuu"	"$Awm(B")
+("wfvis"	"$Awn(B")
+("wfyr"	"$(Gv5(B")
+("wfyrf"	"$Awt(B")
+("wfyta"	"$Awv(B")
+("wg"	"$A@o(B")
+("wgdi"	"$(H7?(B")
+("wgf"	"$A:Z(B")
+("wgfg"	"$AD+(B")
+("wgg"	"$AFh(B")
+("wgit"	"$(HB((B")
+("wgni"	"$(GxP(B")
+("wgnin"	"$AR0(B")
+("wgrv"	"$(GcP(B")
+("wgtj"	"$A`v(B")
+("whd"	"$(H%p(B")
+("whe"	"$An2(B")
+("wher"	"$ABT(B")
+("whjg"	"$(HK~(B")
+("wice"	"$(H>1(B")
+("wihaf"	"$(Hpp(B")
+("wijb"	"$AFT(B")
+("wik"	"$An0(B")
+("wino"	"$(Gs|(B")
+("wirm"	"$(GYO(B")
+("wiye"	"$(H\z(B")
+("wj"	"$ANc$(H!@(B")
+("wjbuc"	"$(G]K(B")
+("wjhaf"	"$(Hnspo(B")
+("wjii"	"$(Gh6(B")
+("wjnu"	"$(HE!$An5(B")
+("wjok"	"$(H\y(B")
+("wjr"	"$A9L(B")
+("wk"	"$ARr(B")
+("wkb"	"$A`s(B")
+("wkmr"	"$A;{(B")
+("wkno"	"$(H/y(B")
+("wkp"	"$A6w(B")
+("wks"	"$ADP(B")
+("wl"	"$A<W(B")
+("wlbi"	"$AX.(B")
+("wlbm"	"$(H2#(B")
+("wlbnd"	"$(H?%(B")
+("wlbuc"	"$(Gb9(B")
+("wlcwa"	"$An@(B")
+("wldd"	"$(HF0(B")
+("wleee"	"$(HF2(B")
+("wlgg"	"$(H86(B")
+("wlggy"	"$(HF/(B")
+("wlgrv"	"$(HRE(B")
+("wlgtj"	"$(GeH(B")
+("wlhaf"	"$(Gs9(B")
+("wlhhw"	"$(HRy(B")
+("wlhvo"	"$(H2$(B")
+("wlibp"	"$(GnH(B")
+("wlipf"	"$(HfF(B")
+("wlirm"	"$(HF.(B")
+("wljbm"	"$AVC(B")
+("wljka"	"$AJp(B")
+("wljr"	"$An9(B")
+("wlklu"	"$An;(B")
+("wlll"	"$(GNw(B")
+("wllmy"	"$AWo(B")
+("wlmc"	"$(HOp(B")
+("wlmf"	"$An7(B")
+("wlmfn"	"$(H^Q(B")
+("wlmym"	"$An8(B")
+("wlnih"	"$(H2!(B")
+("wlooo"	"$(G\8(B")
+("wlpli"	"$AJq(B")
+("wlpog"	"$An>(B")
+("wlrb"	"$(H?$(B")
+("wlrvp"	"$(H2"(B")
+("wlsfi"	"$(HYL(B")
+("wlsqf"	"$(GnG(B")
+("wltab"	"$(HfE(B")
+("wltjf"	"$(G|e(B")
+("wltjr"	"$(Hmq(B")
+("wlvff"	"$(HpH(B")
+("wlvfg"	"$(Gxe(B")
+("wlvvd"	"$(HYN(B")
+("wlwp"	"$(HM#(B")
+("wlwtj"	"$(HYM(B")
+("wlwwk"	"$(HaL(B")
+("wlyaj"	"$AUV(B")
+("wlyg"	"$(H1}(B")
+("wlymr"	"$An:(B")
+("wlyrn"	"$(GjH(B")
+("wlytg"	"$(H^O(B")
+("wml"	"$An/(B")
+("wmmr"	"$A`t(B")
+("wmn"	"$An.(B")
+("wmso"	"$(H.K(B")
+("wmv"	"$AN7(B")
+("wnd"	"$A`n(B")
+("wng"	"$AJ{(B")
+("wo"	"$AGt(B")
+("wohh"	"$An3(B")
+("woii"	"$A`r(B")
+("wok"	"$An1(B")
+("woll"	"$A=g(B")
+("womb"	"$(H4/(B")
+("wop"	"$(H#GJ+(B")
+("wp"	"$AK<(B")
+("wphh"	"$A`q(B")
+("wpim"	"$(H,<(B")
+("wpp"	"$AE~$(H+K(B")
+("wpu"	"$A6Z(B")
+("wqmb"	"$A`u(B")
+("wr"	"$A;X(B")
+("wrbc"	"$(GcQ(B")
+("wryw"	"$(Gh7(B")
+("wsvws"	"$AfU(B")
+("wtc"	"$(G\,(B")
+("wtj"	"$(G\+(B")
+("wumb"	"$(H:`(B")
+("wv"	"$A`o(B")
+("wvfd"	"$(HqZ(B")
+("wvif"	"$A@[(B")
+("wvsmm"	"$(HfI(B")
+("wwhaf"	"$(Hql(B")
+("wwlj"	"$(HVR(B")
+("wwlv"	"$A`w(B")
+("www"	"$(HR6(B")
+("wwwd"	"$(He_(B")
+("wwwf"	"$(Hkz(B")
+("wwwg"	"$(Gv?(B")
+("wwwm"	"$(G{h(B")
+("wwwr"	"$(HiK(B")
+("wwwu"	"$(Hk{(B")
+("wwwwg"	"$(Ho!(B")
+("wyhn"	"$(H#I(B")
+("wyi"	"$AD8(B")
+("wymr"	"$(H.J(B")
+("wyv"	"$(H(2(B")
+("y"	"$A27(B")
+("yad"	"$AW@(B")
+("yahag"	"$(Gwk(B")
+("yahej"	"$(H[d(B")
+("yai"	"$(HBx(B")
+("yaj"	"$AW?(B")
+("yamh"	"$(HH&(B")
+("yano"	"$Al'(B")
+("yaog"	"$Ae_(B")
+("yapv"	"$A6t(B")
+("yarbc"	"$(GyJ(B")
+("yashr"	"$AIX(B")
+("yasm"	"$Ae](B")
+("yatlk"	"$(HdQ(B")
+("yatoe"	"$(Ho_(B")
+("yav"	"$AMK(B")
+("ybaht"	"$(Hdd(B")
+("ybbr"	"$(Gg4(B")
+("ybgr"	"$(GbN(B")
+("ybhaf"	"$(Hk((B")
+("ybhg"	"$AM{(B")
+("ybhne"	"$(HK1(B")
+("ybhu"	"$Aec(B")
+("ybik"	"$(Gyx(B")
+("ybjj"	"$(Gg*(B")
+("yblb"	"$A5[(B")
+("yblbr"	"$A`4(B")
+("ybmcu"	"$An#(B")
+("ybmo"	"$(HTy(B")
+("ybmr"	"$(H3/(B")
+("ybmvn"	"$(HXUkl(B")
+("ybnl"	"$(Gg:(B")
+("ybno"	"$(H6;K+(B")
+("ybog"	"$(Gwb(B")
+("ybok"	"$(Gm.(B")
+("ybou"	"$(GkC(B")
+("ybr"	"$AeD(B")
+("ybuc"	"$(GSV(B")
+("ybye"	"$AGC(B")
+("ybyhs"	"$AET(B")
+("ybysp"	"$(Gs>(B")
+("yc"	"$AAy(B")
+("ycbr"	"$AIL(B")
+("ychaf"	"$(Hk-(B")
+("ychhj"	"$(G|t(B")
+("yck"	"$A=;^H(B")
+("yclb"	"$(GPv(B")
+("ycp"	"$(Hr*(B")
+("ycrhu"	"$(GP"(B")
+("ycrhv"	"$(G]5(B")
+("yct"	"$A^D(B")
+("ydbuu"	"$(Gr5(B")
+("ydhaf"	"$(GyX(B")
+("ydhhh"	"$(H_%(B")
+("ydhml"	"$APB(B")
+("ydkni"	"$AJk(B")
+("ydl"	"$AKY(B")
+("ydlk"	"$(HT{(B")
+("ydmq"	"$(Gg0(B")
+("ydnl"	"$A9y(B")
+("ydno"	"$(HQ9(B")
+("ydog"	"$(Gwc(B")
+("ydok"	"$A6X$(HPf(B")
+("ydrrj"	"$(Hhk(B")
+("yebu"	"$A6=(B")
+("yec"	"$(H[Q(B")
+("yefd"	"$AtS(B")
+("yefh"	"$(H9e(B")
+("yeg"	"$A[V(B")
+("yelmm"	"$(H[c(B")
+("yeoiv"	"$A2M(B")
+("yep"	"$(H;a(B")
+("yeyhv"	"$(HN'(B")
+("yfb"	"$AeP(B")
+("yfd"	"$ACT(B")
+("yfdq"	"$Ae`(B")
+("yfe"	"$AJe(B")
+("yfhaf"	"$(HhF(B")
+("yfiku"	"$A>M(B")
+("yfks"	"$(H.0(B")
+("yfye"	"$(H/O(B")
+("yg"	"$AVw(B")
+("ygcg"	"$AeS(B")
+("yggu"	"$(HZ|(B")
+("yghne"	"$(H+I(B")
+("yghqu"	"$(HWr(B")
+("ygiv"	"$(GuA(B")
+("ygmms"	"$(Gu6(B")
+("ygr"	"$(H34(B")
+("ygrv"	"$(Gk?(B")
+("ygsk"	"$Ae[(B")
+("ygtq"	"$(Gg.(B")
+("yha"	"$AFH(B")
+("yhaf"	"$(HHq(B")
+("yhag"	"$AeX(B")
+("yhbm"	"$(HmD(B")
+("yhds"	"$AM8(B")
+("yhdv"	"$AeT$(HT5(B")
+("yhe"	"$A75(B")
+("yhee"	"$(Hj.(B")
+("yhej"	"$A7j(B")
+("yheq"	"$AeL(B")
+("yhgr"	"$ATl(B")
+("yhhhh"	"$(GP}(B")
+("yhhqm"	"$(G\((B")
+("yhhw"	"$Ae^(B")
+("yhiv"	"$(HZE(B")
+("yhjr"	"$AJJ(B")
+("yhju"	"$A6](B")
+("yhk"	"$(H(r(B")
+("yhln"	"$(HO[(B")
+("yhmbc"	"$(Gs"wm$(HnB(B")
+("yhml"	"$A=|(B")
+("yhmo"	"$(H_o(B")
+("yhmr"	"$AeK(B")
+("yhn"	"$A?:(B")
+("yhqo"	"$A5|(B")
+("yhrr"	"$AW7(B")
+("yhs"	"$A7=eE(B")
+("yhsb"	"$A1i(B")
+("yhsk"	"$AQ{(B")
+("yhsmm"	"$(HfH(B")
+("yhus"	"$(Gy1(B")
+("yhv"	"$ARB(B")
+("yhvl"	"$AS-(B")
+("yhxv"	"$AYv(B")
+("yhyu"	"$(GkD(B")
+("yib"	"$AS}(B")
+("yice"	"$AeR(B")
+("yif"	"$AJl(B")
+("yifh"	"$(H,((B")
+("yig"	"$A[S(B")
+("yihu"	"$A3d(B")
+("yihxo"	"$(HadZ((B")
+("yijb"	"$AeM(B")
+("yijc"	"$AJv(B")
+("yije"	"$AeO(B")
+("yik"	"$(H(p(B")
+("yiohv"	"$(H7/(B")
+("yioj"	"$ABJ(B")
+("yir"	"$AeJ(B")
+("yirv"	"$(H9D(B")
+("yitd"	"$(G[9(B")
+("yitf"	"$AUZ(B")
+("yiyvi"	"$(GV\(B")
+("yj"	"$A67(B")
+("yjco"	"$Aed(B")
+("yjdl"	"$A@1(B")
+("yjhaf"	"$(HhQ(B")
+("yjhec"	"$(G|m(B")
+("yjhee"	"$(HiR(B")
+("yjhhh"	"$AUC(B")
+("yjhoj"	"$A0j(B")
+("yjilj"	"$A1f(B")
+("yjksj"	"$(GrV(B")
+("yjnl"	"$A[5(B")
+("yjrr"	"$AeU(B")
+("yjvfj"	"$(Gz)(B")
+("yjwj"	"$(G]Y(B")
+("yjyrj"	"$(G{3(B")
+("yk"	"$AND(B")
+("ykanw"	"$(Gzn(B")
+("ykb"	"$(H35(B")
+("ykcf"	"$(Gr[(B")
+("ykhaf"	"$(HV/a%nlpn(B")
+("ykhbm"	"$(Ho-(B")
+("ykhf"	"$AeQ(B")
+("ykhg"	"$A9d(B")
+("ykhsb"	"$(HCC(B")
+("ykmbc"	"$(HU`(B")
+("ykmpm"	"$A1s(B")
+("yknl"	"$A=<(B")
+("ykok"	"$AP'(B")
+("ykp"	"$(H&Y$Am-(B")
+("ykpb"	"$(HTx(B")
+("ykq"	"$(HW5(B")
+("ykr"	"$AA_(B")
+("yksr"	"$AeH(B")
+("ykvif"	"$ANI(B")
+("ykymu"	"$(HrB(B")
+("ylb"	"$AJP(B")
+("yle"	"$A4~(B")
+("ylhv"	"$AVT(B")
+("ylm"	"$AV9(B")
+("ylmc"	"$(Gr\(B")
+("ylmh"	"$A2=(B")
+("ylmo"	"$ALS(B")
+("ylmr"	"$AG2(B")
+("ylnc"	"$AR`(B")
+("ylw"	"$A5O(B")
+("ym"	"$AIO(B")
+("ymb"	"$A?O(B")
+("ymbuc"	"$(Hg5(B")
+("ymbuu"	"$(Hf~(B")
+("ymcw"	"$(GXN(B")
+("ymd"	"$ASX(B")
+("ymdhe"	"$(HX`b?(B")
+("ymfb"	"$(GwM(B")
+("ymg"	"$(H(m(B")
+("ymgdi"	"$(H/|(B")
+("ymhaf"	"$(Hpl(B")
+("ymhqu"	"$(Gt!(B")
+("ymihh"	"$(GdY(B")
+("ymje"	"$AFg(B")
+("ymks"	"$(HO](B")
+("ymln"	"$(Gc7(B")
+("ymmbc"	"$(G|$(B")
+("ymmp"	"$(G|I(B")
+("ymmr"	"$AQT$(H9h(B")
+("ymnn"	"$(H3.(B")
+("ymno"	"$(HWj(B")
+("ymp"	"$A4Kl~(B")
+("ympog"	"$A4F(B")
+("ymrt"	"$A6:(B")
+("ymrw"	"$A1F(B")
+("ymso"	"$AVp(B")
+("ymuoo"	"$(Gp/(B")
+("ymvh"	"$AeB(B")
+("ymvm"	"$(G]](B")
+("ymwu"	"$(GoO(B")
+("ymy"	"$A?((B")
+("ynbq"	"$Aeb(B")
+("yndf"	"$(GkA(B")
+("ynhb"	"$(HZ}(B")
+("ynhv"	"$AYs(B")
+("ynib"	"$AM((B")
+("ynin"	"$(H32(B")
+("yniv"	"$(H@3(B")
+("ynj"	"$AQ8(B")
+("ynmbc"	"$(HHd(B")
+("ynnl"	"$(H%'(B")
+("ynot"	"$(H[!(B")
+("ynui"	"$AR](B")
+("yobuc"	"$(HGa(B")
+("yodv"	"$A0}(B")
+("yog"	"$(GbP(B")
+("yohne"	"$ARc(B")
+("yoj"	"$AeC(B")
+("yoks"	"$A[@(B")
+("yoln"	"$A?L$(Gl*(B")
+("yombc"	"$(HUa(B")
+("yomd"	"$AM>(B")
+("yomn"	"$ASb(B")
+("yon"	"$AFy(B")
+("yonk"	"$AR9(B")
+("yono"	"$(H/w(B")
+("yooj"	"$AWd(B")
+("yopd"	"$AeF(B")
+("yp"	"$Ar.(B")
+("ypa"	"$(H31(B")
+("ypbu"	"$(H7S(B")
+("ypbuc"	"$(Gft(B")
+("ypc"	"$(HO"(B")
+("ypd"	"$(GKS$A2q(B")
+("ypg"	"$(Gx/(B")
+("yphaf"	"$(Hpkr((B")
+("yphen"	"$(G]((B")
+("yphfd"	"$(H9!(B")
+("yphu"	"$A;"(B")
+("ypks"	"$(H\K(B")
+("yplmi"	"$(Hm}(B")
+("ypmk"	"$(HkM(B")
+("ypmm"	"$AP)(B")
+("ypmmf"	"$(H7emC(B")
+("ypmr"	"$AmN$(Hkp(B")
+("ypmrb"	"$(H[w(B")
+("ypmso"	"$(HG](B")
+("ypnbg"	"$Au~(B")
+("ypnwf"	"$(H`~(B")
+("ypobo"	"$(H?.(B")
+("ypoiv"	"$(HUi(B")
+("ypph"	"$(H8~(B")
+("ypr"	"$(H)J(B")
+("yprvk"	"$AS](B")
+("ypsj"	"$(G{n(B")
+("ypsm"	"$AE0(B")
+("ypt"	"$(H-M(B")
+("yptc"	"$(G|3(B")
+("yptm"	"$(Gap(B")
+("yptmc"	"$(HM[(B")
+("ypu"	"$(H(o(B")
+("ypuv"	"$(H9E(B")
+("ypvif"	"$AWO(B")
+("ypwb"	"$(GnP(B")
+("ypwbt"	"$(GqM(B")
+("ypwks"	"$(Gf?(B")
+("ypwlb"	"$(HRY(B")
+("ypwp"	"$(Gle(B")
+("ypybp"	"$(HrD(B")
+("ypyhv"	"$(G{q(B")
+("ypyk"	"$Ar/(B")
+("ypymr"	"$Av$$(HoP(B")
+("yqhl"	"$AJE(B")
+("yr"	"$AU<(B")
+("yramo"	"$(HZT(B")
+("yranb"	"$(Hg*(B")
+("yranw"	"$(HpP(B")
+("yrapv"	"$(Gr@(B")
+("yrav"	"$(HG=(B")
+("yrawe"	"$(HcN(B")
+("yrbb"	"$A8`(B")
+("yrbbn"	"$(GzD(B")
+("yrbgr"	"$(Gn~(B")
+("yrbhn"	"$(Hpq(B")
+("yrbjj"	"$(HZM(B")
+("yrbln"	"$AYy(B")
+("yrbm"	"$(Gb((B")
+("yrbme"	"$(GrF(B")
+("yrbmr"	"$(HGP(B")
+("yrbn"	"$AM$(B")
+("yrbo"	"$A:@(B")
+("yrbou"	"$(GuL(B")
+("yrbp"	"$AYq(B")
+("yrbr"	"$A8_$(H@A(B")
+("yrbsd"	"$(Go#(B")
+("yrbtn"	"$AYz(B")
+("yrbu"	"$AAA:A(B")
+("yrbuu"	"$(H@7(B")
+("yrbvk"	"$(H_O(B")
+("yrbvn"	"$AYx(B")
+("yrbwn"	"$(Hk~(B")
+("yrci"	"$(G]D(B")
+("yrcmt"	"$(HZX(B")
+("yrcru"	"$(Gk)(B")
+("yrdd"	"$(HTJ(B")
+("yrdhe"	"$(Gb.(B")
+("yrdi"	"$(GX6(B")
+("yrdk"	"$(G]@(B")
+("yrdmq"	"$(Gr:(B")
+("yrdoo"	"$(HTK(B")
+("yrdwf"	"$(Gr9(B")
+("yrea"	"$(HTD(B")
+("yrf"	"$A>)(B")
+("yrfb"	"$(Gk.(B")
+("yrfbf"	"$(G}:(B")
+("yrff"	"$(Gnv(B")
+("yrfh"	"$(H9N(B")
+("yrfq"	"$(H@H(B")
+("yrgcr"	"$(Hr6(B")
+("yrgdi"	"$(Gf](B")
+("yrgg"	"$(HGM(B")
+("yrggu"	"$(Hg%(B")
+("yrgni"	"$(Hl=(B")
+("yrgp"	"$(Gk"(B")
+("yrgr"	"$(Gf^(B")
+("yrgrr"	"$(Gy#(B")
+("yrgwc"	"$(G{t(B")
+("yrhag"	"$(HZ\(B")
+("yrhdn"	"$(HcV(B")
+("yrhds"	"$(Gk,(B")
+("yrhdv"	"$(Gn|(B")
+("yrhdw"	"$(Hg.(B")
+("yrher"	"$(Gfj(B")
+("yrhg"	"$A3Q(B")
+("yrhge"	"$(Hj#(B")
+("yrhgr"	"$(Gk*(B")
+("yrhgu"	"$(HGS(B")
+("yrhhi"	"$(GuM(B")
+("yrhhj"	"$(HTG(B")
+("yrhjd"	"$(Gfd(B")
+("yrhjm"	"$(HZV(B")
+("yrhjr"	"$(Gfc(B")
+("yrhk"	"$(H9O(B")
+("yrhkb"	"$(Hg,(B")
+("yrhml"	"$(G]F(B")
+("yrhmr"	"$(Gfh(B")
+("yrhmy"	"$(Gb+(B")
+("yrhne"	"$(G]C(B")
+("yrhni"	"$(GrB(B")
+("yrhor"	"$(Hg/(B")
+("yrhp"	"$(GX:(B")
+("yrhpa"	"$(HTM(B")
+("yrhpm"	"$(Gb*(B")
+("yrhqo"	"$(H@C(B")
+("yrhs"	"$(Gb)(B")
+("yrhsb"	"$(HZW(B")
+("yrhsm"	"$(H_Y(B")
+("yrhuc"	"$(G}4(B")
+("yrhv"	"$A0'(B")
+("yrhwp"	"$(HcP(B")
+("yrhxe"	"$(H_S(B")
+("yrhxo"	"$(Go&(B")
+("yrhxu"	"$(HTL(B")
+("yrhyu"	"$(H_U(B")
+("yriav"	"$(HN6(B")
+("yrihr"	"$(HZO(B")
+("yrihs"	"$(Gfb(B")
+("yrii"	"$(HT@(B")
+("yrijb"	"$(Gk/(B")
+("yrijc"	"$(H@>(B")
+("yrikk"	"$(H@?(B")
+("yriku"	"$(H9M(B")
+("yrill"	"$(HGK(B")
+("yrine"	"$(Gb"(B")
+("yriok"	"$(HN5(B")
+("yrior"	"$(Gr>(B")
+("yripm"	"$(Gf\(B")
+("yrir"	"$(H@E(B")
+("yrit"	"$(Gk&(B")
+("yritc"	"$(Hj"(B")
+("yritf"	"$(HcS(B")
+("yrj"	"$(GSS(B")
+("yrjbc"	"$(H_[(B")
+("yrjbd"	"$(HN7(B")
+("yrjbj"	"$(HZP(B")
+("yrjbm"	"$(Gnt(B")
+("yrjhp"	"$(GfY(B")
+("yrjhw"	"$(Hn)(B")
+("yrjip"	"$(Hg'(B")
+("yrjka"	"$(Gnz(B")
+("yrjmm"	"$(HZL(B")
+("yrjp"	"$(H@G(B")
+("yrjr"	"$(Gb&(B")
+("yrkb"	"$(HGV(B")
+("yrkf"	"$(Gf`(B")
+("yrkhg"	"$(Gk-(B")
+("yrkja"	"$(HcK(B")
+("yrkms"	"$(Gf_(B")
+("yrlll"	"$(GX;(B")
+("yrlmo"	"$(HGQ(B")
+("yrlmy"	"$(Go%(B")
+("yrln"	"$AFJ(B")
+("yrlwv"	"$(HcO(B")
+("yrm"	"$(GX7(B")
+("yrmbs"	"$(HcG(B")
+("yrmd"	"$(GX=(B")
+("yrmdm"	"$(HoQ(B")
+("yrmfj"	"$(Gb#(B")
+("yrmhf"	"$(H_Z(B")
+("yrmj"	"$(GX5(B")
+("yrmjk"	"$(Hg&(B")
+("yrmmr"	"$(Gk#(B")
+("yrmmv"	"$(HN2(B")
+("yrmn"	"$(GST(B")
+("yrmnr"	"$(Gb-(B")
+("yrmoo"	"$(Gk$(B")
+("yrmrw"	"$(HZY(B")
+("yrmso"	"$(HTA(B")
+("yrmua"	"$(Hg((B")
+("yrmvh"	"$(G]?(B")
+("yrmvm"	"$(HN3(B")
+("yrmvn"	"$(HD{(B")
+("yrmwf"	"$(HcU(B")
+("yrmwg"	"$(HZN(B")
+("yrmwj"	"$(Gx~(B")
+("yrmym"	"$(Gb%(B")
+("yrnbe"	"$(Hn'(B")
+("yrncr"	"$(GzC(B")
+("yrnd"	"$AOm(B")
+("yrnf"	"$AEk(B")
+("yrnhb"	"$(Gy!(B")
+("yrnhx"	"$(Gn}(B")
+("yrnib"	"$(Gk!(B")
+("yrnin"	"$(HGT(B")
+("yrnir"	"$(HGW(B")
+("yrnj"	"$(GX9(B")
+("yrnkm"	"$(Gnx(B")
+("yrnl"	"$A2?(B")
+("yrnlp"	"$(HpO(B")
+("yrnmu"	"$(Gfe(B")
+("yrnn"	"$A:`(B")
+("yrnob"	"$(HZQ(B")
+("yrnot"	"$(Gx}(B")
+("yrnqd"	"$(H_Q(B")
+("yrnri"	"$(G|j(B")
+("yrnyi"	"$(HT?(B")
+("yrob"	"$(G]A(B")
+("yrog"	"$(Go!(B")
+("yroge"	"$(H_R(B")
+("yrogf"	"$(Gy$(B")
+("yrohh"	"$(Gb,(B")
+("yroii"	"$(H@D(B")
+("yroim"	"$(G|k(B")
+("yroip"	"$(HTE(B")
+("yroir"	"$(H_T(B")
+("yroj"	"$(G]B(B")
+("yrok"	"$(H<<(B")
+("yromb"	"$(Go"(B")
+("yromg"	"$(Gfg(B")
+("yromn"	"$(GrC(B")
+("yromo"	"$(Hi~(B")
+("yron"	"$(GX<(B")
+("yrop"	"$(G]E(B")
+("yrotf"	"$(Hg+(B")
+("yrowy"	"$(Gk+(B")
+("yrpa"	"$(Gfaff(B")
+("yrpd"	"$(GX>(B")
+("yrpht"	"$(GuO(B")
+("yrpko"	"$(Hl?(B")
+("yrppa"	"$(Gr=(B")
+("yrpt"	"$(H@=(B")
+("yrptd"	"$(Gr<(B")
+("yrpu"	"$(H9L(B")
+("yrpuu"	"$(H_P(B")
+("yrqd"	"$(HGR(B")
+("yrqjp"	"$(Hn*(B")
+("yrqmb"	"$(Gny(B")
+("yrqmc"	"$(HcT(B")
+("yrqmv"	"$(HTI(B")
+("yrrrd"	"$(GzB(B")
+("yrrrj"	"$(Hg-(B")
+("yrrrs"	"$(HZS(B")
+("yrrsj"	"$(HZZ(B")
+("yrru"	"$(HZ~(B")
+("yrruc"	"$(Hg)(B")
+("yrrv"	"$AOe(B")
+("yrrvk"	"$(Gk((B")
+("yrrxu"	"$(Hi|(B")
+("yrshi"	"$(H3!(B")
+("yrshr"	"$(Gb'(B")
+("yrsim"	"$(Hl>(B")
+("yrsip"	"$(Gk%(B")
+("yrsje"	"$(HT=(B")
+("yrsjj"	"$(Hq<(B")
+("yrsma"	"$(HcJ(B")
+("yrsmg"	"$(HGL(B")
+("yrsmh"	"$(Gw@(B")
+("yrsmm"	"$(HGN(B")
+("yrsmr"	"$(Gb$(B")
+("yrsrr"	"$(HcH(B")
+("yrss"	"$(H@<(B")
+("yrsu"	"$(GX4(B")
+("yrsup"	"$(HN4(B")
+("yrsyj"	"$(H_M(B")
+("yrtak"	"$(Gw>(B")
+("yrtav"	"$(Hi{(B")
+("yrtbm"	"$(Hn%(B")
+("yrtca"	"$(Gx{(B")
+("yrtct"	"$(H_\(B")
+("yrtgi"	"$(Gz>(B")
+("yrtkr"	"$(Gr?(B")
+("yrtlf"	"$(HoN(B")
+("yrtlm"	"$(Gw?(B")
+("yrtm"	"$(H@I(B")
+("yrtmc"	"$(HT>(B")
+("yrtmd"	"$(Gr;(B")
+("yrtmj"	"$(Gxz(B")
+("yrtmv"	"$(GrE(B")
+("yrtoe"	"$(G{,(B")
+("yrtq"	"$(Gf[(B")
+("yrtrg"	"$(Hq=(B")
+("yrtt"	"$(HGU(B")
+("yrttb"	"$(GuJ(B")
+("yrtwi"	"$(Hg#(B")
+("yrtwv"	"$(Hi}(B")
+("yrtxc"	"$(GuI(B")
+("yrtyu"	"$(GuK(B")
+("yru"	"$AX@$(GX8(B")
+("yruc"	"$(GrY(B")
+("yrumb"	"$(HZ[(B")
+("yruu"	"$(H@B(B")
+("yrvii"	"$(Gy"(B")
+("yrvis"	"$(H@J(B")
+("yrwb"	"$(GrA(B")
+("yrwce"	"$(H_N(B")
+("yrwd"	"$(Gn{(B")
+("yrwlj"	"$(GzA(B")
+("yrwp"	"$(HZU(B")
+("yrwww"	"$(Hn&(B")
+("yry"	"$(GSU(B")
+("yrybb"	"$(Gr7(B")
+("yrybk"	"$(Hqw(B")
+("yrybs"	"$(GuH(B")
+("yrycb"	"$(GwA$(HcE(B")
+("yryck"	"$(Gfl(B")
+("yrydk"	"$(Hg$(B")
+("yrye"	"$AeZ$(H*h(B")
+("yryfd"	"$(GuG(B")
+("yryfe"	"$(HTB(B")
+("yryg"	"$(Gb!(B")
+("yryhh"	"$(Gr8(B")
+("yryhs"	"$(G]>(B")
+("yryia"	"$(Gx|(B")
+("yryjj"	"$(HcI(B")
+("yrylr"	"$(G{+(B")
+("yrymp"	"$(HGO(B")
+("yryoj"	"$(Go$(B")
+("yrypd"	"$(HcM(B")
+("yrypm"	"$(HZRcL(B")
+("yrypu"	"$(HTC(B")
+("yryr"	"$(H@@(B")
+("yryrb"	"$(H_L(B")
+("yryrd"	"$(Gnw(B")
+("yryrf"	"$(Gnu(B")
+("yryro"	"$(Hl<(B")
+("yryrv"	"$(G|i(B")
+("yryta"	"$(GrD(B")
+("yryub"	"$(HcF(B")
+("yryvo"	"$(GfZ(B")
+("yrywm"	"$(Hiz(B")
+("ys"	"$(H%%(B")
+("ysfv"	"$(HZA(B")
+("yshr"	"$ALv(B")
+("ysm"	"$ASk(B")
+("ysmvn"	"$(H,9(B")
+("ysnl"	"$AZz(B")
+("ysoby"	"$Al9(B")
+("ysofb"	"$(HCD(B")
+("ysohc"	"$(Hh{(B")
+("ysohl"	"$(H/T(B")
+("ysohm"	"$Al:(B")
+("ysohn"	"$(H'$(B")
+("ysohu"	"$Al8(B")
+("ysohv"	"$ABC(B")
+("ysohw"	"$(Hae(B")
+("ysojb"	"$Al7(B")
+("ysok"	"$A7E(B")
+("ysokr"	"$Al=(B")
+("ysolo"	"$(H<B(B")
+("ysomf"	"$(H\|(B")
+("ysond"	"$(H*k(B")
+("ysono"	"$AP}(B")
+("ysooa"	"$(HeU(B")
+("ysooi"	"$(H5j(B")
+("ysook"	"$AWe(B")
+("ysopd"	"$AJ)(B")
+("ysosp"	"$Al;(B")
+("ysotc"	"$AFl(B")
+("ysoy"	"$Al6(B")
+("ysoyu"	"$Al<(B")
+("ysp"	"$(H-U(B")
+("ysrj"	"$A1\(B")
+("ysyoo"	"$(HeT(B")
+("ysyq"	"$(GrZ(B")
+("yt"	"$AA"(B")
+("yta"	"$ARt(B")
+("ytahu"	"$A>9(B")
+("ytaj"	"$AUB(B")
+("ytap"	"$ARb(B")
+("ytapv"	"$A=_(B")
+("ytbsd"	"$(HEj(B")
+("ytcw"	"$AeY(B")
+("ytdl"	"$Aq5(B")
+("ythaf"	"$(H\0r'(B")
+("ythni"	"$(Gkl(B")
+("ythu"	"$A5@(B")
+("yti"	"$(Gsa(B")
+("ytice"	"$A?"(B")
+("ytj"	"$APA(B")
+("ytjki"	"$(H>a(B")
+("ytk"	"$AKM(B")
+("ytki"	"$(H,b(B")
+("ytkr"	"$(HH)(B")
+("ytmbc"	"$(G}-(B")
+("ytog"	"$(HTw(B")
+("ytpo"	"$AKl(B")
+("ytpr"	"$(H1`(B")
+("ytqmb"	"$A>8(B")
+("ytsmm"	"$Aq4(B")
+("ytstt"	"$(HLT(B")
+("ytt"	"$A1E(B")
+("yttb"	"$Ae\(B")
+("ytu"	"$ADf(B")
+("ytumb"	"$A6K(B")
+("ytv"	"$Af*(B")
+("ytwa"	"$ATb(B")
+("ytwb"	"$(Gue(B")
+("ytwg"	"$AM/(B")
+("ytwi"	"$AWq(B")
+("ytyr"	"$AU>(B")
+("yu"	"$(H%&(B")
+("yuav"	"$(G{U(B")
+("yubm"	"$(Gz_(B")
+("yubuc"	"$(HoS(B")
+("yubuu"	"$(HT8(B")
+("yudi"	"$(GpR(B")
+("yue"	"$(HVF(B")
+("yuhaf"	"$(Hoz(B")
+("yuhhh"	"$A1k(B")
+("yuhlb"	"$(G}!(B")
+("yuhml"	"$(Hhh(B")
+("yuhxu"	"$(Hp2(B")
+("yuii"	"$(HZ&(B")
+("yuir"	"$(HkK(B")
+("yujbc"	"$(HqW(B")
+("yukb"	"$A@k(B")
+("yukmr"	"$(Hp1(B")
+("yulwp"	"$(HmA(B")
+("yumb"	"$AeW(B")
+("yummr"	"$(G|1(B")
+("yumvh"	"$(Hhg(B")
+("yuoii"	"$(Gza(B")
+("yuolf"	"$(Hqs(B")
+("yuoll"	"$(Hhi(B")
+("yuon"	"$(He6(B")
+("yup"	"$(HaA(B")
+("yupr"	"$(Gz`(B")
+("yupru"	"$(HkL(B")
+("yupt"	"$(HkH(B")
+("yupuu"	"$(HqX(B")
+("yurc"	"$(HkJ(B")
+("yurrs"	"$(Hp{(B")
+("yuryo"	"$(G|2(B")
+("yushr"	"$(HkI(B")
+("yusje"	"$(Hp/(B")
+("yusmg"	"$(G|~(B")
+("yuta"	"$(Hp0(B")
+("yutct"	"$(HqV(B")
+("yutm"	"$(HD~E)(B")
+("yuwd"	"$(Hnz(B")
+("yuwlb"	"$(Hpz(B")
+("yuyhh"	"$(Hpy(B")
+("yuymp"	"$(G{T(B")
+("yuypu"	"$(HZ'(B")
+("yuytu"	"$(Gz#(B")
+("yv"	"$AMv(B")
+("yvb"	"$AkAkv(B")
+("yvbcr"	"$ARa(B")
+("yvbq"	"$(G[t(B")
+("yvbu"	"$AC$(B")
+("yvd"	"$(GJb(B")
+("yvgg"	"$A[U(B")
+("yvgn"	"$(Gvh(B")
+("yvgu"	"$(HfC(B")
+("yvgv"	"$AwS(B")
+("yvhbt"	"$(H-K(B")
+("yvhg"	"$AS:(B")
+("yvhlu"	"$(H":(B")
+("yvho"	"$A:%(B")
+("yvhvo"	"$AH?(B")
+("yvi"	"$AP~(B")
+("yviw"	"$APs(B")
+("yvks"	"$(He:(B")
+("yvne"	"$AeV(B")
+("yvnl"	"$AZx(B")
+("yvp"	"$AM|(B")
+("yvrvp"	"$AC%(B")
+("yvv"	"$AM}(B")
+("yvvv"	"$AQ2ee(B")
+("ywdv"	"$A9|(B")
+("ywgv"	"$(IDN(B")
+("ywihr"	"$(Gz[(B")
+("ywii"	"$(G^%(B")
+("ywlb"	"$ASv(B")
+("ywle"	"$(GkF(B")
+("ywlg"	"$(G|J(B")
+("ywlv"	"$(Gud$(HZD(B")
+("ywmv"	"$AK%(B")
+("ywnl"	"$(HH*(B")
+("ywno"	"$(GVd(B")
+("ywomo"	"$(G|{(B")
+("ywr"	"$(GXO(B")
+("ywrd"	"$(Geb(B")
+("ywrm"	"$(HAX(B")
+("yws"	"$AXU(B")
+("ywtqm"	"$(Hm7(B")
+("yx"	"$(Gk}(B")
+("yxbt"	"$(Hhf(B")
+("yxbuc"	"$(Hm@(B")
+("yxf"	"$(Gv:$(He5(B")
+("yxlmm"	"$(Hp.(B")
+("yxln"	"$(Gp8(B")
+("yy"	"$A1e(B")
+("yyaj"	"$(H@s(B")
+("yybc"	"$(HH((B")
+("yycb"	"$(GoK(B")
+("yyhn"	"$(H(l(B")
+("yymr"	"$(G]U(B")
+("yypo"	"$Aea(B")
+("yyr"	"$(H-W(B")
+("yysd"	"$(Gg+(B")
+("yytj"	"$(HTz(B")
+("yywm"	"$(H_n(B")
+("yyws"	"$(H9i(B")
+("z;" "$A#;$(G!2$A#,!"$(G!.!/(B")
+("z:" "$A#:$(G!+!3$A#.!#!$$(G!0!1(B")
+("z'" "$A!/!.(B")
+("z\"" "$A!1!0$(G!h!i$A!((B")
+("z\\" "$A#\$(G"b#M(B")
+("z|" "$(G!6!8!:$A#|(B")
+("z/" "$A#/$(G"a#L(B")
+("z?" "$A#?$(G!4(B")
+("z<" "$A!4#<$(G"A!T$A!O(B")
+("z>" "$A!5#>$(G"B!U(B")
+("z[" "$A!2!>$(G!b!H!L$A!8!:$(G!X!\(B")
+("z]" "$A!3!?$(G!c!I!M$A!9!;$(G!Y!](B")
+("z{" "$A#{$(G!`!D(B ")
+("z}" "$A#}$(G!a!E(B")
+("z`" "$A!d$(G!k(B")
+("z~" "$(G"D"+",!<!=(B")
+("z!" "$A#!$(G!5(B")
+("z@" "$A#@$(G"n(B")
+("z#" "$A##$(G"-(B")
+("z$" "$A!g$(G"l(B")
+("z%" "$A#%$(G"m(B")
+("z&" "$A#&$(G".(B")
+("z*" "$A#*$(G"/$A!y!n!o(B")
+("z(" "$A#($(G!^!@(B")
+("z)" "$A#)$(G!_!A(B")
+("z-" "$(G!7!9"#"$$A#-$(G"@(B")
+("z_" "$A#_$(G"&(B")
+("z=" "$A#=$(G"C(B")
+("z+" "$A#+$(G"?(B")
+)
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: iso-2022-cn-ext
+;; End:
+
+;;; tsang-cns.el ends here
@@ -207,12 +207,15 @@ profiler-read-profile
 
 (defun profiler-running-p (&optional mode)
   "Return non-nil if the profiler is running.
-Optional argument MODE means only check for the specified mode (cpu or mem)."
+Optional argument MODE means only check for the specified mode (cpu,
+mem or byte-code)."
   (cond ((eq mode 'cpu) (and (fboundp 'profiler-cpu-running-p)
                              (profiler-cpu-running-p)))
         ((eq mode 'mem) (profiler-memory-running-p))
+        ((eq mode 'byte-code) (profiler-byte-code-running-p))
         (t (or (profiler-running-p 'cpu)
-               (profiler-running-p 'mem)))))
+               (profiler-running-p 'mem)
+               (profiler-running-p 'byte-code)))))
 
 (defun profiler-cpu-profile ()
   "Return CPU profile."
@@ -799,20 +802,94 @@ profiler-report-write-profile
                           filename
                           confirm))
 
+
+;;; Byte-code profiler report
+
+(defvar byte-code-vector)
+(defvar byte-pophandler)
+(defvar byte-constant)
+
+(defvar profiler-byte-code-report-instructions 10
+  "Number of instructions listed for each function in a byte-code report.")
+
+(defun profiler-byte-code-op-name (op)
+  "Return the name of the byte-code instruction OP, as a string."
+  (require 'bytecomp)
+  (let ((name (aref byte-code-vector
+                    (cond ((< op byte-pophandler) (logand op -8))
+                          ((>= op byte-constant) byte-constant)
+                          (t op)))))
+    (if name
+        (substring (symbol-name name) (length "byte-"))
+      (format "op%d" op))))
+
+(defun profiler-byte-code-report (log)
+  "Display the byte-code profiler log LOG.
+List the functions that ran, those that executed the most instructions
+first.  For each function, list its most executed instructions, and
+for a call instruction, the functions it called.  LOG is the value of
+`profiler-byte-code-log'."
+  (let ((entries nil)
+        (total 0))
+    (maphash (lambda (bytestr entry)
+               (let ((sum (apply #'+ (append (aref entry 1) nil))))
+                 (setq total (+ total sum))
+                 (push (list sum bytestr entry) entries)))
+             log)
+    (with-current-buffer
+        (get-buffer-create
+         (format "*Byte-Code-Profiler-Report %s*"
+                 (format-time-string "%Y-%m-%d %T")))
+      (let ((inhibit-read-only t))
+        (erase-buffer)
+        (dolist (item (sort entries (lambda (a b) (> (car a) (car b)))))
+          (pcase-let ((`(,sum ,bytestr [,function ,counts ,calls]) item))
+            (insert (format "%12s %5s  %s\n"
+                            (profiler-format-number sum)
+                            (profiler-format-percent sum total)
+                            (profiler-ensure-string function)))
+            (let ((pcs nil))
+              (dotimes (pc (length counts))
+                (when (> (aref counts pc) 0)
+                  (push pc pcs)))
+              (setq pcs (sort pcs (lambda (a b)
+                                    (> (aref counts a) (aref counts b)))))
+              (dolist (pc (butlast pcs (- (length pcs)
+                                          profiler-byte-code-report-instructions)))
+                (insert (format "%12s %5d    %s\n"
+                                (profiler-format-number (aref counts pc))
+                                pc
+                                (profiler-byte-code-op-name (aref bytestr pc))))
+                (dolist (callee (and calls
+                                     (sort (copy-sequence (aref calls pc))
+                                           (lambda (a b) (> (cdr a) (cdr b))))))
+                  (insert (format "%12s %5s    -> %s\n"
+                                  (profiler-format-number (cdr callee))
+                                  ""
+                                  (profiler-ensure-string (car callee)))))))))
+        (goto-char (point-min))
+        (special-mode))
+      (pop-to-buffer (current-buffer)))))
+
 
 ;;; Profiler commands
 
 ;;;###autoload
 (defun profiler-start (mode)
   "Start/restart profilers.
-MODE can be one of `cpu', `mem', or `cpu+mem'.
+MODE can be one of `cpu', `mem', `cpu+mem' or `byte-code'.
 If MODE is `cpu' or `cpu+mem', time-based profiler will be started.
-Also, if MODE is `mem' or `cpu+mem', then memory profiler will be started."
+Also, if MODE is `mem' or `cpu+mem', then memory profiler will be started.
+If MODE is `byte-code', the byte-code profiler, which counts the
+instructions that byte-compiled functions execute, will be started."
   (interactive
-   (list (if (not (fboundp 'profiler-cpu-start)) 'mem
-           (intern (completing-read "Mode (default cpu): "
-                                    '("cpu" "mem" "cpu+mem")
-                                    nil t nil nil "cpu")))))
+   (list (intern (completing-read "Mode (default cpu): "
+                                  (if (fboundp 'profiler-cpu-start)
+                                      '("cpu" "mem" "cpu+mem" "byte-code")
+                                    '("mem" "byte-code"))
+                                  nil t nil nil
+                                  (if (fboundp 'profiler-cpu-start)
+                                      "cpu" "mem")))))
   (cl-ecase mode
     (cpu
      (profiler-cpu-start profiler-sampling-interval)
@@ -823,17 +900,22 @@ profiler-start
     (cpu+mem
      (profiler-cpu-start profiler-sampling-interval)
      (profiler-memory-start)
-     (message "CPU and memory profiler started"))))
+     (message "CPU and memory profiler started"))
+    (byte-code
+     (profiler-byte-code-start)
+     (message "Byte-code profiler started"))))
 
 (defun profiler-stop ()
   "Stop started profilers.  Profiler logs will be kept."
   (interactive)
   (let ((cpu (if (fboundp 'profiler-cpu-stop) (profiler-cpu-stop)))
-        (mem (profiler-memory-stop)))
+        (mem (profiler-memory-stop))
+        (byte-code (profiler-byte-code-stop)))
     (message "%s profiler stopped"
              (cond ((and mem cpu) "CPU and memory")
                    (mem "Memory")
                    (cpu "CPU")
+                   (byte-code "Byte-code")
                    (t "No")))))
 
 (defun profiler-reset ()
@@ -842,6 +924,7 @@ profiler-reset
   (when (fboundp 'profiler-cpu-log)
     (ignore (profiler-cpu-log)))
   (ignore (profiler-memory-log))
+  (ignore (profiler-byte-code-log))
   t)
 
 (defun profiler-report-cpu ()
@@ -854,11 +937,16 @@ profiler-report-memory
     (when profile
       (profiler-report-profile-other-window profile))))
 
+(defun profiler-report-byte-code ()
+  (when (profiler-byte-code-running-p)
+    (profiler-byte-code-report (profiler-byte-code-log))))
+
 (defun profiler-report ()
   "Report profiling results."
   (interactive)
   (profiler-report-cpu)
-  (profiler-report-memory))
+  (profiler-report-memory)
+  (profiler-report-byte-code))
 
 ;;;###autoload
 (defun profiler-find-profile (filename)
@@ -3451,6 +3451,17 @@ with-file-modes
              ,@body)
          (set-default-file-modes ,umask)))))
 
+(defmacro with-mutex (mutex &rest body)
+  "Invoke BODY with MUTEX held, releasing MUTEX when done.
+This is the simplest safe way to acquire and release a mutex."
+  (declare (indent 1) (debug t))
+  (let ((sym (make-symbol "mutex")))
+    `(let ((,sym ,mutex))
+       (mutex-lock ,sym)
+       (unwind-protect
+           (progn ,@body)
+         (mutex-unlock ,sym)))))
+
 
 ;;; Matching and match data.
 
@@ -3468,12 +3479,12 @@ save-match-data
   ;; if you need to recompile all the Lisp files using interpreted code.
   (declare (indent 0) (debug t))
   (list 'let
-	'((save-match-data-internal (match-data)))
+	'((save-match-data-internal (match-data-save-into)))
 	(list 'unwind-protect
 	      (cons 'progn body)
-	      ;; It is safe to free (evaporate) markers immediately here,
+	      ;; It is safe to release the object for reuse here,
 	      ;; as Lisp programs should not copy from save-match-data-internal.
-	      '(set-match-data save-match-data-internal 'evaporate))))
+	      '(match-data-restore-from save-match-data-internal t))))
 
 (defun match-string (num &optional string)
   "Return string of text matched by last search.
@@ -257,8 +257,11 @@ no_sanitize_memcpy (void *dest, void const *src, size_t size)
 
 static void mark_terminals (void);
 static void gc_sweep (void);
+static void finish_lazy_sweep (void);
 static Lisp_Object make_pure_vector (ptrdiff_t);
 static void mark_buffer (struct buffer *);
+static bool mark_stack_empty_p (void);
+static void process_mark_stack (ptrdiff_t);
 
 #if !defined REL_ALLOC || defined SYSTEM_MALLOC || defined HYBRID_MALLOC
 static void refill_memory_reserve (void);
@@ -362,6 +365,25 @@ static void *min_heap_address, *max_heap_address;
 static struct mem_node mem_z;
 #define MEM_NIL &mem_z
 
+/* A direct-mapped cache of recent mem_find results, indexed by the
+   address bits above BLOCK_ALIGN.  Conservative stack marking looks
+   up many pointers into the same few blocks, and most of them are
+   found here without walking the tree.  An entry is valid only if
+   its generation is mem_cache_generation; mem_delete, the only
+   function that frees nodes or changes the block a node describes,
+   invalidates the whole cache by incrementing the generation.  */
+
+#define MEM_CACHE_SIZE 1024
+
+struct mem_cache_entry
+{
+  struct mem_node *node;
+  uintptr_t generation;
+};
+
+static struct mem_cache_entry mem_cache[MEM_CACHE_SIZE];
+static uintptr_t mem_cache_generation = 1;
+
 static struct mem_node *mem_insert (void *, void *, enum mem_type);
 static void mem_insert_fixup (struct mem_node *);
 static void mem_rotate_left (struct mem_node *);
@@ -1846,6 +1868,7 @@ allocate_string_data (struct Lisp_String *s,
 #endif
   s->size = nchars;
   s->size_byte = nbytes;
+  s->hash = 0;
   s->data[nbytes] = '\0';
 #ifdef GC_CHECK_STRING_OVERRUN
   memcpy ((char *) data + needed, string_overrun_cookie,
@@ -2416,6 +2439,30 @@ static int float_block_index = FLOAT_BLOCK_SIZE;
 
 static struct Lisp_Float *float_free_list;
 
+/* First float block whose cells have not been swept since the last
+   GC, or NULL if there is none, and the number of cells to sweep in
+   it.  All the blocks after it still need sweeping as well.  */
+
+static struct float_block *float_sweep_block;
+static int float_sweep_lim;
+
+static int sweep_float_block (struct float_block *, int);
+
+/* Sweep float blocks left over by the last GC until one of them
+   provides a free cell or there are no more of them.  */
+
+static void
+lazy_sweep_floats (void)
+{
+  while (!float_free_list && float_sweep_block)
+    {
+      sweep_float_block (float_sweep_block, float_sweep_lim);
+      gc_blocks_swept_lazily++;
+      float_sweep_block = float_sweep_block->next;
+      float_sweep_lim = FLOAT_BLOCK_SIZE;
+    }
+}
+
 /* Return a new float object with value FLOAT_VALUE.  */
 
 Lisp_Object
@@ -2425,6 +2472,8 @@ make_float (double float_value)
 
   MALLOC_BLOCK_INPUT;
 
+  lazy_sweep_floats ();
+
   if (float_free_list)
     {
       /* We use the data field for chaining the free list
@@ -2510,6 +2559,28 @@ static int cons_block_index = CONS_BLOCK_SIZE;
 
 static struct Lisp_Cons *cons_free_list;
 
+/* Like float_sweep_block and float_sweep_lim, for cons blocks.  */
+
+static struct cons_block *cons_sweep_block;
+static int cons_sweep_lim;
+
+static int sweep_cons_block (struct cons_block *, int);
+
+/* Sweep cons blocks left over by the last GC until one of them
+   provides a free cell or there are no more of them.  */
+
+static void
+lazy_sweep_conses (void)
+{
+  while (!cons_free_list && cons_sweep_block)
+    {
+      sweep_cons_block (cons_sweep_block, cons_sweep_lim);
+      gc_blocks_swept_lazily++;
+      cons_sweep_block = cons_sweep_block->next;
+      cons_sweep_lim = CONS_BLOCK_SIZE;
+    }
+}
+
 /* Explicitly free a cons cell by putting it on the free-list.  */
 
 void
@@ -2530,6 +2601,8 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 
   MALLOC_BLOCK_INPUT;
 
+  lazy_sweep_conses ();
+
   if (cons_free_list)
     {
       /* We use the cdr for chaining the free list
@@ -2557,7 +2630,9 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 
   XSETCAR (val, car);
   XSETCDR (val, cdr);
-  eassert (!CONS_MARKED_P (XCONS (val)));
+  /* A cell released by free_cons keeps its mark bit until its block
+     is swept.  */
+  eassert (!CONS_MARKED_P (XCONS (val)) || cons_sweep_block);
   consing_since_gc += sizeof (struct Lisp_Cons);
   total_free_conses--;
   cons_cells_consed++;
@@ -3000,6 +3075,16 @@ cleanup_vector (struct Lisp_Vector *vector)
 	  drv->close ((struct font *) vector);
 	}
     }
+  else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_THREAD))
+    finalize_one_thread ((struct thread_state *) vector);
+  else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_MUTEX))
+    finalize_one_mutex ((struct Lisp_Mutex *) vector);
+  else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_CONDVAR))
+    finalize_one_condvar ((struct Lisp_CondVar *) vector);
+  else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_KEYWORD_SET))
+    finalize_keyword_set ((struct Lisp_Keyword_Set *) vector);
+  else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_MATCH_DATA))
+    finalize_match_data ((struct Lisp_Match_Data *) vector);
 }
 
 /* Reclaim space used by unmarked vectors.  */
@@ -3634,6 +3719,7 @@ DEFUN ("make-marker", Fmake_marker, Smake_marker, 0, 0, 0,
   p->next = NULL;
   p->insertion_type = 0;
   p->need_adjustment = 0;
+  p->no_undo = 0;
   return val;
 }
 
@@ -3659,6 +3745,7 @@ build_marker (struct buffer *buf, ptrdiff_t charpos, ptrdiff_t bytepos)
   m->bytepos = bytepos;
   m->insertion_type = 0;
   m->need_adjustment = 0;
+  m->no_undo = 0;
   m->next = BUF_MARKERS (buf);
   BUF_MARKERS (buf) = m;
   return obj;
@@ -3832,6 +3919,22 @@ FUNCTION.  FUNCTION will be run once per finalizer object.  */)
 }
 
 
+#ifdef HAVE_MODULES
+/* Create a new module user ptr object.  */
+Lisp_Object
+make_user_ptr (void (*finalizer) (void *), void *p)
+{
+  Lisp_Object obj;
+  struct Lisp_User_Ptr *uptr;
+
+  obj = allocate_misc (Lisp_Misc_User_Ptr);
+  uptr = XUSER_PTR (obj);
+  uptr->finalizer = finalizer;
+  uptr->p = p;
+  return obj;
+}
+#endif
+
 /************************************************************************
 			   Memory Full Handling
  ************************************************************************/
@@ -3939,7 +4042,7 @@ refill_memory_reserve (void)
    lisp_free removes it with mem_delete.  Functions live_string_p etc
    call mem_find to lookup information about a given pointer in the
    tree, and use that to determine if the pointer points to a Lisp
-   object or not.  */
+   object or not.  Recent lookups are cached in mem_cache.  */
 
 /* Initialize this part of alloc.c.  */
 
@@ -3961,10 +4064,16 @@ static struct mem_node *
 mem_find (void *start)
 {
   struct mem_node *p;
+  struct mem_cache_entry *e;
 
   if (start < min_heap_address || start > max_heap_address)
     return MEM_NIL;
 
+  e = &mem_cache[(uintptr_t) start / BLOCK_ALIGN % MEM_CACHE_SIZE];
+  if (e->generation == mem_cache_generation
+      && e->node->start <= start && start < e->node->end)
+    return e->node;
+
   /* Make the search always successful to speed up the loop below.  */
   mem_z.start = start;
   mem_z.end = (char *) start + 1;
@@ -3972,6 +4081,12 @@ mem_find (void *start)
   p = mem_root;
   while (start < p->start || start >= p->end)
     p = start < p->start ? p->left : p->right;
+
+  if (p != MEM_NIL)
+    {
+      e->node = p;
+      e->generation = mem_cache_generation;
+    }
   return p;
 }
 
@@ -4192,6 +4307,8 @@ mem_delete (struct mem_node *z)
   if (!z || z == MEM_NIL)
     return;
 
+  mem_cache_generation++;
+
   if (z->left == MEM_NIL || z->right == MEM_NIL)
     y = z;
   else
@@ -4647,7 +4764,7 @@ mark_maybe_pointer (void *p)
 /* Mark Lisp objects referenced from the address range START+OFFSET..END
    or END+OFFSET..START.  */
 
-static void ATTRIBUTE_NO_SANITIZE_ADDRESS
+void ATTRIBUTE_NO_SANITIZE_ADDRESS
 mark_memory (void *start, void *end)
 {
   void **pp;
@@ -4819,16 +4936,19 @@ test_setjmp (void)
    pass starting at the start of the stack + 2.  Likewise, if the
    minimal alignment of Lisp_Objects on the stack is 1, four passes
    would be necessary, each one starting with one byte more offset
-   from the stack start.  */
+   from the stack start.
 
-static void
-mark_stack (void *end)
+   Each thread has its own C stack, which is scanned from BOTTOM to
+   END.  */
+
+void
+mark_stack (char *bottom, char *end)
 {
 
   /* This assumes that the stack is a contiguous region in memory.  If
      that's not the case, something has to be done here to iterate
      over the stack segments.  */
-  mark_memory (stack_base, end);
+  mark_memory (bottom, end);
 
   /* Allow for marking a secondary stack, like the register stack on the
      ia64.  */
@@ -4896,7 +5016,8 @@ valid_lisp_object_p (Lisp_Object obj)
   if (SYMBOLP (obj) && c_symbol_p (p))
     return ((char *) p - (char *) lispsym) % sizeof lispsym[0] == 0;
 
-  if (p == &buffer_defaults || p == &buffer_local_symbols)
+  if (p == &buffer_defaults || p == &buffer_local_symbols
+      || main_thread_p (p))
     return 2;
 
   struct mem_node *m = mem_find (p);
@@ -5095,6 +5216,7 @@ make_pure_string (const char *data,
   s->size = nchars;
   s->size_byte = multibyte ? nbytes : -1;
   s->intervals = NULL;
+  s->hash = 0;
   XSETSTRING (string, s);
   return string;
 }
@@ -5111,6 +5233,7 @@ make_pure_c_string (const char *data, ptrdiff_t nchars)
   s->size_byte = -1;
   s->data = (unsigned char *) data;
   s->intervals = NULL;
+  s->hash = 0;
   XSETSTRING (string, s);
   return string;
 }
@@ -5444,14 +5567,15 @@ mark_pinned_symbols (void)
    For more details of this, see the discussion at
    http://lists.gnu.org/archive/html/emacs-devel/2014-05/msg00270.html.  */
 static Lisp_Object
-garbage_collect_1 (void *end)
+garbage_collect_1 (void)
 {
   struct buffer *nextb;
   char stack_top_variable;
   ptrdiff_t i;
   bool message_p;
   ptrdiff_t count = SPECPDL_INDEX ();
-  struct timespec start;
+  struct timespec start, phase_start;
+  double mark_time, sweep_time;
   Lisp_Object retval = Qnil;
   size_t tot_before = 0;
 
@@ -5522,11 +5646,19 @@ garbage_collect_1 (void *end)
   shrink_regexp_cache ();
 
   gc_in_progress = 1;
+  phase_start = current_timespec ();
+
+  /* Sweeping left over from the previous collection counts as
+     sweeping, not marking.  */
+  finish_lazy_sweep ();
+  sweep_time = timespectod (timespec_sub (current_timespec (), phase_start));
+  phase_start = current_timespec ();
 
   /* Mark all the special slots that serve as the roots of accessibility.  */
 
   mark_buffer (&buffer_defaults);
   mark_buffer (&buffer_local_symbols);
+  process_mark_stack (0);
 
   for (i = 0; i < ARRAYELTS (lispsym); i++)
     mark_object (builtin_lisp_symbol (i));
@@ -5535,24 +5667,21 @@ garbage_collect_1 (void *end)
     mark_object (*staticvec[i]);
 
   mark_pinned_symbols ();
-  mark_specpdl ();
   mark_terminals ();
   mark_kboards ();
+  mark_regexp_cache ();
+
+#ifdef HAVE_MODULES
+  mark_modules ();
+#endif
 
 #ifdef USE_GTK
   xg_mark_data ();
 #endif
 
-  mark_stack (end);
+  /* Mark the stacks of all threads, and what else they refer to.  */
+  mark_threads ();
 
-  {
-    struct handler *handler;
-    for (handler = handlerlist; handler; handler = handler->next)
-      {
-	mark_object (handler->tag_or_ch);
-	mark_object (handler->val);
-      }
-  }
 #ifdef HAVE_WINDOW_SYSTEM
   mark_fringe_data ();
 #endif
@@ -5582,13 +5711,24 @@ garbage_collect_1 (void *end)
   queue_doomed_finalizers (&doomed_finalizers, &finalizers);
   mark_finalizer_list (&doomed_finalizers);
 
+  eassert (mark_stack_empty_p ());
+  mark_time = timespectod (timespec_sub (current_timespec (), phase_start));
+  phase_start = current_timespec ();
+
   gc_sweep ();
 
-  relocate_byte_stack ();
+  sweep_time += timespectod (timespec_sub (current_timespec (), phase_start));
+
+  relocate_byte_stacks ();
+
+  /* Cached function definitions may refer to objects that were just
+     freed, or to byte-code that was moved.  */
+  function_epoch++;
 
   /* Clear the mark bits that we set in certain root slots.  */
   VECTOR_UNMARK (&buffer_defaults);
   VECTOR_UNMARK (&buffer_local_symbols);
+  unmark_main_thread ();
 
   check_cons_list ();
 
@@ -5680,6 +5820,12 @@ garbage_collect_1 (void *end)
       Vgc_elapsed = make_float (XFLOAT_DATA (Vgc_elapsed)
 				+ timespectod (since_start));
     }
+  if (FLOATP (Vgc_mark_elapsed))
+    Vgc_mark_elapsed = make_float (XFLOAT_DATA (Vgc_mark_elapsed)
+				   + mark_time);
+  if (FLOATP (Vgc_sweep_elapsed))
+    Vgc_sweep_elapsed = make_float (XFLOAT_DATA (Vgc_sweep_elapsed)
+				    + sweep_time);
 
   gcs_done++;
 
@@ -5696,22 +5842,31 @@ garbage_collect_1 (void *end)
   return retval;
 }
 
-DEFUN ("garbage-collect", Fgarbage_collect, Sgarbage_collect, 0, 0, "",
-       doc: /* Reclaim storage for Lisp objects no longer needed.
-Garbage collection happens automatically if you cons more than
-`gc-cons-threshold' bytes of Lisp data since previous garbage collection.
-`garbage-collect' normally returns a list with info on amount of space in use,
-where each entry has the form (NAME SIZE USED FREE), where:
-- NAME is a symbol describing the kind of objects this entry represents,
-- SIZE is the number of bytes used by each one,
-- USED is the number of those objects that were found live in the heap,
-- FREE is the number of those objects that are not live but that Emacs
-  keeps around for future allocations (maybe because it does not know how
-  to return them to the OS).
-However, if there was overflow in pure space, `garbage-collect'
-returns nil, because real GC can't be done.
-See Info node `(elisp)Garbage Collection'.  */)
-  (void)
+/* Like maybe_gc, but called when Emacs is idle, waiting for input.
+If `gc-cons-idle-threshold' is a number, collect as soon as that many
+bytes have been consed, so that most collections happen between
+commands instead of in the middle of one.  */
+
+void
+maybe_gc_idle (void)
+{
+  if (INTEGERP (Vgc_cons_idle_threshold)
+      && consing_since_gc > max (XINT (Vgc_cons_idle_threshold), 0))
+    {
+      gcs_done_idle++;
+      Fgarbage_collect ();
+    }
+  else
+    maybe_gc ();
+}
+
+/* Save the registers of the current thread on its C stack, note the
+   top of that stack for the garbage collector, and call FUNC with
+   ARG.  This is done whenever the thread may give up the global lock,
+   and when it collects garbage itself.  */
+
+void
+flush_stack_call_func (void (*func) (void *arg), void *arg)
 {
   void *end;
 
@@ -5766,7 +5921,120 @@ See Info node `(elisp)Garbage Collection'.  */)
   end = stack_grows_down_p ? (char *) &j + sizeof j : (char *) &j;
 #endif /* not GC_SAVE_REGISTERS_ON_STACK */
 #endif /* not HAVE___BUILTIN_UNWIND_INIT */
-  return garbage_collect_1 (end);
+  current_thread->stack_top = end;
+  func (arg);
+}
+
+static void
+garbage_collect_callback (void *arg)
+{
+  Lisp_Object *retval = arg;
+  *retval = garbage_collect_1 ();
+}
+
+DEFUN ("garbage-collect", Fgarbage_collect, Sgarbage_collect, 0, 0, "",
+       doc: /* Reclaim storage for Lisp objects no longer needed.
+Garbage collection happens automatically if you cons more than
+`gc-cons-threshold' bytes of Lisp data since previous garbage collection.
+`garbage-collect' normally returns a list with info on amount of space in use,
+where each entry has the form (NAME SIZE USED FREE), where:
+- NAME is a symbol describing the kind of objects this entry represents,
+- SIZE is the number of bytes used by each one,
+- USED is the number of those objects that were found live in the heap,
+- FREE is the number of those objects that are not live but that Emacs
+  keeps around for future allocations (maybe because it does not know how
+  to return them to the OS).
+However, if there was overflow in pure space, `garbage-collect'
+returns nil, because real GC can't be done.
+See Info node `(elisp)Garbage Collection'.  */)
+  (void)
+{
+  Lisp_Object retval;
+
+  flush_stack_call_func (garbage_collect_callback, &retval);
+  return retval;
+}
+
+/* An entry on the mark stack: either a single object, or N
+   consecutive objects starting at VALUES that remain to be marked.
+   Ranges let us push the contents of a vector in one step.  */
+
+struct mark_entry
+{
+  /* Number of objects in VALUES, or 0 if this entry is VALUE.  */
+  ptrdiff_t n;
+  union
+  {
+    Lisp_Object value;
+    Lisp_Object *values;
+  } u;
+};
+
+/* Objects that still have to be traced are pushed on this stack
+   instead of being marked by recursive calls, so that deeply nested
+   structures do not exhaust the C stack.  The stack is kept between
+   collections, so it is normally allocated only once.  */
+
+static struct mark_entry *mark_stack_base;
+static ptrdiff_t mark_stack_size;
+static ptrdiff_t mark_stack_sp;
+
+static bool
+mark_stack_empty_p (void)
+{
+  return mark_stack_sp == 0;
+}
+
+static void
+grow_mark_stack (void)
+{
+  mark_stack_base = xpalloc (mark_stack_base, &mark_stack_size, 1, -1,
+			     sizeof *mark_stack_base);
+}
+
+/* Push OBJ on the mark stack.  */
+
+static void
+mark_stack_push_value (Lisp_Object obj)
+{
+  if (mark_stack_sp == mark_stack_size)
+    grow_mark_stack ();
+  mark_stack_base[mark_stack_sp].n = 0;
+  mark_stack_base[mark_stack_sp].u.value = obj;
+  mark_stack_sp++;
+}
+
+/* Push the N objects starting at VALUES on the mark stack.  */
+
+static void
+mark_stack_push_values (Lisp_Object *values, ptrdiff_t n)
+{
+  if (n > 0)
+    {
+      if (mark_stack_sp == mark_stack_size)
+	grow_mark_stack ();
+      mark_stack_base[mark_stack_sp].n = n;
+      mark_stack_base[mark_stack_sp].u.values = values;
+      mark_stack_sp++;
+    }
+}
+
+/* Pop the next object to mark from the non-empty mark stack.  */
+
+static Lisp_Object
+mark_stack_pop (void)
+{
+  struct mark_entry *e = &mark_stack_base[mark_stack_sp - 1];
+
+  eassert (!mark_stack_empty_p ());
+  if (e->n == 0)
+    {
+      mark_stack_sp--;
+      return e->u.value;
+    }
+  if (--e->n == 0)
+    mark_stack_sp--;
+  return *e->u.values++;
 }
 
 /* Mark Lisp objects in glyph matrix MATRIX.  Currently the
@@ -5790,14 +6058,14 @@ mark_glyph_matrix (struct glyph_matrix *matrix)
 	    for (; glyph < end_glyph; ++glyph)
 	      if (STRINGP (glyph->object)
 		  && !STRING_MARKED_P (XSTRING (glyph->object)))
-		mark_object (glyph->object);
+		mark_stack_push_value (glyph->object);
 	  }
       }
 }
 
 /* Mark reference to a Lisp_Object.
-   If the object referred to has not been seen yet, recursively mark
-   all the references contained in it.  */
+   If the object referred to has not been seen yet, mark all the
+   references contained in it, using the mark stack below.  */
 
 #define LAST_MARKED_SIZE 500
 static Lisp_Object last_marked[LAST_MARKED_SIZE];
@@ -5813,7 +6081,6 @@ static void
 mark_vectorlike (struct Lisp_Vector *ptr)
 {
   ptrdiff_t size = ptr->header.size;
-  ptrdiff_t i;
 
   eassert (!VECTOR_MARKED_P (ptr));
   VECTOR_MARK (ptr);		/* Else mark it.  */
@@ -5824,8 +6091,7 @@ mark_vectorlike (struct Lisp_Vector *ptr)
      the number of Lisp_Object fields that we should trace.
      The distinction is used e.g. by Lisp_Process which places extra
      non-Lisp_Object fields at the end of the structure...  */
-  for (i = 0; i < size; i++) /* ...and then mark its elements.  */
-    mark_object (ptr->contents[i]);
+  mark_stack_push_values (ptr->contents, size);
 }
 
 /* Like mark_vectorlike but optimized for char-tables (and
@@ -5853,23 +6119,10 @@ mark_char_table (struct Lisp_Vector *ptr, enum pvec_type pvectype)
 	    mark_char_table (XVECTOR (val), PVEC_SUB_CHAR_TABLE);
 	}
       else
-	mark_object (val);
+	mark_stack_push_value (val);
     }
 }
 
-NO_INLINE /* To reduce stack depth in mark_object.  */
-static Lisp_Object
-mark_compiled (struct Lisp_Vector *ptr)
-{
-  int i, size = ptr->header.size & PSEUDOVECTOR_SIZE_MASK;
-
-  VECTOR_MARK (ptr);
-  for (i = 0; i < size; i++)
-    if (i != COMPILED_CONSTANTS)
-      mark_object (ptr->contents[i]);
-  return size > COMPILED_CONSTANTS ? ptr->contents[COMPILED_CONSTANTS] : Qnil;
-}
-
 /* Mark the chain of overlays starting at PTR.  */
 
 static void
@@ -5881,11 +6134,13 @@ mark_overlay (struct Lisp_Overlay *ptr)
       /* These two are always markers and can be marked fast.  */
       XMARKER (ptr->start)->gcmarkbit = 1;
       XMARKER (ptr->end)->gcmarkbit = 1;
-      mark_object (ptr->plist);
+      mark_stack_push_value (ptr->plist);
     }
 }
 
-/* Mark Lisp_Objects and special pointers in BUFFER.  */
+/* Mark Lisp_Objects and special pointers in BUFFER.  The objects
+   found there are only pushed on the mark stack; callers outside
+   process_mark_stack must process it themselves.  */
 
 static void
 mark_buffer (struct buffer *buffer)
@@ -5911,13 +6166,12 @@ mark_buffer (struct buffer *buffer)
 
 /* Mark Lisp faces in the face cache C.  */
 
-NO_INLINE /* To reduce stack depth in mark_object.  */
 static void
 mark_face_cache (struct face_cache *c)
 {
   if (c)
     {
-      int i, j;
+      int i;
       for (i = 0; i < c->used; ++i)
 	{
 	  struct face *face = FACE_FROM_ID (c->f, i);
@@ -5927,14 +6181,12 @@ mark_face_cache (struct face_cache *c)
 	      if (face->font && !VECTOR_MARKED_P (face->font))
 		mark_vectorlike ((struct Lisp_Vector *) face->font);
 
-	      for (j = 0; j < LFACE_VECTOR_SIZE; ++j)
-		mark_object (face->lface[j]);
+	      mark_stack_push_values (face->lface, LFACE_VECTOR_SIZE);
 	    }
 	}
     }
 }
 
-NO_INLINE /* To reduce stack depth in mark_object.  */
 static void
 mark_localized_symbol (struct Lisp_Symbol *ptr)
 {
@@ -5947,12 +6199,11 @@ mark_localized_symbol (struct Lisp_Symbol *ptr)
   if ((BUFFERP (where) && !BUFFER_LIVE_P (XBUFFER (where)))
       || (FRAMEP (where) && !FRAME_LIVE_P (XFRAME (where))))
     swap_in_global_binding (ptr);
-  mark_object (blv->where);
-  mark_object (blv->valcell);
-  mark_object (blv->defcell);
+  mark_stack_push_value (blv->where);
+  mark_stack_push_value (blv->valcell);
+  mark_stack_push_value (blv->defcell);
 }
 
-NO_INLINE /* To reduce stack depth in mark_object.  */
 static void
 mark_save_value (struct Lisp_Save_Value *ptr)
 {
@@ -5972,12 +6223,13 @@ mark_save_value (struct Lisp_Save_Value *ptr)
       int i;
       for (i = 0; i < SAVE_VALUE_SLOTS; i++)
 	if (save_type (ptr, i) == SAVE_OBJECT)
-	  mark_object (ptr->data[i].object);
+	  mark_stack_push_value (ptr->data[i].object);
     }
 }
 
 /* Remove killed buffers or items whose car is a killed buffer from
-   LIST, and mark other items.  Return changed LIST, which is marked.  */
+   LIST, and mark other items.  Return changed LIST, whose remaining
+   elements are pushed on the mark stack.  */
 
 static Lisp_Object
 mark_discard_killed_buffers (Lisp_Object list)
@@ -5995,50 +6247,22 @@ mark_discard_killed_buffers (Lisp_Object list)
       else
 	{
 	  CONS_MARK (XCONS (tail));
-	  mark_object (XCAR (tail));
+	  mark_stack_push_value (XCAR (tail));
 	  prev = xcdr_addr (tail);
 	}
     }
-  mark_object (tail);
+  mark_stack_push_value (tail);
   return list;
 }
 
-/* Determine type of generic Lisp_Object and mark it accordingly.
-
-   This function implements a straightforward depth-first marking
-   algorithm and so the recursion depth may be very high (a few
-   tens of thousands is not uncommon).  To minimize stack usage,
-   a few cold paths are moved out to NO_INLINE functions above.
-   In general, inlining them doesn't help you to gain more speed.  */
-
-void
-mark_object (Lisp_Object arg)
-{
-  register Lisp_Object obj;
-  void *po;
-#ifdef GC_CHECK_MARKED_OBJECTS
-  struct mem_node *m;
-#endif
-  ptrdiff_t cdr_count = 0;
-
-  obj = arg;
- loop:
-
-  po = XPNTR (obj);
-  if (PURE_P (po))
-    return;
-
-  last_marked[last_marked_index++] = obj;
-  if (last_marked_index == LAST_MARKED_SIZE)
-    last_marked_index = 0;
+/* Perform some sanity checks on the objects marked by
+   process_mark_stack.  Abort if we encounter an object we know is
+   bogus.  This increases GC time by ~80%.  */
 
-  /* Perform some sanity checks on the objects marked here.  Abort if
-     we encounter an object we know is bogus.  This increases GC time
-     by ~80%.  */
 #ifdef GC_CHECK_MARKED_OBJECTS
 
-  /* Check that the object pointed to by PO is known to be a Lisp
-     structure allocated from the heap.  */
+/* Check that the object pointed to by PO is known to be a Lisp
+   structure allocated from the heap.  */
 #define CHECK_ALLOCATED()			\
   do {						\
     m = mem_find (po);				\
@@ -6046,22 +6270,22 @@ mark_object (Lisp_Object arg)
       emacs_abort ();				\
   } while (0)
 
-  /* Check that the object pointed to by PO is live, using predicate
-     function LIVEP.  */
+/* Check that the object pointed to by PO is live, using predicate
+   function LIVEP.  */
 #define CHECK_LIVE(LIVEP)			\
   do {						\
     if (!LIVEP (m, po))				\
       emacs_abort ();				\
   } while (0)
 
-  /* Check both of the above conditions, for non-symbols.  */
+/* Check both of the above conditions, for non-symbols.  */
 #define CHECK_ALLOCATED_AND_LIVE(LIVEP)		\
   do {						\
     CHECK_ALLOCATED ();				\
     CHECK_LIVE (LIVEP);				\
   } while (0)					\
 
-  /* Check both of the above conditions, for symbols.  */
+/* Check both of the above conditions, for symbols.  */
 #define CHECK_ALLOCATED_AND_LIVE_SYMBOL()	\
   do {						\
     if (!c_symbol_p (ptr))			\
@@ -6079,271 +6303,312 @@ mark_object (Lisp_Object arg)
 
 #endif /* not GC_CHECK_MARKED_OBJECTS */
 
-  switch (XTYPE (obj))
+/* Mark objects popped from the mark stack until its depth drops back
+   to BASE_SP, pushing the objects they refer to as we go.
+
+   Marking used to be done by recursive calls to mark_object, and the
+   recursion depth could be very high (a few tens of thousands was not
+   uncommon).  With the explicit stack the C stack depth stays
+   bounded, and the amount of pending work is visible in one place.  */
+
+static void
+process_mark_stack (ptrdiff_t base_sp)
+{
+  register Lisp_Object obj;
+  void *po;
+#ifdef GC_CHECK_MARKED_OBJECTS
+  struct mem_node *m;
+#endif
+  ptrdiff_t cdr_count = 0;
+
+  while (mark_stack_sp > base_sp)
     {
-    case Lisp_String:
-      {
-	register struct Lisp_String *ptr = XSTRING (obj);
-	if (STRING_MARKED_P (ptr))
-	  break;
-	CHECK_ALLOCATED_AND_LIVE (live_string_p);
-	MARK_STRING (ptr);
-	MARK_INTERVAL_TREE (ptr->intervals);
+      obj = mark_stack_pop ();
+     loop:
+
+      po = XPNTR (obj);
+      if (PURE_P (po))
+	continue;
+
+      last_marked[last_marked_index++] = obj;
+      if (last_marked_index == LAST_MARKED_SIZE)
+	last_marked_index = 0;
+
+      switch (XTYPE (obj))
+	{
+	case Lisp_String:
+	  {
+	    register struct Lisp_String *ptr = XSTRING (obj);
+	    if (STRING_MARKED_P (ptr))
+	      break;
+	    CHECK_ALLOCATED_AND_LIVE (live_string_p);
+	    MARK_STRING (ptr);
+	    MARK_INTERVAL_TREE (ptr->intervals);
 #ifdef GC_CHECK_STRING_BYTES
-	/* Check that the string size recorded in the string is the
-	   same as the one recorded in the sdata structure.  */
-	string_bytes (ptr);
+	    /* Check that the string size recorded in the string is the
+	       same as the one recorded in the sdata structure.  */
+	    string_bytes (ptr);
 #endif /* GC_CHECK_STRING_BYTES */
-      }
-      break;
+	  }
+	  break;
 
-    case Lisp_Vectorlike:
-      {
-	register struct Lisp_Vector *ptr = XVECTOR (obj);
-	register ptrdiff_t pvectype;
+	case Lisp_Vectorlike:
+	  {
+	    register struct Lisp_Vector *ptr = XVECTOR (obj);
+	    register ptrdiff_t pvectype;
 
-	if (VECTOR_MARKED_P (ptr))
-	  break;
+	    if (VECTOR_MARKED_P (ptr))
+	      break;
 
 #ifdef GC_CHECK_MARKED_OBJECTS
-	m = mem_find (po);
-	if (m == MEM_NIL && !SUBRP (obj))
-	  emacs_abort ();
+	    m = mem_find (po);
+	    if (m == MEM_NIL && !SUBRP (obj) && !main_thread_p (po))
+	      emacs_abort ();
 #endif /* GC_CHECK_MARKED_OBJECTS */
 
-	if (ptr->header.size & PSEUDOVECTOR_FLAG)
-	  pvectype = ((ptr->header.size & PVEC_TYPE_MASK)
-		      >> PSEUDOVECTOR_AREA_BITS);
-	else
-	  pvectype = PVEC_NORMAL_VECTOR;
+	    if (ptr->header.size & PSEUDOVECTOR_FLAG)
+	      pvectype = ((ptr->header.size & PVEC_TYPE_MASK)
+			  >> PSEUDOVECTOR_AREA_BITS);
+	    else
+	      pvectype = PVEC_NORMAL_VECTOR;
 
-	if (pvectype != PVEC_SUBR && pvectype != PVEC_BUFFER)
-	  CHECK_LIVE (live_vector_p);
+	    if (pvectype != PVEC_SUBR && pvectype != PVEC_BUFFER)
+	      CHECK_LIVE (live_vector_p);
 
-	switch (pvectype)
-	  {
-	  case PVEC_BUFFER:
+	    switch (pvectype)
+	      {
+	      case PVEC_BUFFER:
 #ifdef GC_CHECK_MARKED_OBJECTS
-	    {
-	      struct buffer *b;
-	      FOR_EACH_BUFFER (b)
-		if (b == po)
-		  break;
-	      if (b == NULL)
-		emacs_abort ();
-	    }
+		{
+		  struct buffer *b;
+		  FOR_EACH_BUFFER (b)
+		    if (b == po)
+		      break;
+		  if (b == NULL)
+		    emacs_abort ();
+		}
 #endif /* GC_CHECK_MARKED_OBJECTS */
-	    mark_buffer ((struct buffer *) ptr);
-	    break;
+		mark_buffer ((struct buffer *) ptr);
+		break;
 
-	  case PVEC_COMPILED:
-	    /* Although we could treat this just like a vector, mark_compiled
-	       returns the COMPILED_CONSTANTS element, which is marked at the
-	       next iteration of goto-loop here.  This is done to avoid a few
-	       recursive calls to mark_object.  */
-	    obj = mark_compiled (ptr);
-	    if (!NILP (obj))
-	      goto loop;
-	    break;
-
-	  case PVEC_FRAME:
-	    {
-	      struct frame *f = (struct frame *) ptr;
+	      case PVEC_FRAME:
+		{
+		  struct frame *f = (struct frame *) ptr;
 
-	      mark_vectorlike (ptr);
-	      mark_face_cache (f->face_cache);
+		  mark_vectorlike (ptr);
+		  mark_face_cache (f->face_cache);
 #ifdef HAVE_WINDOW_SYSTEM
-	      if (FRAME_WINDOW_P (f) && FRAME_X_OUTPUT (f))
-		{
-		  struct font *font = FRAME_FONT (f);
+		  if (FRAME_WINDOW_P (f) && FRAME_X_OUTPUT (f))
+		    {
+		      struct font *font = FRAME_FONT (f);
 
-		  if (font && !VECTOR_MARKED_P (font))
-		    mark_vectorlike ((struct Lisp_Vector *) font);
-		}
+		      if (font && !VECTOR_MARKED_P (font))
+			mark_vectorlike ((struct Lisp_Vector *) font);
+		    }
 #endif
-	    }
-	    break;
+		}
+		break;
 
-	  case PVEC_WINDOW:
-	    {
-	      struct window *w = (struct window *) ptr;
+	      case PVEC_WINDOW:
+		{
+		  struct window *w = (struct window *) ptr;
 
-	      mark_vectorlike (ptr);
+		  mark_vectorlike (ptr);
 
-	      /* Mark glyph matrices, if any.  Marking window
-		 matrices is sufficient because frame matrices
-		 use the same glyph memory.  */
-	      if (w->current_matrix)
-		{
-		  mark_glyph_matrix (w->current_matrix);
-		  mark_glyph_matrix (w->desired_matrix);
-		}
+		  /* Mark glyph matrices, if any.  Marking window
+		     matrices is sufficient because frame matrices
+		     use the same glyph memory.  */
+		  if (w->current_matrix)
+		    {
+		      mark_glyph_matrix (w->current_matrix);
+		      mark_glyph_matrix (w->desired_matrix);
+		    }
 
-	      /* Filter out killed buffers from both buffer lists
-		 in attempt to help GC to reclaim killed buffers faster.
-		 We can do it elsewhere for live windows, but this is the
-		 best place to do it for dead windows.  */
-	      wset_prev_buffers
-		(w, mark_discard_killed_buffers (w->prev_buffers));
-	      wset_next_buffers
-		(w, mark_discard_killed_buffers (w->next_buffers));
-	    }
-	    break;
+		  /* Filter out killed buffers from both buffer lists
+		     in attempt to help GC to reclaim killed buffers faster.
+		     We can do it elsewhere for live windows, but this is the
+		     best place to do it for dead windows.  */
+		  wset_prev_buffers
+		    (w, mark_discard_killed_buffers (w->prev_buffers));
+		  wset_next_buffers
+		    (w, mark_discard_killed_buffers (w->next_buffers));
+		}
+		break;
 
-	  case PVEC_HASH_TABLE:
-	    {
-	      struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) ptr;
-
-	      mark_vectorlike (ptr);
-	      mark_object (h->test.name);
-	      mark_object (h->test.user_hash_function);
-	      mark_object (h->test.user_cmp_function);
-	      /* If hash table is not weak, mark all keys and values.
-		 For weak tables, mark only the vector.  */
-	      if (NILP (h->weak))
-		mark_object (h->key_and_value);
-	      else
-		VECTOR_MARK (XVECTOR (h->key_and_value));
-	    }
-	    break;
+	      case PVEC_HASH_TABLE:
+		{
+		  struct Lisp_Hash_Table *h = (struct Lisp_Hash_Table *) ptr;
+
+		  mark_vectorlike (ptr);
+		  mark_stack_push_value (h->test.name);
+		  mark_stack_push_value (h->test.user_hash_function);
+		  mark_stack_push_value (h->test.user_cmp_function);
+		  /* If hash table is not weak, mark all keys and values.
+		     For weak tables, mark only the vector.  */
+		  if (NILP (h->weak))
+		    mark_stack_push_value (h->key_and_value);
+		  else
+		    VECTOR_MARK (XVECTOR (h->key_and_value));
+		}
+		break;
 
-	  case PVEC_CHAR_TABLE:
-	  case PVEC_SUB_CHAR_TABLE:
-	    mark_char_table (ptr, (enum pvec_type) pvectype);
-	    break;
+	      case PVEC_CHAR_TABLE:
+	      case PVEC_SUB_CHAR_TABLE:
+		mark_char_table (ptr, (enum pvec_type) pvectype);
+		break;
 
-	  case PVEC_BOOL_VECTOR:
-	    /* No Lisp_Objects to mark in a bool vector.  */
-	    VECTOR_MARK (ptr);
-	    break;
+	      case PVEC_BOOL_VECTOR:
+		/* No Lisp_Objects to mark in a bool vector.  */
+		VECTOR_MARK (ptr);
+		break;
 
-	  case PVEC_SUBR:
-	    break;
+	      case PVEC_SUBR:
+		break;
 
-	  case PVEC_FREE:
-	    emacs_abort ();
+	      case PVEC_FREE:
+		emacs_abort ();
 
-	  default:
-	    mark_vectorlike (ptr);
+	      default:
+		mark_vectorlike (ptr);
+	      }
 	  }
-      }
-      break;
-
-    case Lisp_Symbol:
-      {
-	register struct Lisp_Symbol *ptr = XSYMBOL (obj);
-      nextsym:
-	if (ptr->gcmarkbit)
 	  break;
-	CHECK_ALLOCATED_AND_LIVE_SYMBOL ();
-	ptr->gcmarkbit = 1;
-	/* Attempt to catch bogus objects.  */
-        eassert (valid_lisp_object_p (ptr->function));
-	mark_object (ptr->function);
-	mark_object (ptr->plist);
-	switch (ptr->redirect)
+
+	case Lisp_Symbol:
 	  {
-	  case SYMBOL_PLAINVAL: mark_object (SYMBOL_VAL (ptr)); break;
-	  case SYMBOL_VARALIAS:
-	    {
-	      Lisp_Object tem;
-	      XSETSYMBOL (tem, SYMBOL_ALIAS (ptr));
-	      mark_object (tem);
+	    register struct Lisp_Symbol *ptr = XSYMBOL (obj);
+	  nextsym:
+	    if (ptr->gcmarkbit)
 	      break;
-	    }
-	  case SYMBOL_LOCALIZED:
-	    mark_localized_symbol (ptr);
-	    break;
-	  case SYMBOL_FORWARDED:
-	    /* If the value is forwarded to a buffer or keyboard field,
-	       these are marked when we see the corresponding object.
-	       And if it's forwarded to a C variable, either it's not
-	       a Lisp_Object var, or it's staticpro'd already.  */
-	    break;
-	  default: emacs_abort ();
+	    CHECK_ALLOCATED_AND_LIVE_SYMBOL ();
+	    ptr->gcmarkbit = 1;
+	    /* Attempt to catch bogus objects.  */
+	    eassert (valid_lisp_object_p (ptr->function));
+	    mark_stack_push_value (ptr->function);
+	    mark_stack_push_value (ptr->plist);
+	    switch (ptr->redirect)
+	      {
+	      case SYMBOL_PLAINVAL: mark_stack_push_value (SYMBOL_VAL (ptr)); break;
+	      case SYMBOL_VARALIAS:
+		{
+		  Lisp_Object tem;
+		  XSETSYMBOL (tem, SYMBOL_ALIAS (ptr));
+		  mark_stack_push_value (tem);
+		  break;
+		}
+	      case SYMBOL_LOCALIZED:
+		mark_localized_symbol (ptr);
+		break;
+	      case SYMBOL_FORWARDED:
+		/* If the value is forwarded to a buffer or keyboard field,
+		   these are marked when we see the corresponding object.
+		   And if it's forwarded to a C variable, either it's not
+		   a Lisp_Object var, or it's staticpro'd already.  */
+		break;
+	      default: emacs_abort ();
+	      }
+	    if (!PURE_P (XSTRING (ptr->name)))
+	      MARK_STRING (XSTRING (ptr->name));
+	    MARK_INTERVAL_TREE (string_intervals (ptr->name));
+	    /* Inner loop to mark next symbol in this bucket, if any.  */
+	    po = ptr = ptr->next;
+	    if (ptr)
+	      goto nextsym;
 	  }
-	if (!PURE_P (XSTRING (ptr->name)))
-	  MARK_STRING (XSTRING (ptr->name));
-	MARK_INTERVAL_TREE (string_intervals (ptr->name));
-	/* Inner loop to mark next symbol in this bucket, if any.  */
-	po = ptr = ptr->next;
-	if (ptr)
-	  goto nextsym;
-      }
-      break;
+	  break;
 
-    case Lisp_Misc:
-      CHECK_ALLOCATED_AND_LIVE (live_misc_p);
+	case Lisp_Misc:
+	  CHECK_ALLOCATED_AND_LIVE (live_misc_p);
 
-      if (XMISCANY (obj)->gcmarkbit)
-	break;
+	  if (XMISCANY (obj)->gcmarkbit)
+	    break;
 
-      switch (XMISCTYPE (obj))
-	{
-	case Lisp_Misc_Marker:
-	  /* DO NOT mark thru the marker's chain.
-	     The buffer's markers chain does not preserve markers from gc;
-	     instead, markers are removed from the chain when freed by gc.  */
-	  XMISCANY (obj)->gcmarkbit = 1;
-	  break;
+	  switch (XMISCTYPE (obj))
+	    {
+	    case Lisp_Misc_Marker:
+	      /* DO NOT mark thru the marker's chain.
+		 The buffer's markers chain does not preserve markers from gc;
+		 instead, markers are removed from the chain when freed by gc.  */
+	      XMISCANY (obj)->gcmarkbit = 1;
+	      break;
 
-	case Lisp_Misc_Save_Value:
-	  XMISCANY (obj)->gcmarkbit = 1;
-	  mark_save_value (XSAVE_VALUE (obj));
-	  break;
+	    case Lisp_Misc_Save_Value:
+	      XMISCANY (obj)->gcmarkbit = 1;
+	      mark_save_value (XSAVE_VALUE (obj));
+	      break;
 
-	case Lisp_Misc_Overlay:
-	  mark_overlay (XOVERLAY (obj));
-          break;
+	    case Lisp_Misc_Overlay:
+	      mark_overlay (XOVERLAY (obj));
+	      break;
 
-        case Lisp_Misc_Finalizer:
-          XMISCANY (obj)->gcmarkbit = true;
-          mark_object (XFINALIZER (obj)->function);
-          break;
+	    case Lisp_Misc_Finalizer:
+	      XMISCANY (obj)->gcmarkbit = true;
+	      mark_stack_push_value (XFINALIZER (obj)->function);
+	      break;
 
-	default:
-	  emacs_abort ();
-	}
-      break;
+#ifdef HAVE_MODULES
+	    case Lisp_Misc_User_Ptr:
+	      XMISCANY (obj)->gcmarkbit = true;
+	      break;
+#endif
 
-    case Lisp_Cons:
-      {
-	register struct Lisp_Cons *ptr = XCONS (obj);
-	if (CONS_MARKED_P (ptr))
+	    default:
+	      emacs_abort ();
+	    }
 	  break;
-	CHECK_ALLOCATED_AND_LIVE (live_cons_p);
-	CONS_MARK (ptr);
-	/* If the cdr is nil, avoid recursion for the car.  */
-	if (EQ (ptr->u.cdr, Qnil))
+
+	case Lisp_Cons:
 	  {
-	    obj = ptr->car;
-	    cdr_count = 0;
+	    register struct Lisp_Cons *ptr = XCONS (obj);
+	    if (CONS_MARKED_P (ptr))
+	      break;
+	    CHECK_ALLOCATED_AND_LIVE (live_cons_p);
+	    CONS_MARK (ptr);
+	    /* If the cdr is nil, go on with the car right away.  */
+	    if (EQ (ptr->u.cdr, Qnil))
+	      {
+		obj = ptr->car;
+		cdr_count = 0;
+		goto loop;
+	      }
+	    /* Otherwise defer the car and walk down the list, so that the
+	       spine of a long list takes no room on the mark stack.  */
+	    mark_stack_push_value (ptr->car);
+	    obj = ptr->u.cdr;
+	    cdr_count++;
+	    if (cdr_count == mark_object_loop_halt)
+	      emacs_abort ();
 	    goto loop;
 	  }
-	mark_object (ptr->car);
-	obj = ptr->u.cdr;
-	cdr_count++;
-	if (cdr_count == mark_object_loop_halt)
-	  emacs_abort ();
-	goto loop;
-      }
 
-    case Lisp_Float:
-      CHECK_ALLOCATED_AND_LIVE (live_float_p);
-      FLOAT_MARK (XFLOAT (obj));
-      break;
+	case Lisp_Float:
+	  CHECK_ALLOCATED_AND_LIVE (live_float_p);
+	  FLOAT_MARK (XFLOAT (obj));
+	  break;
 
-    case_Lisp_Int:
-      break;
+	case_Lisp_Int:
+	  break;
 
-    default:
-      emacs_abort ();
+	default:
+	  emacs_abort ();
+	}
     }
 
 #undef CHECK_LIVE
 #undef CHECK_ALLOCATED
 #undef CHECK_ALLOCATED_AND_LIVE
 }
+
+/* Determine type of generic Lisp_Object and mark it accordingly,
+   together with everything reachable from it.  */
+
+void
+mark_object (Lisp_Object arg)
+{
+  ptrdiff_t sp = mark_stack_sp;
+  mark_stack_push_value (arg);
+  process_mark_stack (sp);
+}
 /* Mark the Lisp pointers in the terminal objects.
    Called by Fgarbage_collect.  */
 
@@ -6363,6 +6628,7 @@ mark_terminals (void)
       if (!VECTOR_MARKED_P (t))
 	mark_vectorlike ((struct Lisp_Vector *)t);
     }
+  process_mark_stack (0);
 }
 
 
@@ -6415,6 +6681,113 @@ survives_gc_p (Lisp_Object obj)
 
 
 
+/* Put the unmarked cells among the first LIM ones of CBLK on the
+   free list, clear the mark bits of the others, and return the number
+   of cells freed.  */
+
+static int
+sweep_cons_block (struct cons_block *cblk, int lim)
+{
+  int i;
+  int this_free = 0;
+  int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+
+  /* Scan the mark bits an int at a time.  */
+  for (i = 0; i < ilim; i++)
+    {
+      if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
+	{
+	  /* Fast path - all cons cells for this int are marked.  */
+	  cblk->gcmarkbits[i] = 0;
+	}
+      else
+	{
+	  /* Some cons cells for this int are not marked.
+	     Find which ones, and free them.  */
+	  int start, pos, stop;
+
+	  start = i * BITS_PER_BITS_WORD;
+	  stop = lim - start;
+	  if (stop > BITS_PER_BITS_WORD)
+	    stop = BITS_PER_BITS_WORD;
+	  stop += start;
+
+	  for (pos = start; pos < stop; pos++)
+	    {
+	      if (!CONS_MARKED_P (&cblk->conses[pos]))
+		{
+		  this_free++;
+		  cblk->conses[pos].u.chain = cons_free_list;
+		  cons_free_list = &cblk->conses[pos];
+		  cons_free_list->car = Vdead;
+		}
+	      else
+		CONS_UNMARK (&cblk->conses[pos]);
+	    }
+	}
+    }
+  return this_free;
+}
+
+/* Like sweep_cons_block, for float blocks.  */
+
+static int
+sweep_float_block (struct float_block *fblk, int lim)
+{
+  int i;
+  int this_free = 0;
+
+  for (i = 0; i < lim; i++)
+    if (!FLOAT_MARKED_P (&fblk->floats[i]))
+      {
+	this_free++;
+	fblk->floats[i].u.chain = float_free_list;
+	float_free_list = &fblk->floats[i];
+      }
+    else
+      FLOAT_UNMARK (&fblk->floats[i]);
+  return this_free;
+}
+
+/* Return the number of bits set in the N words at BITS.  */
+
+static int
+count_mark_bits (bits_word *bits, int n)
+{
+  int i, count = 0;
+
+  for (i = 0; i < n; i++)
+    count += count_one_bits_word (bits[i]);
+  return count;
+}
+
+/* Sweep the blocks left over by the lazy sweep of the last GC, so
+   that no mark bits remain set when marking starts again.  */
+
+static void
+finish_lazy_sweep (void)
+{
+  for (; cons_sweep_block; cons_sweep_block = cons_sweep_block->next)
+    {
+      sweep_cons_block (cons_sweep_block, cons_sweep_lim);
+      cons_sweep_lim = CONS_BLOCK_SIZE;
+      gc_blocks_swept_eagerly++;
+    }
+  for (; float_sweep_block; float_sweep_block = float_sweep_block->next)
+    {
+      sweep_float_block (float_sweep_block, float_sweep_lim);
+      float_sweep_lim = FLOAT_BLOCK_SIZE;
+      gc_blocks_swept_eagerly++;
+    }
+}
+
+/* Sweep the cons blocks lazily: count the live cells of each block
+   from its mark bits and release the blocks that are entirely free,
+   but leave putting the dead cells of the other blocks on the free
+   list to lazy_sweep_conses, when allocation needs them.  Since the
+   cells themselves are not touched, this is much faster than a full
+   sweep.  */
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_conses (void)
@@ -6428,48 +6801,9 @@ sweep_conses (void)
 
   for (cblk = cons_block; cblk; cblk = *cprev)
     {
-      int i = 0;
-      int this_free = 0;
-      int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
-
-      /* Scan the mark bits an int at a time.  */
-      for (i = 0; i < ilim; i++)
-        {
-          if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
-            {
-              /* Fast path - all cons cells for this int are marked.  */
-              cblk->gcmarkbits[i] = 0;
-              num_used += BITS_PER_BITS_WORD;
-            }
-          else
-            {
-              /* Some cons cells for this int are not marked.
-                 Find which ones, and free them.  */
-              int start, pos, stop;
-
-              start = i * BITS_PER_BITS_WORD;
-              stop = lim - start;
-              if (stop > BITS_PER_BITS_WORD)
-                stop = BITS_PER_BITS_WORD;
-              stop += start;
-
-              for (pos = start; pos < stop; pos++)
-                {
-                  if (!CONS_MARKED_P (&cblk->conses[pos]))
-                    {
-                      this_free++;
-                      cblk->conses[pos].u.chain = cons_free_list;
-                      cons_free_list = &cblk->conses[pos];
-                      cons_free_list->car = Vdead;
-                    }
-                  else
-                    {
-                      num_used++;
-                      CONS_UNMARK (&cblk->conses[pos]);
-                    }
-                }
-            }
-        }
+      int this_free = lim - count_mark_bits (cblk->gcmarkbits,
+					     ARRAYELTS (cblk->gcmarkbits));
+      num_used += lim - this_free;
 
       lim = CONS_BLOCK_SIZE;
       /* If this block contains only free conses and we have already
@@ -6478,8 +6812,6 @@ sweep_conses (void)
       if (this_free == CONS_BLOCK_SIZE && num_free > CONS_BLOCK_SIZE)
         {
           *cprev = cblk->next;
-          /* Unhook from the free list.  */
-          cons_free_list = cblk->conses[0].u.chain;
           lisp_align_free (cblk);
         }
       else
@@ -6490,8 +6822,12 @@ sweep_conses (void)
     }
   total_conses = num_used;
   total_free_conses = num_free;
+  cons_sweep_block = cons_block;
+  cons_sweep_lim = cons_block_index;
 }
 
+/* Like sweep_conses, for float blocks.  */
+
 NO_INLINE /* For better stack traces */
 static void
 sweep_floats (void)
@@ -6505,20 +6841,10 @@ sweep_floats (void)
 
   for (fblk = float_block; fblk; fblk = *fprev)
     {
-      register int i;
-      int this_free = 0;
-      for (i = 0; i < lim; i++)
-        if (!FLOAT_MARKED_P (&fblk->floats[i]))
-          {
-            this_free++;
-            fblk->floats[i].u.chain = float_free_list;
-            float_free_list = &fblk->floats[i];
-          }
-        else
-          {
-            num_used++;
-            FLOAT_UNMARK (&fblk->floats[i]);
-          }
+      int this_free = lim - count_mark_bits (fblk->gcmarkbits,
+					     ARRAYELTS (fblk->gcmarkbits));
+      num_used += lim - this_free;
+
       lim = FLOAT_BLOCK_SIZE;
       /* If this block contains only free floats and we have already
          seen more than two blocks worth of free floats then deallocate
@@ -6526,8 +6852,6 @@ sweep_floats (void)
       if (this_free == FLOAT_BLOCK_SIZE && num_free > FLOAT_BLOCK_SIZE)
         {
           *fprev = fblk->next;
-          /* Unhook from the free list.  */
-          float_free_list = fblk->floats[0].u.chain;
           lisp_align_free (fblk);
         }
       else
@@ -6538,6 +6862,8 @@ sweep_floats (void)
     }
   total_floats = num_used;
   total_free_floats = num_free;
+  float_sweep_block = float_block;
+  float_sweep_lim = float_block_index;
 }
 
 NO_INLINE /* For better stack traces */
@@ -6679,6 +7005,14 @@ sweep_misc (void)
                 unchain_marker (&mblk->markers[i].m.u_marker);
               if (mblk->markers[i].m.u_any.type == Lisp_Misc_Finalizer)
                 unchain_finalizer (&mblk->markers[i].m.u_finalizer);
+#ifdef HAVE_MODULES
+	      else if (mblk->markers[i].m.u_any.type == Lisp_Misc_User_Ptr)
+		{
+		  struct Lisp_User_Ptr *uptr = &mblk->markers[i].m.u_user_ptr;
+		  if (uptr->finalizer)
+		    uptr->finalizer (uptr->p);
+		}
+#endif
               /* Set the type of the freed object to Lisp_Misc_Free.
                  We could leave the type alone, since nobody checks it,
                  but this might catch bugs faster.  */
@@ -6748,6 +7082,8 @@ gc_sweep (void)
 
   sweep_strings ();
   check_string_bytes (!noninteractive);
+  /* Cons and float blocks are swept lazily, since freeing their cells
+     has no side effects.  */
   sweep_conses ();
   sweep_floats ();
   sweep_intervals ();
@@ -7078,7 +7414,12 @@ init_alloc (void)
   setjmp_tested_p = longjmps_done = 0;
 #endif
   Vgc_elapsed = make_float (0.0);
+  Vgc_mark_elapsed = make_float (0.0);
+  Vgc_sweep_elapsed = make_float (0.0);
   gcs_done = 0;
+  gcs_done_idle = 0;
+  gc_blocks_swept_eagerly = 0;
+  gc_blocks_swept_lazily = 0;
 
 #if USE_VALGRIND
   valgrind_p = RUNNING_ON_VALGRIND != 0;
@@ -7182,8 +7523,39 @@ do hash-consing of the objects allocated to pure space.  */);
   DEFVAR_LISP ("gc-elapsed", Vgc_elapsed,
 	       doc: /* Accumulated time elapsed in garbage collections.
 The time is in seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-mark-elapsed", Vgc_mark_elapsed,
+	       doc: /* Accumulated time spent marking live objects during garbage collections.
+The time is in seconds as a floating point value.  It is part of
+`gc-elapsed', as is `gc-sweep-elapsed'.  */);
+  DEFVAR_LISP ("gc-sweep-elapsed", Vgc_sweep_elapsed,
+	       doc: /* Accumulated time spent sweeping unused objects during garbage collections.
+The time is in seconds as a floating point value.  It is part of
+`gc-elapsed', as is `gc-mark-elapsed'.  */);
+  DEFVAR_INT ("gc-blocks-swept-eagerly", gc_blocks_swept_eagerly,
+	      doc: /* Number of cons and float blocks swept during garbage collections.  */);
+  DEFVAR_INT ("gc-blocks-swept-lazily", gc_blocks_swept_lazily,
+	      doc: /* Number of cons and float blocks swept after garbage collections.
+After a collection, the dead cells of cons and float blocks are put
+on the free lists one block at a time, when allocation needs them,
+which shortens the collection pause.  */);
   DEFVAR_INT ("gcs-done", gcs_done,
               doc: /* Accumulated number of garbage collections done.  */);
+  DEFVAR_INT ("gcs-done-idle", gcs_done_idle,
+	      doc: /* Number of garbage collections done while Emacs was idle.
+These are the collections triggered by `gc-cons-idle-threshold'; they
+are included in `gcs-done'.  */);
+
+  DEFVAR_LISP ("gc-cons-idle-threshold", Vgc_cons_idle_threshold,
+	       doc: /* Number of bytes of consing that trigger a collection when idle.
+If this is a number, Emacs garbage collects whenever it is about to
+wait for input and at least this many bytes have been allocated since
+the last garbage collection.  Setting it well below `gc-cons-threshold'
+moves most collection pauses out of commands and into the time Emacs
+spends waiting for the user, which matters most when the heap is large.
+
+If nil, idle time does not make collections happen any earlier than
+`gc-cons-threshold' and `gc-cons-percentage' say.  */);
+  Vgc_cons_idle_threshold = Qnil;
 
   defsubr (&Scons);
   defsubr (&Slist);
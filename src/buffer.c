@@ -47,8 +47,6 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #include "w32heap.h"		/* for mmap_* */
 #endif
 
-struct buffer *current_buffer;		/* The current buffer.  */
-
 /* First buffer in chain of all buffers (in reverse order of creation).
    Threaded through ->header.next.buffer.  */
 
@@ -680,6 +678,7 @@ clone_per_buffer_values (struct buffer *from, struct buffer *to)
   /* Get (a copy of) the alist of Lisp-level local variables of FROM
      and install that in TO.  */
   bset_local_var_alist (to, buffer_lisp_local_variables (from, 1));
+  index_buffer_local_cells (to);
 }
 
 
@@ -980,7 +979,11 @@ reset_buffer_local_variables (struct buffer *b, bool permanent_too)
 
   /* Reset all (or most) per-buffer variables to their defaults.  */
   if (permanent_too)
-    bset_local_var_alist (b, Qnil);
+    {
+      bset_local_var_alist (b, Qnil);
+      bset_local_var_cells (b, Qnil);
+      b->local_var_count = 0;
+    }
   else
     {
       Lisp_Object tmp, prop, last = Qnil;
@@ -1017,6 +1020,7 @@ reset_buffer_local_variables (struct buffer *b, bool permanent_too)
 	  bset_local_var_alist (b, XCDR (tmp));
 	else
 	  XSETCDR (last, XCDR (tmp));
+      index_buffer_local_cells (b);
     }
 
   for (i = 0; i < last_per_buffer_idx; ++i)
@@ -1161,7 +1165,7 @@ buffer_local_value (Lisp_Object variable, Lisp_Object buffer)
       { /* Look in local_var_alist.  */
 	struct Lisp_Buffer_Local_Value *blv = SYMBOL_BLV (sym);
 	XSETSYMBOL (variable, sym); /* Update In case of aliasing.  */
-	result = Fassoc (variable, BVAR (buf, local_var_alist));
+	result = buffer_local_cell (buf, variable);
 	if (!NILP (result))
 	  {
 	    if (blv->fwd)
@@ -1198,6 +1202,110 @@ buffer_local_value (Lisp_Object variable, Lisp_Object buffer)
   return result;
 }
 
+/* Insert CELL, an element of a local_var_alist, into the
+   local_var_cells table CELLS, which must have a free slot and no
+   element for the symbol of CELL.  */
+
+static void
+insert_local_var_cell (Lisp_Object cells, Lisp_Object cell)
+{
+  ptrdiff_t mask = ASIZE (cells) - 1;
+  ptrdiff_t i = local_var_cell_hash (XCAR (cell), mask);
+
+  while (!NILP (AREF (cells, i)))
+    i = (i + 1) & mask;
+  ASET (cells, i, cell);
+}
+
+/* Record CELL, which has just been added to the local_var_alist of
+   buffer B, in the local_var_cells of B.  */
+
+void
+add_buffer_local_cell (struct buffer *b, Lisp_Object cell)
+{
+  Lisp_Object cells = BVAR (b, local_var_cells);
+  ptrdiff_t size = VECTORP (cells) ? ASIZE (cells) : 0;
+
+  if (2 * (b->local_var_count + 1) > size)
+    {
+      Lisp_Object old = cells;
+      ptrdiff_t i;
+
+      cells = Fmake_vector (make_number (max (16, 2 * size)), Qnil);
+      for (i = 0; i < size; i++)
+	if (!NILP (AREF (old, i)))
+	  insert_local_var_cell (cells, AREF (old, i));
+      bset_local_var_cells (b, cells);
+    }
+  insert_local_var_cell (cells, cell);
+  b->local_var_count++;
+}
+
+/* Forget the binding of VARIABLE in the local_var_cells of buffer B,
+   after its element has been removed from the local_var_alist.  */
+
+void
+remove_buffer_local_cell (struct buffer *b, Lisp_Object variable)
+{
+  Lisp_Object cells = BVAR (b, local_var_cells);
+  ptrdiff_t mask, i, j;
+
+  if (!VECTORP (cells))
+    return;
+  mask = ASIZE (cells) - 1;
+  for (i = local_var_cell_hash (variable, mask); ; i = (i + 1) & mask)
+    {
+      Lisp_Object cell = AREF (cells, i);
+      if (NILP (cell))
+	return;
+      if (EQ (XCAR (cell), variable))
+	break;
+    }
+
+  /* Fill the hole with the next element that may move back to it, so
+     that no element is separated from its home slot by a free slot;
+     repeat with the hole this leaves.  */
+  ASET (cells, i, Qnil);
+  for (j = (i + 1) & mask; !NILP (AREF (cells, j)); j = (j + 1) & mask)
+    {
+      ptrdiff_t home = local_var_cell_hash (XCAR (AREF (cells, j)), mask);
+      if (i < j ? i < home && home <= j : i < home || home <= j)
+	continue;
+      ASET (cells, i, AREF (cells, j));
+      ASET (cells, j, Qnil);
+      i = j;
+    }
+  b->local_var_count--;
+}
+
+/* Rebuild the local_var_cells of buffer B from its local_var_alist.  */
+
+void
+index_buffer_local_cells (struct buffer *b)
+{
+  Lisp_Object tail, cells;
+  ptrdiff_t length = 0, size = 16;
+
+  for (tail = BVAR (b, local_var_alist); CONSP (tail); tail = XCDR (tail))
+    length++;
+  bset_local_var_cells (b, Qnil);
+  b->local_var_count = 0;
+  if (length == 0)
+    return;
+
+  while (size < 2 * length)
+    size *= 2;
+  cells = Fmake_vector (make_number (size), Qnil);
+  bset_local_var_cells (b, cells);
+  for (tail = BVAR (b, local_var_alist); CONSP (tail); tail = XCDR (tail))
+    /* Only the first element for a symbol counts, as with assq.  */
+    if (NILP (buffer_local_cell (b, XCAR (XCAR (tail)))))
+      {
+	insert_local_var_cell (cells, XCAR (tail));
+	b->local_var_count++;
+      }
+}
+
 /* Return an alist of the Lisp-level buffer-local bindings of
    buffer BUF.  That is, don't include the variables maintained
    in special slots in the buffer object.
@@ -1647,6 +1755,10 @@ cleaning up all windows currently displaying the buffer to be killed. */)
   if (!BUFFER_LIVE_P (b))
     return Qnil;
 
+  /* Don't kill a buffer that another thread has made current.  */
+  if (thread_check_current_buffer (b))
+    return Qnil;
+
   /* Run hooks with the buffer to be killed the current buffer.  */
   {
     ptrdiff_t count = SPECPDL_INDEX ();
@@ -2023,7 +2135,6 @@ void
 set_buffer_internal_1 (register struct buffer *b)
 {
   register struct buffer *old_buf;
-  register Lisp_Object tail;
 
 #ifdef USE_MMAP_FOR_BUFFERS
   if (b->text->beg == NULL)
@@ -2033,10 +2144,23 @@ set_buffer_internal_1 (register struct buffer *b)
   if (current_buffer == b)
     return;
 
-  BUFFER_CHECK_INDIRECTION (b);
-
   old_buf = current_buffer;
   current_buffer = b;
+  set_buffer_internal_2 (old_buf, b);
+}
+
+/* Finish making B, which is already current_buffer, current in place
+   of OLD_BUF.  This is also used when switching threads, where B may
+   be the same buffer as OLD_BUF but the variables forwarded to C must
+   be refreshed anyway, because of thread-local bindings.  */
+
+void
+set_buffer_internal_2 (struct buffer *old_buf, struct buffer *b)
+{
+  register Lisp_Object tail;
+
+  BUFFER_CHECK_INDIRECTION (b);
+
   last_known_column_point = -1;   /* Invalidate indentation cache.  */
 
   if (old_buf)
@@ -2060,24 +2184,22 @@ set_buffer_internal_1 (register struct buffer *b)
      when it is not current, fetch them now.  */
   fetch_buffer_markers (b);
 
-  /* Look down buffer's list of local Lisp variables
-     to find and update any that forward into C variables.  */
+  /* Update the variables that forward into C variables and are local
+     to the new or the previous buffer.  There are few of them, while
+     a buffer can have many local variables.  */
 
-  do
+  for (tail = forwarded_local_variables; CONSP (tail); tail = XCDR (tail))
     {
-      for (tail = BVAR (b, local_var_alist); CONSP (tail); tail = XCDR (tail))
-	{
-	  Lisp_Object var = XCAR (XCAR (tail));
-	  struct Lisp_Symbol *sym = XSYMBOL (var);
-	  if (sym->redirect == SYMBOL_LOCALIZED /* Just to be sure.  */
-	      && SYMBOL_BLV (sym)->fwd)
-	    /* Just reference the variable
-	       to cause it to become set for this buffer.  */
-	    Fsymbol_value (var);
-	}
+      Lisp_Object var = XCAR (tail);
+      struct Lisp_Symbol *sym = XSYMBOL (var);
+      if (sym->redirect == SYMBOL_LOCALIZED /* Just to be sure.  */
+	  && SYMBOL_BLV (sym)->fwd
+	  && (!NILP (buffer_local_cell (b, var))
+	      || (old_buf && !NILP (buffer_local_cell (old_buf, var)))))
+	/* Just reference the variable
+	   to cause it to become set for this buffer.  */
+	Fsymbol_value (var);
     }
-  /* Do the same with any others that were local to the previous buffer */
-  while (b != old_buf && (b = old_buf, b));
 }
 
 /* Switch to buffer B temporarily for redisplay purposes.
@@ -5041,6 +5163,7 @@ init_buffer_once (void)
   bset_name (&buffer_local_flags, make_number (0));
   bset_mark (&buffer_local_flags, make_number (0));
   bset_local_var_alist (&buffer_local_flags, make_number (0));
+  bset_local_var_cells (&buffer_local_flags, make_number (0));
   bset_keymap (&buffer_local_flags, make_number (0));
   bset_downcase_table (&buffer_local_flags, make_number (0));
   bset_upcase_table (&buffer_local_flags, make_number (0));
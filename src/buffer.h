@@ -535,6 +535,11 @@ struct buffer
      symbols, just the symbol appears as the element.  */
   Lisp_Object local_var_alist_;
 
+  /* Index of the elements of local_var_alist by their symbols, so
+     that a variable's binding is found without scanning the alist.
+     Either nil or a hash table; see buffer_local_cell.  */
+  Lisp_Object local_var_cells_;
+
   /* Symbol naming major mode (e.g., lisp-mode).  */
   Lisp_Object major_mode_;
 
@@ -794,6 +799,9 @@ struct buffer
      an indirect buffer since it counts as its base buffer.  */
   int window_count;
 
+  /* Number of elements in local_var_cells.  */
+  ptrdiff_t local_var_count;
+
   /* A non-zero value in slot IDX means that per-buffer variable
      with index IDX has a local value in this buffer.  The index IDX
      for a buffer-local variable is stored in that variable's slot
@@ -950,6 +958,11 @@ bset_local_var_alist (struct buffer *b, Lisp_Object val)
   b->local_var_alist_ = val;
 }
 INLINE void
+bset_local_var_cells (struct buffer *b, Lisp_Object val)
+{
+  b->local_var_cells_ = val;
+}
+INLINE void
 bset_mark_active (struct buffer *b, Lisp_Object val)
 {
   b->mark_active_ = val;
@@ -1040,10 +1053,6 @@ extern struct buffer *all_buffers;
 #define FOR_EACH_BUFFER(b) \
   for ((b) = all_buffers; (b); (b) = (b)->next)
 
-/* This points to the current buffer.  */
-
-extern struct buffer *current_buffer;
-
 /* This structure holds the default values of the buffer-local variables
    that have special slots in each buffer.
    The default value occupies the same slot in this structure
@@ -1086,6 +1095,7 @@ extern void recenter_overlay_lists (struct buffer *, ptrdiff_t);
 extern ptrdiff_t overlay_strings (ptrdiff_t, struct window *, unsigned char **);
 extern void validate_region (Lisp_Object *, Lisp_Object *);
 extern void set_buffer_internal_1 (struct buffer *);
+extern void set_buffer_internal_2 (struct buffer *, struct buffer *);
 extern void set_buffer_temp (struct buffer *);
 extern Lisp_Object buffer_local_value (Lisp_Object, Lisp_Object);
 extern void record_buffer (Lisp_Object);
@@ -1093,6 +1103,9 @@ extern void fix_overlays_before (struct buffer *, ptrdiff_t, ptrdiff_t);
 extern void mmap_set_vars (bool);
 extern void restore_buffer (Lisp_Object);
 extern void set_buffer_if_live (Lisp_Object);
+extern void add_buffer_local_cell (struct buffer *, Lisp_Object);
+extern void remove_buffer_local_cell (struct buffer *, Lisp_Object);
+extern void index_buffer_local_cells (struct buffer *);
 
 /* Return B as a struct buffer pointer, defaulting to the current buffer.  */
 
@@ -1102,6 +1115,46 @@ decode_buffer (Lisp_Object b)
   return NILP (b) ? current_buffer : (CHECK_BUFFER (b), XBUFFER (b));
 }
 
+/* The local_var_cells of a buffer is a hash table of the elements of
+   its local_var_alist, keyed by their symbols: a vector whose size is
+   a power of two, with each element at the first free slot at or
+   after the slot its symbol hashes to, and nil in the free slots.
+   At most half the slots are used, so that probes are short.  */
+
+/* Return the slot that the symbol VARIABLE hashes to in a
+   local_var_cells table of size MASK + 1.  */
+
+INLINE ptrdiff_t
+local_var_cell_hash (Lisp_Object variable, ptrdiff_t mask)
+{
+  /* Symbols never move, so their addresses make good keys.  */
+  EMACS_UINT hash = (XLI (variable) >> GCTYPEBITS) * 0x9e3779b9;
+  return (hash ^ (hash >> 15)) & mask;
+}
+
+/* Return the element of the local_var_alist of buffer B that binds
+   VARIABLE, or nil if VARIABLE has no binding in B.  */
+
+INLINE Lisp_Object
+buffer_local_cell (struct buffer *b, Lisp_Object variable)
+{
+  Lisp_Object cells = BVAR (b, local_var_cells);
+
+  if (VECTORP (cells))
+    {
+      ptrdiff_t mask = ASIZE (cells) - 1;
+      ptrdiff_t i;
+
+      for (i = local_var_cell_hash (variable, mask); ; i = (i + 1) & mask)
+	{
+	  Lisp_Object cell = AREF (cells, i);
+	  if (NILP (cell) || EQ (XCAR (cell), variable))
+	    return cell;
+	}
+    }
+  return Qnil;
+}
+
 /* Set the current buffer to B.
 
    We previously set windows_or_buffers_changed here to invalidate
@@ -308,38 +308,191 @@ struct byte_stack
   const unsigned char *pc;
 
   /* Top and bottom of stack.  The bottom points to an area of memory
-     allocated with alloca in Fbyte_code.  */
+     allocated with alloca in Fbyte_code, or to the byte stack region
+     for a frame pushed by Bcall.  */
 #if BYTE_MAINTAIN_TOP
   Lisp_Object *top, *bottom;
 #endif
 
+  /* The end of the memory for the stack.  */
+  Lisp_Object *limit;
+
   /* The string containing the byte-code, and its current address.
      Storing this here protects it from GC because mark_byte_stack
      marks it.  */
   Lisp_Object byte_string;
   const unsigned char *byte_string_start;
 
+  /* The vector of constants used by the byte-code.  */
+  Lisp_Object constants;
+
+  /* The specpdl index when execution of the byte-code started.  */
+  ptrdiff_t count;
+
+  /* For a frame pushed by Bcall, the caller's stack top, which holds
+     the function called; null for a call of exec_byte_code.  */
+  Lisp_Object *caller_top;
+
+  /* The entry of the byte-code profiler log for the byte-code, and
+     the contents of its vector of counts.  They are valid only as long
+     as byte_code_log_epoch equals LOG_EPOCH.  */
+  Lisp_Object log_entry;
+  Lisp_Object *log_counts;
+  EMACS_INT log_epoch;
+
   /* Next entry in byte_stack_list.  */
   struct byte_stack *next;
 };
 
-/* A list of currently active byte-code execution value stacks.
-   Fbyte_code adds an entry to the head of this list before it starts
-   processing byte-code, and it removes the entry again when it is
-   done.  Signaling an error truncates the list.  */
+/* Each thread has a list of currently active byte-code execution
+   value stacks, byte_stack_list.  Fbyte_code adds an entry to the
+   head of this list before it starts processing byte-code, and it
+   removes the entry again when it is done.  Signaling an error
+   truncates the list.
+
+   When byte-code calls a byte-compiled function with lexical binding,
+   the interpreter does not call itself recursively.  Instead it
+   pushes a frame for the callee, consisting of a struct byte_stack
+   followed by the callee's value stack, in this region, and continues
+   with the callee's byte-code; returning from the callee pops the
+   frame.  BYTE_STACK_REGION_TOP is the first free word of the region.
+   When the region is full, the call goes through Ffuncall instead.
+   The region, too, belongs to the thread.  */
+
+enum { BYTE_STACK_REGION_SIZE = 32 * 1024 };
+
+/* Make STACK the head of byte_stack_list after a non-local exit,
+   and free the frames that were above it in the byte stack region.  */
+
+void
+restore_byte_stack (struct byte_stack *stack)
+{
+  byte_stack_list = stack;
+  while (stack && !stack->caller_top)
+    stack = stack->next;
+  byte_stack_region_top = stack ? stack->limit : byte_stack_region;
+}
+
+/* Mark the objects referenced from the frames in the byte stack
+   region of THR.  The frames are scanned conservatively like the C
+   stack, since the part of each value stack that is in use is not
+   known.  */
+
+void
+mark_byte_stack (struct thread_state *thr)
+{
+  if (thr->m_byte_stack_region)
+    mark_memory (thr->m_byte_stack_region, thr->m_byte_stack_region_top);
+}
+
+/* How a function called from byte-code is to be called.  */
+
+enum call_kind
+{
+  /* Through funcall_general.  */
+  CALL_GENERAL,
+  /* Through funcall_subr; the primitive accepts the arguments.  */
+  CALL_SUBR,
+  /* By pushing a frame for its byte-code; see Bcall.  */
+  CALL_BYTE_CODE
+};
+
+/* An inline cache for the function called at a call site in
+   byte-code.  PC is the address just after the call instruction,
+   SYMBOL the symbol called, FUN its definition and KIND how to call
+   it.  The entry is valid only as long as function_epoch equals
+   EPOCH.  */
+
+struct call_cache
+{
+  const unsigned char *pc;
+  Lisp_Object symbol;
+  Lisp_Object fun;
+  enum call_kind kind;
+  EMACS_INT epoch;
+};
+
+/* The call caches, indexed by the PC of the call site.  A site whose
+   entry was taken by another site just looks up the function again.  */
 
-struct byte_stack *byte_stack_list;
+enum { CALL_CACHE_SIZE = 1024 };
+static struct call_cache call_cache[CALL_CACHE_SIZE];
+
+/* Return how to call the function FUN with NARGS arguments.  */
+
+static enum call_kind
+call_kind (Lisp_Object fun, ptrdiff_t nargs)
+{
+  if (SUBRP (fun))
+    return (XSUBR (fun)->min_args <= nargs
+	    && (XSUBR (fun)->max_args == MANY
+		|| nargs <= XSUBR (fun)->max_args)
+	    ? CALL_SUBR : CALL_GENERAL);
+  if (COMPILEDP (fun)
+      && INTEGERP (AREF (fun, COMPILED_ARGLIST))
+      && STRINGP (AREF (fun, COMPILED_BYTECODE))
+      && !STRING_MULTIBYTE (AREF (fun, COMPILED_BYTECODE))
+      && VECTORP (AREF (fun, COMPILED_CONSTANTS))
+      && NATNUMP (AREF (fun, COMPILED_STACK_DEPTH)))
+    return CALL_BYTE_CODE;
+  return CALL_GENERAL;
+}
+
+/* Record in the byte-code profiler log that the instruction OP, whose
+   operands start at STACK->pc, was executed in the frame STACK, whose
+   value stack top is TOP.  */
+
+static void
+profile_byte_op_1 (struct byte_stack *stack, Lisp_Object *top, int op)
+{
+  const unsigned char *pc = stack->pc;
+  ptrdiff_t offset = pc - 1 - stack->byte_string_start;
+
+  if (stack->log_epoch != byte_code_log_epoch)
+    {
+      stack->log_entry = byte_code_log_entry (stack->byte_string);
+      stack->log_counts = XVECTOR (AREF (stack->log_entry, 1))->contents;
+      stack->log_epoch = byte_code_log_epoch;
+    }
+  if (XFASTINT (stack->log_counts[offset]) < MOST_POSITIVE_FIXNUM)
+    stack->log_counts[offset]
+      = make_number (XFASTINT (stack->log_counts[offset]) + 1);
+  if (Bcall <= op && op <= Bcall7)
+    {
+      int nargs = (op == Bcall6 ? pc[0]
+		   : op == Bcall7 ? pc[0] + (pc[1] << 8)
+		   : op - Bcall);
+      byte_code_call_probe (stack->log_entry, offset, top[-nargs]);
+    }
+}
+
+/* Like profile_byte_op_1, but count the common instructions inline.  */
+
+static void
+profile_byte_op (struct byte_stack *stack, Lisp_Object *top, int op)
+{
+  if (stack->log_epoch == byte_code_log_epoch
+      && ! (Bcall <= op && op <= Bcall7))
+    {
+      Lisp_Object *count
+	= &stack->log_counts[stack->pc - 1 - stack->byte_string_start];
+      if (XFASTINT (*count) < MOST_POSITIVE_FIXNUM)
+	*count = make_number (XFASTINT (*count) + 1);
+    }
+  else
+    profile_byte_op_1 (stack, top, op);
+}
 
 
-/* Relocate program counters in the stacks on byte_stack_list.  Called
-   when GC has completed.  */
+/* Relocate program counters in the stacks on the byte_stack_list of
+   THR.  Called when GC has completed.  */
 
 void
-relocate_byte_stack (void)
+relocate_byte_stack (struct thread_state *thr)
 {
   struct byte_stack *stack;
 
-  for (stack = byte_stack_list; stack; stack = stack->next)
+  for (stack = thr->m_byte_stack_list; stack; stack = stack->next)
     {
       if (stack->byte_string_start != SDATA (stack->byte_string))
 	{
@@ -354,9 +507,9 @@ relocate_byte_stack (void)
 /* Fetch the next byte from the bytecode stream.  */
 
 #ifdef BYTE_CODE_SAFE
-#define FETCH (eassert (stack.byte_string_start == SDATA (stack.byte_string)), *stack.pc++)
+#define FETCH (eassert (stack->byte_string_start == SDATA (stack->byte_string)), *stack->pc++)
 #else
-#define FETCH *stack.pc++
+#define FETCH *stack->pc++
 #endif
 
 /* Fetch two bytes from the bytecode stream and make a 16-bit number
@@ -391,8 +544,8 @@ relocate_byte_stack (void)
 #define BEFORE_POTENTIAL_GC()	((void)0)
 #define AFTER_POTENTIAL_GC()	((void)0)
 #else
-#define BEFORE_POTENTIAL_GC()	stack.top = top
-#define AFTER_POTENTIAL_GC()	stack.top = NULL
+#define BEFORE_POTENTIAL_GC()	stack->top = top
+#define AFTER_POTENTIAL_GC()	stack->top = NULL
 #endif
 
 /* Garbage collect if we have consed enough since the last time.
@@ -419,7 +572,9 @@ relocate_byte_stack (void)
 #endif /* not BYTE_CODE_SAFE */
 
 /* A version of the QUIT macro which makes sure that the stack top is
-   set before signaling `quit'.  */
+   set before signaling `quit'.  Since it is used at jumps, it also
+   makes the byte-code profiler take effect in loops that started
+   before it.  */
 
 #define BYTE_CODE_QUIT					\
   do {							\
@@ -435,6 +590,7 @@ relocate_byte_stack (void)
       }							\
     else if (pending_signals)				\
       process_pending_signals ();			\
+    UPDATE_DISPATCH;					\
   } while (0)
 
 
@@ -455,6 +611,168 @@ bcall0 (Lisp_Object f)
   Ffuncall (1, &f);
 }
 
+/* Push the NARGS arguments in ARGS on the value stack whose top is
+   TOP, as specified by the integer ARGS_TEMPLATE of a byte-code
+   function with lexical binding.  Return the new top of stack.  */
+
+static Lisp_Object *
+push_args (Lisp_Object *top, Lisp_Object args_template,
+	   ptrdiff_t nargs, Lisp_Object *args)
+{
+  ptrdiff_t at = XINT (args_template);
+  bool rest = (at & 128) != 0;
+  int mandatory = at & 127;
+  ptrdiff_t nonrest = at >> 8;
+  eassert (mandatory <= nonrest);
+  if (nargs <= nonrest)
+    {
+      ptrdiff_t i;
+      for (i = 0 ; i < nargs; i++, args++)
+	PUSH (*args);
+      if (nargs < mandatory)
+	/* Too few arguments.  */
+	Fsignal (Qwrong_number_of_arguments,
+		 list2 (Fcons (make_number (mandatory),
+			       rest ? Qand_rest : make_number (nonrest)),
+			make_number (nargs)));
+      else
+	{
+	  for (; i < nonrest; i++)
+	    PUSH (Qnil);
+	  if (rest)
+	    PUSH (Qnil);
+	}
+    }
+  else if (rest)
+    {
+      ptrdiff_t i;
+      for (i = 0 ; i < nonrest; i++, args++)
+	PUSH (*args);
+      PUSH (Flist (nargs - nonrest, args));
+    }
+  else
+    /* Too many arguments.  */
+    Fsignal (Qwrong_number_of_arguments,
+	     list2 (Fcons (make_number (mandatory), make_number (nonrest)),
+		    make_number (nargs)));
+  return top;
+}
+
+/* A float made by an arithmetic instruction.  A later arithmetic
+   instruction may store its result in this float instead of
+   allocating a new one, if the float is one of its operands and
+   nothing else can refer to it, since then the operand is dead.  OBJ
+   is the float, SLOT the stack slot where the instruction left it,
+   and PC the address just after the instruction; SLOT is null if
+   there is no such float.  */
+
+struct fresh_float
+{
+  Lisp_Object obj;
+  Lisp_Object *slot;
+  const unsigned char *pc;
+};
+
+/* Return true if the instructions from FRESH->pc up to PC cannot have
+   copied the value of FRESH->slot anywhere.  Only a few instructions
+   that push constants, variables or other stack slots are allowed in
+   between; anything else might have stored the value, so give up.  */
+
+static bool
+fresh_float_unshared_p (struct fresh_float *fresh, const unsigned char *pc)
+{
+  const unsigned char *p = fresh->pc;
+  int pushed;
+
+  for (pushed = 0; p < pc && pushed < 4; pushed++)
+    {
+      int op = *p++;
+      int n;
+
+      if (op >= Bconstant)
+	continue;
+      switch (op)
+	{
+	case Bconstant2: case Bvarref7:
+	  p += 2;
+	  continue;
+	case Bvarref6:
+	  p++;
+	  continue;
+	case Bvarref: case Bvarref1: case Bvarref2: case Bvarref3:
+	case Bvarref4: case Bvarref5:
+	  continue;
+	case Bstack_ref1: case Bstack_ref2: case Bstack_ref3:
+	case Bstack_ref4: case Bstack_ref5:
+	  n = op - Bstack_ref;
+	  break;
+	case Bstack_ref6:
+	  n = p[0];
+	  p++;
+	  break;
+	case Bstack_ref7:
+	  n = p[0] + (p[1] << 8);
+	  p += 2;
+	  break;
+	default:
+	  return false;
+	}
+
+      /* A stack reference copies the slot N below the top, which is
+	 the float's slot after PUSHED other values were pushed.  */
+      if (n == pushed)
+	return false;
+    }
+
+  return p == pc;
+}
+
+/* Return a float whose value is D, as the result of the arithmetic
+   instruction that ends just before PC and whose N operands are in
+   the stack slots starting at OPERANDS.  Reuse FRESH->obj if that is
+   safe, and record the result in FRESH.  */
+
+static Lisp_Object
+fresh_float (struct fresh_float *fresh, double d,
+	     Lisp_Object *operands, int n, const unsigned char *pc)
+{
+  Lisp_Object val;
+
+  if (operands <= fresh->slot && fresh->slot < operands + n
+      && EQ (*fresh->slot, fresh->obj)
+      && fresh_float_unshared_p (fresh, pc - 1))
+    {
+      val = fresh->obj;
+      XFLOAT (val)->u.data = d;
+    }
+  else
+    val = make_float (d);
+
+  fresh->obj = val;
+  fresh->slot = operands;
+  fresh->pc = pc;
+  return val;
+}
+
+/* Return true if X and Y are numbers and at least one is a float, so
+   that arithmetic on them is done in floating point.  */
+
+static bool
+float_operands_p (Lisp_Object x, Lisp_Object y)
+{
+  return ((FLOATP (x) || FLOATP (y))
+	  && (FLOATP (x) || INTEGERP (x))
+	  && (FLOATP (y) || INTEGERP (y)));
+}
+
+/* The value of X, which is a fixnum or a float, as a double.  */
+
+static double
+float_value (Lisp_Object x)
+{
+  return FLOATP (x) ? XFLOAT_DATA (x) : XINT (x);
+}
+
 /* Execute the byte-code in BYTESTR.  VECTOR is the constant vector, and
    MAXDEPTH is the maximum stack depth used (if MAXDEPTH is incorrect,
    emacs may crash!).  If ARGS_TEMPLATE is non-nil, it should be a lisp
@@ -467,7 +785,6 @@ Lisp_Object
 exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 		Lisp_Object args_template, ptrdiff_t nargs, Lisp_Object *args)
 {
-  ptrdiff_t count = SPECPDL_INDEX ();
 #ifdef BYTE_CODE_METER
   int volatile this_op = 0;
   int prev_op;
@@ -480,10 +797,11 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
   Lisp_Object *stacke;
   ptrdiff_t bytestr_length;
 #endif
-  struct byte_stack stack;
+  struct byte_stack entry_stack, *stack = &entry_stack;
   Lisp_Object *top;
   Lisp_Object result;
   enum handlertype type;
+  struct fresh_float fresh = { Qnil, NULL, NULL };
 
 #if 0 /* CHECK_FRAME_FONT */
  {
@@ -516,61 +834,29 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 #endif
   vectorp = XVECTOR (vector)->contents;
 
-  stack.byte_string = bytestr;
-  stack.pc = stack.byte_string_start = SDATA (bytestr);
+  stack->byte_string = bytestr;
+  stack->pc = stack->byte_string_start = SDATA (bytestr);
+  stack->constants = vector;
+  stack->count = SPECPDL_INDEX ();
+  stack->caller_top = NULL;
+  stack->log_epoch = 0;
   if (MAX_ALLOCA / word_size <= XFASTINT (maxdepth))
     memory_full (SIZE_MAX);
   top = alloca ((XFASTINT (maxdepth) + 1) * sizeof *top);
+  stack->limit = top + XFASTINT (maxdepth) + 1;
 #if BYTE_MAINTAIN_TOP
-  stack.bottom = top + 1;
-  stack.top = NULL;
+  stack->bottom = top + 1;
+  stack->top = NULL;
 #endif
-  stack.next = byte_stack_list;
-  byte_stack_list = &stack;
+  stack->next = byte_stack_list;
+  byte_stack_list = stack;
 
 #ifdef BYTE_CODE_SAFE
-  stacke = stack.bottom - 1 + XFASTINT (maxdepth);
+  stacke = stack->limit - 1;
 #endif
 
   if (INTEGERP (args_template))
-    {
-      ptrdiff_t at = XINT (args_template);
-      bool rest = (at & 128) != 0;
-      int mandatory = at & 127;
-      ptrdiff_t nonrest = at >> 8;
-      eassert (mandatory <= nonrest);
-      if (nargs <= nonrest)
-	{
-	  ptrdiff_t i;
-	  for (i = 0 ; i < nargs; i++, args++)
-	    PUSH (*args);
-	  if (nargs < mandatory)
-	    /* Too few arguments.  */
-	    Fsignal (Qwrong_number_of_arguments,
-		     list2 (Fcons (make_number (mandatory),
-				   rest ? Qand_rest : make_number (nonrest)),
-			    make_number (nargs)));
-	  else
-	    {
-	      for (; i < nonrest; i++)
-		PUSH (Qnil);
-	      if (rest)
-		PUSH (Qnil);
-	    }
-	}
-      else if (rest)
-	{
-	  ptrdiff_t i;
-	  for (i = 0 ; i < nonrest; i++, args++)
-	    PUSH (*args);
-	  PUSH (Flist (nargs - nonrest, args));
-	}
-      else
-	/* Too many arguments.  */
-	Fsignal (Qwrong_number_of_arguments,
-		 list2 (Fcons (make_number (mandatory), make_number (nonrest)),
-			make_number (nargs)));
-    }
+    top = push_args (top, args_template, nargs, args);
   else if (! NILP (args_template))
     /* We should push some arguments on the stack.  */
     {
@@ -582,7 +868,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 #ifdef BYTE_CODE_SAFE
       if (top > stacke)
 	emacs_abort ();
-      else if (top < stack.bottom - 1)
+      else if (top < stack->bottom - 1)
 	emacs_abort ();
 #endif
 
@@ -594,6 +880,10 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 #ifndef BYTE_CODE_THREADED
       op = FETCH;
 #endif
+#endif
+#ifndef BYTE_CODE_THREADED
+      if (profiler_byte_code_running)
+	profile_byte_op (stack, top, op);
 #endif
 
       /* The interpreter can be compiled one of two ways: as an
@@ -608,8 +898,17 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 #define CASE(OP) insn_ ## OP
       /* NEXT is invoked at the end of an instruction to go to the
 	 next instruction.  It is either a computed goto, or a
-	 plain break.  */
-#define NEXT goto *(targets[op = FETCH])
+	 plain break.  The computed goto goes through DISPATCH, which
+	 is TARGETS, or PROFILE_TARGETS while the byte-code profiler
+	 is running.  */
+#define NEXT goto *(dispatch[op = FETCH])
+      /* UPDATE_DISPATCH makes DISPATCH follow whether the byte-code
+	 profiler is running.  It is invoked after anything that may
+	 have started or stopped the profiler.  The switch-based
+	 interpreter checks for the profiler before each
+	 instruction instead.  */
+#define UPDATE_DISPATCH							\
+      (dispatch = profiler_byte_code_running ? profile_targets : targets)
       /* FIRST is like NEXT, but is only used at the start of the
 	 interpreter body.  In the switch-based interpreter it is the
 	 switch, so the threaded definition must include a semicolon.  */
@@ -629,6 +928,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 #define FIRST switch (op)
 #define CASE_DEFAULT case 255: default:
 #define CASE_ABORT case 0
+#define UPDATE_DISPATCH ((void) 0)
 #endif
 
 #ifdef BYTE_CODE_THREADED
@@ -656,10 +956,20 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 #undef DEFINE
 	};
 
+      /* The dispatch table while the byte-code profiler is running.
+	 Every instruction goes through insn_profile, which logs it
+	 before jumping to its entry in TARGETS.  */
+      static const void *const profile_targets[256] =
+	{
+	  [0 ... 255] = &&insn_profile
+	};
+      const void *const *dispatch;
+
 #if 4 < __GNUC__ + (6 <= __GNUC_MINOR__) || defined __clang__
 # pragma GCC diagnostic pop
 #endif
 
+      UPDATE_DISPATCH;
 #endif
 
 
@@ -687,18 +997,27 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	    Lisp_Object v1, v2;
 
 	    v1 = vectorp[op];
+	    v2 = Qunbound;
+	    /* Inline the variables whose value is found directly from
+	       the symbol.  The redirect kind of the symbol is the guard
+	       an inline cache would need, since making the variable
+	       local or an alias changes it.  */
 	    if (SYMBOLP (v1))
 	      {
-		if (XSYMBOL (v1)->redirect != SYMBOL_PLAINVAL
-		    || (v2 = SYMBOL_VAL (XSYMBOL (v1)),
-			EQ (v2, Qunbound)))
+		struct Lisp_Symbol *sym = XSYMBOL (v1);
+		if (sym->redirect == SYMBOL_PLAINVAL)
+		  v2 = SYMBOL_VAL (sym);
+		else if (sym->redirect == SYMBOL_FORWARDED)
 		  {
-		    BEFORE_POTENTIAL_GC ();
-		    v2 = Fsymbol_value (v1);
-		    AFTER_POTENTIAL_GC ();
+		    union Lisp_Fwd *fwd = SYMBOL_FWD (sym);
+		    if (OBJFWDP (fwd))
+		      v2 = *XOBJFWD (fwd)->objvar;
+		    else if (BUFFER_OBJFWDP (fwd))
+		      v2 = per_buffer_value (current_buffer,
+					     XBUFFER_OBJFWD (fwd)->offset);
 		  }
 	      }
-	    else
+	    if (EQ (v2, Qunbound))
 	      {
 		BEFORE_POTENTIAL_GC ();
 		v2 = Fsymbol_value (v1);
@@ -718,7 +1037,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	      {
 		BYTE_CODE_QUIT;
 		CHECK_RANGE (op);
-		stack.pc = stack.byte_string_start + op;
+		stack->pc = stack->byte_string_start + op;
 	      }
 	    NEXT;
 	  }
@@ -877,8 +1196,126 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 		  }
 	      }
 #endif
-	    TOP = Ffuncall (op + 1, &TOP);
+	    Lisp_Object original_fun = TOP, fun;
+	    ptrdiff_t count1 = begin_funcall (op + 1, &TOP);
+	    struct call_cache *cache
+	      = &call_cache[(uintptr_t) stack->pc % CALL_CACHE_SIZE];
+	    enum call_kind kind;
+
+	    if (cache->pc == stack->pc && EQ (cache->symbol, original_fun)
+		&& cache->epoch == function_epoch)
+	      {
+		fun = cache->fun;
+		kind = cache->kind;
+	      }
+	    else
+	      {
+		fun = original_fun;
+		if (SYMBOLP (fun) && !NILP (fun)
+		    && (fun = XSYMBOL (fun)->function, SYMBOLP (fun)))
+		  fun = indirect_function (fun);
+		kind = call_kind (fun, op);
+		if (SYMBOLP (original_fun))
+		  {
+		    cache->pc = stack->pc;
+		    cache->symbol = original_fun;
+		    cache->fun = fun;
+		    cache->kind = kind;
+		    cache->epoch = function_epoch;
+		  }
+	      }
+
+	    if (kind == CALL_SUBR)
+	      {
+		TOP = end_funcall (count1, funcall_subr (XSUBR (fun), op,
+							 &TOP + 1));
+		AFTER_POTENTIAL_GC ();
+		UPDATE_DISPATCH;
+		NEXT;
+	      }
+
+	    if (kind == CALL_BYTE_CODE)
+	      {
+		EMACS_INT depth = XFASTINT (AREF (fun, COMPILED_STACK_DEPTH));
+		enum { FRAME_WORDS = ((sizeof (struct byte_stack) + word_size - 1)
+				      / word_size) };
+		struct byte_stack *callee = NULL;
+		Lisp_Object *args = top + 1, *bottom;
+
+		if (!byte_stack_region)
+		  byte_stack_region_top = byte_stack_region
+		    = xmalloc (BYTE_STACK_REGION_SIZE * word_size);
+
+		/* A call just before a return from a frame pushed by
+		   Bcall is a tail call, unless the frame has bindings
+		   or handlers pending.  Reuse the frame for the callee,
+		   moving the function and its arguments to the bottom
+		   of the frame, where the backtrace refers to them.  */
+		if (*stack->pc == Breturn
+		    && stack->caller_top
+		    && SPECPDL_INDEX () == stack->count + 1
+		    && handlerlist->byte_stack != stack
+		    && (op + 1 + depth
+			< (byte_stack_region + BYTE_STACK_REGION_SIZE
+			   - (Lisp_Object *) stack - FRAME_WORDS))
+		    && replace_funcall (stack->count - 1,
+					(Lisp_Object *) stack + FRAME_WORDS + 1))
+		  {
+		    ptrdiff_t i;
+
+		    callee = stack;
+		    args = (Lisp_Object *) callee + FRAME_WORDS;
+		    /* The arguments move down, so copy them in order.  */
+		    for (i = 0; i <= op; i++)
+		      args[i] = top[i];
+		    args++;
+		    bottom = args + op;
+		  }
+		else if (depth < (byte_stack_region + BYTE_STACK_REGION_SIZE
+				  - byte_stack_region_top - FRAME_WORDS))
+		  {
+		    /* Push a frame for FUN and execute its byte-code
+		       without recursing.  Breturn pops it again.  */
+		    callee = (struct byte_stack *) byte_stack_region_top;
+		    callee->caller_top = top;
+		    callee->count = SPECPDL_INDEX ();
+		    callee->next = stack;
+		    bottom = byte_stack_region_top + FRAME_WORDS;
+		  }
+
+		if (callee)
+		  {
+		    Lisp_Object bytestr = AREF (fun, COMPILED_BYTECODE);
+
+		    callee->limit = bottom + depth;
+		    byte_stack_region_top = callee->limit;
+		    callee->byte_string = bytestr;
+		    callee->pc = callee->byte_string_start = SDATA (bytestr);
+		    callee->constants = AREF (fun, COMPILED_CONSTANTS);
+		    callee->log_epoch = 0;
+#if BYTE_MAINTAIN_TOP
+		    callee->bottom = bottom;
+		    callee->top = NULL;
+#endif
+		    byte_stack_list = stack = callee;
+		    vectorp = XVECTOR (stack->constants)->contents;
+#ifdef BYTE_CODE_SAFE
+		    const_length = ASIZE (stack->constants);
+		    bytestr_length = SBYTES (bytestr);
+		    stacke = stack->limit - 1;
+#endif
+		    top = push_args (bottom - 1, AREF (fun, COMPILED_ARGLIST),
+				     op, args);
+		    fresh.slot = NULL;
+		    UPDATE_DISPATCH;
+		    NEXT;
+		  }
+	      }
+
+	    TOP = end_funcall (count1, funcall_general (original_fun, op,
+							&TOP + 1));
 	    AFTER_POTENTIAL_GC ();
+	    UPDATE_DISPATCH;
 	    NEXT;
 	  }
 
@@ -907,7 +1344,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	  /* To unbind back to the beginning of this frame.  Not used yet,
 	     but will be needed for tail-recursion elimination.  */
 	  BEFORE_POTENTIAL_GC ();
-	  unbind_to (count, Qnil);
+	  unbind_to (stack->count, Qnil);
 	  AFTER_POTENTIAL_GC ();
 	  NEXT;
 
@@ -916,7 +1353,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	  BYTE_CODE_QUIT;
 	  op = FETCH2;    /* pc = FETCH2 loses since FETCH2 contains pc++ */
 	  CHECK_RANGE (op);
-	  stack.pc = stack.byte_string_start + op;
+	  stack->pc = stack->byte_string_start + op;
 	  NEXT;
 
 	CASE (Bgotoifnonnil):
@@ -929,7 +1366,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	      {
 		BYTE_CODE_QUIT;
 		CHECK_RANGE (op);
-		stack.pc = stack.byte_string_start + op;
+		stack->pc = stack->byte_string_start + op;
 	      }
 	    NEXT;
 	  }
@@ -941,7 +1378,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	    {
 	      BYTE_CODE_QUIT;
 	      CHECK_RANGE (op);
-	      stack.pc = stack.byte_string_start + op;
+	      stack->pc = stack->byte_string_start + op;
 	    }
 	  else DISCARD (1);
 	  NEXT;
@@ -953,7 +1390,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	    {
 	      BYTE_CODE_QUIT;
 	      CHECK_RANGE (op);
-	      stack.pc = stack.byte_string_start + op;
+	      stack->pc = stack->byte_string_start + op;
 	    }
 	  else DISCARD (1);
 	  NEXT;
@@ -961,7 +1398,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	CASE (BRgoto):
 	  MAYBE_GC ();
 	  BYTE_CODE_QUIT;
-	  stack.pc += (int) *stack.pc - 127;
+	  stack->pc += (int) *stack->pc - 127;
 	  NEXT;
 
 	CASE (BRgotoifnil):
@@ -972,9 +1409,9 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	    if (NILP (v1))
 	      {
 		BYTE_CODE_QUIT;
-		stack.pc += (int) *stack.pc - 128;
+		stack->pc += (int) *stack->pc - 128;
 	      }
-	    stack.pc++;
+	    stack->pc++;
 	    NEXT;
 	  }
 
@@ -986,36 +1423,63 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	    if (!NILP (v1))
 	      {
 		BYTE_CODE_QUIT;
-		stack.pc += (int) *stack.pc - 128;
+		stack->pc += (int) *stack->pc - 128;
 	      }
-	    stack.pc++;
+	    stack->pc++;
 	    NEXT;
 	  }
 
 	CASE (BRgotoifnilelsepop):
 	  MAYBE_GC ();
-	  op = *stack.pc++;
+	  op = *stack->pc++;
 	  if (NILP (TOP))
 	    {
 	      BYTE_CODE_QUIT;
-	      stack.pc += op - 128;
+	      stack->pc += op - 128;
 	    }
 	  else DISCARD (1);
 	  NEXT;
 
 	CASE (BRgotoifnonnilelsepop):
 	  MAYBE_GC ();
-	  op = *stack.pc++;
+	  op = *stack->pc++;
 	  if (!NILP (TOP))
 	    {
 	      BYTE_CODE_QUIT;
-	      stack.pc += op - 128;
+	      stack->pc += op - 128;
 	    }
 	  else DISCARD (1);
 	  NEXT;
 
 	CASE (Breturn):
 	  result = POP;
+	  if (stack->caller_top)
+	    {
+	      /* Return from a frame pushed by Bcall to its caller.  */
+	      struct byte_stack *callee = stack;
+
+	      if (SPECPDL_INDEX () != callee->count)
+		{
+		  if (SPECPDL_INDEX () > callee->count)
+		    unbind_to (callee->count, Qnil);
+		  error ("binding stack not balanced (serious byte compiler bug)");
+		}
+
+	      byte_stack_list = stack = callee->next;
+	      byte_stack_region_top = (Lisp_Object *) callee;
+	      top = callee->caller_top;
+	      vectorp = XVECTOR (stack->constants)->contents;
+#ifdef BYTE_CODE_SAFE
+	      const_length = ASIZE (stack->constants);
+	      bytestr_length = SBYTES (stack->byte_string);
+	      stacke = stack->limit - 1;
+#endif
+	      TOP = end_funcall (callee->count - 1, result);
+	      AFTER_POTENTIAL_GC ();
+	      fresh.slot = NULL;
+	      UPDATE_DISPATCH;
+	      NEXT;
+	    }
 	  goto exit;
 
 	CASE (Bdiscard):
@@ -1085,14 +1549,25 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	      {
 		struct handler *c = handlerlist;
 		int dest;
+		/* Frames may have been pushed since the handler was;
+		   unwind_to_catch made the one that pushed it current.  */
+		stack = byte_stack_list;
+		vectorp = XVECTOR (stack->constants)->contents;
+#ifdef BYTE_CODE_SAFE
+		const_length = ASIZE (stack->constants);
+		bytestr_length = SBYTES (stack->byte_string);
+		stacke = stack->limit - 1;
+#endif
 		top = c->bytecode_top;
+		fresh.slot = NULL;
 		dest = c->bytecode_dest;
 		handlerlist = c->next;
 		PUSH (c->val);
 		CHECK_RANGE (dest);
 		/* Might have been re-set by longjmp!  */
-		stack.byte_string_start = SDATA (stack.byte_string);
-		stack.pc = stack.byte_string_start + dest;
+		stack->byte_string_start = SDATA (stack->byte_string);
+		stack->pc = stack->byte_string_start + dest;
+		UPDATE_DISPATCH;
 	      }
 
 	    NEXT;
@@ -1336,6 +1811,9 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 		XSETINT (v1, XINT (v1) - 1);
 		TOP = v1;
 	      }
+	    else if (FLOATP (v1))
+	      TOP = fresh_float (&fresh, XFLOAT_DATA (v1) - 1, top, 1,
+				 stack->pc);
 	    else
 	      {
 		BEFORE_POTENTIAL_GC ();
@@ -1354,6 +1832,9 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 		XSETINT (v1, XINT (v1) + 1);
 		TOP = v1;
 	      }
+	    else if (FLOATP (v1))
+	      TOP = fresh_float (&fresh, XFLOAT_DATA (v1) + 1, top, 1,
+				 stack->pc);
 	    else
 	      {
 		BEFORE_POTENTIAL_GC ();
@@ -1384,52 +1865,106 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	    NEXT;
 	  }
 
+	/* The comparison and arithmetic ops from here on handle two
+	   fixnum operands in place and call the general functions for
+	   anything else.  */
 	CASE (Bgtr):
 	  {
-	    Lisp_Object v1;
-	    BEFORE_POTENTIAL_GC ();
-	    v1 = POP;
-	    TOP = arithcompare (TOP, v1, ARITH_GRTR);
-	    AFTER_POTENTIAL_GC ();
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		DISCARD (1);
+		TOP = XINT (v1) > XINT (v2) ? Qt : Qnil;
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = arithcompare (v1, v2, ARITH_GRTR);
+		AFTER_POTENTIAL_GC ();
+	      }
 	    NEXT;
 	  }
 
 	CASE (Blss):
 	  {
-	    Lisp_Object v1;
-	    BEFORE_POTENTIAL_GC ();
-	    v1 = POP;
-	    TOP = arithcompare (TOP, v1, ARITH_LESS);
-	    AFTER_POTENTIAL_GC ();
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		DISCARD (1);
+		TOP = XINT (v1) < XINT (v2) ? Qt : Qnil;
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = arithcompare (v1, v2, ARITH_LESS);
+		AFTER_POTENTIAL_GC ();
+	      }
 	    NEXT;
 	  }
 
 	CASE (Bleq):
 	  {
-	    Lisp_Object v1;
-	    BEFORE_POTENTIAL_GC ();
-	    v1 = POP;
-	    TOP = arithcompare (TOP, v1, ARITH_LESS_OR_EQUAL);
-	    AFTER_POTENTIAL_GC ();
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		DISCARD (1);
+		TOP = XINT (v1) <= XINT (v2) ? Qt : Qnil;
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = arithcompare (v1, v2, ARITH_LESS_OR_EQUAL);
+		AFTER_POTENTIAL_GC ();
+	      }
 	    NEXT;
 	  }
 
 	CASE (Bgeq):
 	  {
-	    Lisp_Object v1;
-	    BEFORE_POTENTIAL_GC ();
-	    v1 = POP;
-	    TOP = arithcompare (TOP, v1, ARITH_GRTR_OR_EQUAL);
-	    AFTER_POTENTIAL_GC ();
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		DISCARD (1);
+		TOP = XINT (v1) >= XINT (v2) ? Qt : Qnil;
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = arithcompare (v1, v2, ARITH_GRTR_OR_EQUAL);
+		AFTER_POTENTIAL_GC ();
+	      }
 	    NEXT;
 	  }
 
 	CASE (Bdiff):
-	  BEFORE_POTENTIAL_GC ();
-	  DISCARD (1);
-	  TOP = Fminus (2, &TOP);
-	  AFTER_POTENTIAL_GC ();
-	  NEXT;
+	  {
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		DISCARD (1);
+		XSETINT (TOP, XINT (v1) - XINT (v2));
+	      }
+	    else if (float_operands_p (v1, v2))
+	      {
+		Lisp_Object val
+		  = fresh_float (&fresh, float_value (v1) - float_value (v2),
+				 top - 1, 2, stack->pc);
+		DISCARD (1);
+		TOP = val;
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = Fminus (2, &TOP);
+		AFTER_POTENTIAL_GC ();
+	      }
+	    NEXT;
+	  }
 
 	CASE (Bnegate):
 	  {
@@ -1440,6 +1975,8 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 		XSETINT (v1, - XINT (v1));
 		TOP = v1;
 	      }
+	    else if (FLOATP (v1))
+	      TOP = fresh_float (&fresh, - XFLOAT_DATA (v1), top, 1, stack->pc);
 	    else
 	      {
 		BEFORE_POTENTIAL_GC ();
@@ -1450,47 +1987,138 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	  }
 
 	CASE (Bplus):
-	  BEFORE_POTENTIAL_GC ();
-	  DISCARD (1);
-	  TOP = Fplus (2, &TOP);
-	  AFTER_POTENTIAL_GC ();
-	  NEXT;
+	  {
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		DISCARD (1);
+		XSETINT (TOP, XINT (v1) + XINT (v2));
+	      }
+	    else if (float_operands_p (v1, v2))
+	      {
+		Lisp_Object val
+		  = fresh_float (&fresh, float_value (v1) + float_value (v2),
+				 top - 1, 2, stack->pc);
+		DISCARD (1);
+		TOP = val;
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = Fplus (2, &TOP);
+		AFTER_POTENTIAL_GC ();
+	      }
+	    NEXT;
+	  }
 
 	CASE (Bmax):
-	  BEFORE_POTENTIAL_GC ();
-	  DISCARD (1);
-	  TOP = Fmax (2, &TOP);
-	  AFTER_POTENTIAL_GC ();
-	  NEXT;
+	  {
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		DISCARD (1);
+		XSETINT (TOP, max (XINT (v1), XINT (v2)));
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = Fmax (2, &TOP);
+		AFTER_POTENTIAL_GC ();
+	      }
+	    NEXT;
+	  }
 
 	CASE (Bmin):
-	  BEFORE_POTENTIAL_GC ();
-	  DISCARD (1);
-	  TOP = Fmin (2, &TOP);
-	  AFTER_POTENTIAL_GC ();
-	  NEXT;
+	  {
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		DISCARD (1);
+		XSETINT (TOP, min (XINT (v1), XINT (v2)));
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = Fmin (2, &TOP);
+		AFTER_POTENTIAL_GC ();
+	      }
+	    NEXT;
+	  }
 
 	CASE (Bmult):
-	  BEFORE_POTENTIAL_GC ();
-	  DISCARD (1);
-	  TOP = Ftimes (2, &TOP);
-	  AFTER_POTENTIAL_GC ();
-	  NEXT;
+	  {
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    EMACS_INT product;
+	    if (INTEGERP (v1) && INTEGERP (v2))
+	      {
+		/* Like arith_driver, keep the low-order bits of a product
+		   that overflows.  */
+		INT_MULTIPLY_WRAPV (XINT (v1), XINT (v2), &product);
+		DISCARD (1);
+		XSETINT (TOP, product);
+	      }
+	    else if (float_operands_p (v1, v2))
+	      {
+		Lisp_Object val
+		  = fresh_float (&fresh, float_value (v1) * float_value (v2),
+				 top - 1, 2, stack->pc);
+		DISCARD (1);
+		TOP = val;
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = Ftimes (2, &TOP);
+		AFTER_POTENTIAL_GC ();
+	      }
+	    NEXT;
+	  }
 
 	CASE (Bquo):
-	  BEFORE_POTENTIAL_GC ();
-	  DISCARD (1);
-	  TOP = Fquo (2, &TOP);
-	  AFTER_POTENTIAL_GC ();
-	  NEXT;
+	  {
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2) && XINT (v2) != 0)
+	      {
+		DISCARD (1);
+		XSETINT (TOP, XINT (v1) / XINT (v2));
+	      }
+	    else if (float_operands_p (v1, v2))
+	      {
+		Lisp_Object val
+		  = fresh_float (&fresh, float_value (v1) / float_value (v2),
+				 top - 1, 2, stack->pc);
+		DISCARD (1);
+		TOP = val;
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = Fquo (2, &TOP);
+		AFTER_POTENTIAL_GC ();
+	      }
+	    NEXT;
+	  }
 
 	CASE (Brem):
 	  {
-	    Lisp_Object v1;
-	    BEFORE_POTENTIAL_GC ();
-	    v1 = POP;
-	    TOP = Frem (TOP, v1);
-	    AFTER_POTENTIAL_GC ();
+	    Lisp_Object v1 = top[-1], v2 = TOP;
+	    if (INTEGERP (v1) && INTEGERP (v2) && XINT (v2) != 0)
+	      {
+		DISCARD (1);
+		XSETINT (TOP, XINT (v1) % XINT (v2));
+	      }
+	    else
+	      {
+		BEFORE_POTENTIAL_GC ();
+		DISCARD (1);
+		TOP = Frem (v1, v2);
+		AFTER_POTENTIAL_GC ();
+	      }
 	    NEXT;
 	  }
 
@@ -1909,7 +2537,7 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	  call3 (Qerror,
 		 build_string ("Invalid byte opcode: op=%s, ptr=%d"),
 		 make_number (op),
-		 make_number ((stack.pc - 1) - stack.byte_string_start));
+		 make_number ((stack->pc - 1) - stack->byte_string_start));
 
 	  /* Handy byte-codes for lexical binding.  */
 	CASE (Bstack_ref1):
@@ -1973,6 +2601,20 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	  PUSH (vectorp[op - Bconstant]);
 #endif
 	  NEXT;
+
+#ifdef BYTE_CODE_THREADED
+	insn_profile:
+	  /* The previous instruction may have run Lisp code that stopped
+	     the profiler without updating DISPATCH.  */
+	  UPDATE_DISPATCH;
+	  if (profiler_byte_code_running)
+	    {
+	      BEFORE_POTENTIAL_GC ();
+	      profile_byte_op (stack, top, op);
+	      AFTER_POTENTIAL_GC ();
+	    }
+	  goto *(targets[op]);
+#endif
 	}
     }
 
@@ -1981,10 +2623,10 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
   byte_stack_list = byte_stack_list->next;
 
   /* Binds and unbinds are supposed to be compiled balanced.  */
-  if (SPECPDL_INDEX () != count)
+  if (SPECPDL_INDEX () != stack->count)
     {
-      if (SPECPDL_INDEX () > count)
-	unbind_to (count, Qnil);
+      if (SPECPDL_INDEX () > stack->count)
+	unbind_to (stack->count, Qnil);
       error ("binding stack not balanced (serious byte compiler bug)");
     }
 
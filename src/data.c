@@ -52,11 +52,6 @@ KBOARD_OBJFWDP (union Lisp_Fwd *a)
 {
   return XFWDTYPE (a) == Lisp_Fwd_Kboard_Obj;
 }
-static bool
-OBJFWDP (union Lisp_Fwd *a)
-{
-  return XFWDTYPE (a) == Lisp_Fwd_Obj;
-}
 
 static struct Lisp_Boolfwd *
 XBOOLFWD (union Lisp_Fwd *a)
@@ -76,12 +71,6 @@ XINTFWD (union Lisp_Fwd *a)
   eassert (INTFWDP (a));
   return &a->u_intfwd;
 }
-static struct Lisp_Objfwd *
-XOBJFWD (union Lisp_Fwd *a)
-{
-  eassert (OBJFWDP (a));
-  return &a->u_objfwd;
-}
 
 static void
 CHECK_SUBR (Lisp_Object x)
@@ -223,6 +212,10 @@ for example, (type-of 1) returns `integer'.  */)
           return Qfloat;
         case Lisp_Misc_Finalizer:
           return Qfinalizer;
+#ifdef HAVE_MODULES
+	case Lisp_Misc_User_Ptr:
+	  return Quser_ptr;
+#endif
 	default:
 	  emacs_abort ();
 	}
@@ -254,6 +247,16 @@ for example, (type-of 1) returns `integer'.  */)
 	return Qfont_entity;
       if (FONT_OBJECT_P (object))
 	return Qfont_object;
+      if (THREADP (object))
+	return Qthread;
+      if (MUTEXP (object))
+	return Qmutex;
+      if (CONDVARP (object))
+	return Qcondition_variable;
+      if (KEYWORD_SET_P (object))
+	return Qkeyword_set;
+      if (MATCH_DATA_P (object))
+	return Qmatch_data_object;
       return Qvector;
 
     case Lisp_Float:
@@ -424,6 +427,15 @@ DEFUN ("markerp", Fmarkerp, Smarkerp, 1, 1, 0,
   return Qnil;
 }
 
+#ifdef HAVE_MODULES
+DEFUN ("user-ptrp", Fuser_ptrp, Suser_ptrp, 1, 1, 0,
+       doc: /* Return t if OBJECT is a module user pointer.  */)
+  (Lisp_Object object)
+{
+  return USER_PTRP (object) ? Qt : Qnil;
+}
+#endif
+
 DEFUN ("subrp", Fsubrp, Ssubrp, 1, 1, 0,
        doc: /* Return t if OBJECT is a built-in function.  */)
   (Lisp_Object object)
@@ -635,6 +647,13 @@ Return SYMBOL.  */)
   return symbol;
 }
 
+/* Incremented whenever a symbol's function definition changes, and
+   after each garbage collection.  Caches of function definitions,
+   such as those of the byte-code interpreter, are valid only while
+   this stays the same.  */
+
+EMACS_INT function_epoch;
+
 DEFUN ("fmakunbound", Ffmakunbound, Sfmakunbound, 1, 1, 0,
        doc: /* Make SYMBOL's function definition be nil.
 Return SYMBOL.  */)
@@ -644,6 +663,7 @@ Return SYMBOL.  */)
   if (NILP (symbol) || EQ (symbol, Qt))
     xsignal1 (Qsetting_constant, symbol);
   set_symbol_function (symbol, Qnil);
+  function_epoch++;
   return symbol;
 }
 
@@ -695,6 +715,7 @@ DEFUN ("fset", Ffset, Sfset, 2, 2, 0,
     emacs_abort ();
 
   set_symbol_function (symbol, definition);
+  function_epoch++;
 
   return definition;
 }
@@ -1140,7 +1161,7 @@ swap_in_symval_forwarding (struct Lisp_Symbol *symbol, struct Lisp_Buffer_Local_
 	  }
 	else
 	  {
-	    tem1 = assq_no_quit (var, BVAR (current_buffer, local_var_alist));
+	    tem1 = buffer_local_cell (current_buffer, var);
 	    set_blv_where (blv, Fcurrent_buffer ());
 	  }
       }
@@ -1276,10 +1297,9 @@ set_internal (Lisp_Object symbol, Lisp_Object newval, Lisp_Object where,
 
 	    /* Find the new binding.  */
 	    XSETSYMBOL (symbol, sym); /* May have changed via aliasing.  */
-	    tem1 = assq_no_quit (symbol,
-				 (blv->frame_local
-				  ? XFRAME (where)->param_alist
-				  : BVAR (XBUFFER (where), local_var_alist)));
+	    tem1 = (blv->frame_local
+		    ? assq_no_quit (symbol, XFRAME (where)->param_alist)
+		    : buffer_local_cell (XBUFFER (where), symbol));
 	    set_blv_where (blv, where);
 	    blv->found = 1;
 
@@ -1313,6 +1333,7 @@ set_internal (Lisp_Object symbol, Lisp_Object newval, Lisp_Object where,
 		    bset_local_var_alist
 		      (XBUFFER (where),
 		       Fcons (tem1, BVAR (XBUFFER (where), local_var_alist)));
+		    add_buffer_local_cell (XBUFFER (where), tem1);
 		  }
 	      }
 
@@ -1371,7 +1392,7 @@ set_internal (Lisp_Object symbol, Lisp_Object newval, Lisp_Object where,
 /* Return the default value of SYMBOL, but don't check for voidness.
    Return Qunbound if it is void.  */
 
-static Lisp_Object
+Lisp_Object
 default_value (Lisp_Object symbol)
 {
   struct Lisp_Symbol *sym;
@@ -1550,6 +1571,13 @@ union Lisp_Val_Fwd
     union Lisp_Fwd *fwd;
   };
 
+/* The variables that forward to C variables and that have been made
+   buffer-local or frame-local.  When the current buffer changes, those
+   with a binding in the old or new buffer must be swapped in again, so
+   that C code sees the new buffer's values; see set_buffer_internal_2.  */
+
+Lisp_Object forwarded_local_variables;
+
 static struct Lisp_Buffer_Local_Value *
 make_blv (struct Lisp_Symbol *sym, bool forwarded,
 	  union Lisp_Val_Fwd valcontents)
@@ -1574,6 +1602,8 @@ make_blv (struct Lisp_Symbol *sym, bool forwarded,
   set_blv_defcell (blv, tem);
   set_blv_valcell (blv, tem);
   set_blv_found (blv, 0);
+  if (forwarded)
+    forwarded_local_variables = Fcons (symbol, forwarded_local_variables);
   return blv;
 }
 
@@ -1738,7 +1768,7 @@ Instead, use `add-hook' and specify t for the LOCAL argument.  */)
 
   /* Make sure this buffer has its own value of symbol.  */
   XSETSYMBOL (variable, sym);	/* Update in case of aliasing.  */
-  tem = Fassq (variable, BVAR (current_buffer, local_var_alist));
+  tem = buffer_local_cell (current_buffer, variable);
   if (NILP (tem))
     {
       if (let_shadows_buffer_binding_p (sym))
@@ -1753,10 +1783,10 @@ Instead, use `add-hook' and specify t for the LOCAL argument.  */)
 	 default value.  */
       find_symbol_value (variable);
 
+      tem = Fcons (variable, XCDR (blv->defcell));
       bset_local_var_alist
-	(current_buffer,
-	 Fcons (Fcons (variable, XCDR (blv->defcell)),
-		BVAR (current_buffer, local_var_alist)));
+	(current_buffer, Fcons (tem, BVAR (current_buffer, local_var_alist)));
+      add_buffer_local_cell (current_buffer, tem);
 
       /* Make sure symbol does not think it is set up for this buffer;
 	 force it to look once again for this buffer's value.  */
@@ -1820,11 +1850,14 @@ From now on the default value will apply in this buffer.  Return VARIABLE.  */)
 
   /* Get rid of this buffer's alist element, if any.  */
   XSETSYMBOL (variable, sym);	/* Propagate variable indirection.  */
-  tem = Fassq (variable, BVAR (current_buffer, local_var_alist));
+  tem = buffer_local_cell (current_buffer, variable);
   if (!NILP (tem))
-    bset_local_var_alist
-      (current_buffer,
-       Fdelq (tem, BVAR (current_buffer, local_var_alist)));
+    {
+      bset_local_var_alist
+	(current_buffer,
+	 Fdelq (tem, BVAR (current_buffer, local_var_alist)));
+      remove_buffer_local_cell (current_buffer, variable);
+    }
 
   /* If the symbol is set up with the current buffer's binding
      loaded, recompute its value.  We have to do it now, or else
@@ -1938,23 +1971,18 @@ BUFFER defaults to the current buffer.  */)
     case SYMBOL_PLAINVAL: return Qnil;
     case SYMBOL_LOCALIZED:
       {
-	Lisp_Object tail, elt, tmp;
+	Lisp_Object tmp;
 	struct Lisp_Buffer_Local_Value *blv = SYMBOL_BLV (sym);
 	XSETBUFFER (tmp, buf);
 	XSETSYMBOL (variable, sym); /* Update in case of aliasing.  */
 
 	if (EQ (blv->where, tmp)) /* The binding is already loaded.  */
 	  return blv_found (blv) ? Qt : Qnil;
-	else
-	  for (tail = BVAR (buf, local_var_alist); CONSP (tail); tail = XCDR (tail))
-	    {
-	      elt = XCAR (tail);
-	      if (EQ (variable, XCAR (elt)))
-		{
-		  eassert (!blv->frame_local);
-		  return Qt;
-		}
-	    }
+	else if (!NILP (buffer_local_cell (buf, variable)))
+	  {
+	    eassert (!blv->frame_local);
+	    return Qt;
+	  }
 	return Qnil;
       }
     case SYMBOL_FORWARDED:
@@ -2272,6 +2300,7 @@ bool-vector.  IDX starts at 0.  */)
 	    }
 	  while (new_bytes--)
 	    *p1++ = *p0++;
+	  XSTRING (array)->hash = 0;
 	}
       else
 	{
@@ -3007,7 +3036,7 @@ shift_right_ull (bits_word w)
 
 /* Return the number of 1 bits in W.  */
 
-static int
+int
 count_one_bits_word (bits_word w)
 {
   if (BITS_WORD_MAX <= UINT_MAX)
@@ -3542,6 +3571,10 @@ syms_of_data (void)
   DEFSYM (Qmarker, "marker");
   DEFSYM (Qoverlay, "overlay");
   DEFSYM (Qfinalizer, "finalizer");
+#ifdef HAVE_MODULES
+  DEFSYM (Quser_ptr, "user-ptr");
+  DEFSYM (Quser_ptrp, "user-ptrp");
+#endif
   DEFSYM (Qfloat, "float");
   DEFSYM (Qwindow_configuration, "window-configuration");
   DEFSYM (Qprocess, "process");
@@ -3553,6 +3586,11 @@ syms_of_data (void)
   DEFSYM (Qchar_table, "char-table");
   DEFSYM (Qbool_vector, "bool-vector");
   DEFSYM (Qhash_table, "hash-table");
+  DEFSYM (Qthread, "thread");
+  DEFSYM (Qmutex, "mutex");
+  DEFSYM (Qcondition_variable, "condition-variable");
+  DEFSYM (Qkeyword_set, "keyword-set");
+  DEFSYM (Qmatch_data_object, "match-data-object");
 
   DEFSYM (Qdefun, "defun");
 
@@ -3590,6 +3628,9 @@ syms_of_data (void)
   defsubr (&Ssequencep);
   defsubr (&Sbufferp);
   defsubr (&Smarkerp);
+#ifdef HAVE_MODULES
+  defsubr (&Suser_ptrp);
+#endif
   defsubr (&Ssubrp);
   defsubr (&Sbyte_code_function_p);
   defsubr (&Schar_or_string_p);
@@ -3668,6 +3709,8 @@ syms_of_data (void)
 
   set_symbol_function (Qwholenump, XSYMBOL (Qnatnump)->function);
 
+  staticpro (&forwarded_local_variables);
+
   DEFVAR_LISP ("most-positive-fixnum", Vmost_positive_fixnum,
 	       doc: /* The largest value that is representable in a Lisp integer.  */);
   Vmost_positive_fixnum = make_number (MOST_POSITIVE_FIXNUM);
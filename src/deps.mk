@@ -292,6 +292,9 @@ print.o: print.c process.h frame.h window.h buffer.h keyboard.h character.h \
 lread.o: lread.c commands.h keyboard.h buffer.h epaths.h character.h \
    charset.h lisp.h globals.h $(config_h) $(INTERVALS_H) termhooks.h \
    coding.h msdos.h systime.h frame.h blockinput.h atimer.h ../lib/unistd.h
+systhread.o: systhread.c systhread.h lisp.h globals.h $(config_h)
+thread.o: thread.c thread.h systhread.h buffer.h character.h sysselect.h \
+   lisp.h globals.h $(config_h)
 
 ## Text properties support.
 composite.o: composite.c composite.h buffer.h character.h coding.h font.h \
@@ -1179,6 +1179,7 @@ Using an Emacs configured with --with-x-toolkit=lucid does not have this problem
       init_alloc_once ();
       init_obarray ();
       init_eval_once ();
+      init_threads_once ();
       init_charset_once ();
       init_coding_once ();
       init_syntax_once ();	/* Create standard syntax table.  */
@@ -1232,6 +1233,7 @@ Using an Emacs configured with --with-x-toolkit=lucid does not have this problem
     }
 
   init_eval ();
+  init_threads ();
   init_atimer ();
   running_asynch_code = 0;
   init_random ();
@@ -1420,6 +1422,7 @@ Using an Emacs configured with --with-x-toolkit=lucid does not have this problem
       syms_of_lread ();
       syms_of_print ();
       syms_of_eval ();
+      syms_of_threads ();
       syms_of_floatfns ();
 
       syms_of_buffer ();
@@ -1490,6 +1493,10 @@ Using an Emacs configured with --with-x-toolkit=lucid does not have this problem
       syms_of_decompress ();
 #endif
 
+#ifdef HAVE_MODULES
+      syms_of_module ();
+#endif
+
       syms_of_menu ();
 
 #ifdef HAVE_NTGUI
@@ -29,10 +29,6 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #include "dispextern.h"
 #include "buffer.h"
 
-/* Chain of condition and catch handlers currently in effect.  */
-
-struct handler *handlerlist;
-
 /* Non-nil means record all fset's and provide's, to be undone
    if the file being autoloaded is not fully loaded.
    They are recorded by being consed onto the front of Vautoload_queue:
@@ -45,24 +41,6 @@ Lisp_Object Vautoload_queue;
    is shutting down.  */
 Lisp_Object Vrun_hooks;
 
-/* Current number of specbindings allocated in specpdl, not counting
-   the dummy entry specpdl[-1].  */
-
-ptrdiff_t specpdl_size;
-
-/* Pointer to beginning of specpdl.  A dummy entry specpdl[-1] exists
-   only so that its address can be taken.  */
-
-union specbinding *specpdl;
-
-/* Pointer to first unused element in specpdl.  */
-
-union specbinding *specpdl_ptr;
-
-/* Depth in Lisp evaluations and function calls.  */
-
-EMACS_INT lisp_eval_depth;
-
 /* The value of num_nonmacro_input_events as of the last time we
    started to enter the debugger.  If we decide to enter the debugger
    again when this is still equal to num_nonmacro_input_events, then we
@@ -216,23 +194,30 @@ init_eval_once (void)
   Vrun_hooks = Qnil;
 }
 
-static struct handler handlerlist_sentinel;
+/* Put a dummy catcher at top-level of the current thread so that
+   handlerlist is never NULL.  This is important since
+   handlerlist->nextfree holds the freelist which would otherwise leak
+   every time we unwind back to top-level.  */
+
+void
+init_handlerlist (void)
+{
+  struct handler *c;
+  if (!handlerlist_sentinel)
+    handlerlist_sentinel = xzalloc (sizeof *handlerlist_sentinel);
+  handlerlist = handlerlist_sentinel->nextfree = handlerlist_sentinel;
+  PUSH_HANDLER (c, Qunbound, CATCHER);
+  eassert (c == handlerlist_sentinel);
+  handlerlist_sentinel->nextfree = NULL;
+  handlerlist_sentinel->next = NULL;
+}
 
 void
 init_eval (void)
 {
-  byte_stack_list = 0;
+  restore_byte_stack (NULL);
   specpdl_ptr = specpdl;
-  { /* Put a dummy catcher at top-level so that handlerlist is never NULL.
-       This is important since handlerlist->nextfree holds the freelist
-       which would otherwise leak every time we unwind back to top-level.   */
-    struct handler *c;
-    handlerlist = handlerlist_sentinel.nextfree = &handlerlist_sentinel;
-    PUSH_HANDLER (c, Qunbound, CATCHER);
-    eassert (c == &handlerlist_sentinel);
-    handlerlist_sentinel.nextfree = NULL;
-    handlerlist_sentinel.next = NULL;
-  }
+  init_handlerlist ();
   Vquit_flag = Qnil;
   debug_on_next_call = 0;
   lisp_eval_depth = 0;
@@ -1128,8 +1113,8 @@ unwind_to_catch (struct handler *catch, Lisp_Object value)
 
   eassert (handlerlist == catch);
 
-  byte_stack_list = catch->byte_stack;
-  lisp_eval_depth = catch->lisp_eval_depth;
+  restore_byte_stack (catch->byte_stack);
+  lisp_eval_depth = catch->f_lisp_eval_depth;
 
   sys_longjmp (catch->jmp, 1);
 }
@@ -1145,6 +1130,8 @@ Both TAG and VALUE are evalled.  */
   if (!NILP (tag))
     for (c = handlerlist; c; c = c->next)
       {
+	if (c->type == CATCHER_ALL)
+          unwind_to_catch (c, Fcons (tag, value));
 	if (c->type == CATCHER && EQ (c->tag_or_ch, tag))
 	  unwind_to_catch (c, value);
       }
@@ -1519,7 +1506,7 @@ See also the function `condition-case'.  */)
     }
   else
     {
-      if (handlerlist != &handlerlist_sentinel)
+      if (handlerlist != handlerlist_sentinel)
 	/* FIXME: This will come right back here if there's no `top-level'
 	   catcher.  A better solution would be to abort here, and instead
 	   add a catch-all condition handler so we never come here.  */
@@ -1969,40 +1956,30 @@ grow_specpdl (void)
   specpdl_ptr++;
 
   if (specpdl_ptr == specpdl + specpdl_size)
-    {
-      ptrdiff_t count = SPECPDL_INDEX ();
-      ptrdiff_t max_size = min (max_specpdl_size, PTRDIFF_MAX - 1000);
-      union specbinding *pdlvec = specpdl - 1;
-      ptrdiff_t pdlvecsize = specpdl_size + 1;
-      if (max_size <= specpdl_size)
-	{
-	  if (max_specpdl_size < 400)
-	    max_size = max_specpdl_size = 400;
-	  if (max_size <= specpdl_size)
-	    signal_error ("Variable binding depth exceeds max-specpdl-size",
-			  Qnil);
-	}
-      pdlvec = xpalloc (pdlvec, &pdlvecsize, 1, max_size + 1, sizeof *specpdl);
-      specpdl = pdlvec + 1;
-      specpdl_size = pdlvecsize - 1;
-      specpdl_ptr = specpdl + count;
-    }
+    grow_specpdl_allocation ();
 }
 
-ptrdiff_t
-record_in_backtrace (Lisp_Object function, Lisp_Object *args, ptrdiff_t nargs)
+/* Enlarge the specpdl, now that SPECPDL_PTR has reached its end.  */
+
+void
+grow_specpdl_allocation (void)
 {
   ptrdiff_t count = SPECPDL_INDEX ();
-
-  eassert (nargs >= UNEVALLED);
-  specpdl_ptr->bt.kind = SPECPDL_BACKTRACE;
-  specpdl_ptr->bt.debug_on_exit = false;
-  specpdl_ptr->bt.function = function;
-  specpdl_ptr->bt.args = args;
-  specpdl_ptr->bt.nargs = nargs;
-  grow_specpdl ();
-
-  return count;
+  ptrdiff_t max_size = min (max_specpdl_size, PTRDIFF_MAX - 1000);
+  union specbinding *pdlvec = specpdl - 1;
+  ptrdiff_t pdlvecsize = specpdl_size + 1;
+  if (max_size <= specpdl_size)
+    {
+      if (max_specpdl_size < 400)
+	max_size = max_specpdl_size = 400;
+      if (max_size <= specpdl_size)
+	signal_error ("Variable binding depth exceeds max-specpdl-size",
+		      Qnil);
+    }
+  pdlvec = xpalloc (pdlvec, &pdlvecsize, 1, max_size + 1, sizeof *specpdl);
+  specpdl = pdlvec + 1;
+  specpdl_size = pdlvecsize - 1;
+  specpdl_ptr = specpdl + count;
 }
 
 /* Eval a sub-expression of the current expression (i.e. in the same
@@ -2037,12 +2014,7 @@ eval_sub (Lisp_Object form)
   maybe_gc ();
 
   if (++lisp_eval_depth > max_lisp_eval_depth)
-    {
-      if (max_lisp_eval_depth < 100)
-	max_lisp_eval_depth = 100;
-      if (lisp_eval_depth > max_lisp_eval_depth)
-	error ("Lisp nesting exceeds `max-lisp-eval-depth'");
-    }
+    lisp_eval_depth_exceeded ();
 
   original_fun = XCAR (form);
   original_args = XCDR (form);
@@ -2577,34 +2549,159 @@ Thus, (funcall \\='cons \\='x \\='y) returns (x . y).
 usage: (funcall FUNCTION &rest ARGUMENTS)  */)
   (ptrdiff_t nargs, Lisp_Object *args)
 {
-  Lisp_Object fun, original_fun;
-  Lisp_Object funcar;
-  ptrdiff_t numargs = nargs - 1;
-  Lisp_Object lisp_numargs;
-  Lisp_Object val;
-  Lisp_Object *internal_args;
-  ptrdiff_t count;
+  ptrdiff_t count = begin_funcall (nargs, args);
+  return end_funcall (count, funcall_general (args[0], nargs - 1, args + 1));
+}
 
-  QUIT;
+/* Signal an error because a call nested too deeply, unless
+   max-lisp-eval-depth was set so low that it is better raised.  This
+   is the slow path of begin_funcall.  */
 
-  if (++lisp_eval_depth > max_lisp_eval_depth)
+void
+lisp_eval_depth_exceeded (void)
+{
+  if (max_lisp_eval_depth < 100)
+    max_lisp_eval_depth = 100;
+  if (lisp_eval_depth > max_lisp_eval_depth)
+    error ("Lisp nesting exceeds `max-lisp-eval-depth'");
+}
+
+/* Enter the debugger on a call begun by begin_funcall, whose value
+   was COUNT, because `debug-on-next-call' is set.  */
+
+void
+funcall_debug_on_call (ptrdiff_t count)
+{
+  do_debug_on_call (Qlambda, count);
+}
+
+/* Enter the debugger on exit from a call that returned VAL, and
+   return the debugger's value.  This is the slow path of
+   end_funcall.  */
+
+Lisp_Object
+funcall_debug_on_exit (Lisp_Object val)
+{
+  return call_debugger (list2 (Qexit, val));
+}
+
+/* Make the call whose backtrace record is at COUNT, begun by
+   begin_funcall, be replaced by the call begun by begin_funcall just
+   after it, whose arguments are now at ARGS.  Nothing else may be on
+   the specpdl above COUNT.  This is for a tail call, which reuses the
+   caller's frame for the callee.  Return false, doing nothing, if the
+   caller is to enter the debugger when it returns.  */
+
+bool
+replace_funcall (ptrdiff_t count, Lisp_Object *args)
+{
+  union specbinding *pdl = specpdl + count;
+
+  eassert (SPECPDL_INDEX () == count + 2);
+  if (backtrace_debug_on_exit (pdl))
+    return false;
+  /* Copy the fields one by one rather than the whole record, which
+     was just stored field by field.  */
+  pdl->bt.function = pdl[1].bt.function;
+  set_backtrace_args (pdl, args, pdl[1].bt.nargs);
+  set_backtrace_debug_on_exit (pdl, backtrace_debug_on_exit (pdl + 1));
+  specpdl_ptr--;
+  lisp_eval_depth--;
+  return true;
+}
+
+/* Call the primitive SUBR with the NUMARGS arguments in ARGS.  The
+   caller has checked that SUBR accepts NUMARGS arguments and is not a
+   special form.  */
+
+Lisp_Object
+funcall_subr (struct Lisp_Subr *subr, ptrdiff_t numargs, Lisp_Object *args)
+{
+  if (subr->max_args == MANY)
+    return subr->function.aMANY (numargs, args);
+  else
     {
-      if (max_lisp_eval_depth < 100)
-	max_lisp_eval_depth = 100;
-      if (lisp_eval_depth > max_lisp_eval_depth)
-	error ("Lisp nesting exceeds `max-lisp-eval-depth'");
-    }
+      Lisp_Object internal_argbuf[8];
+      Lisp_Object *internal_args;
+      Lisp_Object val;
 
-  count = record_in_backtrace (args[0], &args[1], nargs - 1);
+      if (subr->max_args > numargs)
+	{
+	  eassert (subr->max_args <= ARRAYELTS (internal_argbuf));
+	  internal_args = internal_argbuf;
+	  memcpy (internal_args, args, numargs * word_size);
+	  memclear (internal_args + numargs,
+		    (subr->max_args - numargs) * word_size);
+	}
+      else
+	internal_args = args;
+      switch (subr->max_args)
+	{
+	case 0:
+	  val = (subr->function.a0 ());
+	  break;
+	case 1:
+	  val = (subr->function.a1 (internal_args[0]));
+	  break;
+	case 2:
+	  val = (subr->function.a2
+		 (internal_args[0], internal_args[1]));
+	  break;
+	case 3:
+	  val = (subr->function.a3
+		 (internal_args[0], internal_args[1], internal_args[2]));
+	  break;
+	case 4:
+	  val = (subr->function.a4
+		 (internal_args[0], internal_args[1], internal_args[2],
+		 internal_args[3]));
+	  break;
+	case 5:
+	  val = (subr->function.a5
+		 (internal_args[0], internal_args[1], internal_args[2],
+		  internal_args[3], internal_args[4]));
+	  break;
+	case 6:
+	  val = (subr->function.a6
+		 (internal_args[0], internal_args[1], internal_args[2],
+		  internal_args[3], internal_args[4], internal_args[5]));
+	  break;
+	case 7:
+	  val = (subr->function.a7
+		 (internal_args[0], internal_args[1], internal_args[2],
+		  internal_args[3], internal_args[4], internal_args[5],
+		  internal_args[6]));
+	  break;
 
-  maybe_gc ();
+	case 8:
+	  val = (subr->function.a8
+		 (internal_args[0], internal_args[1], internal_args[2],
+		  internal_args[3], internal_args[4], internal_args[5],
+		  internal_args[6], internal_args[7]));
+	  break;
 
-  if (debug_on_next_call)
-    do_debug_on_call (Qlambda, count);
+	default:
 
-  check_cons_list ();
+	  /* If a subr takes more than 8 arguments without using MANY
+	     or UNEVALLED, we need to extend this function to support it.
+	     Until this is done, there is no way to call the function.  */
+	  emacs_abort ();
+	}
+      return val;
+    }
+}
 
-  original_fun = args[0];
+/* Call the function ORIGINAL_FUN with the NUMARGS arguments in ARGS,
+   without any of the bookkeeping of Ffuncall.  */
+
+Lisp_Object
+funcall_general (Lisp_Object original_fun, ptrdiff_t numargs,
+		 Lisp_Object *args)
+{
+  Lisp_Object fun;
+  Lisp_Object funcar;
+  Lisp_Object lisp_numargs;
+  Lisp_Object val;
 
  retry:
 
@@ -2626,77 +2723,11 @@ usage: (funcall FUNCTION &rest ARGUMENTS)  */)
       else if (XSUBR (fun)->max_args == UNEVALLED)
 	xsignal1 (Qinvalid_function, original_fun);
 
-      else if (XSUBR (fun)->max_args == MANY)
-	val = (XSUBR (fun)->function.aMANY) (numargs, args + 1);
       else
-	{
-	  Lisp_Object internal_argbuf[8];
-	  if (XSUBR (fun)->max_args > numargs)
-	    {
-	      eassert (XSUBR (fun)->max_args <= ARRAYELTS (internal_argbuf));
-	      internal_args = internal_argbuf;
-	      memcpy (internal_args, args + 1, numargs * word_size);
-	      memclear (internal_args + numargs,
-			(XSUBR (fun)->max_args - numargs) * word_size);
-	    }
-	  else
-	    internal_args = args + 1;
-	  switch (XSUBR (fun)->max_args)
-	    {
-	    case 0:
-	      val = (XSUBR (fun)->function.a0 ());
-	      break;
-	    case 1:
-	      val = (XSUBR (fun)->function.a1 (internal_args[0]));
-	      break;
-	    case 2:
-	      val = (XSUBR (fun)->function.a2
-		     (internal_args[0], internal_args[1]));
-	      break;
-	    case 3:
-	      val = (XSUBR (fun)->function.a3
-		     (internal_args[0], internal_args[1], internal_args[2]));
-	      break;
-	    case 4:
-	      val = (XSUBR (fun)->function.a4
-		     (internal_args[0], internal_args[1], internal_args[2],
-		     internal_args[3]));
-	      break;
-	    case 5:
-	      val = (XSUBR (fun)->function.a5
-		     (internal_args[0], internal_args[1], internal_args[2],
-		      internal_args[3], internal_args[4]));
-	      break;
-	    case 6:
-	      val = (XSUBR (fun)->function.a6
-		     (internal_args[0], internal_args[1], internal_args[2],
-		      internal_args[3], internal_args[4], internal_args[5]));
-	      break;
-	    case 7:
-	      val = (XSUBR (fun)->function.a7
-		     (internal_args[0], internal_args[1], internal_args[2],
-		      internal_args[3], internal_args[4], internal_args[5],
-		      internal_args[6]));
-	      break;
-
-	    case 8:
-	      val = (XSUBR (fun)->function.a8
-		     (internal_args[0], internal_args[1], internal_args[2],
-		      internal_args[3], internal_args[4], internal_args[5],
-		      internal_args[6], internal_args[7]));
-	      break;
-
-	    default:
-
-	      /* If a subr takes more than 8 arguments without using MANY
-		 or UNEVALLED, we need to extend this function to support it.
-		 Until this is done, there is no way to call the function.  */
-	      emacs_abort ();
-	    }
-	}
+	val = funcall_subr (XSUBR (fun), numargs, args);
     }
   else if (COMPILEDP (fun))
-    val = funcall_lambda (fun, numargs, args + 1);
+    val = funcall_lambda (fun, numargs, args);
   else
     {
       if (NILP (fun))
@@ -2708,7 +2739,7 @@ usage: (funcall FUNCTION &rest ARGUMENTS)  */)
 	xsignal1 (Qinvalid_function, original_fun);
       if (EQ (funcar, Qlambda)
 	  || EQ (funcar, Qclosure))
-	val = funcall_lambda (fun, numargs, args + 1);
+	val = funcall_lambda (fun, numargs, args);
       else if (EQ (funcar, Qautoload))
 	{
 	  Fautoload_do_load (fun, original_fun, Qnil);
@@ -2718,11 +2749,6 @@ usage: (funcall FUNCTION &rest ARGUMENTS)  */)
       else
 	xsignal1 (Qinvalid_function, original_fun);
     }
-  check_cons_list ();
-  lisp_eval_depth--;
-  if (backtrace_debug_on_exit (specpdl + count))
-    val = call_debugger (list2 (Qexit, val));
-  specpdl_ptr--;
   return val;
 }
 
@@ -3183,6 +3209,75 @@ unbind_to (ptrdiff_t count, Lisp_Object value)
   return value;
 }
 
+/* Exchange the value of the variable bound by the let-binding BIND
+   with the value saved in BIND.  When a thread gives up the global
+   lock, this undoes its bindings, leaving their values in its
+   specpdl; when it gets the lock back, this does them again.  */
+
+static void
+swap_specbinding (union specbinding *bind)
+{
+  Lisp_Object symbol = specpdl_symbol (bind);
+  Lisp_Object value = specpdl_old_value (bind);
+
+  switch (bind->kind)
+    {
+    case SPECPDL_LET:
+      {
+	struct Lisp_Symbol *sym = XSYMBOL (symbol);
+	if (sym->redirect == SYMBOL_PLAINVAL)
+	  {
+	    set_specpdl_old_value (bind, SYMBOL_VAL (sym));
+	    SET_SYMBOL_VAL (sym, value);
+	    break;
+	  }
+      }
+      /* Fall through.  */
+    case SPECPDL_LET_DEFAULT:
+      set_specpdl_old_value (bind, default_value (symbol));
+      Fset_default (symbol, value);
+      break;
+    case SPECPDL_LET_LOCAL:
+      {
+	Lisp_Object where = specpdl_where (bind);
+	if (!NILP (Flocal_variable_p (symbol, where)))
+	  {
+	    set_specpdl_old_value (bind, buffer_local_value (symbol, where));
+	    set_internal (symbol, value, where, 1);
+	  }
+      }
+      break;
+    default:
+      break;
+    }
+}
+
+/* Undo the let-bindings of THR, which is giving up the global lock,
+   innermost first.  */
+
+void
+unbind_for_thread_switch (struct thread_state *thr)
+{
+  union specbinding *bind;
+
+  for (bind = thr->m_specpdl_ptr; bind != thr->m_specpdl;)
+    if ((--bind)->kind >= SPECPDL_LET)
+      swap_specbinding (bind);
+}
+
+/* Redo the let-bindings of the current thread, which has just got the
+   global lock, outermost first.  */
+
+void
+rebind_for_thread_switch (void)
+{
+  union specbinding *bind;
+
+  for (bind = specpdl; bind != specpdl_ptr; bind++)
+    if (bind->kind >= SPECPDL_LET)
+      swap_specbinding (bind);
+}
+
 DEFUN ("special-variable-p", Fspecial_variable_p, Sspecial_variable_p, 1, 1, 0,
        doc: /* Return non-nil if SYMBOL's global binding has been declared special.
 A special variable is one that will be bound dynamically, even in a
@@ -3500,11 +3595,14 @@ NFRAMES and BASE specify the activation frame to use, as in `backtrace-frame'.
 }
 
 
+/* Mark the objects referenced from the entries of a specpdl, from
+   FIRST up to but not including PTR.  */
+
 void
-mark_specpdl (void)
+mark_specpdl (union specbinding *first, union specbinding *ptr)
 {
   union specbinding *pdl;
-  for (pdl = specpdl; pdl != specpdl_ptr; pdl++)
+  for (pdl = first; pdl != ptr; pdl++)
     {
       switch (pdl->kind)
 	{
@@ -468,6 +468,9 @@ enum Lisp_Misc_Type
     Lisp_Misc_Overlay,
     Lisp_Misc_Save_Value,
     Lisp_Misc_Finalizer,
+#ifdef HAVE_MODULES
+    Lisp_Misc_User_Ptr,
+#endif
     /* Currently floats are not a misc type,
        but let's define this in case we want to change that.  */
     Lisp_Misc_Float,
@@ -592,6 +595,10 @@ INLINE bool WINDOWP (Lisp_Object);
 INLINE bool TERMINALP (Lisp_Object);
 INLINE struct Lisp_Save_Value *XSAVE_VALUE (Lisp_Object);
 INLINE struct Lisp_Finalizer *XFINALIZER (Lisp_Object);
+#ifdef HAVE_MODULES
+INLINE bool USER_PTRP (Lisp_Object);
+INLINE struct Lisp_User_Ptr *XUSER_PTR (Lisp_Object);
+#endif
 INLINE struct Lisp_Symbol *(XSYMBOL) (Lisp_Object);
 INLINE void *(XUNTAG) (Lisp_Object, int);
 
@@ -657,6 +664,10 @@ struct Lisp_Symbol
   /* True if pointed to from purespace and hence can't be GC'd.  */
   bool_bf pinned : 1;
 
+  /* Hash code of the symbol's name, if the symbol is interned.  The
+     obarray uses it to pick the symbol's bucket.  */
+  unsigned int hash;
+
   /* The symbol's name, as a Lisp string.  */
   Lisp_Object name;
 
@@ -778,6 +789,11 @@ enum pvec_type
   PVEC_WINDOW_CONFIGURATION,
   PVEC_SUBR,
   PVEC_OTHER,
+  PVEC_THREAD,
+  PVEC_MUTEX,
+  PVEC_CONDVAR,
+  PVEC_KEYWORD_SET,
+  PVEC_MATCH_DATA,
   /* These should be last, check internal_equal to see why.  */
   PVEC_COMPILED,
   PVEC_CHAR_TABLE,
@@ -1143,6 +1159,11 @@ builtin_lisp_symbol (int index)
 #define XSETCHAR_TABLE(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_CHAR_TABLE))
 #define XSETBOOL_VECTOR(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_BOOL_VECTOR))
 #define XSETSUB_CHAR_TABLE(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_SUB_CHAR_TABLE))
+#define XSETTHREAD(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_THREAD))
+#define XSETMUTEX(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_MUTEX))
+#define XSETCONDVAR(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_CONDVAR))
+#define XSETKEYWORD_SET(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_KEYWORD_SET))
+#define XSETMATCH_DATA(a, b) (XSETPSEUDOVECTOR (a, b, PVEC_MATCH_DATA))
 
 /* Efficiently convert a pointer to a Lisp object and back.  The
    pointer is represented as a Lisp integer, so the garbage collector
@@ -1273,6 +1294,10 @@ struct GCALIGNED Lisp_String
     ptrdiff_t size_byte;
     INTERVAL intervals;		/* Text properties in this string.  */
     unsigned char *data;
+    /* Cached value of sxhash for this string, or 0 if not yet
+       computed.  Anything that changes the contents of the string in
+       place must reset this to 0.  */
+    EMACS_UINT hash;
   };
 
 /* True if STR is a multibyte string.  */
@@ -1339,6 +1364,7 @@ INLINE void
 SSET (Lisp_Object string, ptrdiff_t index, unsigned char new)
 {
   SDATA (string)[index] = new;
+  XSTRING (string)->hash = 0;
 }
 INLINE ptrdiff_t
 SCHARS (Lisp_Object string)
@@ -1368,6 +1394,7 @@ INLINE void
 STRING_SET_CHARS (Lisp_Object string, ptrdiff_t newsize)
 {
   XSTRING (string)->size = newsize;
+  XSTRING (string)->hash = 0;
 }
 
 /* Header of vector-like objects.  This documents the layout constraints on
@@ -1890,17 +1917,20 @@ struct Lisp_Hash_Table
      I-th entry is unused.  */
   Lisp_Object hash;
 
-  /* Vector used to chain entries.  If entry I is free, next[I] is the
-     entry number of the next free item.  If entry I is non-free,
-     next[I] is the index of the next entry in the collision chain.  */
+  /* Vector used to chain free entries.  If entry I is free, next[I]
+     is the entry number of the next free item.  If entry I is
+     non-free, next[I] is nil.  */
   Lisp_Object next;
 
   /* Index of first free entry in free list.  */
   Lisp_Object next_free;
 
-  /* Bucket vector.  A non-nil entry is the index of the first item in
-     a collision chain.  This vector's size can be larger than the
-     hash table size to reduce collisions.  */
+  /* Index vector, searched by linear probing.  A non-nil element is
+     the number of an entry; the entry with hash code H is found by
+     scanning from element H modulo the vector's size up to the next
+     nil element, wrapping around at the end.  This vector is kept
+     more than twice as large as the hash table size, so that there
+     are always nil elements and the scans stay short.  */
   Lisp_Object index;
 
   /* Only the fields above are traced normally by the GC.  The ones below
@@ -1953,8 +1983,8 @@ HASH_VALUE (struct Lisp_Hash_Table *h, ptrdiff_t idx)
   return AREF (h->key_and_value, 2 * idx + 1);
 }
 
-/* Value is the index of the next entry following the one at IDX
-   in hash table H.  */
+/* Value is the index of the next free entry following the one at
+   IDX in hash table H.  */
 INLINE Lisp_Object
 HASH_NEXT (struct Lisp_Hash_Table *h, ptrdiff_t idx)
 {
@@ -1968,8 +1998,8 @@ HASH_HASH (struct Lisp_Hash_Table *h, ptrdiff_t idx)
   return AREF (h->hash, idx);
 }
 
-/* Value is the index of the element in hash table H that is the
-   start of the collision list at index IDX in the index vector of H.  */
+/* Value is the number of the entry recorded at index IDX in the
+   index vector of hash table H, or nil if that slot is empty.  */
 INLINE Lisp_Object
 HASH_INDEX (struct Lisp_Hash_Table *h, ptrdiff_t idx)
 {
@@ -2027,7 +2057,11 @@ struct Lisp_Marker
 {
   ENUM_BF (Lisp_Misc_Type) type : 16;		/* = Lisp_Misc_Marker */
   bool_bf gcmarkbit : 1;
-  unsigned spacer : 13;
+  unsigned spacer : 12;
+  /* True means deleting the text around the marker records no
+     adjustment of it in the undo list.  The markers of match data
+     objects are like this, since they are reused.  */
+  bool_bf no_undo : 1;
   /* This flag is temporarily used in the functions
      decode/encode_coding_object to record that the marker position
      must be adjusted after the conversion.  */
@@ -2245,6 +2279,20 @@ struct Lisp_Finalizer
     Lisp_Object function;
   };
 
+#ifdef HAVE_MODULES
+/* A pointer owned by a dynamic module, see emacs-module.h.  */
+struct Lisp_User_Ptr
+  {
+    struct Lisp_Misc_Any base;
+
+    /* Called with P when the object is garbage collected, unless
+       NULL.  */
+    void (*finalizer) (void *);
+
+    void *p;
+  };
+#endif
+
 /* A miscellaneous object, when it's on the free list.  */
 struct Lisp_Free
   {
@@ -2265,6 +2313,9 @@ union Lisp_Misc
     struct Lisp_Overlay u_overlay;
     struct Lisp_Save_Value u_save_value;
     struct Lisp_Finalizer u_finalizer;
+#ifdef HAVE_MODULES
+    struct Lisp_User_Ptr u_user_ptr;
+#endif
   };
 
 INLINE union Lisp_Misc *
@@ -2314,6 +2365,15 @@ XFINALIZER (Lisp_Object a)
   return & XMISC (a)->u_finalizer;
 }
 
+#ifdef HAVE_MODULES
+INLINE struct Lisp_User_Ptr *
+XUSER_PTR (Lisp_Object a)
+{
+  eassert (USER_PTRP (a));
+  return & XMISC (a)->u_user_ptr;
+}
+#endif
+
 
 /* Forwarding pointer to an int variable.
    This is allowed only in the value cell of a symbol,
@@ -2598,6 +2658,14 @@ FINALIZERP (Lisp_Object x)
   return MISCP (x) && XMISCTYPE (x) == Lisp_Misc_Finalizer;
 }
 
+#ifdef HAVE_MODULES
+INLINE bool
+USER_PTRP (Lisp_Object x)
+{
+  return MISCP (x) && XMISCTYPE (x) == Lisp_Misc_User_Ptr;
+}
+#endif
+
 INLINE bool
 AUTOLOADP (Lisp_Object x)
 {
@@ -2610,6 +2678,19 @@ BUFFER_OBJFWDP (union Lisp_Fwd *a)
   return XFWDTYPE (a) == Lisp_Fwd_Buffer_Obj;
 }
 
+INLINE bool
+OBJFWDP (union Lisp_Fwd *a)
+{
+  return XFWDTYPE (a) == Lisp_Fwd_Obj;
+}
+
+INLINE struct Lisp_Objfwd *
+XOBJFWD (union Lisp_Fwd *a)
+{
+  eassert (OBJFWDP (a));
+  return &a->u_objfwd;
+}
+
 INLINE bool
 PSEUDOVECTOR_TYPEP (struct vectorlike_header *a, int code)
 {
@@ -2700,6 +2781,18 @@ FRAMEP (Lisp_Object a)
   return PSEUDOVECTORP (a, PVEC_FRAME);
 }
 
+INLINE bool
+KEYWORD_SET_P (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_KEYWORD_SET);
+}
+
+INLINE bool
+MATCH_DATA_P (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_MATCH_DATA);
+}
+
 /* Test for image (image . spec)  */
 INLINE bool
 IMAGEP (Lisp_Object x)
@@ -3082,9 +3175,8 @@ union specbinding
     } bt;
   };
 
-extern union specbinding *specpdl;
-extern union specbinding *specpdl_ptr;
-extern ptrdiff_t specpdl_size;
+/* The specpdl, like the other stacks, belongs to the current thread.  */
+#include "thread.h"
 
 INLINE ptrdiff_t
 SPECPDL_INDEX (void)
@@ -3102,9 +3194,10 @@ SPECPDL_INDEX (void)
    free element since we mostly use it on the deepest handler).
 
    A call like (throw TAG VAL) searches for a catchtag whose `tag_or_ch'
-   member is TAG, and then unbinds to it.  The `val' member is used to
-   hold VAL while the stack is unwound; `val' is returned as the value
-   of the catch form.
+   member is TAG, and then unbinds to it.  A CATCHER_ALL handler
+   catches every throw regardless of its tag; its `val' is then
+   (TAG . VAL).  The `val' member is used to hold VAL while the stack
+   is unwound; `val' is returned as the value of the catch form.
 
    All the other members are concerned with restoring the interpreter
    state.
@@ -3112,7 +3205,7 @@ SPECPDL_INDEX (void)
    Members are volatile if their values need to survive _longjmp when
    a 'struct handler' is a local variable.  */
 
-enum handlertype { CATCHER, CONDITION_CASE };
+enum handlertype { CATCHER, CONDITION_CASE, CATCHER_ALL };
 
 struct handler
 {
@@ -3133,7 +3226,7 @@ struct handler
   /* Most global vars are reset to their value via the specpdl mechanism,
      but a few others are handled by storing their value here.  */
   sys_jmp_buf jmp;
-  EMACS_INT lisp_eval_depth;
+  EMACS_INT f_lisp_eval_depth;
   ptrdiff_t pdlcount;
   int poll_suppress_count;
   int interrupt_input_blocked;
@@ -3154,7 +3247,7 @@ struct handler
   (c)->tag_or_ch = (tag_ch_val);			\
   (c)->val = Qnil;					\
   (c)->next = handlerlist;				\
-  (c)->lisp_eval_depth = lisp_eval_depth;		\
+  (c)->f_lisp_eval_depth = lisp_eval_depth;		\
   (c)->pdlcount = SPECPDL_INDEX ();			\
   (c)->poll_suppress_count = poll_suppress_count;	\
   (c)->interrupt_input_blocked = interrupt_input_blocked;\
@@ -3326,8 +3419,11 @@ set_sub_char_table_contents (Lisp_Object table, ptrdiff_t idx, Lisp_Object val)
 }
 
 /* Defined in data.c.  */
+extern EMACS_INT function_epoch;
+extern Lisp_Object forwarded_local_variables;
 extern Lisp_Object indirect_function (Lisp_Object);
 extern Lisp_Object find_symbol_value (Lisp_Object);
+extern Lisp_Object default_value (Lisp_Object);
 enum Arith_Comparison {
   ARITH_EQUAL,
   ARITH_NOTEQUAL,
@@ -3372,6 +3468,7 @@ extern _Noreturn void args_out_of_range (Lisp_Object, Lisp_Object);
 extern _Noreturn void args_out_of_range_3 (Lisp_Object, Lisp_Object,
 					   Lisp_Object);
 extern Lisp_Object do_symval_forwarding (union Lisp_Fwd *);
+extern int count_one_bits_word (bits_word);
 extern void set_internal (Lisp_Object, Lisp_Object, Lisp_Object, bool);
 extern void syms_of_data (void);
 extern void swap_in_global_binding (struct Lisp_Symbol *);
@@ -3556,6 +3653,9 @@ extern _Noreturn void memory_full (size_t);
 extern _Noreturn void buffer_memory_full (ptrdiff_t);
 extern bool survives_gc_p (Lisp_Object);
 extern void mark_object (Lisp_Object);
+extern void mark_memory (void *, void *);
+extern void mark_stack (char *, char *);
+extern void flush_stack_call_func (void (*) (void *), void *);
 #if defined REL_ALLOC && !defined SYSTEM_MALLOC && !defined HYBRID_MALLOC
 extern void refill_memory_reserve (void);
 #endif
@@ -3565,6 +3665,7 @@ extern Lisp_Object *stack_base;
 extern EMACS_INT consing_since_gc;
 extern EMACS_INT gc_relative_threshold;
 extern EMACS_INT memory_full_cons_threshold;
+extern void maybe_gc_idle (void);
 extern Lisp_Object list1 (Lisp_Object);
 extern Lisp_Object list2 (Lisp_Object, Lisp_Object);
 extern Lisp_Object list3 (Lisp_Object, Lisp_Object, Lisp_Object);
@@ -3709,6 +3810,9 @@ extern Lisp_Object make_save_ptr_ptr (void *, void *);
 extern Lisp_Object make_save_funcptr_ptr_obj (void (*) (void), void *,
 					      Lisp_Object);
 extern Lisp_Object make_save_memory (Lisp_Object *, ptrdiff_t);
+#ifdef HAVE_MODULES
+extern Lisp_Object make_user_ptr (void (*finalizer) (void *), void *p);
+#endif
 extern void free_save_value (Lisp_Object);
 extern Lisp_Object build_overlay (Lisp_Object, Lisp_Object, Lisp_Object);
 extern void free_marker (Lisp_Object);
@@ -3777,6 +3881,8 @@ extern ptrdiff_t evxprintf (char **, ptrdiff_t *, char const *, ptrdiff_t,
 
 /* Defined in lread.c.  */
 extern Lisp_Object check_obarray (Lisp_Object);
+extern Lisp_Object obarray_buckets (Lisp_Object);
+extern void inhibit_obarray_growth (void);
 extern Lisp_Object intern_1 (const char *, ptrdiff_t);
 extern Lisp_Object intern_c_string_1 (const char *, ptrdiff_t);
 extern Lisp_Object intern_driver (Lisp_Object, Lisp_Object, Lisp_Object);
@@ -3811,12 +3917,10 @@ intern_c_string (const char *str)
 }
 
 /* Defined in eval.c.  */
-extern EMACS_INT lisp_eval_depth;
 extern Lisp_Object Vautoload_queue;
 extern Lisp_Object Vrun_hooks;
 extern Lisp_Object Vsignaling_function;
 extern Lisp_Object inhibit_lisp_code;
-extern struct handler *handlerlist;
 
 /* To run a normal hook, use the appropriate function from the list below.
    The calling convention:
@@ -3876,10 +3980,19 @@ extern Lisp_Object safe_call (ptrdiff_t, Lisp_Object, ...);
 extern Lisp_Object safe_call1 (Lisp_Object, Lisp_Object);
 extern Lisp_Object safe_call2 (Lisp_Object, Lisp_Object, Lisp_Object);
 extern void init_eval (void);
+extern void init_handlerlist (void);
+extern void unbind_for_thread_switch (struct thread_state *);
+extern void rebind_for_thread_switch (void);
 extern void syms_of_eval (void);
 extern void unwind_body (Lisp_Object);
-extern ptrdiff_t record_in_backtrace (Lisp_Object, Lisp_Object *, ptrdiff_t);
-extern void mark_specpdl (void);
+extern void grow_specpdl_allocation (void);
+extern void lisp_eval_depth_exceeded (void);
+extern void funcall_debug_on_call (ptrdiff_t);
+extern Lisp_Object funcall_debug_on_exit (Lisp_Object);
+extern bool replace_funcall (ptrdiff_t, Lisp_Object *);
+extern Lisp_Object funcall_subr (struct Lisp_Subr *, ptrdiff_t, Lisp_Object *);
+extern Lisp_Object funcall_general (Lisp_Object, ptrdiff_t, Lisp_Object *);
+extern void mark_specpdl (union specbinding *, union specbinding *);
 extern void get_backtrace (Lisp_Object array);
 Lisp_Object backtrace_top_function (void);
 extern bool let_shadows_buffer_binding_p (struct Lisp_Symbol *symbol);
@@ -3952,6 +4065,11 @@ extern Lisp_Object make_temp_name (Lisp_Object, bool);
 
 /* Defined in search.c.  */
 extern void shrink_regexp_cache (void);
+extern void mark_regexp_cache (void);
+struct Lisp_Keyword_Set;
+extern void finalize_keyword_set (struct Lisp_Keyword_Set *);
+struct Lisp_Match_Data;
+extern void finalize_match_data (struct Lisp_Match_Data *);
 extern void restore_search_regs (void);
 extern void record_unwind_save_match_data (void);
 struct re_registers;
@@ -4160,8 +4278,9 @@ extern int read_bytecode_char (bool);
 
 /* Defined in bytecode.c.  */
 extern void syms_of_bytecode (void);
-extern struct byte_stack *byte_stack_list;
-extern void relocate_byte_stack (void);
+extern void restore_byte_stack (struct byte_stack *);
+extern void mark_byte_stack (struct thread_state *);
+extern void relocate_byte_stack (struct thread_state *);
 extern Lisp_Object exec_byte_code (Lisp_Object, Lisp_Object, Lisp_Object,
 				   Lisp_Object, ptrdiff_t, Lisp_Object *);
 
@@ -4318,6 +4437,15 @@ extern void xml_cleanup_parser (void);
 extern void syms_of_decompress (void);
 #endif
 
+#ifdef HAVE_MODULES
+/* Defined in module.c.  */
+extern Lisp_Object Fmodule_load (Lisp_Object);
+extern void mark_modules (void);
+struct emacs_env_private;
+extern void mark_module_environments (struct emacs_env_private *);
+extern void syms_of_module (void);
+#endif
+
 #ifdef HAVE_DBUS
 /* Defined in dbusbind.c.  */
 void init_dbusbind (void);
@@ -4328,6 +4456,10 @@ void syms_of_dbusbind (void);
 /* Defined in profiler.c.  */
 extern bool profiler_memory_running;
 extern void malloc_probe (size_t);
+extern bool profiler_byte_code_running;
+extern EMACS_INT byte_code_log_epoch;
+extern Lisp_Object byte_code_log_entry (Lisp_Object);
+extern void byte_code_call_probe (Lisp_Object, ptrdiff_t, Lisp_Object);
 extern void syms_of_profiler (void);
 
 
@@ -4602,6 +4734,72 @@ maybe_gc (void)
     Fgarbage_collect ();
 }
 
+/* Push a backtrace record for a call to FUNCTION with the NARGS
+   arguments at ARGS, or with the unevaluated argument list *ARGS if
+   NARGS is UNEVALLED.  Return its specpdl index.  */
+
+INLINE ptrdiff_t
+record_in_backtrace (Lisp_Object function, Lisp_Object *args, ptrdiff_t nargs)
+{
+  ptrdiff_t count = SPECPDL_INDEX ();
+
+  eassert (nargs >= UNEVALLED);
+  specpdl_ptr->bt.kind = SPECPDL_BACKTRACE;
+  specpdl_ptr->bt.debug_on_exit = false;
+  specpdl_ptr->bt.function = function;
+  specpdl_ptr->bt.args = args;
+  specpdl_ptr->bt.nargs = nargs;
+  if (++specpdl_ptr == specpdl + specpdl_size)
+    grow_specpdl_allocation ();
+
+  return count;
+}
+
+/* Do the bookkeeping for calling the function ARGS[0] with the
+   NARGS - 1 arguments that follow it: check the nesting depth, record
+   the call in the backtrace, and give the garbage collector and the
+   debugger a chance to run.  Return the specpdl index of the
+   backtrace record, to be passed to end_funcall when the call
+   returns.  This is inline because every call from Lisp goes through
+   it; the rare cases are handled out of line.  */
+
+INLINE ptrdiff_t
+begin_funcall (ptrdiff_t nargs, Lisp_Object *args)
+{
+  ptrdiff_t count;
+
+  QUIT;
+
+  if (++lisp_eval_depth > max_lisp_eval_depth)
+    lisp_eval_depth_exceeded ();
+
+  count = record_in_backtrace (args[0], &args[1], nargs - 1);
+
+  maybe_gc ();
+
+  if (debug_on_next_call)
+    funcall_debug_on_call (count);
+
+  check_cons_list ();
+
+  return count;
+}
+
+/* Undo the bookkeeping of begin_funcall, whose value was COUNT, for a
+   call that returned VAL.  Return VAL, or the value of the debugger
+   if the call was marked for entering it on exit.  */
+
+INLINE Lisp_Object
+end_funcall (ptrdiff_t count, Lisp_Object val)
+{
+  check_cons_list ();
+  lisp_eval_depth--;
+  if (specpdl[count].bt.debug_on_exit)
+    val = funcall_debug_on_exit (val);
+  specpdl_ptr--;
+  return val;
+}
+
 INLINE bool
 functionp (Lisp_Object object)
 {
@@ -975,6 +975,19 @@ This uses the variables `load-suffixes' and `load-file-rep-suffixes'.  */)
   return Fnreverse (lst);
 }
 
+#ifdef HAVE_MODULES
+/* Return true if STRING ends with SUFFIX.  */
+static bool
+suffix_p (Lisp_Object string, const char *suffix)
+{
+  ptrdiff_t suffix_len = strlen (suffix);
+  ptrdiff_t string_len = SBYTES (string);
+
+  return (suffix_len <= string_len
+	  && !strcmp (SSDATA (string) + string_len - suffix_len, suffix));
+}
+#endif
+
 DEFUN ("load", Fload, Sload, 1, 5, 0,
        doc: /* Execute a file of Lisp code named FILE.
 First try FILE with `.elc' appended, then try with `.el',
@@ -1081,6 +1094,10 @@ Return t if the file exists and loads successfully.  */)
 	  else if (size > 4
 		   && !strcmp (SSDATA (file) + size - 4, ".elc"))
 	    must_suffix = Qnil;
+#ifdef HAVE_MODULES
+	  else if (suffix_p (file, MODULES_SUFFIX))
+	    must_suffix = Qnil;
+#endif
 	  /* Don't insist on adding a suffix
 	     if the argument includes a directory name.  */
 	  else if (! NILP (Ffile_name_directory (file)))
@@ -1189,6 +1206,35 @@ Return t if the file exists and loads successfully.  */)
   specbind (Qold_style_backquotes, Qnil);
   record_unwind_protect (load_warn_old_style_backquotes, file);
 
+#ifdef HAVE_MODULES
+  if (suffix_p (found, MODULES_SUFFIX))
+    {
+      /* Modules are mapped by the dynamic linker rather than read,
+	 so there is no need to keep FD open.  */
+      if (fd >= 0)
+	{
+	  emacs_close (fd);
+	  clear_unwind_protect (fd_index);
+	}
+
+      if (NILP (nomessage) || force_load_messages)
+	message_with_string ("Loading %s (module)...", file, 1);
+
+      specbind (Qload_file_name, found);
+      specbind (Qload_in_progress, Qt);
+      Fmodule_load (found);
+      unbind_to (count, Qnil);
+
+      if (!NILP (Ffboundp (Qdo_after_load_evaluation)))
+	call1 (Qdo_after_load_evaluation, hist_file_name);
+
+      if (!noninteractive && (NILP (nomessage) || force_load_messages))
+	message_with_string ("Loading %s (module)...done", file, 1);
+
+      return Qt;
+    }
+#endif
+
   if (!memcmp (SDATA (found) + SBYTES (found) - 4, ".elc", 4)
       || (fd >= 0 && (version = safe_to_load_version (fd)) > 0))
     /* Load .elc files directly, but not when they are
@@ -3687,12 +3733,38 @@ read_list (bool flag, Lisp_Object readcharfun)
     }
 }
 
+/* An obarray is a vector used as a hash table of symbols.  Each
+   element is a bucket: either 0, or the first of a chain of symbols
+   linked through their `next' fields.  Lisp programs create obarrays
+   with `make-vector', so an obarray's size says nothing about how
+   many symbols it will hold.  Once one of its chains gets long, an
+   obarray therefore grows: its symbols move to a larger vector of
+   buckets, the first element of the obarray becomes a cons
+   (BUCKETS . COUNT) of that vector and the number of symbols, and the
+   other elements become 0.  The obarray keeps its identity, so every
+   reference to it stays valid; and filling it with 0 still empties
+   it.  */
+
 static Lisp_Object initial_obarray;
 
 /* `oblookup' stores the bucket number here, for the sake of Funintern.  */
 
 static size_t oblookup_last_bucket_number;
 
+/* Grow an obarray when it has more than this many symbols per bucket.  */
+
+#define OBARRAY_MAX_LOAD 2
+
+/* Grow an obarray that does not count its symbols yet when a symbol
+   is added to a chain longer than this.  */
+
+#define OBARRAY_MAX_CHAIN 8
+
+/* Positive while some code is iterating over the buckets of an
+   obarray; growing an obarray then would make it miss symbols.  */
+
+static int obarray_growth_inhibited;
+
 /* Get an error if OBARRAY is not an obarray.
    If it is one, return it.  */
 
@@ -3708,27 +3780,151 @@ check_obarray (Lisp_Object obarray)
   return obarray;
 }
 
+/* Return the vector holding the buckets of OBARRAY.  */
+
+Lisp_Object
+obarray_buckets (Lisp_Object obarray)
+{
+  Lisp_Object first = AREF (obarray, 0);
+  return CONSP (first) ? XCAR (first) : obarray;
+}
+
+/* Return the hash code of the symbol name of SIZE_BYTE bytes at PTR.  */
+
+static unsigned int
+obarray_hash (const char *ptr, ptrdiff_t size_byte)
+{
+  return hash_string (ptr, size_byte);
+}
+
+static void
+allow_obarray_growth (void)
+{
+  obarray_growth_inhibited--;
+}
+
+/* Keep all obarrays from growing until the current binding context
+   is unwound.  Call this before iterating over the buckets of an
+   obarray with code that might intern symbols.  */
+
+void
+inhibit_obarray_growth (void)
+{
+  obarray_growth_inhibited++;
+  record_unwind_protect_void (allow_obarray_growth);
+}
+
+/* Move the COUNT symbols of OBARRAY to a larger vector of buckets.  */
+
+static void
+grow_obarray (Lisp_Object obarray, EMACS_INT count)
+{
+  Lisp_Object old = obarray_buckets (obarray);
+  ptrdiff_t oldsize = ASIZE (old);
+  EMACS_INT size = max (count, 2 * oldsize) | 1;
+  Lisp_Object first = AREF (obarray, 0);
+  Lisp_Object buckets;
+  ptrdiff_t i;
+
+  if (size > MOST_POSITIVE_FIXNUM)
+    return;
+  buckets = Fmake_vector (make_number (size), make_number (0));
+  if (!CONSP (first))
+    first = Fcons (buckets, make_number (count));
+
+  /* Nothing below allocates, so the garbage collector never sees
+     the obarray half rehashed.  */
+  for (i = 0; i < oldsize; i++)
+    {
+      Lisp_Object tail = AREF (old, i);
+
+      while (SYMBOLP (tail))
+	{
+	  struct Lisp_Symbol *next = XSYMBOL (tail)->next;
+	  Lisp_Object *ptr = aref_addr (buckets,
+					XSYMBOL (tail)->hash % size);
+
+	  set_symbol_next (tail, SYMBOLP (*ptr) ? XSYMBOL (*ptr) : NULL);
+	  *ptr = tail;
+	  if (!next)
+	    break;
+	  XSETSYMBOL (tail, next);
+	}
+    }
+
+  if (EQ (old, obarray))
+    for (i = 1; i < oldsize; i++)
+      ASET (obarray, i, make_number (0));
+  XSETCAR (first, buckets);
+  ASET (obarray, 0, first);
+}
+
+/* Note that SYM has just been added to OBARRAY, as the first symbol
+   of its chain, and grow OBARRAY if it is getting crowded.  */
+
+static void
+obarray_note_insertion (Lisp_Object obarray, Lisp_Object sym)
+{
+  Lisp_Object first = AREF (obarray, 0);
+
+  if (CONSP (first))
+    {
+      EMACS_INT count = XINT (XCDR (first)) + 1;
+
+      XSETCDR (first, make_number (count));
+      if (count > OBARRAY_MAX_LOAD * ASIZE (XCAR (first))
+	  && !obarray_growth_inhibited)
+	grow_obarray (obarray, count);
+    }
+  else if (!obarray_growth_inhibited)
+    {
+      struct Lisp_Symbol *p = XSYMBOL (sym);
+      int length = 0;
+      EMACS_INT count = 0;
+      ptrdiff_t i;
+
+      while ((p = p->next) && length <= OBARRAY_MAX_CHAIN)
+	length++;
+      if (length <= OBARRAY_MAX_CHAIN)
+	return;
+
+      /* Count the symbols once; from now on, OBARRAY keeps count.  */
+      for (i = ASIZE (obarray) - 1; i >= 0; i--)
+	{
+	  Lisp_Object tail = AREF (obarray, i);
+
+	  if (SYMBOLP (tail))
+	    for (p = XSYMBOL (tail); p; p = p->next)
+	      count++;
+	}
+      grow_obarray (obarray, count);
+    }
+}
+
 /* Intern symbol SYM in OBARRAY using bucket INDEX.  */
 
 static Lisp_Object
 intern_sym (Lisp_Object sym, Lisp_Object obarray, Lisp_Object index)
 {
   Lisp_Object *ptr;
+  Lisp_Object name = SYMBOL_NAME (sym);
 
   XSYMBOL (sym)->interned = (EQ (obarray, initial_obarray)
 			     ? SYMBOL_INTERNED_IN_INITIAL_OBARRAY
 			     : SYMBOL_INTERNED);
 
-  if (SREF (SYMBOL_NAME (sym), 0) == ':' && EQ (obarray, initial_obarray))
+  if (SREF (name, 0) == ':' && EQ (obarray, initial_obarray))
     {
       XSYMBOL (sym)->constant = 1;
       XSYMBOL (sym)->redirect = SYMBOL_PLAINVAL;
       SET_SYMBOL_VAL (XSYMBOL (sym), sym);
     }
 
-  ptr = aref_addr (obarray, XINT (index));
+  XSYMBOL (sym)->hash = obarray_hash (SSDATA (name), SBYTES (name));
+  ptr = aref_addr (obarray_buckets (obarray), XINT (index));
   set_symbol_next (sym, SYMBOLP (*ptr) ? XSYMBOL (*ptr) : NULL);
   *ptr = sym;
+  obarray_note_insertion (obarray, sym);
   return sym;
 }
 
@@ -3846,6 +4042,7 @@ usage: (unintern NAME OBARRAY)  */)
   (Lisp_Object name, Lisp_Object obarray)
 {
   register Lisp_Object string, tem;
+  Lisp_Object buckets, first;
   size_t hash;
 
   if (NILP (obarray)) obarray = Vobarray;
@@ -3878,23 +4075,24 @@ usage: (unintern NAME OBARRAY)  */)
   XSYMBOL (tem)->interned = SYMBOL_UNINTERNED;
 
   hash = oblookup_last_bucket_number;
+  buckets = obarray_buckets (obarray);
 
-  if (EQ (AREF (obarray, hash), tem))
+  if (EQ (AREF (buckets, hash), tem))
     {
       if (XSYMBOL (tem)->next)
 	{
 	  Lisp_Object sym;
 	  XSETSYMBOL (sym, XSYMBOL (tem)->next);
-	  ASET (obarray, hash, sym);
+	  ASET (buckets, hash, sym);
 	}
       else
-	ASET (obarray, hash, make_number (0));
+	ASET (buckets, hash, make_number (0));
     }
   else
     {
       Lisp_Object tail, following;
 
-      for (tail = AREF (obarray, hash);
+      for (tail = AREF (buckets, hash);
 	   XSYMBOL (tail)->next;
 	   tail = following)
 	{
@@ -3907,6 +4105,10 @@ usage: (unintern NAME OBARRAY)  */)
 	}
     }
 
+  first = AREF (obarray, 0);
+  if (CONSP (first))
+    XSETCDR (first, make_number (XINT (XCDR (first)) - 1));
+
   return Qt;
 }
 
@@ -3920,19 +4122,20 @@ usage: (unintern NAME OBARRAY)  */)
 Lisp_Object
 oblookup (Lisp_Object obarray, register const char *ptr, ptrdiff_t size, ptrdiff_t size_byte)
 {
-  size_t hash;
+  unsigned int hash;
   size_t obsize;
   register Lisp_Object tail;
-  Lisp_Object bucket, tem;
+  Lisp_Object buckets, bucket, tem;
 
   obarray = check_obarray (obarray);
-  obsize = ASIZE (obarray);
+  buckets = obarray_buckets (obarray);
+  obsize = ASIZE (buckets);
 
   /* This is sometimes needed in the middle of GC.  */
   obsize &= ~ARRAY_MARK_FLAG;
-  hash = hash_string (ptr, size_byte) % obsize;
-  bucket = AREF (obarray, hash);
-  oblookup_last_bucket_number = hash;
+  hash = obarray_hash (ptr, size_byte);
+  bucket = AREF (buckets, hash % obsize);
+  oblookup_last_bucket_number = hash % obsize;
   if (EQ (bucket, make_number (0)))
     ;
   else if (!SYMBOLP (bucket))
@@ -3940,23 +4143,29 @@ oblookup (Lisp_Object obarray, register const char *ptr, ptrdiff_t size, ptrdiff
   else
     for (tail = bucket; ; XSETSYMBOL (tail, XSYMBOL (tail)->next))
       {
-	if (SBYTES (SYMBOL_NAME (tail)) == size_byte
+	/* Comparing the cached hash codes first skips most symbols
+	   without looking at their names.  */
+	if (XSYMBOL (tail)->hash == hash
+	    && SBYTES (SYMBOL_NAME (tail)) == size_byte
 	    && SCHARS (SYMBOL_NAME (tail)) == size
 	    && !memcmp (SDATA (SYMBOL_NAME (tail)), ptr, size_byte))
 	  return tail;
 	else if (XSYMBOL (tail)->next == 0)
 	  break;
       }
-  XSETINT (tem, hash);
+  XSETINT (tem, oblookup_last_bucket_number);
   return tem;
 }
-
+
 void
 map_obarray (Lisp_Object obarray, void (*fn) (Lisp_Object, Lisp_Object), Lisp_Object arg)
 {
   ptrdiff_t i;
   register Lisp_Object tail;
-  CHECK_VECTOR (obarray);
+  ptrdiff_t count = SPECPDL_INDEX ();
+
+  obarray = obarray_buckets (check_obarray (obarray));
+  inhibit_obarray_growth ();
   for (i = ASIZE (obarray) - 1; i >= 0; i--)
     {
       tail = AREF (obarray, i);
@@ -3969,6 +4178,7 @@ map_obarray (Lisp_Object obarray, void (*fn) (Lisp_Object, Lisp_Object), Lisp_Ob
 	    XSETSYMBOL (tail, XSYMBOL (tail)->next);
 	  }
     }
+  unbind_to (count, Qnil);
 }
 
 static void
@@ -4491,8 +4701,21 @@ and without trailing slashes.  */);
 This list should not include the empty string.
 `load' and related functions try to append these suffixes, in order,
 to the specified file name if a Lisp suffix is allowed or required.  */);
+#ifdef HAVE_MODULES
+  Vload_suffixes = list3 (build_pure_c_string (".elc"),
+			  build_pure_c_string (MODULES_SUFFIX),
+			  build_pure_c_string (".el"));
+#else
   Vload_suffixes = list2 (build_pure_c_string (".elc"),
 			  build_pure_c_string (".el"));
+#endif
+  DEFVAR_LISP ("module-file-suffix", Vmodule_file_suffix,
+	       doc: /* Suffix of loadable module file, or nil if modules are not supported.  */);
+#ifdef HAVE_MODULES
+  Vmodule_file_suffix = build_pure_c_string (MODULES_SUFFIX);
+#else
+  Vmodule_file_suffix = Qnil;
+#endif
   DEFVAR_LISP ("load-file-rep-suffixes", Vload_file_rep_suffixes,
 	       doc: /* List of suffixes that indicate representations of \
 the same file.
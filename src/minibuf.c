@@ -1187,6 +1187,7 @@ is used to further constrain the set of candidates.  */)
   ptrdiff_t idx = 0, obsize = 0;
   int matchcount = 0;
   ptrdiff_t bindcount = -1;
+  ptrdiff_t count = SPECPDL_INDEX ();
   Lisp_Object bucket, zero, end, tem;
 
   CHECK_STRING (string);
@@ -1200,9 +1201,11 @@ is used to further constrain the set of candidates.  */)
   tail = collection;
   if (type == obarray_table)
     {
-      collection = check_obarray (collection);
+      collection = obarray_buckets (check_obarray (collection));
       obsize = ASIZE (collection);
       bucket = AREF (collection, idx);
+      /* A predicate that interns symbols must not move them.  */
+      inhibit_obarray_growth ();
     }
 
   while (1)
@@ -1380,6 +1383,7 @@ is used to further constrain the set of candidates.  */)
     unbind_to (bindcount, Qnil);
     bindcount = -1;
   }
+  unbind_to (count, Qnil);
 
   if (NILP (bestmatch))
     return Qnil;		/* No completions found.  */
@@ -1441,6 +1445,7 @@ with a space are ignored unless STRING itself starts with a space.  */)
     : NILP (collection) || (CONSP (collection) && !FUNCTIONP (collection));
   ptrdiff_t idx = 0, obsize = 0;
   ptrdiff_t bindcount = -1;
+  ptrdiff_t count = SPECPDL_INDEX ();
   Lisp_Object bucket, tem, zero;
 
   CHECK_STRING (string);
@@ -1453,9 +1458,11 @@ with a space are ignored unless STRING itself starts with a space.  */)
   tail = collection;
   if (type == 2)
     {
-      collection = check_obarray (collection);
+      collection = obarray_buckets (check_obarray (collection));
       obsize = ASIZE (collection);
       bucket = AREF (collection, idx);
+      /* A predicate that interns symbols must not move them.  */
+      inhibit_obarray_growth ();
     }
 
   while (1)
@@ -1575,6 +1582,7 @@ with a space are ignored unless STRING itself starts with a space.  */)
     unbind_to (bindcount, Qnil);
     bindcount = -1;
   }
+  unbind_to (count, Qnil);
 
   return Fnreverse (allmatches);
 }
@@ -1688,9 +1696,11 @@ the values STRING, PREDICATE and `lambda'.  */)
 
       if (completion_ignore_case && !SYMBOLP (tem))
 	{
-	  for (i = ASIZE (collection) - 1; i >= 0; i--)
+	  Lisp_Object buckets = obarray_buckets (collection);
+
+	  for (i = ASIZE (buckets) - 1; i >= 0; i--)
 	    {
-	      tail = AREF (collection, i);
+	      tail = AREF (buckets, i);
 	      if (SYMBOLP (tail))
 		while (1)
 		  {
@@ -0,0 +1,932 @@
+/* module.c - Module loading and runtime implementation
+
+Copyright (C) 2015 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#include <config.h>
+
+#ifdef HAVE_MODULES
+
+#include "emacs-module.h"
+
+#include <dlfcn.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "lisp.h"
+#include "blockinput.h"
+#include "commands.h"
+#include "keyboard.h"
+#include "dispextern.h"
+#include "character.h"
+#include "buffer.h"
+#include "coding.h"
+
+#include <verify.h>
+
+
+/* Feature tests.  */
+
+enum
+  {
+    /* 1 if we have __attribute__((cleanup(...))), 0 otherwise.  */
+    module_has_cleanup =
+#ifdef __GNUC__
+    1
+#else
+    0
+#endif
+  };
+
+/* Module code may only reach Lisp values through emacs_value handles,
+   and those handles must stay valid even when GC runs, so every
+   handle points into memory that `mark_modules' knows about.  */
+
+/* A single Lisp value, as seen by modules.  */
+struct emacs_value_tag { Lisp_Object v; };
+
+/* Values created by an environment are stored in a chain of frames
+   that lives as long as the environment does.  */
+enum { value_frame_size = 512 };
+
+struct emacs_value_frame
+{
+  struct emacs_value_tag objects[value_frame_size];
+
+  /* Index of the next free value in `objects'.  */
+  int offset;
+
+  /* Pointer to the next frame, if any.  */
+  struct emacs_value_frame *next;
+};
+
+/* A global reference, created by `make_global_ref'.  The value must
+   be the first member so that an emacs_value can be converted back
+   to the reference that contains it.  */
+struct module_global_ref
+{
+  struct emacs_value_tag value;
+  struct module_global_ref *prev, *next;
+};
+
+/* Private runtime and environment members.  */
+
+struct emacs_env_private
+{
+  enum emacs_funcall_exit pending_non_local_exit;
+
+  /* Dedicated storage for non-local exit symbol and data so that
+     storage is always available for them, even in an out-of-memory
+     situation.  */
+  struct emacs_value_tag non_local_exit_symbol, non_local_exit_data;
+
+  /* The first value frame is part of the environment itself; further
+     frames are allocated on demand.  */
+  struct emacs_value_frame initial;
+  struct emacs_value_frame *current;
+
+  /* The next outer live environment.  */
+  struct emacs_env_private *outer;
+};
+
+/* The private part of a runtime object contains the environment that
+   `get_environment' hands out.  */
+struct emacs_runtime_private
+{
+  emacs_env pub;
+};
+
+/* A module function, as created by `make_function'.  */
+struct module_fun_env
+{
+  ptrdiff_t min_arity, max_arity;
+  emacs_subr subr;
+  void *data;
+};
+
+/* All global references, in a doubly-linked list headed by this
+   sentinel.  */
+static struct module_global_ref global_refs =
+  { { 0 }, &global_refs, &global_refs };
+
+/* Value that is returned when a function fails.  Modules must not
+   dereference it; it is only used to have a non-NULL return value.  */
+static struct emacs_value_tag module_nil_storage;
+static emacs_value const module_nil = &module_nil_storage;
+
+static void initialize_environment (emacs_env *, struct emacs_env_private *);
+static void finalize_environment (struct emacs_env_private *);
+static void finalize_environment_unwind (void *);
+static Lisp_Object finish_environment (emacs_env *, ptrdiff_t, emacs_value);
+
+static enum emacs_funcall_exit module_non_local_exit_check (emacs_env *);
+static void module_handle_signal (emacs_env *, Lisp_Object);
+static void module_handle_throw (emacs_env *, Lisp_Object);
+static void module_non_local_exit_signal_1 (emacs_env *, Lisp_Object,
+					    Lisp_Object);
+static void module_non_local_exit_throw_1 (emacs_env *, Lisp_Object,
+					   Lisp_Object);
+static void module_out_of_memory (emacs_env *);
+static void module_reset_handlerlist (const int *);
+
+static Lisp_Object value_to_lisp (emacs_value);
+static emacs_value lisp_to_value (emacs_env *, Lisp_Object);
+
+
+/* Convenience macros for non-local exit handling.  */
+
+/* Emacs uses setjmp and longjmp for non-local exits, but
+   module frames cannot be skipped because they are in general
+   not prepared for long jumps (e.g., the behavior in C++ is undefined
+   if objects with nontrivial destructors would be skipped).
+   Therefore, catch all non-local exits.  There are two kinds of
+   non-local exits: `signal' and `throw'.  The macros in this section
+   can be used to catch both.  Use macros to avoid additional variants
+   of `internal_condition_case' etc., and to avoid worrying about
+   passing information to the handler functions.  */
+
+/* Place this macro at the beginning of a function returning a number
+   or a pointer to handle non-local exits.  The function must have an
+   ENV parameter.  The function will return the specified value if a
+   signal or throw is caught.  */
+#define MODULE_HANDLE_NONLOCAL_EXIT(retval)                     \
+  MODULE_SETJMP (CONDITION_CASE, module_handle_signal, retval); \
+  MODULE_SETJMP (CATCHER_ALL, module_handle_throw, retval)
+
+#define MODULE_SETJMP(handlertype, handlerfunc, retval)			\
+  MODULE_SETJMP_1 (handlertype, handlerfunc, retval,			\
+		   internal_handler_##handlertype,			\
+		   internal_cleanup_##handlertype)
+
+/* It is very important that pushing the handler doesn't itself raise
+   a signal.  Install the cleanup only after the handler has been
+   pushed.  Use __attribute__ ((cleanup)) to avoid
+   non-local-exit-prone manual cleanup.
+
+   The do-while forces uses of the macro to be followed by a semicolon.
+   This macro cannot enclose its entire body inside a do-while, as the
+   code after the macro may longjmp back into the macro, which means
+   its local variable C must stay live in later code.  */
+
+#define MODULE_SETJMP_1(handlertype, handlerfunc, retval, c, dummy)	\
+  eassert (module_non_local_exit_check (env)				\
+	   == emacs_funcall_exit_return);				\
+  struct handler *c;							\
+  PUSH_HANDLER (c, Qt, handlertype);					\
+  int dummy __attribute__ ((cleanup (module_reset_handlerlist)));	\
+  if (sys_setjmp (c->jmp))						\
+    {									\
+      (handlerfunc) (env, c->val);					\
+      return retval;							\
+    }									\
+  do { } while (false)
+
+/* Prologue of all module functions that may run Lisp code or
+   allocate.  Functions that can't do either don't need to catch
+   anything.  */
+#define MODULE_FUNCTION_BEGIN(error_retval)				\
+  if (module_non_local_exit_check (env) != emacs_funcall_exit_return)	\
+    return error_retval;						\
+  MODULE_HANDLE_NONLOCAL_EXIT (error_retval)
+
+verify (module_has_cleanup);
+
+
+/* Implementation of runtime and environment functions.
+
+   These should abide by the following rules:
+
+   1. The first argument should always be a pointer to emacs_env.
+
+   2. Each function should first call MODULE_FUNCTION_BEGIN unless it
+      can neither signal nor allocate.
+
+   3. Each function should return a value as if nothing had happened
+      when a non-local exit is pending.  */
+
+static emacs_env *
+module_get_environment (struct emacs_runtime *ert)
+{
+  return &ert->private_members->pub;
+}
+
+static emacs_value
+module_make_global_ref (emacs_env *env, emacs_value ref)
+{
+  MODULE_FUNCTION_BEGIN (NULL);
+  struct module_global_ref *global = xmalloc (sizeof *global);
+  global->value.v = value_to_lisp (ref);
+  global->next = global_refs.next;
+  global->prev = &global_refs;
+  global_refs.next->prev = global;
+  global_refs.next = global;
+  return &global->value;
+}
+
+static void
+module_free_global_ref (emacs_env *env, emacs_value ref)
+{
+  struct module_global_ref *global = (struct module_global_ref *) ref;
+  global->prev->next = global->next;
+  global->next->prev = global->prev;
+  xfree (global);
+}
+
+static enum emacs_funcall_exit
+module_non_local_exit_check (emacs_env *env)
+{
+  return env->private_members->pending_non_local_exit;
+}
+
+static void
+module_non_local_exit_clear (emacs_env *env)
+{
+  env->private_members->pending_non_local_exit = emacs_funcall_exit_return;
+}
+
+static enum emacs_funcall_exit
+module_non_local_exit_get (emacs_env *env, emacs_value *sym, emacs_value *data)
+{
+  struct emacs_env_private *p = env->private_members;
+  if (p->pending_non_local_exit != emacs_funcall_exit_return)
+    {
+      *sym = &p->non_local_exit_symbol;
+      *data = &p->non_local_exit_data;
+    }
+  return p->pending_non_local_exit;
+}
+
+/* Like for `signal', DATA must be a list.  */
+static void
+module_non_local_exit_signal (emacs_env *env, emacs_value sym, emacs_value data)
+{
+  if (module_non_local_exit_check (env) == emacs_funcall_exit_return)
+    module_non_local_exit_signal_1 (env, value_to_lisp (sym),
+				    value_to_lisp (data));
+}
+
+static void
+module_non_local_exit_throw (emacs_env *env, emacs_value tag, emacs_value value)
+{
+  if (module_non_local_exit_check (env) == emacs_funcall_exit_return)
+    module_non_local_exit_throw_1 (env, value_to_lisp (tag),
+				   value_to_lisp (value));
+}
+
+/* A module function is a Lisp lambda that calls
+   `internal--module-call' with a save-value pointing at the function's
+   `module_fun_env' as first argument:
+
+   (lambda (&rest args) DOC (apply #'internal--module-call ENVOBJ args))
+
+   The `module_fun_env' is never freed, because the lambda might be
+   copied anywhere.  */
+
+static emacs_value
+module_make_function (emacs_env *env, ptrdiff_t min_arity, ptrdiff_t max_arity,
+		      emacs_subr subr, const char *documentation,
+		      void *data)
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+
+  if (! (0 <= min_arity
+	 && (max_arity < 0
+	     ? max_arity == emacs_variadic_function
+	     : min_arity <= max_arity)))
+    xsignal2 (Qinvalid_arity, make_number (min_arity),
+	      make_number (max_arity));
+
+  struct module_fun_env *envptr = xmalloc (sizeof *envptr);
+  envptr->min_arity = min_arity;
+  envptr->max_arity = max_arity;
+  envptr->subr = subr;
+  envptr->data = data;
+
+  Lisp_Object envobj = make_save_ptr (envptr);
+  Lisp_Object doc = (documentation
+		     ? code_convert_string_norecord
+		         (build_unibyte_string (documentation), Qutf_8, false)
+		     : Qnil);
+  Lisp_Object ret = list4 (Qlambda,
+                           list2 (Qand_rest, Qargs),
+                           doc,
+                           list4 (Qapply,
+                                  list2 (Qfunction, Qinternal_module_call),
+                                  envobj,
+                                  Qargs));
+
+  return lisp_to_value (env, ret);
+}
+
+static emacs_value
+module_funcall (emacs_env *env, emacs_value fun, ptrdiff_t nargs,
+		emacs_value args[])
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+
+  /* Make a new Lisp_Object array starting with the function as the
+     first arg, because that's what Ffuncall takes.  */
+  Lisp_Object *newargs;
+  USE_SAFE_ALLOCA;
+  if (nargs == PTRDIFF_MAX)
+    xsignal0 (Qoverflow_error);
+  SAFE_ALLOCA_LISP (newargs, nargs + 1);
+  newargs[0] = value_to_lisp (fun);
+  for (ptrdiff_t i = 0; i < nargs; i++)
+    newargs[1 + i] = value_to_lisp (args[i]);
+  emacs_value result = lisp_to_value (env, Ffuncall (nargs + 1, newargs));
+  SAFE_FREE ();
+  return result;
+}
+
+static emacs_value
+module_intern (emacs_env *env, const char *name)
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+  return lisp_to_value (env, intern (name));
+}
+
+static emacs_value
+module_type_of (emacs_env *env, emacs_value value)
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+  return lisp_to_value (env, Ftype_of (value_to_lisp (value)));
+}
+
+static bool
+module_is_not_nil (emacs_env *env, emacs_value value)
+{
+  return ! NILP (value_to_lisp (value));
+}
+
+static bool
+module_eq (emacs_env *env, emacs_value a, emacs_value b)
+{
+  return EQ (value_to_lisp (a), value_to_lisp (b));
+}
+
+static intmax_t
+module_extract_integer (emacs_env *env, emacs_value n)
+{
+  MODULE_FUNCTION_BEGIN (0);
+  Lisp_Object l = value_to_lisp (n);
+  CHECK_NUMBER (l);
+  return XINT (l);
+}
+
+static emacs_value
+module_make_integer (emacs_env *env, intmax_t n)
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+  if (! (MOST_NEGATIVE_FIXNUM <= n && n <= MOST_POSITIVE_FIXNUM))
+    xsignal0 (Qoverflow_error);
+  return lisp_to_value (env, make_number (n));
+}
+
+static double
+module_extract_float (emacs_env *env, emacs_value f)
+{
+  MODULE_FUNCTION_BEGIN (0);
+  Lisp_Object lisp = value_to_lisp (f);
+  CHECK_TYPE (FLOATP (lisp), Qfloatp, lisp);
+  return XFLOAT_DATA (lisp);
+}
+
+static emacs_value
+module_make_float (emacs_env *env, double d)
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+  return lisp_to_value (env, make_float (d));
+}
+
+static bool
+module_copy_string_contents (emacs_env *env, emacs_value value, char *buffer,
+			     ptrdiff_t *length)
+{
+  MODULE_FUNCTION_BEGIN (false);
+  Lisp_Object lisp_str = value_to_lisp (value);
+  CHECK_STRING (lisp_str);
+
+  Lisp_Object lisp_str_utf8 = ENCODE_UTF_8 (lisp_str);
+  ptrdiff_t raw_size = SBYTES (lisp_str_utf8);
+  if (raw_size == PTRDIFF_MAX)
+    xsignal0 (Qoverflow_error);
+  ptrdiff_t required_buf_size = raw_size + 1;
+
+  eassert (length != NULL);
+
+  if (buffer == NULL)
+    {
+      *length = required_buf_size;
+      return true;
+    }
+
+  eassert (*length >= 0);
+
+  if (*length < required_buf_size)
+    {
+      *length = required_buf_size;
+      xsignal0 (Qargs_out_of_range);
+    }
+
+  *length = required_buf_size;
+  memcpy (buffer, SDATA (lisp_str_utf8), raw_size + 1);
+
+  return true;
+}
+
+static emacs_value
+module_make_string (emacs_env *env, const char *str, ptrdiff_t length)
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+  if (! (0 <= length && length <= STRING_BYTES_BOUND))
+    xsignal0 (Qoverflow_error);
+  Lisp_Object lstr = make_unibyte_string (str, length);
+  return lisp_to_value (env,
+			code_convert_string_norecord (lstr, Qutf_8, false));
+}
+
+static emacs_value
+module_make_user_ptr (emacs_env *env, emacs_finalizer_function fin, void *ptr)
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+  return lisp_to_value (env, make_user_ptr (fin, ptr));
+}
+
+static void *
+module_get_user_ptr (emacs_env *env, emacs_value uptr)
+{
+  MODULE_FUNCTION_BEGIN (NULL);
+  Lisp_Object lisp = value_to_lisp (uptr);
+  CHECK_TYPE (USER_PTRP (lisp), Quser_ptrp, lisp);
+  return XUSER_PTR (lisp)->p;
+}
+
+static void
+module_set_user_ptr (emacs_env *env, emacs_value uptr, void *ptr)
+{
+  MODULE_FUNCTION_BEGIN ();
+  Lisp_Object lisp = value_to_lisp (uptr);
+  CHECK_TYPE (USER_PTRP (lisp), Quser_ptrp, lisp);
+  XUSER_PTR (lisp)->p = ptr;
+}
+
+static emacs_finalizer_function
+module_get_user_finalizer (emacs_env *env, emacs_value uptr)
+{
+  MODULE_FUNCTION_BEGIN (NULL);
+  Lisp_Object lisp = value_to_lisp (uptr);
+  CHECK_TYPE (USER_PTRP (lisp), Quser_ptrp, lisp);
+  return XUSER_PTR (lisp)->finalizer;
+}
+
+static void
+module_set_user_finalizer (emacs_env *env, emacs_value uptr,
+			   emacs_finalizer_function fin)
+{
+  MODULE_FUNCTION_BEGIN ();
+  Lisp_Object lisp = value_to_lisp (uptr);
+  CHECK_TYPE (USER_PTRP (lisp), Quser_ptrp, lisp);
+  XUSER_PTR (lisp)->finalizer = fin;
+}
+
+static void
+check_vec_index (Lisp_Object lvec, ptrdiff_t i)
+{
+  CHECK_VECTOR (lvec);
+  if (! (0 <= i && i < ASIZE (lvec)))
+    args_out_of_range_3 (make_fixnum_or_float (i),
+			 make_number (0), make_number (ASIZE (lvec) - 1));
+}
+
+static void
+module_vec_set (emacs_env *env, emacs_value vec, ptrdiff_t i, emacs_value val)
+{
+  MODULE_FUNCTION_BEGIN ();
+  Lisp_Object lvec = value_to_lisp (vec);
+  check_vec_index (lvec, i);
+  ASET (lvec, i, value_to_lisp (val));
+}
+
+static emacs_value
+module_vec_get (emacs_env *env, emacs_value vec, ptrdiff_t i)
+{
+  MODULE_FUNCTION_BEGIN (module_nil);
+  Lisp_Object lvec = value_to_lisp (vec);
+  check_vec_index (lvec, i);
+  return lisp_to_value (env, AREF (lvec, i));
+}
+
+static ptrdiff_t
+module_vec_size (emacs_env *env, emacs_value vec)
+{
+  MODULE_FUNCTION_BEGIN (0);
+  Lisp_Object lvec = value_to_lisp (vec);
+  CHECK_VECTOR (lvec);
+  return ASIZE (lvec);
+}
+
+
+/* Subroutines.  */
+
+DEFUN ("module-load", Fmodule_load, Smodule_load, 1, 1, 0,
+       doc: /* Load module FILE.
+FILE must be the name of a shared library that exports the symbol
+`plugin_is_GPL_compatible' and the function `emacs_module_init', as
+described in emacs-module.h.  Each module is initialized only once per
+session; loading it again just returns t.
+
+Return t if the module was loaded and initialized successfully.  */)
+  (Lisp_Object file)
+{
+  void *handle;
+  emacs_init_function module_init;
+  void *gpl_sym;
+
+  CHECK_STRING (file);
+  file = Fexpand_file_name (file, Qnil);
+  Lisp_Object encoded_file = ENCODE_FILE (file);
+
+  /* RTLD_NOLOAD lets us detect modules that were initialized
+     already.  */
+  bool loaded_before = false;
+#ifdef RTLD_NOLOAD
+  handle = dlopen (SSDATA (encoded_file), RTLD_LAZY | RTLD_NOLOAD);
+  if (handle)
+    {
+      loaded_before = true;
+      dlclose (handle);
+    }
+#endif
+
+  handle = dlopen (SSDATA (encoded_file), RTLD_LAZY);
+  if (!handle)
+    xsignal2 (Qmodule_open_failed, file, build_string (dlerror ()));
+
+  if (loaded_before)
+    return Qt;
+
+  gpl_sym = dlsym (handle, "plugin_is_GPL_compatible");
+  if (!gpl_sym)
+    xsignal1 (Qmodule_not_gpl_compatible, file);
+
+  module_init = (emacs_init_function) dlsym (handle, "emacs_module_init");
+  if (!module_init)
+    xsignal1 (Qmodule_no_init, file);
+
+  ptrdiff_t count = SPECPDL_INDEX ();
+  struct emacs_runtime_private rt;
+  struct emacs_env_private priv;
+  initialize_environment (&rt.pub, &priv);
+  record_unwind_protect_ptr (finalize_environment_unwind, &priv);
+  struct emacs_runtime pub =
+    {
+      .size = sizeof pub,
+      .private_members = &rt,
+      .get_environment = module_get_environment
+    };
+  int r = module_init (&pub);
+
+  if (r != 0)
+    {
+      finish_environment (&rt.pub, count, module_nil);
+      if (! (MOST_NEGATIVE_FIXNUM <= r && r <= MOST_POSITIVE_FIXNUM))
+        xsignal0 (Qoverflow_error);
+      xsignal2 (Qmodule_init_failed, file, make_number (r));
+    }
+
+  finish_environment (&rt.pub, count, module_nil);
+  return Qt;
+}
+
+DEFUN ("internal--module-call", Finternal_module_call, Sinternal_module_call,
+       1, MANY, 0,
+       doc: /* Internal function to call a module function.
+ENVOBJ is a save pointer to a module_fun_env structure.
+ARGLIST is a list of arguments passed to the module function.
+usage: (internal--module-call ENVOBJ &rest ARGLIST)   */)
+  (ptrdiff_t nargs, Lisp_Object *arglist)
+{
+  Lisp_Object envobj = arglist[0];
+  CHECK_TYPE (SAVE_VALUEP (envobj)
+	      && save_type (XSAVE_VALUE (envobj), 0) == SAVE_POINTER,
+	      Qsave_value_p, envobj);
+  struct module_fun_env *envptr = XSAVE_POINTER (envobj, 0);
+  ptrdiff_t len = nargs - 1;
+  eassume (0 <= envptr->min_arity);
+  if (! (envptr->min_arity <= len
+	 && len <= (envptr->max_arity < 0 ? PTRDIFF_MAX : envptr->max_arity)))
+    xsignal2 (Qwrong_number_of_arguments, envobj, make_number (len));
+
+  ptrdiff_t count = SPECPDL_INDEX ();
+  emacs_env pub;
+  struct emacs_env_private priv;
+  initialize_environment (&pub, &priv);
+  record_unwind_protect_ptr (finalize_environment_unwind, &priv);
+
+  emacs_value *args;
+  USE_SAFE_ALLOCA;
+  SAFE_NALLOCA (args, 1, len);
+  for (ptrdiff_t i = 0; i < len; i++)
+    args[i] = lisp_to_value (&pub, arglist[i + 1]);
+
+  emacs_value ret = envptr->subr (&pub, len, args, envptr->data);
+  SAFE_FREE ();
+  return finish_environment (&pub, count, ret);
+}
+
+
+/* Helper functions.  */
+
+/* Environments.  */
+
+static void
+initialize_environment (emacs_env *env, struct emacs_env_private *priv)
+{
+  priv->pending_non_local_exit = emacs_funcall_exit_return;
+  priv->non_local_exit_symbol.v = Qnil;
+  priv->non_local_exit_data.v = Qnil;
+  priv->initial.offset = 0;
+  priv->initial.next = NULL;
+  priv->current = &priv->initial;
+  priv->outer = live_environments;
+  live_environments = priv;
+
+  env->size = sizeof *env;
+  env->private_members = priv;
+  env->make_global_ref = module_make_global_ref;
+  env->free_global_ref = module_free_global_ref;
+  env->non_local_exit_check = module_non_local_exit_check;
+  env->non_local_exit_clear = module_non_local_exit_clear;
+  env->non_local_exit_get = module_non_local_exit_get;
+  env->non_local_exit_signal = module_non_local_exit_signal;
+  env->non_local_exit_throw = module_non_local_exit_throw;
+  env->make_function = module_make_function;
+  env->funcall = module_funcall;
+  env->intern = module_intern;
+  env->type_of = module_type_of;
+  env->is_not_nil = module_is_not_nil;
+  env->eq = module_eq;
+  env->extract_integer = module_extract_integer;
+  env->make_integer = module_make_integer;
+  env->extract_float = module_extract_float;
+  env->make_float = module_make_float;
+  env->copy_string_contents = module_copy_string_contents;
+  env->make_string = module_make_string;
+  env->make_user_ptr = module_make_user_ptr;
+  env->get_user_ptr = module_get_user_ptr;
+  env->set_user_ptr = module_set_user_ptr;
+  env->get_user_finalizer = module_get_user_finalizer;
+  env->set_user_finalizer = module_set_user_finalizer;
+  env->vec_set = module_vec_set;
+  env->vec_get = module_vec_get;
+  env->vec_size = module_vec_size;
+}
+
+/* Free the storage of the environment PRIV and remove it from the
+   list of live environments.  PRIV must be the innermost live
+   environment.  */
+static void
+finalize_environment (struct emacs_env_private *priv)
+{
+  eassert (live_environments == priv);
+  live_environments = priv->outer;
+
+  struct emacs_value_frame *next;
+  for (struct emacs_value_frame *frame = priv->initial.next;
+       frame; frame = next)
+    {
+      next = frame->next;
+      xfree (frame);
+    }
+}
+
+static void
+finalize_environment_unwind (void *priv)
+{
+  finalize_environment (priv);
+}
+
+/* Finish using ENV, whose finalization was recorded at specpdl index
+   COUNT, and either return the Lisp value of RET or propagate the
+   non-local exit that is pending in ENV.  */
+static Lisp_Object
+finish_environment (emacs_env *env, ptrdiff_t count, emacs_value ret)
+{
+  struct emacs_env_private *priv = env->private_members;
+  Lisp_Object symbol, data, value;
+
+  switch (priv->pending_non_local_exit)
+    {
+    case emacs_funcall_exit_return:
+      value = value_to_lisp (ret);
+      return unbind_to (count, value);
+    case emacs_funcall_exit_signal:
+      symbol = priv->non_local_exit_symbol.v;
+      data = priv->non_local_exit_data.v;
+      unbind_to (count, Qnil);
+      xsignal (symbol, data);
+    case emacs_funcall_exit_throw:
+      symbol = priv->non_local_exit_symbol.v;
+      data = priv->non_local_exit_data.v;
+      unbind_to (count, Qnil);
+      Fthrow (symbol, data);
+    default:
+      eassume (false);
+    }
+}
+
+/* Mark all values referenced by the live environment ENVS and the
+   environments outside it, those of one thread.  Called by the
+   garbage collector.  */
+void
+mark_module_environments (struct emacs_env_private *envs)
+{
+  for (struct emacs_env_private *priv = envs; priv; priv = priv->outer)
+    {
+      mark_object (priv->non_local_exit_symbol.v);
+      mark_object (priv->non_local_exit_data.v);
+      for (struct emacs_value_frame *frame = &priv->initial;
+	   frame; frame = frame->next)
+	for (int i = 0; i < frame->offset; i++)
+	  mark_object (frame->objects[i].v);
+    }
+}
+
+/* Mark all values referenced by global references.  Called by the
+   garbage collector.  */
+void
+mark_modules (void)
+{
+  for (struct module_global_ref *global = global_refs.next;
+       global != &global_refs; global = global->next)
+    mark_object (global->value.v);
+}
+
+
+/* Non-local exit handling.  */
+
+/* Called on `signal'.  ERR is a pair (SYMBOL . DATA), which gets
+   stored in the environment.  Set the pending non-local exit flag.  */
+static void
+module_handle_signal (emacs_env *env, Lisp_Object err)
+{
+  module_non_local_exit_signal_1 (env, XCAR (err), XCDR (err));
+}
+
+/* Called on `throw'.  TAG_VAL is a pair (TAG . VALUE), which gets
+   stored in the environment.  Set the pending non-local exit flag.  */
+static void
+module_handle_throw (emacs_env *env, Lisp_Object tag_val)
+{
+  module_non_local_exit_throw_1 (env, XCAR (tag_val), XCDR (tag_val));
+}
+
+static void
+module_non_local_exit_signal_1 (emacs_env *env, Lisp_Object sym,
+				Lisp_Object data)
+{
+  struct emacs_env_private *p = env->private_members;
+  if (p->pending_non_local_exit == emacs_funcall_exit_return)
+    {
+      p->pending_non_local_exit = emacs_funcall_exit_signal;
+      p->non_local_exit_symbol.v = sym;
+      p->non_local_exit_data.v = data;
+    }
+}
+
+static void
+module_non_local_exit_throw_1 (emacs_env *env, Lisp_Object tag,
+			       Lisp_Object value)
+{
+  struct emacs_env_private *p = env->private_members;
+  if (p->pending_non_local_exit == emacs_funcall_exit_return)
+    {
+      p->pending_non_local_exit = emacs_funcall_exit_throw;
+      p->non_local_exit_symbol.v = tag;
+      p->non_local_exit_data.v = value;
+    }
+}
+
+/* The initial value of `memory-signal-data', which stays usable even
+   if Lisp code sets that variable to something else.  */
+static Lisp_Object module_memory_signal_data;
+
+/* Signal an out-of-memory condition to the caller.  */
+static void
+module_out_of_memory (emacs_env *env)
+{
+  module_non_local_exit_signal_1 (env, XCAR (module_memory_signal_data),
+				  XCDR (module_memory_signal_data));
+}
+
+/* Pop the handler pushed by MODULE_SETJMP_1.  Used as a cleanup
+   function, so DUMMY is unused.  */
+static void
+module_reset_handlerlist (const int *dummy)
+{
+  handlerlist = handlerlist->next;
+}
+
+
+/* Value conversion.  */
+
+/* Convert V to the corresponding internal object O, such that
+   V == lisp_to_value_bits (O).  Never fails.  */
+static Lisp_Object
+value_to_lisp (emacs_value v)
+{
+  return v->v;
+}
+
+/* Store O in the value storage of ENV and return a handle to it.  If
+   there is no memory for another frame, set a pending out-of-memory
+   exit and return `module_nil'.  */
+static emacs_value
+lisp_to_value (emacs_env *env, Lisp_Object o)
+{
+  struct emacs_env_private *priv = env->private_members;
+  struct emacs_value_frame *frame = priv->current;
+
+  if (frame->offset == value_frame_size)
+    {
+      struct emacs_value_frame *next = malloc (sizeof *next);
+      if (!next)
+	{
+	  module_out_of_memory (env);
+	  return module_nil;
+	}
+      next->offset = 0;
+      next->next = NULL;
+      frame->next = next;
+      priv->current = frame = next;
+    }
+
+  struct emacs_value_tag *value = &frame->objects[frame->offset];
+  value->v = o;
+  frame->offset++;
+  return value;
+}
+
+
+/* Segment initializer.  */
+
+void
+syms_of_module (void)
+{
+  module_memory_signal_data = Vmemory_signal_data;
+  staticpro (&module_memory_signal_data);
+
+  DEFSYM (Qmodule_open_failed, "module-open-failed");
+  Fput (Qmodule_open_failed, Qerror_conditions,
+        listn (CONSTYPE_PURE, 2, Qmodule_open_failed, Qerror));
+  Fput (Qmodule_open_failed, Qerror_message,
+        build_pure_c_string ("Module could not be opened"));
+
+  DEFSYM (Qmodule_not_gpl_compatible, "module-not-gpl-compatible");
+  Fput (Qmodule_not_gpl_compatible, Qerror_conditions,
+        listn (CONSTYPE_PURE, 2, Qmodule_not_gpl_compatible, Qerror));
+  Fput (Qmodule_not_gpl_compatible, Qerror_message,
+        build_pure_c_string ("Module is not GPL compatible"));
+
+  DEFSYM (Qmodule_no_init, "module-no-init");
+  Fput (Qmodule_no_init, Qerror_conditions,
+        listn (CONSTYPE_PURE, 2, Qmodule_no_init, Qerror));
+  Fput (Qmodule_no_init, Qerror_message,
+        build_pure_c_string ("Module has no init function"));
+
+  DEFSYM (Qmodule_init_failed, "module-init-failed");
+  Fput (Qmodule_init_failed, Qerror_conditions,
+        listn (CONSTYPE_PURE, 2, Qmodule_init_failed, Qerror));
+  Fput (Qmodule_init_failed, Qerror_message,
+        build_pure_c_string ("Module initialization failed"));
+
+  DEFSYM (Qinvalid_arity, "invalid-arity");
+  Fput (Qinvalid_arity, Qerror_conditions,
+        listn (CONSTYPE_PURE, 2, Qinvalid_arity, Qerror));
+  Fput (Qinvalid_arity, Qerror_message,
+        build_pure_c_string ("Invalid function arity"));
+
+  DEFSYM (Qsave_value_p, "save-value-p");
+  DEFSYM (Qinternal_module_call, "internal--module-call");
+
+  defsubr (&Smodule_load);
+  defsubr (&Sinternal_module_call);
+}
+
+#endif /* HAVE_MODULES */
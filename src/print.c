@@ -1867,6 +1867,35 @@ print_object (Lisp_Object obj, Lisp_Object printcharfun, bool escapeflag)
 	  len = sprintf (buf, " %p>", ptr);
 	  strout (buf, len, len, printcharfun);
 	}
+      else if (THREADP (obj) || MUTEXP (obj) || CONDVARP (obj))
+	{
+	  Lisp_Object name = (THREADP (obj) ? XTHREAD (obj)->name
+			      : MUTEXP (obj) ? XMUTEX (obj)->name
+			      : XCONDVAR (obj)->name);
+	  print_c_string (THREADP (obj) ? "#<thread "
+			  : MUTEXP (obj) ? "#<mutex " : "#<condvar ",
+			  printcharfun);
+	  if (STRINGP (name))
+	    print_string (name, printcharfun);
+	  else
+	    {
+	      int len = sprintf (buf, "%p", XUNTAG (obj, Lisp_Vectorlike));
+	      strout (buf, len, len, printcharfun);
+	    }
+	  printchar ('>', printcharfun);
+	}
+      else if (KEYWORD_SET_P (obj))
+	{
+	  int len = sprintf (buf, "#<keyword-set %p>",
+			     XUNTAG (obj, Lisp_Vectorlike));
+	  strout (buf, len, len, printcharfun);
+	}
+      else if (MATCH_DATA_P (obj))
+	{
+	  int len = sprintf (buf, "#<match-data-object %p>",
+			     XUNTAG (obj, Lisp_Vectorlike));
+	  strout (buf, len, len, printcharfun);
+	}
       else if (FONTP (obj))
 	{
 	  int i;
@@ -1997,6 +2026,19 @@ print_object (Lisp_Object obj, Lisp_Object printcharfun, bool escapeflag)
 	  printchar ('>', printcharfun);
           break;
 
+#ifdef HAVE_MODULES
+	case Lisp_Misc_User_Ptr:
+	  {
+	    print_c_string ("#<user-ptr ", printcharfun);
+	    int i = sprintf (buf, "ptr=%p finalizer=%p",
+			     XUSER_PTR (obj)->p,
+			     XUSER_PTR (obj)->finalizer);
+	    strout (buf, i, i, printcharfun);
+	    printchar ('>', printcharfun);
+	    break;
+	  }
+#endif
+
 	  /* Remaining cases shouldn't happen in normal usage, but let's
 	     print them anyway for the benefit of the debugger.  */
 
@@ -4740,7 +4740,8 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 	}
       else
 	{
-	  if (! read_kbd)
+	  /* Only the main thread reads the keyboard.  */
+	  if (! read_kbd || ! main_thread_p (current_thread))
 	    Available = non_keyboard_wait_mask;
 	  else
 	    Available = input_wait_mask;
@@ -4836,14 +4837,16 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 	  if (timeout.tv_sec > 0 || timeout.tv_nsec > 0)
 	    now = invalid_timespec ();
 
+	  /* Other threads may run while this one waits.  */
+	  nfds = thread_select (
 #if defined (HAVE_NS)
-          nfds = ns_select
+				ns_select,
 #elif defined (HAVE_GLIB)
-	  nfds = xg_select
+				xg_select,
 #else
-	  nfds = pselect
+				pselect,
 #endif
-            (max (max_process_desc, max_input_desc) + 1,
+            max (max_process_desc, max_input_desc) + 1,
              &Available,
              (check_write ? &Writeok : 0),
              NULL, &timeout, NULL);
@@ -496,6 +496,105 @@ Before returning, a new log is allocated for future samples.  */)
   return result;
 }
 
+
+/* Byte-code profiler.  */
+
+/* True if the byte-code profiler is running.  */
+bool profiler_byte_code_running;
+
+/* Incremented whenever byte_code_log is replaced or cleared, so that
+   the byte-code interpreter can tell that the log entries it
+   remembers for its frames are stale.  */
+EMACS_INT byte_code_log_epoch;
+
+static Lisp_Object byte_code_log;
+
+/* The number of different functions logged for a call site.  Calls of
+   further functions are counted under t.  */
+enum { BYTE_CODE_LOG_CALLEES = 8 };
+
+static Lisp_Object
+make_byte_code_log (void)
+{
+  byte_code_log_epoch++;
+  return make_hash_table (hashtest_eql, make_number (DEFAULT_HASH_SIZE),
+			  make_float (DEFAULT_REHASH_SIZE),
+			  make_float (DEFAULT_REHASH_THRESHOLD),
+			  Qnil);
+}
+
+DEFUN ("profiler-byte-code-start",
+       Fprofiler_byte_code_start, Sprofiler_byte_code_start,
+       0, 0, 0,
+       doc: /* Start/restart the byte-code profiler.
+The byte-code profiler counts how often each instruction of
+byte-compiled functions is executed, and which functions each call
+instruction calls.  Byte-code that is already running is counted from
+its next call, return or backward jump on.
+See `profiler-byte-code-log'.  */)
+  (void)
+{
+  if (profiler_byte_code_running)
+    error ("Byte-code profiler is already running");
+
+  if (NILP (byte_code_log))
+    byte_code_log = make_byte_code_log ();
+
+  profiler_byte_code_running = true;
+
+  return Qt;
+}
+
+DEFUN ("profiler-byte-code-stop",
+       Fprofiler_byte_code_stop, Sprofiler_byte_code_stop,
+       0, 0, 0,
+       doc: /* Stop the byte-code profiler.  The profiler log is not affected.
+Return non-nil if the profiler was running.  */)
+  (void)
+{
+  if (!profiler_byte_code_running)
+    return Qnil;
+  profiler_byte_code_running = false;
+  return Qt;
+}
+
+DEFUN ("profiler-byte-code-running-p",
+       Fprofiler_byte_code_running_p, Sprofiler_byte_code_running_p,
+       0, 0, 0,
+       doc: /* Return non-nil if byte-code profiler is running.  */)
+  (void)
+{
+  return profiler_byte_code_running ? Qt : Qnil;
+}
+
+DEFUN ("profiler-byte-code-log",
+       Fprofiler_byte_code_log, Sprofiler_byte_code_log,
+       0, 0, 0,
+       doc: /* Return the current byte-code profiler log.
+The log is a hash-table mapping the byte-code strings of the functions
+that ran to vectors [FUNCTION COUNTS CALLS].  FUNCTION is the function
+that ran the byte-code, as it appeared in the backtrace.  COUNTS is a
+vector with an element for each byte of the byte-code; the element for
+the first byte of an instruction is the number of times it was
+executed.  CALLS is nil if no call instruction was executed, and
+otherwise a vector like COUNTS, whose element for a call instruction
+is an alist mapping the functions called there to the number of calls.
+Calls of functions other than the first 8 called by an instruction are
+counted under t.
+Before returning, a new log is allocated for future samples.  */)
+  (void)
+{
+  Lisp_Object result = byte_code_log;
+  if (profiler_byte_code_running)
+    byte_code_log = make_byte_code_log ();
+  else
+    {
+      byte_code_log = Qnil;
+      byte_code_log_epoch++;
+    }
+  return result;
+}
+
 
 /* Signals and probes.  */
 
@@ -507,6 +606,67 @@ malloc_probe (size_t size)
   record_backtrace (XHASH_TABLE (memory_log), min (size, MOST_POSITIVE_FIXNUM));
 }
 
+/* Return the entry of the byte-code profiler log for the byte-code
+   BYTESTR, which the function at the top of the backtrace runs.  The
+   interpreter counts the instructions it executes in the vector
+   COUNTS of the entry itself.  */
+Lisp_Object
+byte_code_log_entry (Lisp_Object bytestr)
+{
+  struct Lisp_Hash_Table *log = XHASH_TABLE (byte_code_log);
+  Lisp_Object function = backtrace_top_function (), entry;
+  EMACS_UINT hash;
+  ptrdiff_t i = hash_lookup (log, bytestr, &hash);
+
+  if (i >= 0)
+    {
+      entry = HASH_VALUE (log, i);
+      /* Prefer the name of the function to its definition.  */
+      if (SYMBOLP (function) && !SYMBOLP (AREF (entry, 0)))
+	ASET (entry, 0, function);
+      return entry;
+    }
+  entry = CALLN (Fvector, function,
+		 Fmake_vector (make_number (SBYTES (bytestr)),
+			       make_number (0)),
+		 Qnil);
+  hash_put (log, bytestr, entry, hash);
+  return entry;
+}
+
+/* Record in the log ENTRY that the call instruction at PC called
+   FUNCTION.  */
+void
+byte_code_call_probe (Lisp_Object entry, ptrdiff_t pc, Lisp_Object function)
+{
+  Lisp_Object calls = AREF (entry, 2), callees, cell;
+
+  if (NILP (calls))
+    {
+      calls = Fmake_vector (make_number (ASIZE (AREF (entry, 1))), Qnil);
+      ASET (entry, 2, calls);
+    }
+  callees = AREF (calls, pc);
+  cell = assq_no_quit (function, callees);
+  if (NILP (cell))
+    {
+      ptrdiff_t n = 0;
+      Lisp_Object tail;
+
+      for (tail = callees; CONSP (tail); tail = XCDR (tail))
+	n++;
+      if (n >= BYTE_CODE_LOG_CALLEES)
+	cell = assq_no_quit (Qt, callees);
+      if (NILP (cell))
+	{
+	  cell = Fcons (n < BYTE_CODE_LOG_CALLEES ? function : Qt,
+			make_number (0));
+	  ASET (calls, pc, Fcons (cell, callees));
+	}
+    }
+  XSETCDR (cell, make_number (saturated_add (XFASTINT (XCDR (cell)), 1)));
+}
+
 DEFUN ("function-equal", Ffunction_equal, Sfunction_equal, 2, 2, 0,
        doc: /* Return non-nil if F1 and F2 come from the same source.
 Used to determine if different closures are just different instances of
@@ -605,4 +765,11 @@ to make room for new entries.  */);
   defsubr (&Sprofiler_memory_stop);
   defsubr (&Sprofiler_memory_running_p);
   defsubr (&Sprofiler_memory_log);
+  profiler_byte_code_running = false;
+  byte_code_log = Qnil;
+  staticpro (&byte_code_log);
+  defsubr (&Sprofiler_byte_code_start);
+  defsubr (&Sprofiler_byte_code_stop);
+  defsubr (&Sprofiler_byte_code_running_p);
+  defsubr (&Sprofiler_byte_code_log);
 }
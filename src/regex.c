@@ -1634,6 +1634,10 @@ static boolean at_endline_loc_p (re_char *p, re_char *pend,
 static re_char *skip_one_char (re_char *p);
 static int analyze_first (re_char *p, re_char *pend,
 			  char *fastmap, const int multibyte);
+#ifdef emacs
+static void re_compile_literal (struct re_pattern_buffer *bufp);
+static void re_compile_caseless (struct re_pattern_buffer *bufp);
+#endif
 
 /* Fetch the next character in the uncompiled pattern, with no
    translation.  */
@@ -2505,6 +2509,10 @@ regex_compile (const_re_char *pattern, size_t size, reg_syntax_t syntax,
   bufp->fastmap_accurate = 0;
   bufp->not_bol = bufp->not_eol = 0;
   bufp->used_syntax = 0;
+#ifdef emacs
+  re_free_automaton (bufp);
+  bufp->literal_length = 0;
+#endif
 
   /* Set `used' to zero, so that if we return an error, the pattern
      printer (for debugging) will think there's no pattern.  We reset it
@@ -3681,6 +3689,11 @@ regex_compile (const_re_char *pattern, size_t size, reg_syntax_t syntax,
   /* We have succeeded; set the length of the buffer.  */
   bufp->used = b - bufp->buffer;
 
+#ifdef emacs
+  re_compile_literal (bufp);
+  re_compile_caseless (bufp);
+#endif
+
 #ifdef DEBUG
   if (debug > 0)
     {
@@ -4183,6 +4196,503 @@ re_compile_fastmap (struct re_pattern_buffer *bufp)
   bufp->can_be_null = (analysis != 0);
   return 0;
 } /* re_compile_fastmap */
+
+#ifdef emacs
+
+/* Finding a literal that every match contains.  */
+
+/* Store in SUCC the operations that may follow the one at P, in a
+   pattern that ends at PEND, and return their number.  PEND stands for
+   the end of a successful match.  Return -1 if the operation is not
+   known.  */
+
+static int
+re_literal_successors (re_char *p, re_char *pend, re_char **succ)
+{
+  int mcnt;
+
+  switch (*p)
+    {
+    case succeed:
+      succ[0] = pend;
+      return 1;
+
+    case no_op:
+    case anychar:
+    case begline:
+    case endline:
+    case begbuf:
+    case endbuf:
+    case wordbeg:
+    case wordend:
+    case wordbound:
+    case notwordbound:
+    case symbeg:
+    case symend:
+    case before_dot:
+    case at_dot:
+    case after_dot:
+      succ[0] = p + 1;
+      return 1;
+
+    case start_memory:
+    case stop_memory:
+    case duplicate:
+    case syntaxspec:
+    case notsyntaxspec:
+    case categoryspec:
+    case notcategoryspec:
+      succ[0] = p + 2;
+      return 1;
+
+    case exactn:
+    case charset:
+    case charset_not:
+      succ[0] = skip_one_char (p);
+      return 1;
+
+    case set_number_at:
+      succ[0] = p + 5;
+      return 1;
+
+    case jump:
+      EXTRACT_NUMBER (mcnt, p + 1);
+      succ[0] = p + 3 + mcnt;
+      return 1;
+
+    case on_failure_jump:
+    case on_failure_keep_string_jump:
+    case on_failure_jump_loop:
+    case on_failure_jump_nastyloop:
+    case on_failure_jump_smart:
+      EXTRACT_NUMBER (mcnt, p + 1);
+      succ[0] = p + 3;
+      succ[1] = p + 3 + mcnt;
+      return 2;
+
+    case succeed_n:
+    case jump_n:
+      EXTRACT_NUMBER (mcnt, p + 1);
+      succ[0] = p + 5;
+      succ[1] = p + 3 + mcnt;
+      return 2;
+
+    default:
+      return -1;
+    }
+}
+
+/* Return 1 if the end of the pattern of BUFP can be reached from its
+   start without going through the operation at offset AVOID, 0 if it
+   cannot, and -1 if that is not known.  If it can, FROM[Q] is the
+   offset of the operation that was gone through to reach offset Q
+   first, or -1 for the start.  QUEUE has room for the offsets of all
+   the operations.  */
+
+static int
+re_literal_reachable (struct re_pattern_buffer *bufp, ptrdiff_t avoid,
+		      ptrdiff_t *from, ptrdiff_t *queue)
+{
+  re_char *pattern = bufp->buffer;
+  re_char *pend = pattern + bufp->used;
+  ptrdiff_t i, head = 0, tail = 0;
+
+  for (i = 0; i <= bufp->used; i++)
+    from[i] = -2;
+  from[0] = -1;
+  queue[tail++] = 0;
+  while (head < tail)
+    {
+      ptrdiff_t u = queue[head++];
+      re_char *succ[2];
+      int n;
+
+      if (u == bufp->used)
+	return 1;
+      n = re_literal_successors (pattern + u, pend, succ);
+      if (n < 0)
+	return -1;
+      for (i = 0; i < n; i++)
+	{
+	  ptrdiff_t v = succ[i] - pattern;
+
+	  if (v < 0 || v > bufp->used)
+	    return -1;
+	  if (v != avoid && from[v] == -2)
+	    {
+	      from[v] = u;
+	      queue[tail++] = v;
+	    }
+	}
+    }
+  return 0;
+}
+
+/* Store in STR the multibyte form of the character C of a pattern
+   translated by TRANSLATE, and in ALT that of the other case of C, or
+   the same bytes again if C has no other case.  Return the number of
+   bytes, or 0 if other characters of the text can match C.  */
+
+static int
+re_literal_char (RE_TRANSLATE_TYPE translate, int c,
+		 unsigned char *str, unsigned char *alt)
+{
+  int len, other = c;
+
+  if (RE_TRANSLATE_P (translate))
+    {
+      Lisp_Object eqv_table = XCHAR_TABLE (translate)->extras[2];
+
+      if (!CHAR_TABLE_P (eqv_table) || RE_TRANSLATE (translate, c) != c)
+	return 0;
+      other = RE_TRANSLATE (eqv_table, c);
+      if (other != c
+	  && !(c < 0x80 && other < 0x80
+	       && RE_TRANSLATE (eqv_table, other) == c))
+	return 0;
+    }
+  len = CHAR_STRING (c, str);
+  if (other == c)
+    memcpy (alt, str, len);
+  else
+    alt[0] = other;
+  return len;
+}
+
+/* The printable ASCII characters and newline, roughly from the most
+   to the least frequent in text and code.  */
+static const char re_literal_frequent[] =
+  " e\n\tta(o)-sinrl\"dcu;pm.fh'bg,y_w:v=k0A1S2TCEx/IDRMNPL*<>j3FO!9B45H"
+  "6W78q?z[]U{}GV|+Y&%KJ$@#QX^Z~`\\";
+
+/* Return how rare the byte C of a literal is likely to be in text.
+   ALT is C in the other case; both have to be looked for.  */
+
+static int
+re_literal_rarity (int c, int alt)
+{
+  const char *p = c ? strchr (re_literal_frequent, c) : NULL;
+  const char *q = alt ? strchr (re_literal_frequent, alt) : NULL;
+  int rarity = p ? p - re_literal_frequent : sizeof re_literal_frequent;
+
+  if (q && q - re_literal_frequent < rarity)
+    rarity = q - re_literal_frequent;
+  return rarity;
+}
+
+/* Record in BUFP the LEN bytes of STR and ALT as its literal, if they
+   are better than the one it has.  PREFIX says whether every match
+   starts with them.  */
+
+static void
+re_literal_consider (struct re_pattern_buffer *bufp,
+		     const unsigned char *str, const unsigned char *alt,
+		     int len, bool prefix)
+{
+  int i, best = -1;
+
+  if (len == 0
+      || (bufp->literal_length > 0
+	  && (bufp->literal_prefix || (!prefix && len <= bufp->literal_length))))
+    return;
+
+  bufp->literal_length = len;
+  bufp->literal_prefix = prefix;
+  bufp->literal_multibyte = false;
+  for (i = 0; i < len; i++)
+    {
+      int rarity = re_literal_rarity (str[i], alt[i]);
+
+      bufp->literal[i] = str[i];
+      bufp->literal_alt[i] = alt[i];
+      if (str[i] >= 0x80)
+	bufp->literal_multibyte = true;
+      if (rarity > best)
+	{
+	  best = rarity;
+	  bufp->literal_anchor = i;
+	}
+    }
+}
+
+/* Find the longest string of literal characters, up to RE_LITERAL_MAX
+   bytes, that every match of BUFP contains, and record it in BUFP.
+   Prefer one that every match starts with.  */
+
+static void
+re_compile_literal (struct re_pattern_buffer *bufp)
+{
+  re_char *pattern = bufp->buffer;
+  re_char *pend = pattern + bufp->used;
+  RE_TRANSLATE_TYPE translate = bufp->translate;
+  unsigned char str[RE_LITERAL_MAX], alt[RE_LITERAL_MAX];
+  ptrdiff_t *from, *queue, *path;
+  ptrdiff_t i, u, npath = 0;
+  int len = 0, tested = 0;
+  bool prefix = true, str_prefix = false;
+
+  bufp->literal_length = 0;
+  if (bufp->used == 0)
+    return;
+
+  from = xnmalloc (bufp->used + 1, sizeof *from);
+  queue = xnmalloc (bufp->used + 1, sizeof *queue);
+  path = xnmalloc (bufp->used + 1, sizeof *path);
+
+  /* Every match goes through the operations that it goes through on
+     one way from the start to the end, if it cannot avoid them.  */
+  if (re_literal_reachable (bufp, -1, from, queue) != 1)
+    goto done;
+  for (u = bufp->used; u >= 0; u = from[u])
+    path[npath++] = u;
+
+  for (i = npath - 1; i > 0; i--)
+    {
+      re_char *p = pattern + path[i];
+      re_char *succ[2];
+      int nsucc = re_literal_successors (p, pend, succ);
+
+      if (*p == exactn
+	  /* Each test takes time in proportion to the pattern.  */
+	  && tested++ < 32
+	  && re_literal_reachable (bufp, path[i], from, queue) == 0)
+	{
+	  re_char *q = p + 2, *qend = q + p[1];
+
+	  while (q < qend)
+	    {
+	      unsigned char cstr[MAX_MULTIBYTE_LENGTH];
+	      unsigned char calt[MAX_MULTIBYTE_LENGTH];
+	      int c, clen, n;
+
+	      if (bufp->multibyte)
+		c = STRING_CHAR_AND_LENGTH (q, clen);
+	      else
+		c = RE_CHAR_TO_MULTIBYTE (*q), clen = 1;
+	      q += clen;
+
+	      n = re_literal_char (translate, c, cstr, calt);
+	      if (n == 0 || len + n > RE_LITERAL_MAX)
+		{
+		  re_literal_consider (bufp, str, alt, len, str_prefix);
+		  len = 0;
+		  prefix = false;
+		}
+	      if (n > 0)
+		{
+		  if (len == 0)
+		    str_prefix = prefix;
+		  memcpy (str + len, cstr, n);
+		  memcpy (alt + len, calt, n);
+		  len += n;
+		}
+	    }
+	  prefix = false;
+	}
+      else if (nsucc != 1
+	       || *p == exactn || *p == anychar || *p == charset
+	       || *p == charset_not || *p == duplicate
+	       || *p == syntaxspec || *p == notsyntaxspec
+	       || *p == categoryspec || *p == notcategoryspec)
+	{
+	  /* Text that is not literal may come next.  */
+	  re_literal_consider (bufp, str, alt, len, str_prefix);
+	  len = 0;
+	  prefix = false;
+	}
+    }
+  re_literal_consider (bufp, str, alt, len, str_prefix);
+
+ done:
+  xfree (from);
+  xfree (queue);
+  xfree (path);
+}
+
+/* Return true if BUFP's literal can be looked for in its target.  */
+
+static bool
+re_literal_usable (struct re_pattern_buffer *bufp)
+{
+  return (bufp->literal_length > 0
+	  && (RE_TARGET_MULTIBYTE_P (bufp) || !bufp->literal_multibyte));
+}
+
+/* Return the first position from FROM on where the literal of BUFP
+   occurs in the virtual concatenation of STRING1 and STRING2, ending
+   no later than TO, or -1 if there is none.  */
+
+static ssize_t
+re_find_literal (struct re_pattern_buffer *bufp,
+		 re_char *string1, ssize_t size1, re_char *string2,
+		 ssize_t from, ssize_t to)
+{
+  int len = bufp->literal_length, anchor = bufp->literal_anchor;
+  int a = bufp->literal[anchor], b = bufp->literal_alt[anchor];
+  ssize_t pos = from + anchor, lim = to - len + anchor + 1;
+
+  /* Look for the rarest byte of the literal with memchr, which is
+     fast, and check the rest of the literal where it is found.  */
+  while (pos < lim)
+    {
+      ssize_t offset = pos < size1 ? 0 : size1;
+      re_char *base = pos < size1 ? string1 : string2;
+      re_char *p = base + (pos - offset);
+      re_char *end = base + ((pos < size1 ? min (size1, lim) : lim) - offset);
+      re_char *qa = NULL, *qb = NULL;
+
+      while (p < end)
+	{
+	  re_char *q;
+	  ssize_t start;
+	  int i;
+
+	  if (!qa || qa < p)
+	    {
+	      qa = memchr (p, a, end - p);
+	      if (!qa)
+		qa = end;
+	    }
+	  q = qa;
+	  if (b != a)
+	    {
+	      if (!qb || qb < p)
+		{
+		  qb = memchr (p, b, end - p);
+		  if (!qb)
+		    qb = end;
+		}
+	      q = min (qa, qb);
+	    }
+	  if (q == end)
+	    break;
+
+	  start = offset + (q - base) - anchor;
+	  for (i = 0; i < len; i++)
+	    {
+	      ssize_t j = start + i;
+	      int c = j < size1 ? string1[j] : string2[j - size1];
+
+	      if (c != bufp->literal[i] && c != bufp->literal_alt[i])
+		break;
+	    }
+	  if (i == len)
+	    return start;
+	  p = q + 1;
+	}
+      pos = end - base + offset;
+    }
+  return -1;
+}
+
+/* Finding whether ignoring case matters.  */
+
+/* The most characters of the ranges of a pattern that
+   re_compile_caseless looks up in the case tables.  */
+#define RE_CASELESS_RANGE_MAX 0x400
+
+/* Return true if C is the only character of its case equivalence
+   class under TRANSLATE, whose case equivalence table is EQV.  */
+
+static bool
+re_char_caseless (RE_TRANSLATE_TYPE translate, Lisp_Object eqv, int c)
+{
+  return RE_TRANSLATE (translate, c) == c && RE_TRANSLATE (eqv, c) == c;
+}
+
+/* Record in BUFP whether translating the text by its translation
+   table can change what its pattern matches.  It cannot if no
+   character that the pattern matches has another case, and no
+   back reference compares texts.  */
+
+static void
+re_compile_caseless (struct re_pattern_buffer *bufp)
+{
+  re_char *p = bufp->buffer;
+  re_char *pend = p + bufp->used;
+  RE_TRANSLATE_TYPE translate = bufp->translate;
+  bool multibyte = RE_MULTIBYTE_P (bufp);
+  Lisp_Object eqv;
+  int checked = 0;
+
+  bufp->caseless = false;
+  if (!RE_TRANSLATE_P (translate))
+    return;
+  eqv = XCHAR_TABLE (translate)->extras[2];
+  if (!CHAR_TABLE_P (eqv))
+    return;
+
+  while (p < pend)
+    {
+      re_char *succ[2];
+      int i, n = re_literal_successors (p, pend, succ);
+
+      if (n < 0)
+	return;
+      switch (*p)
+	{
+	case exactn:
+	  for (i = 0; i < p[1]; )
+	    {
+	      int c, len;
+
+	      if (multibyte)
+		c = STRING_CHAR_AND_LENGTH (p + 2 + i, len);
+	      else
+		{
+		  c = p[2 + i], len = 1;
+		  if (c >= 0x80)
+		    return;
+		}
+	      if (!re_char_caseless (translate, eqv, c))
+		return;
+	      i += len;
+	    }
+	  break;
+
+	case charset:
+	case charset_not:
+	  for (i = 0; i < CHARSET_BITMAP_SIZE (p) * BYTEWIDTH; i++)
+	    if (p[2 + i / BYTEWIDTH] & (1 << (i % BYTEWIDTH))
+		&& (i >= 0x80 || !re_char_caseless (translate, eqv, i)))
+	      return;
+	  if (CHARSET_RANGE_TABLE_EXISTS_P (p))
+	    {
+	      re_char *range_table = CHARSET_RANGE_TABLE (p);
+	      int count;
+
+	      if (CHARSET_RANGE_TABLE_BITS (p) & (BIT_LOWER | BIT_UPPER))
+		return;
+	      EXTRACT_NUMBER_AND_INCR (count, range_table);
+	      for (; count > 0; count--, range_table += 2 * 3)
+		{
+		  re_wchar_t c, range_end;
+
+		  EXTRACT_CHARACTER (c, range_table);
+		  EXTRACT_CHARACTER (range_end, range_table + 3);
+		  for (; c <= range_end; c++)
+		    if (++checked > RE_CASELESS_RANGE_MAX
+			|| !re_char_caseless (translate, eqv, c))
+		      return;
+		}
+	    }
+	  break;
+
+	case duplicate:
+	  return;
+
+	default:
+	  break;
+	}
+
+      /* The operations follow one another, except that an
+	 unconditional jump goes elsewhere.  */
+      p = *p == jump ? p + 3 : succ[0];
+    }
+  bufp->caseless = true;
+}
+
+#endif /* emacs */
 
 /* Set REGS to hold NUM_REGS registers, storing them in STARTS and
    ENDS.  Subsequent matches using PATTERN_BUFFER and REGS will use
@@ -4216,79 +4726,1314 @@ re_set_registers (struct re_pattern_buffer *bufp, struct re_registers *regs, uns
 }
 WEAK_ALIAS (__re_set_registers, re_set_registers)
 
-/* Searching routines.  */
+#ifdef emacs
 
-/* Like re_search_2, below, but only one string is specified, and
-   doesn't let you say where to stop matching. */
+/* Searching with a lazily built automaton.
+
+   re_match_2_internal may take time exponential in the length of the
+   text to find out that a pattern does not match at a position, and
+   re_search_2 calls it at each possible starting position in turn.
+   Most patterns, though, have no back-references and can be run as an
+   automaton instead.
+
+   The automaton works on a graph of nodes made from the compiled
+   pattern.  Its states are the lists of nodes that the threads of a
+   match have reached, in the order in which the backtracking matcher
+   would try them.  A forward scan of the text finds where the leftmost
+   match ends, then a backward scan from there finds where it begins,
+   and re_match_2_internal is called just once, at that position, to
+   fill in the registers.  States are made only when the text leads to
+   them, and they and their transitions on characters below 256 are
+   cached in the pattern buffer, up to a bound.
+
+   The patterns left to the backtracking matcher are those with
+   back-references, counted repetitions, category or point assertions,
+   or POSIX backtracking, and those that depend on the syntax table
+   when `parse-sexp-lookup-properties' is set.  */
+
+/* Kinds of nodes.  */
+enum re_dfa_kind
+  {
+    /* Match one character, then go to the next node.  */
+    RE_DFA_CHAR,
+    /* Go to the next node; failing that, go to node ARG.  */
+    RE_DFA_SPLIT,
+    /* Go to node ARG.  */
+    RE_DFA_JUMP,
+    /* Go to the next node if the assertion holds at this position.  */
+    RE_DFA_ASSERT,
+    /* The pattern has matched.  */
+    RE_DFA_MATCH
+  };
 
-regoff_t
-re_search (struct re_pattern_buffer *bufp, const char *string, size_t size,
-	   ssize_t startpos, ssize_t range, struct re_registers *regs)
+struct re_dfa_node
 {
-  return re_search_2 (bufp, NULL, 0, string, size, startpos, range,
-		      regs, size);
-}
-WEAK_ALIAS (__re_search, re_search)
+  /* An enum re_dfa_kind.  */
+  unsigned char kind;
 
-/* Head address of virtual concatenation of string.  */
-#define HEAD_ADDR_VSTRING(P)		\
-  (((P) >= size1 ? string2 : string1))
+  /* The opcode of the pattern command this node comes from.  */
+  unsigned char op;
 
-/* Address of POS in the concatenation of virtual string. */
-#define POS_ADDR_VSTRING(POS)					\
-  (((POS) >= size1 ? string2 - size1 : string1) + (POS))
+  /* For RE_DFA_SPLIT and RE_DFA_JUMP, the node to go to.  For
+     RE_DFA_CHAR, the character to match for exactn in a multibyte
+     target, the offset of the command in the pattern for charset and
+     charset_not, or the syntax code for syntaxspec and notsyntaxspec.  */
+  int arg;
 
-/* Using the compiled pattern in BUFP->buffer, first tries to match the
-   virtual concatenation of STRING1 and STRING2, starting first at index
-   STARTPOS, then at STARTPOS + 1, and so on.
+  /* For exactn, the character to match in a unibyte target.  */
+  int arg2;
+};
 
-   STRING1 and STRING2 have length SIZE1 and SIZE2, respectively.
+/* Flags of a state.  All but RE_DFA_STARTING describe the character
+   before the position, which is all the assertions need to know
+   about it.  */
+enum
+  {
+    /* A new thread starts at each position.  */
+    RE_DFA_STARTING = 1,
+    /* There is no character before: this is the beginning.  */
+    RE_DFA_AT_BEG = 2,
+    /* The character before is a newline.  */
+    RE_DFA_AFTER_NEWLINE = 4,
+    /* The character before has word syntax.  */
+    RE_DFA_AFTER_WORD = 8,
+    /* The character before has symbol syntax.  */
+    RE_DFA_AFTER_SYMBOL = 16,
+    /* The character before is not a single byte character, so word
+       boundaries depend on the character itself, and transitions from
+       the state cannot be cached.  */
+    RE_DFA_AFTER_WIDE = 32
+  };
 
-   RANGE is how far to scan while trying to match.  RANGE = 0 means try
-   only at STARTPOS; in general, the last start tried is STARTPOS +
-   RANGE.
+struct re_dfa_state
+{
+  /* The nodes the threads are going to, as NNODES elements of `pool'
+     starting at NODES, highest priority first.  */
+  ptrdiff_t nodes;
+  int nnodes;
 
-   In REGS, return the indices of the virtual concatenation of STRING1
-   and STRING2 that matched the entire BUFP->buffer and its contained
-   subexpressions.
+  /* Flags, see above.  */
+  int flags;
 
-   Do not consider matching one past the index STOP in the virtual
-   concatenation of STRING1 and STRING2.
+  /* The next state in the same bucket of `table', or -1.  */
+  int chain;
+};
 
-   We return either the position in the strings at which the match was
-   found, -1 if no match, or -2 if error (such as failure
-   stack overflow).  */
+/* Most states an automaton caches.  */
+#define RE_DFA_MAX_STATES 512
 
-regoff_t
-re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
-	     const char *str2, size_t size2, ssize_t startpos, ssize_t range,
-	     struct re_registers *regs, ssize_t stop)
+/* Number of hash buckets of an automaton's states.  */
+#define RE_DFA_BUCKETS 1024
+
+/* Most elements of the node lists of an automaton's states.  */
+#define RE_DFA_POOL_SIZE 65536
+
+/* A search gives up on the automaton when it has to flush the cache
+   after scanning fewer than this many bytes per cached state.  */
+#define RE_DFA_MIN_BYTES_PER_STATE 16
+
+struct re_dfa
 {
-  regoff_t val;
-  re_char *string1 = (re_char*) str1;
-  re_char *string2 = (re_char*) str2;
-  register char *fastmap = bufp->fastmap;
-  register RE_TRANSLATE_TYPE translate = bufp->translate;
-  size_t total_size = size1 + size2;
-  ssize_t endpos = startpos + range;
-  boolean anchored_start;
-  /* Nonzero if we are searching multibyte string.  */
-  const boolean multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  /* False if the pattern must be left to the backtracking matcher.  */
+  bool usable;
+
+  /* True if matching depends on the syntax table, on the case tables,
+     or on word boundaries between multibyte characters.  */
+  bool uses_syntax, uses_case, word_boundaries;
+
+  /* True if an exactn of a multibyte pattern has a non-ASCII
+     character, which re_match_2_internal does not match the same way
+     in a unibyte target.  */
+  bool multibyte_literals;
+
+  /* The nodes.  The first one is where matching starts.  */
+  int nnodes;
+  struct re_dfa_node *node;
+
+  /* For each node N, the nodes that go to N without reading a
+     character are PRED[PRED_START[N]] to PRED[PRED_START[N + 1] - 1].  */
+  int *pred_start, *pred;
+
+  /* What the cached transitions were computed for.  The tables are
+     not protected from garbage collection, so the automaton must be
+     freed whenever they might be collected.  */
+  bool target_multibyte, not_bol, not_eol;
+  Lisp_Object syntax_table, downcase_table, upcase_table;
+
+  /* The cached states, and their hash table.  */
+  int nstates, states_allocated;
+  struct re_dfa_state *state;
+  int table[RE_DFA_BUCKETS];
+
+  /* The transitions of each state on characters below 256, in rows of
+     256: -1 if unknown, else 4 * NEXT-STATE, plus two if a thread
+     started before the character reads it, plus one if a match ends
+     before the character.  */
+  int *trans;
+
+  /* Storage for the node lists of the states.  */
+  int *pool;
+  ptrdiff_t pool_used, pool_allocated;
+
+  /* Work areas, with room for a list of all the nodes.  */
+  int *list, *out, *stack;
+  unsigned *mark;
+  unsigned mark_gen;
+
+  /* Number of bytes scanned since the cache was last flushed, and
+     the number of times it was flushed.  */
+  ptrdiff_t scanned;
+  unsigned flushes;
+
+  /* True if the cache was flushed too soon after the previous time.  */
+  bool thrashing;
+};
 
-  /* Check for out-of-range STARTPOS.  */
-  if (startpos < 0 || startpos > total_size)
-    return -1;
+/* The context of a position in the text.  */
+struct re_dfa_context
+{
+  /* The character before the position, converted to multibyte, or -1
+     at the beginning of the text.  */
+  int before;
 
-  /* Fix up RANGE if it might eventually take us outside
-     the virtual concatenation of STRING1 and STRING2.
-     Make sure we won't move STARTPOS below 0 or above TOTAL_SIZE.  */
-  if (endpos < 0)
-    range = 0 - startpos;
-  else if (endpos > total_size)
-    range = total_size - startpos;
+  /* The character at the position as it is in the text, or -1 at the
+     end of the text.  */
+  int after;
 
-  /* If the search isn't to be a backwards one, don't waste time in a
-     search for a pattern anchored at beginning of buffer.  */
+  /* True if the position is where the match must stop, so that
+     commands that read a character fail.  */
+  bool at_limit;
+};
+
+/* Make the automaton for the pattern of BUFP.  */
+
+static struct re_dfa *
+re_dfa_make (struct re_pattern_buffer *bufp)
+{
+  re_char *pattern = bufp->buffer;
+  re_char *pend = pattern + bufp->used;
+  re_char *p = pattern;
+  struct re_dfa *dfa = xzalloc (sizeof *dfa);
+  struct re_dfa_node *node;
+  int *node_at;
+  int n = 0, i;
+
+  if (!(bufp->syntax & RE_NO_POSIX_BACKTRACKING))
+    return dfa;
+
+  /* Each command makes at most one node per byte, and the end of the
+     pattern one more.  */
+  node = xnmalloc (bufp->used + 1, sizeof *node);
+  node_at = xnmalloc (bufp->used + 1, sizeof *node_at);
+  for (i = 0; i <= bufp->used; i++)
+    node_at[i] = -1;
+
+  while (p < pend)
+    {
+      re_opcode_t op = *p;
+      int mcnt;
+
+      node_at[p - pattern] = n;
+      node[n].op = op;
+      switch (op)
+	{
+	case no_op:
+	  node[n].kind = RE_DFA_JUMP;
+	  node[n++].arg = p + 1 - pattern;
+	  p++;
+	  break;
+
+	case start_memory:
+	case stop_memory:
+	  node[n].kind = RE_DFA_JUMP;
+	  node[n++].arg = p + 2 - pattern;
+	  p += 2;
+	  break;
+
+	case succeed:
+	  node[n++].kind = RE_DFA_MATCH;
+	  p++;
+	  break;
+
+	case exactn:
+	  {
+	    re_char *q = p + 2;
+	    re_char *qend = q + p[1];
+
+	    while (q < qend)
+	      {
+		int c, len;
+
+		node[n].kind = RE_DFA_CHAR;
+		node[n].op = exactn;
+		if (bufp->multibyte)
+		  {
+		    c = STRING_CHAR_AND_LENGTH (q, len);
+		    node[n].arg = c;
+		    node[n].arg2 = RE_CHAR_TO_UNIBYTE (c);
+		    if (len > 1)
+		      dfa->multibyte_literals = true;
+		  }
+		else
+		  {
+		    len = 1;
+		    node[n].arg = RE_CHAR_TO_MULTIBYTE (*q);
+		    node[n].arg2 = *q;
+		  }
+		n++;
+		q += len;
+	      }
+	    p = qend;
+	  }
+	  break;
+
+	case charset:
+	case charset_not:
+	  if (CHARSET_RANGE_TABLE_EXISTS_P (p))
+	    {
+	      int bits = CHARSET_RANGE_TABLE_BITS (p);
+
+	      if (bits & (BIT_WORD | BIT_PUNCT | BIT_SPACE))
+		dfa->uses_syntax = true;
+	      if (bits & (BIT_LOWER | BIT_UPPER))
+		dfa->uses_case = true;
+	    }
+	  node[n].kind = RE_DFA_CHAR;
+	  node[n++].arg = p - pattern;
+	  p = skip_one_char (p);
+	  break;
+
+	case anychar:
+	  node[n++].kind = RE_DFA_CHAR;
+	  p++;
+	  break;
+
+	case syntaxspec:
+	case notsyntaxspec:
+	  dfa->uses_syntax = true;
+	  node[n].kind = RE_DFA_CHAR;
+	  node[n++].arg = p[1];
+	  p += 2;
+	  break;
+
+	case wordbound:
+	case notwordbound:
+	case wordbeg:
+	case wordend:
+	  dfa->word_boundaries = true;
+	  /* Fall through.  */
+	case symbeg:
+	case symend:
+	  dfa->uses_syntax = true;
+	  /* Fall through.  */
+	case begline:
+	case endline:
+	case begbuf:
+	case endbuf:
+	  node[n++].kind = RE_DFA_ASSERT;
+	  p++;
+	  break;
+
+	case jump:
+	  EXTRACT_NUMBER (mcnt, p + 1);
+	  node[n].kind = RE_DFA_JUMP;
+	  node[n++].arg = p + 3 + mcnt - pattern;
+	  p += 3;
+	  break;
+
+	case on_failure_jump:
+	case on_failure_keep_string_jump:
+	case on_failure_jump_loop:
+	case on_failure_jump_nastyloop:
+	case on_failure_jump_smart:
+	  EXTRACT_NUMBER (mcnt, p + 1);
+	  node[n].kind = RE_DFA_SPLIT;
+	  node[n++].arg = p + 3 + mcnt - pattern;
+	  p += 3;
+	  break;
+
+	default:
+	  /* Back-references, counted repetitions, and category and point
+	     assertions.  */
+	  goto unusable;
+	}
+    }
+  node_at[bufp->used] = n;
+  node[n].kind = RE_DFA_MATCH;
+  node[n++].op = succeed;
+
+  /* Turn the offsets of jump targets into nodes.  */
+  for (i = 0; i < n; i++)
+    if (node[i].kind == RE_DFA_SPLIT || node[i].kind == RE_DFA_JUMP)
+      {
+	int target = node[i].arg;
+
+	if (target < 0 || target > bufp->used || node_at[target] < 0)
+	  goto unusable;
+	/* Once on_failure_jump_smart has turned itself into
+	   on_failure_keep_string_jump, the jump at the end of its loop
+	   goes just past it.  The automaton must still go back to the
+	   split, so that it can leave the loop after each iteration.  */
+	if (node[i].kind == RE_DFA_JUMP && target >= 3
+	    && node_at[target - 3] >= 0
+	    && pattern[target - 3] == on_failure_keep_string_jump)
+	  target -= 3;
+	node[i].arg = node_at[target];
+      }
+
+  dfa->usable = true;
+  dfa->nnodes = n;
+  dfa->node = node;
+
+  /* Record the nodes that lead to each node without reading.  */
+  dfa->pred_start = xzalloc ((n + 1) * sizeof *dfa->pred_start);
+  for (i = 0; i < n; i++)
+    switch (node[i].kind)
+      {
+      case RE_DFA_SPLIT:
+	dfa->pred_start[node[i].arg]++;
+	/* Fall through.  */
+      case RE_DFA_ASSERT:
+	dfa->pred_start[i + 1]++;
+	break;
+      case RE_DFA_JUMP:
+	dfa->pred_start[node[i].arg]++;
+	break;
+      }
+  for (i = 1; i <= n; i++)
+    dfa->pred_start[i] += dfa->pred_start[i - 1];
+  dfa->pred = xnmalloc (dfa->pred_start[n] + 1, sizeof *dfa->pred);
+  for (i = n - 1; i >= 0; i--)
+    switch (node[i].kind)
+      {
+      case RE_DFA_SPLIT:
+	dfa->pred[--dfa->pred_start[node[i].arg]] = i;
+	/* Fall through.  */
+      case RE_DFA_ASSERT:
+	dfa->pred[--dfa->pred_start[i + 1]] = i;
+	break;
+      case RE_DFA_JUMP:
+	dfa->pred[--dfa->pred_start[node[i].arg]] = i;
+	break;
+      }
+
+  /* A thread can be pushed on the stack once per node it starts from
+     and once per edge.  */
+  dfa->list = xnmalloc (n, sizeof *dfa->list);
+  dfa->out = xnmalloc (n, sizeof *dfa->out);
+  dfa->stack = xnmalloc (3 * n + 1, sizeof *dfa->stack);
+  dfa->mark = xzalloc (n * sizeof *dfa->mark);
+  for (i = 0; i < RE_DFA_BUCKETS; i++)
+    dfa->table[i] = -1;
+  xfree (node_at);
+  return dfa;
+
+ unusable:
+  xfree (node);
+  xfree (node_at);
+  return dfa;
+}
+
+/* Free the automaton of BUFP, if any.  This must be done whenever the
+   syntax tables its cached transitions rely on might have changed or
+   been garbage collected.  */
+
+void
+re_free_automaton (struct re_pattern_buffer *bufp)
+{
+  struct re_dfa *dfa = bufp->dfa;
+
+  if (dfa)
+    {
+      xfree (dfa->node);
+      xfree (dfa->pred_start);
+      xfree (dfa->pred);
+      xfree (dfa->state);
+      xfree (dfa->trans);
+      xfree (dfa->pool);
+      xfree (dfa->list);
+      xfree (dfa->out);
+      xfree (dfa->stack);
+      xfree (dfa->mark);
+      xfree (dfa);
+      bufp->dfa = NULL;
+    }
+}
+
+/* Forget the states of DFA.  */
+
+static void
+re_dfa_flush (struct re_dfa *dfa)
+{
+  int i;
+
+  dfa->nstates = 0;
+  dfa->pool_used = 0;
+  dfa->scanned = 0;
+  dfa->flushes++;
+  for (i = 0; i < RE_DFA_BUCKETS; i++)
+    dfa->table[i] = -1;
+}
+
+/* Return a fresh generation for the marks of DFA's nodes.  */
+
+static unsigned
+re_dfa_new_marks (struct re_dfa *dfa)
+{
+  if (++dfa->mark_gen == 0)
+    {
+      memset (dfa->mark, 0, dfa->nnodes * sizeof *dfa->mark);
+      dfa->mark_gen = 1;
+    }
+  return dfa->mark_gen;
+}
+
+/* Return the state of DFA with the N nodes at NODES and FLAGS, making
+   it if need be.  Flush the cache if it is full; this invalidates all
+   states, so NODES must not be in the cache.  */
+
+static int
+re_dfa_state (struct re_dfa *dfa, const int *nodes, int n, int flags)
+{
+  unsigned hash = flags;
+  int i, s, bucket;
+
+  for (i = 0; i < n; i++)
+    hash = hash * 31 + nodes[i];
+  bucket = hash % RE_DFA_BUCKETS;
+
+  for (s = dfa->table[bucket]; s >= 0; s = dfa->state[s].chain)
+    if (dfa->state[s].flags == flags && dfa->state[s].nnodes == n
+	&& !memcmp (dfa->pool + dfa->state[s].nodes, nodes, n * sizeof *nodes))
+      return s;
+
+  if (dfa->nstates == RE_DFA_MAX_STATES
+      || dfa->pool_used + n > max (RE_DFA_POOL_SIZE, dfa->nnodes))
+    {
+      dfa->thrashing = (dfa->scanned
+			< RE_DFA_MIN_BYTES_PER_STATE * RE_DFA_MAX_STATES);
+      re_dfa_flush (dfa);
+      bucket = hash % RE_DFA_BUCKETS;
+    }
+
+#ifdef REL_ALLOC
+  /* Allocating memory must not move the text being searched.  */
+  r_alloc_inhibit_buffer_relocation (1);
+#endif
+  if (dfa->nstates == dfa->states_allocated)
+    {
+      int alloc = max (16, 2 * dfa->states_allocated);
+
+      dfa->state = xnrealloc (dfa->state, alloc, sizeof *dfa->state);
+      dfa->trans = xnrealloc (dfa->trans, alloc, 256 * sizeof *dfa->trans);
+      dfa->states_allocated = alloc;
+    }
+  if (dfa->pool_used + n > dfa->pool_allocated)
+    {
+      ptrdiff_t alloc = max (dfa->pool_used + n, 2 * dfa->pool_allocated);
+
+      alloc = min (alloc, max (RE_DFA_POOL_SIZE, dfa->nnodes));
+      dfa->pool = xnrealloc (dfa->pool, alloc, sizeof *dfa->pool);
+      dfa->pool_allocated = alloc;
+    }
+#ifdef REL_ALLOC
+  r_alloc_inhibit_buffer_relocation (0);
+#endif
+
+  s = dfa->nstates++;
+  dfa->state[s].nodes = dfa->pool_used;
+  dfa->state[s].nnodes = n;
+  dfa->state[s].flags = flags;
+  dfa->state[s].chain = dfa->table[bucket];
+  dfa->table[bucket] = s;
+  memcpy (dfa->pool + dfa->pool_used, nodes, n * sizeof *nodes);
+  dfa->pool_used += n;
+  for (i = 0; i < 256; i++)
+    dfa->trans[s * 256 + i] = -1;
+  return s;
+}
+
+/* Return the flags describing the character C, converted to
+   multibyte, as the character before a position; C is -1 at the
+   beginning of the text.  */
+
+static int
+re_dfa_context_flags (struct re_dfa *dfa, int c)
+{
+  int flags;
+
+  if (c < 0)
+    return RE_DFA_AT_BEG;
+  flags = c == '\n' ? RE_DFA_AFTER_NEWLINE : 0;
+  if (dfa->uses_syntax)
+    {
+      enum syntaxcode syntax = SYNTAX (c);
+
+      if (syntax == Sword)
+	flags |= RE_DFA_AFTER_WORD;
+      else if (syntax == Ssymbol)
+	flags |= RE_DFA_AFTER_SYMBOL;
+    }
+  if (dfa->word_boundaries && !SINGLE_BYTE_CHAR_P (c))
+    flags |= RE_DFA_AFTER_WIDE;
+  return flags;
+}
+
+/* Return true if the RE_DFA_CHAR node NODE of BUFP's automaton matches
+   C, a character as it is in the text.  This must agree with
+   re_match_2_internal.  */
+
+static bool
+re_dfa_char_matches (struct re_pattern_buffer *bufp,
+		     struct re_dfa_node *node, int c)
+{
+  RE_TRANSLATE_TYPE translate = bufp->translate;
+  const boolean target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+
+  switch (node->op)
+    {
+    case exactn:
+      if (target_multibyte)
+	return TRANSLATE (c) == node->arg;
+      else
+	{
+	  int buf_ch = RE_CHAR_TO_MULTIBYTE (c);
+
+	  if (! CHAR_BYTE8_P (buf_ch))
+	    {
+	      buf_ch = TRANSLATE (buf_ch);
+	      buf_ch = RE_CHAR_TO_UNIBYTE (buf_ch);
+	      if (buf_ch < 0)
+		buf_ch = c;
+	    }
+	  else
+	    buf_ch = c;
+	  return buf_ch == node->arg2;
+	}
+
+    case anychar:
+      c = TRANSLATE (c);
+      return !((!(bufp->syntax & RE_DOT_NEWLINE) && c == '\n')
+	       || ((bufp->syntax & RE_DOT_NOT_NULL) && c == '\000'));
+
+    case charset:
+    case charset_not:
+      {
+	re_char *p = bufp->buffer + node->arg;
+	boolean not = (re_opcode_t) *p == charset_not;
+	boolean unibyte_char = false;
+
+	if (target_multibyte)
+	  {
+	    int c1;
+
+	    c = TRANSLATE (c);
+	    c1 = RE_CHAR_TO_UNIBYTE (c);
+	    if (c1 >= 0)
+	      {
+		unibyte_char = true;
+		c = c1;
+	      }
+	  }
+	else
+	  {
+	    int c1 = RE_CHAR_TO_MULTIBYTE (c);
+
+	    if (! CHAR_BYTE8_P (c1))
+	      {
+		c1 = TRANSLATE (c1);
+		c1 = RE_CHAR_TO_UNIBYTE (c1);
+		if (c1 >= 0)
+		  {
+		    unibyte_char = true;
+		    c = c1;
+		  }
+	      }
+	    else
+	      unibyte_char = true;
+	  }
+
+	if (unibyte_char && c < (1 << BYTEWIDTH))
+	  {
+	    if (c < CHARSET_BITMAP_SIZE (p) * BYTEWIDTH
+		&& p[2 + c / BYTEWIDTH] & (1 << (c % BYTEWIDTH)))
+	      not = !not;
+	  }
+	else if (CHARSET_RANGE_TABLE_EXISTS_P (p))
+	  {
+	    int class_bits = CHARSET_RANGE_TABLE_BITS (p);
+
+	    if (  (class_bits & BIT_LOWER && ISLOWER (c))
+		| (class_bits & BIT_MULTIBYTE)
+		| (class_bits & BIT_PUNCT && ISPUNCT (c))
+		| (class_bits & BIT_SPACE && ISSPACE (c))
+		| (class_bits & BIT_UPPER && ISUPPER (c))
+		| (class_bits & BIT_WORD  && ISWORD  (c))
+		| (class_bits & BIT_ALPHA && ISALPHA (c))
+		| (class_bits & BIT_ALNUM && ISALNUM (c))
+		| (class_bits & BIT_GRAPH && ISGRAPH (c))
+		| (class_bits & BIT_PRINT && ISPRINT (c)))
+	      not = !not;
+	    else
+	      CHARSET_LOOKUP_RANGE_TABLE (not, c, p);
+	  }
+	return not;
+      }
+
+    case syntaxspec:
+    case notsyntaxspec:
+      if (!target_multibyte)
+	c = RE_CHAR_TO_MULTIBYTE (c);
+      return (SYNTAX (c) == node->arg) != (node->op == notsyntaxspec);
+
+    default:
+      abort ();
+    }
+}
+
+/* Return true if the assertion OP of BUFP holds in the context CTX.
+   This must agree with re_match_2_internal.  */
+
+static bool
+re_dfa_assertion_holds (struct re_pattern_buffer *bufp, int op,
+			struct re_dfa_context *ctx)
+{
+  const boolean target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  int c1 = ctx->before;
+  int c2 = ctx->after;
+  int c2m = c2 < 0 || target_multibyte ? c2 : RE_CHAR_TO_MULTIBYTE (c2);
+  int s1, s2;
+
+  switch (op)
+    {
+    case begline:
+      return c1 < 0 ? !bufp->not_bol : c1 == '\n';
+
+    case endline:
+      return c2 < 0 ? !bufp->not_eol : c2 == '\n';
+
+    case begbuf:
+      return c1 < 0;
+
+    case endbuf:
+      return c2 < 0;
+
+    case wordbound:
+    case notwordbound:
+      {
+	bool boundary;
+
+	if (c1 < 0 || c2 < 0)
+	  boundary = true;
+	else
+	  {
+	    s1 = SYNTAX (c1);
+	    s2 = SYNTAX (c2m);
+	    boundary = (((s1 == Sword) != (s2 == Sword))
+			|| (s1 == Sword && WORD_BOUNDARY_P (c1, c2m)));
+	  }
+	return boundary == (op == wordbound);
+      }
+
+    case wordbeg:
+      if (c2 < 0 || ctx->at_limit || SYNTAX (c2m) != Sword)
+	return false;
+      return !(c1 >= 0 && SYNTAX (c1) == Sword && !WORD_BOUNDARY_P (c1, c2m));
+
+    case wordend:
+      if (c1 < 0 || SYNTAX (c1) != Sword)
+	return false;
+      return !(c2 >= 0 && SYNTAX (c2m) == Sword && !WORD_BOUNDARY_P (c1, c2m));
+
+    case symbeg:
+      if (c2 < 0 || ctx->at_limit)
+	return false;
+      s2 = SYNTAX (c2);
+      if (s2 != Sword && s2 != Ssymbol)
+	return false;
+      if (c1 < 0)
+	return true;
+      s1 = SYNTAX (c1);
+      return s1 != Sword && s1 != Ssymbol;
+
+    case symend:
+      if (c1 < 0)
+	return false;
+      s1 = SYNTAX (c1);
+      if (s1 != Sword && s1 != Ssymbol)
+	return false;
+      if (c2 < 0)
+	return true;
+      s2 = SYNTAX (c2);
+      return s2 != Sword && s2 != Ssymbol;
+
+    default:
+      abort ();
+    }
+}
+
+/* Follow the threads at the N nodes of LIST, and then a new thread if
+   STARTING, through the nodes that read no character, in the context
+   CTX.  Store the RE_DFA_CHAR nodes they reach in DFA->out, in order of
+   priority, their number in *NOUT, and the number of those that only
+   the new thread reaches, which come last, in *NNEW.  Return true if a
+   thread reaches the end of the pattern; the threads of lower priority
+   are then dropped.  */
+
+static bool
+re_dfa_closure (struct re_pattern_buffer *bufp, struct re_dfa *dfa,
+		const int *list, int n, bool starting,
+		struct re_dfa_context *ctx, int *nout, int *nnew)
+{
+  unsigned gen = re_dfa_new_marks (dfa);
+  int *stack = dfa->stack;
+  int i, sp, nodes = 0, first_new = -1;
+
+  for (i = 0; i < n + starting; i++)
+    {
+      if (i == n)
+	first_new = nodes;
+      sp = 0;
+      stack[sp++] = i < n ? list[i] : 0;
+      while (sp > 0)
+	{
+	  int u = stack[--sp];
+	  struct re_dfa_node *node = &dfa->node[u];
+
+	  if (dfa->mark[u] == gen)
+	    continue;
+	  dfa->mark[u] = gen;
+	  switch (node->kind)
+	    {
+	    case RE_DFA_CHAR:
+	      dfa->out[nodes++] = u;
+	      break;
+	    case RE_DFA_SPLIT:
+	      stack[sp++] = node->arg;
+	      stack[sp++] = u + 1;
+	      break;
+	    case RE_DFA_JUMP:
+	      stack[sp++] = node->arg;
+	      break;
+	    case RE_DFA_ASSERT:
+	      if (re_dfa_assertion_holds (bufp, node->op, ctx))
+		stack[sp++] = u + 1;
+	      break;
+	    case RE_DFA_MATCH:
+	      *nout = nodes;
+	      *nnew = first_new < 0 ? 0 : nodes - first_new;
+	      return true;
+	    }
+	}
+    }
+  *nout = nodes;
+  *nnew = first_new < 0 ? 0 : nodes - first_new;
+  return false;
+}
+
+/* Return the transition of BUFP's automaton from STATE over the
+   character C, in the context CTX, encoded as in the cache of
+   transitions.  If CACHE, C is below 256 and the transition depends
+   only on the flags of STATE, so record it.  */
+
+static int
+re_dfa_transition (struct re_pattern_buffer *bufp, int state,
+		   struct re_dfa_context *ctx, int c, bool cache)
+{
+  struct re_dfa *dfa = bufp->dfa;
+  struct re_dfa_state *s = &dfa->state[state];
+  int flags = s->flags;
+  unsigned flushes = dfa->flushes;
+  int i, n = 0, nout, nnew, next, cm, t;
+  bool matched, started = false;
+
+  matched = re_dfa_closure (bufp, dfa, dfa->pool + s->nodes, s->nnodes,
+			    flags & RE_DFA_STARTING, ctx, &nout, &nnew);
+  for (i = 0; i < nout; i++)
+    if (re_dfa_char_matches (bufp, &dfa->node[dfa->out[i]], c))
+      {
+	dfa->list[n++] = dfa->out[i] + 1;
+	if (i >= nout - nnew)
+	  started = true;
+      }
+
+  cm = RE_TARGET_MULTIBYTE_P (bufp) ? c : RE_CHAR_TO_MULTIBYTE (c);
+  flags = ((matched ? 0 : flags & RE_DFA_STARTING)
+	   | re_dfa_context_flags (dfa, cm));
+  next = re_dfa_state (dfa, dfa->list, n, flags);
+
+  /* If the cache was flushed, STATE is gone.  */
+  t = 4 * next + 2 * started + matched;
+  if (cache && dfa->flushes == flushes)
+    dfa->trans[state * 256 + c] = t;
+  return t;
+}
+
+/* Return the character at POS in the virtual concatenation of STRING1
+   and STRING2, as it is in the text, and set *LEN to its length.  */
+
+static int
+re_dfa_char_at (boolean multibyte, re_char *string1, ssize_t size1,
+		re_char *string2, ssize_t pos, int *len)
+{
+  re_char *d = pos < size1 ? string1 + pos : string2 + (pos - size1);
+
+  if (multibyte)
+    return STRING_CHAR_AND_LENGTH (d, *len);
+  *len = 1;
+  return *d;
+}
+
+/* Return the character before POS, which is not 0, in the virtual
+   concatenation of STRING1 and STRING2, as it is in the text, and set
+   *LEN to its length.  */
+
+static int
+re_dfa_char_before (boolean multibyte, re_char *string1, ssize_t size1,
+		    re_char *string2, ssize_t pos, int *len)
+{
+  re_char *start = pos <= size1 ? string1 : string2;
+  re_char *d = pos <= size1 ? string1 + pos : string2 + (pos - size1);
+  re_char *p = d - 1;
+
+  if (multibyte)
+    while (p > start && !CHAR_HEAD_P (*p))
+      p--;
+  *len = d - p;
+  return multibyte ? STRING_CHAR (p) : *p;
+}
+
+/* Return the first position from POS on, and before LIMIT, where the
+   fastmap of BUFP allows a match to start in the virtual concatenation
+   of STRING1 and STRING2, or LIMIT if there is none.  */
+
+static ssize_t
+re_dfa_skip (struct re_pattern_buffer *bufp, re_char *string1, ssize_t size1,
+	     re_char *string2, ssize_t pos, ssize_t limit)
+{
+  RE_TRANSLATE_TYPE translate = bufp->translate;
+  const boolean multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  char *fastmap = bufp->fastmap;
+
+  while (pos < limit)
+    {
+      re_char *d, *dend, *start;
+
+      if (pos < size1)
+	d = string1 + pos, dend = string1 + min (size1, limit);
+      else
+	d = string2 + (pos - size1), dend = string2 + (limit - size1);
+      start = d;
+
+      /* Like the loops of re_search_2.  */
+      if (multibyte && RE_TRANSLATE_P (translate))
+	while (d < dend)
+	  {
+	    int len, c = STRING_CHAR_AND_LENGTH (d, len);
+
+	    c = RE_TRANSLATE (translate, c);
+	    if (fastmap[CHAR_LEADING_CODE (c)])
+	      break;
+	    d += len;
+	  }
+      else if (multibyte)
+	while (d < dend)
+	  {
+	    int len, c = STRING_CHAR_AND_LENGTH (d, len);
+
+	    if (fastmap[CHAR_LEADING_CODE (c)])
+	      break;
+	    d += len;
+	  }
+      else if (RE_TRANSLATE_P (translate))
+	while (d < dend)
+	  {
+	    int c = *d, ch = RE_CHAR_TO_MULTIBYTE (c);
+	    int translated = RE_TRANSLATE (translate, ch);
+
+	    if (translated != ch
+		&& (ch = RE_CHAR_TO_UNIBYTE (translated)) >= 0)
+	      c = ch;
+	    if (fastmap[c])
+	      break;
+	    d++;
+	  }
+      else
+	while (d < dend && !fastmap[*d])
+	  d++;
+
+      pos += d - start;
+      if (d < dend)
+	break;
+    }
+  return pos;
+}
+
+/* Add to the N nodes of LIST, which are marked with GEN, the nodes of
+   BUFP's automaton that lead to them without reading a character in
+   the context CTX, and mark those too.  Return the new number of
+   nodes.  */
+
+static int
+re_dfa_back_closure (struct re_pattern_buffer *bufp, int *list, int n,
+		     unsigned gen, struct re_dfa_context *ctx)
+{
+  struct re_dfa *dfa = bufp->dfa;
+  int i, j;
+
+  for (i = 0; i < n; i++)
+    for (j = dfa->pred_start[list[i]]; j < dfa->pred_start[list[i] + 1]; j++)
+      {
+	int w = dfa->pred[j];
+
+	if (dfa->mark[w] != gen
+	    && (dfa->node[w].kind != RE_DFA_ASSERT
+		|| re_dfa_assertion_holds (bufp, dfa->node[w].op, ctx)))
+	  {
+	    dfa->mark[w] = gen;
+	    list[n++] = w;
+	  }
+      }
+  return n;
+}
+
+/* Return the first position from START on where a match of BUFP can
+   begin that ends at END, or -2 if there is none.  STOP is as in
+   re_search_2.  */
+
+static ssize_t
+re_dfa_match_start (struct re_pattern_buffer *bufp,
+		    re_char *string1, ssize_t size1,
+		    re_char *string2, ssize_t size2,
+		    ssize_t start, ssize_t end, ssize_t stop)
+{
+  struct re_dfa *dfa = bufp->dfa;
+  const boolean multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  int *set = dfa->list, *next = dfa->out;
+  unsigned gen = re_dfa_new_marks (dfa);
+  ssize_t pos = end, found = -2;
+  struct re_dfa_context ctx;
+  int i, n = 0, c = -1, len = 0;
+  unsigned count = 0;
+
+  if (end > 0)
+    c = re_dfa_char_before (multibyte, string1, size1, string2, end, &len);
+  ctx.before = c < 0 || multibyte ? c : RE_CHAR_TO_MULTIBYTE (c);
+  ctx.after = (end < size1 + size2
+	       ? re_dfa_char_at (multibyte, string1, size1, string2, end, &i)
+	       : -1);
+  ctx.at_limit = end == stop;
+
+  /* Go backward from the end of the pattern, keeping the set of nodes
+     from which the text between POS and END can be matched.  */
+  for (i = 0; i < dfa->nnodes; i++)
+    if (dfa->node[i].kind == RE_DFA_MATCH)
+      {
+	dfa->mark[i] = gen;
+	set[n++] = i;
+      }
+  n = re_dfa_back_closure (bufp, set, n, gen, &ctx);
+
+  for (;;)
+    {
+      int *tmp, m = 0;
+
+      if (dfa->mark[0] == gen)
+	found = pos;
+      if (pos == start || n == 0)
+	break;
+
+      pos -= len;
+      ctx.after = c;
+      ctx.at_limit = false;
+      gen = re_dfa_new_marks (dfa);
+      for (i = 0; i < n; i++)
+	{
+	  int v = set[i] - 1;
+
+	  if (v >= 0 && dfa->node[v].kind == RE_DFA_CHAR
+	      && re_dfa_char_matches (bufp, &dfa->node[v], c))
+	    {
+	      dfa->mark[v] = gen;
+	      next[m++] = v;
+	    }
+	}
+      c = -1;
+      if (pos > 0)
+	c = re_dfa_char_before (multibyte, string1, size1, string2, pos, &len);
+      ctx.before = c < 0 || multibyte ? c : RE_CHAR_TO_MULTIBYTE (c);
+      n = re_dfa_back_closure (bufp, next, m, gen, &ctx);
+      tmp = set, set = next, next = tmp;
+      if ((++count & 0xfff) == 0)
+	IMMEDIATE_QUIT_CHECK;
+    }
+  return found;
+}
+
+/* Search like re_search_2 with a RANGE that is not negative, using the
+   automaton of BUFP.  Return the position where the leftmost match
+   begins, -1 if there is no match, or -2 if the automaton cannot
+   tell.  */
+
+static ssize_t
+re_dfa_search (struct re_pattern_buffer *bufp,
+	       re_char *string1, ssize_t size1, re_char *string2, ssize_t size2,
+	       ssize_t startpos, ssize_t range, ssize_t stop)
+{
+  struct re_dfa *dfa = bufp->dfa;
+  const boolean multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  ssize_t total_size = size1 + size2;
+  ssize_t last_start = startpos + range;
+  ssize_t pos = startpos, match_end = -1;
+  struct re_dfa_context ctx;
+  int state, flags, c, len, nout, nnew;
+  unsigned count = 0;
+
+  /* Where the first thread alive since no thread was, started, or -1
+     if none did; and whether more than one thread did so.  A match
+     cannot start before FIRST_START, and if only one thread started,
+     it is the one that matched.  */
+  ssize_t first_start = -1;
+  bool several_starts = false;
+
+  if (!dfa)
+    {
+#ifdef REL_ALLOC
+      /* Allocating memory must not move the text being searched.  */
+      r_alloc_inhibit_buffer_relocation (1);
+#endif
+      dfa = bufp->dfa = re_dfa_make (bufp);
+#ifdef REL_ALLOC
+      r_alloc_inhibit_buffer_relocation (0);
+#endif
+    }
+  if (!dfa->usable
+      || (dfa->multibyte_literals && !multibyte)
+      || (dfa->uses_syntax && parse_sexp_lookup_properties)
+      || startpos < 0 || range < 0 || last_start > stop || stop > total_size)
+    return -2;
+
+  /* Forget the cached transitions if what they depend on changed.  */
+  if (dfa->target_multibyte != multibyte
+      || dfa->not_bol != bufp->not_bol || dfa->not_eol != bufp->not_eol
+      || (dfa->uses_syntax
+	  && !EQ (dfa->syntax_table, gl_state.current_syntax_table))
+      || (dfa->uses_case
+	  && !(EQ (dfa->downcase_table, BVAR (current_buffer, downcase_table))
+	       && EQ (dfa->upcase_table, BVAR (current_buffer, upcase_table)))))
+    {
+      re_dfa_flush (dfa);
+      dfa->target_multibyte = multibyte;
+      dfa->not_bol = bufp->not_bol;
+      dfa->not_eol = bufp->not_eol;
+      dfa->syntax_table = gl_state.current_syntax_table;
+      dfa->downcase_table = BVAR (current_buffer, downcase_table);
+      dfa->upcase_table = BVAR (current_buffer, upcase_table);
+    }
+  dfa->thrashing = false;
+
+  c = -1;
+  if (startpos > 0)
+    c = re_dfa_char_before (multibyte, string1, size1, string2, startpos, &len);
+  ctx.before = c < 0 || multibyte ? c : RE_CHAR_TO_MULTIBYTE (c);
+  ctx.at_limit = false;
+  state = re_dfa_state (dfa, dfa->list, 0,
+			RE_DFA_STARTING | re_dfa_context_flags (dfa, ctx.before));
+
+  for (;;)
+    {
+      struct re_dfa_state *s = &dfa->state[state];
+      int t;
+
+      flags = s->flags;
+      if (pos > last_start && flags & RE_DFA_STARTING)
+	{
+	  /* No more matches may start.  */
+	  flags &= ~RE_DFA_STARTING;
+	  memcpy (dfa->list, dfa->pool + s->nodes, s->nnodes * sizeof *dfa->list);
+	  state = re_dfa_state (dfa, dfa->list, s->nnodes, flags);
+	  s = &dfa->state[state];
+	}
+      if (s->nnodes == 0 && !(flags & RE_DFA_STARTING))
+	break;
+
+      if (s->nnodes == 0)
+	{
+	  first_start = -1;
+	  several_starts = false;
+	}
+      if (s->nnodes == 0
+	  && ((bufp->literal_prefix && re_literal_usable (bufp))
+	      || (bufp->fastmap && bufp->fastmap_accurate
+		  && !bufp->can_be_null)))
+	{
+	  /* No thread is alive, so go straight to where one can start.  */
+	  ssize_t next;
+
+	  if (bufp->literal_prefix && re_literal_usable (bufp))
+	    {
+	      next = re_find_literal (bufp, string1, size1, string2, pos,
+				      min (last_start + bufp->literal_length,
+					   stop));
+	      if (next < 0)
+		break;
+	    }
+	  else
+	    next = re_dfa_skip (bufp, string1, size1, string2,
+				pos, last_start);
+
+	  if (next > pos)
+	    {
+	      dfa->scanned += next - pos;
+	      pos = next;
+	      c = re_dfa_char_before (multibyte, string1, size1, string2,
+				      pos, &len);
+	      ctx.before = multibyte ? c : RE_CHAR_TO_MULTIBYTE (c);
+	      state = re_dfa_state (dfa, dfa->list, 0,
+				    (RE_DFA_STARTING
+				     | re_dfa_context_flags (dfa, ctx.before)));
+	      continue;
+	    }
+	}
+
+      if (pos == stop)
+	{
+	  /* See whether a match ends here.  */
+	  ctx.after = (pos < total_size
+		       ? re_dfa_char_at (multibyte, string1, size1, string2,
+					 pos, &len)
+		       : -1);
+	  ctx.at_limit = true;
+	  if (re_dfa_closure (bufp, dfa, dfa->pool + s->nodes, s->nnodes,
+			      flags & RE_DFA_STARTING, &ctx, &nout, &nnew))
+	    match_end = pos;
+	  break;
+	}
+
+      c = re_dfa_char_at (multibyte, string1, size1, string2, pos, &len);
+      ctx.after = c;
+      if (c < 256 && !(flags & RE_DFA_AFTER_WIDE)
+	  && (multibyte || c < 128 || !dfa->word_boundaries))
+	{
+	  t = dfa->trans[state * 256 + c];
+	  if (t < 0)
+	    t = re_dfa_transition (bufp, state, &ctx, c, true);
+	}
+      else
+	t = re_dfa_transition (bufp, state, &ctx, c, false);
+      if (dfa->thrashing)
+	return -2;
+
+      if (t & 1)
+	match_end = pos;
+      if (t & 2)
+	{
+	  if (first_start >= 0)
+	    several_starts = true;
+	  else
+	    first_start = pos;
+	}
+      state = t >> 2;
+      ctx.before = multibyte ? c : RE_CHAR_TO_MULTIBYTE (c);
+      pos += len;
+      dfa->scanned += len;
+      if ((++count & 0xfff) == 0)
+	IMMEDIATE_QUIT_CHECK;
+    }
+
+  if (match_end < 0)
+    return -1;
+  if (range == 0)
+    return startpos;
+
+  /* If no thread was alive when the match ended, it is empty.  */
+  if (first_start < 0)
+    return match_end;
+  if (!several_starts)
+    return first_start;
+  return re_dfa_match_start (bufp, string1, size1, string2, size2,
+			     first_start, match_end, stop);
+}
+
+#endif /* emacs */
+
+/* Searching routines.  */
+
+/* Like re_search_2, below, but only one string is specified, and
+   doesn't let you say where to stop matching. */
+
+regoff_t
+re_search (struct re_pattern_buffer *bufp, const char *string, size_t size,
+	   ssize_t startpos, ssize_t range, struct re_registers *regs)
+{
+  return re_search_2 (bufp, NULL, 0, string, size, startpos, range,
+		      regs, size);
+}
+WEAK_ALIAS (__re_search, re_search)
+
+/* Head address of virtual concatenation of string.  */
+#define HEAD_ADDR_VSTRING(P)		\
+  (((P) >= size1 ? string2 : string1))
+
+/* Address of POS in the concatenation of virtual string. */
+#define POS_ADDR_VSTRING(POS)					\
+  (((POS) >= size1 ? string2 - size1 : string1) + (POS))
+
+/* Using the compiled pattern in BUFP->buffer, first tries to match the
+   virtual concatenation of STRING1 and STRING2, starting first at index
+   STARTPOS, then at STARTPOS + 1, and so on.
+
+   STRING1 and STRING2 have length SIZE1 and SIZE2, respectively.
+
+   RANGE is how far to scan while trying to match.  RANGE = 0 means try
+   only at STARTPOS; in general, the last start tried is STARTPOS +
+   RANGE.
+
+   In REGS, return the indices of the virtual concatenation of STRING1
+   and STRING2 that matched the entire BUFP->buffer and its contained
+   subexpressions.
+
+   Do not consider matching one past the index STOP in the virtual
+   concatenation of STRING1 and STRING2.
+
+   We return either the position in the strings at which the match was
+   found, -1 if no match, or -2 if error (such as failure
+   stack overflow).  */
+
+regoff_t
+re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
+	     const char *str2, size_t size2, ssize_t startpos, ssize_t range,
+	     struct re_registers *regs, ssize_t stop)
+{
+  regoff_t val;
+  re_char *string1 = (re_char*) str1;
+  re_char *string2 = (re_char*) str2;
+  register char *fastmap = bufp->fastmap;
+  register RE_TRANSLATE_TYPE translate = bufp->translate;
+  size_t total_size = size1 + size2;
+  ssize_t endpos = startpos + range;
+  boolean anchored_start;
+  /* Nonzero if we are searching multibyte string.  */
+  const boolean multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+#ifdef emacs
+  /* True if every match starts with a literal we can look for.  */
+  bool literal_start;
+#endif
+
+  /* Check for out-of-range STARTPOS.  */
+  if (startpos < 0 || startpos > total_size)
+    return -1;
+
+  /* Fix up RANGE if it might eventually take us outside
+     the virtual concatenation of STRING1 and STRING2.
+     Make sure we won't move STARTPOS below 0 or above TOTAL_SIZE.  */
+  if (endpos < 0)
+    range = 0 - startpos;
+  else if (endpos > total_size)
+    range = total_size - startpos;
+
+  /* If the search isn't to be a backwards one, don't waste time in a
+     search for a pattern anchored at beginning of buffer.  */
   if (bufp->used > 0 && (re_opcode_t) bufp->buffer[0] == begbuf && range > 0)
     {
       if (startpos > 0)
@@ -4322,6 +6067,32 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
 
     SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, charpos, 1);
   }
+
+  /* Every match contains the literal, so there is no match unless it
+     is there.  Unless the match starts with it, don't look for it
+     much further than the matcher would look.  */
+  literal_start = (range > 0 && stop <= total_size
+		   && bufp->literal_prefix && re_literal_usable (bufp));
+  if (range > 0 && stop <= total_size && re_literal_usable (bufp)
+      && !literal_start && stop - (startpos + range) <= range
+      && re_find_literal (bufp, string1, size1, string2,
+			  startpos, stop) < 0)
+    return -1;
+
+  /* Let the automaton find where the leftmost match starts, if it
+     can.  The matcher then only has to confirm it there.  */
+  if (range >= 0 && regexp_use_automaton)
+    {
+      ssize_t start = re_dfa_search (bufp, string1, size1, string2, size2,
+				     startpos, range, stop);
+      if (start == -1)
+	return -1;
+      if (start >= 0)
+	{
+	  range -= start - startpos;
+	  startpos = start;
+	}
+    }
 #endif
 
   /* Loop through the string, looking for a place to start matching.  */
@@ -4339,6 +6110,21 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, size_t size1,
 	    goto advance;
 	}
 
+#ifdef emacs
+      /* If every match starts with the literal, go straight to it.  */
+      if (literal_start && range > 0)
+	{
+	  ssize_t start
+	    = re_find_literal (bufp, string1, size1, string2, startpos,
+			       min (startpos + range + bufp->literal_length,
+				    stop));
+	  if (start < 0)
+	    return -1;
+	  range -= start - startpos;
+	  startpos = start;
+	}
+      else
+#endif
       /* If a fastmap is supplied, skip quickly over characters that
 	 cannot be the start of a match.  If the pattern can match the
 	 null string, however, we don't need to skip characters; we want
@@ -4917,6 +6703,11 @@ re_match_2 (struct re_pattern_buffer *bufp, const char *string1,
   gl_state.object = re_match_object; /* Used by SYNTAX_TABLE_BYTE_TO_CHAR. */
   charpos = SYNTAX_TABLE_BYTE_TO_CHAR (POS_AS_IN_BUFFER (pos));
   SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, charpos, 1);
+
+  if (regexp_use_automaton
+      && re_dfa_search (bufp, (re_char *) string1, size1,
+			(re_char *) string2, size2, pos, 0, stop) == -1)
+    return -1;
 #endif
 
   result = re_match_2_internal (bufp, (re_char*) string1, size1,
@@ -333,6 +333,12 @@ typedef enum
 # define RE_TRANSLATE_TYPE char *
 #endif
 
+#ifdef emacs
+/* The most bytes of literal text that a compiled pattern records as
+   part of every match.  */
+# define RE_LITERAL_MAX 16
+#endif
+
 struct re_pattern_buffer
 {
 /* [[[begin pattern_buffer]]] */
@@ -409,6 +415,28 @@ struct re_pattern_buffer
 
   /* Charset of unibyte characters at compiling time. */
   int charset_unibyte;
+
+  /* The automaton that searches for the pattern, built on the first
+     search, or NULL.  */
+  struct re_dfa *dfa;
+
+  /* A string of LITERAL_LENGTH bytes that every match contains, in
+     multibyte form.  Where case is ignored, LITERAL_ALT has the other
+     case of each byte.  LITERAL_ANCHOR is the index of the byte to
+     look for first.  */
+  unsigned char literal[RE_LITERAL_MAX], literal_alt[RE_LITERAL_MAX];
+  unsigned char literal_length, literal_anchor;
+
+  /* If true, every match starts with the literal.  */
+  unsigned literal_prefix : 1;
+
+  /* If true, the literal has non-ASCII characters, so it can only be
+     found in multibyte text.  */
+  unsigned literal_multibyte : 1;
+
+  /* If true, translating the text by TRANSLATE cannot change what the
+     pattern matches, so the pattern can be used without it.  */
+  unsigned caseless : 1;
 #endif
 
 /* [[[end pattern_buffer]]] */
@@ -523,6 +551,11 @@ extern void re_set_registers (struct re_pattern_buffer *__buffer,
 			      unsigned __num_regs,
 			      regoff_t *__starts, regoff_t *__ends);
 
+#ifdef emacs
+/* Free the automaton that searches for the pattern in BUFFER.  */
+extern void re_free_automaton (struct re_pattern_buffer *__buffer);
+#endif
+
 #if defined _REGEX_RE_COMP || defined _LIBC
 # ifndef _CRAY
 /* 4.2 bsd compatibility.  */
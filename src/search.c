@@ -29,34 +29,52 @@ along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
 #include "region-cache.h"
 #include "blockinput.h"
 #include "intervals.h"
+#include "systime.h"
 
 #include <sys/types.h>
 #include "regex.h"
 
-#define REGEXP_CACHE_SIZE 20
+/* The default number of entries in the cache of compiled regexps.  */
+#define REGEXP_CACHE_SIZE 100
 
 /* If the regexp is non-nil, then the buffer contains the compiled form
    of that regexp, suitable for searching.  */
 struct regexp_cache
 {
-  struct regexp_cache *next;
+  /* The neighbors of this entry in the list of all the entries, which
+     goes from the most to the least recently used.  */
+  struct regexp_cache *next, *prev;
+  /* The next entry in the same bucket of the index.  */
+  struct regexp_cache *next_in_bucket;
+  /* The hash code of the regexp, which decides its bucket.  */
+  EMACS_UINT hash;
   Lisp_Object regexp, whitespace_regexp;
   /* Syntax table for which the regexp applies.  We need this because
      of character classes.  If this is t, then the compiled pattern is valid
      for any syntax-table.  */
   Lisp_Object syntax_table;
+  /* Translation table for which the regexp was compiled, or nil.  If
+     the compiled pattern is caseless, it does not use the table, and
+     it is valid for nil as well.  */
+  Lisp_Object translate;
   struct re_pattern_buffer buf;
   char fastmap[0400];
   /* True means regexp was compiled to do full POSIX backtracking.  */
   bool posix;
 };
 
-/* The instances of that struct.  */
-static struct regexp_cache searchbufs[REGEXP_CACHE_SIZE];
+/* The instances of that struct, and their number.  */
+static struct regexp_cache *searchbufs;
+static ptrdiff_t searchbufs_size;
 
-/* The head of the linked list; points to the most recently used buffer.  */
-static struct regexp_cache *searchbuf_head;
+/* The index of the instances that have a regexp.  Bucket I has those
+   whose hash code is I modulo the number of buckets, a power of 2.  */
+static struct regexp_cache **searchbuf_index;
+static ptrdiff_t searchbuf_index_size;
 
+/* The ends of the linked list; the head points to the most recently
+   used buffer.  */
+static struct regexp_cache *searchbuf_head, *searchbuf_tail;
 
 /* Every call to re_match, etc., must pass &search_regs as the regs
    argument unless you can show it is unnecessary (i.e., if re_match
@@ -74,13 +92,10 @@ static struct regexp_cache *searchbuf_head;
    time you call a searching or matching function.  Therefore, we need
    to call re_set_registers after compiling a new pattern or after
    setting the match registers, so that the regex functions will be
-   able to free or re-allocate it properly.  */
-static struct re_registers search_regs;
+   able to free or re-allocate it properly.
 
-/* The buffer in which the last search was performed, or
-   Qt if the last search was done in a string;
-   Qnil if no searching has been done yet.  */
-static Lisp_Object last_thing_searched;
+   Each thread has its own match data, so search_regs and
+   last_thing_searched are defined in thread.h.  */
 
 static void set_search_regs (ptrdiff_t, ptrdiff_t);
 static void save_search_regs (void);
@@ -117,6 +132,7 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
   reg_syntax_t old;
 
   cp->regexp = Qnil;
+  cp->translate = translate;
   cp->buf.translate = (! NILP (translate) ? translate : make_number (0));
   cp->posix = posix;
   cp->buf.multibyte = STRING_MULTIBYTE (pattern);
@@ -153,11 +169,84 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
   if (val)
     xsignal1 (Qinvalid_regexp, build_string (val));
 
+  /* Searching without translating the text is faster, and gives the
+     same results if the pattern is caseless.  */
+  if (cp->buf.caseless)
+    cp->buf.translate = make_number (0);
+
   cp->regexp = Fcopy_sequence (pattern);
 }
 
+/* Remove the regexp of CP from the cache, if it has one.  */
+
+static void
+uncache_regexp (struct regexp_cache *cp)
+{
+  struct regexp_cache **cpp;
+
+  if (NILP (cp->regexp))
+    return;
+  for (cpp = &searchbuf_index[cp->hash & (searchbuf_index_size - 1)];
+       *cpp != cp; cpp = &(*cpp)->next_in_bucket)
+    ;
+  *cpp = cp->next_in_bucket;
+  cp->regexp = Qnil;
+}
+
+/* Make the cache have SIZE empty entries.  */
+
+static void
+resize_regexp_cache (ptrdiff_t size)
+{
+  ptrdiff_t i;
+
+  for (i = 0; i < searchbufs_size; i++)
+    {
+      xfree (searchbufs[i].buf.buffer);
+      re_free_automaton (&searchbufs[i].buf);
+    }
+  xfree (searchbufs);
+  xfree (searchbuf_index);
+
+  searchbufs = xzalloc (size * sizeof *searchbufs);
+  searchbufs_size = size;
+  for (searchbuf_index_size = 1; searchbuf_index_size < size;
+       searchbuf_index_size *= 2)
+    ;
+  searchbuf_index = xzalloc (searchbuf_index_size * sizeof *searchbuf_index);
+  for (i = 0; i < size; i++)
+    {
+      searchbufs[i].buf.fastmap = searchbufs[i].fastmap;
+      searchbufs[i].regexp = Qnil;
+      searchbufs[i].whitespace_regexp = Qnil;
+      searchbufs[i].syntax_table = Qnil;
+      searchbufs[i].translate = Qnil;
+      searchbufs[i].prev = i == 0 ? 0 : &searchbufs[i - 1];
+      searchbufs[i].next = i == size - 1 ? 0 : &searchbufs[i + 1];
+    }
+  searchbuf_head = &searchbufs[0];
+  searchbuf_tail = &searchbufs[size - 1];
+}
+
+/* Mark the Lisp objects that the cache refers to.
+   This is called from garbage collection.  */
+
+void
+mark_regexp_cache (void)
+{
+  ptrdiff_t i;
+
+  for (i = 0; i < searchbufs_size; i++)
+    {
+      mark_object (searchbufs[i].regexp);
+      mark_object (searchbufs[i].whitespace_regexp);
+      mark_object (searchbufs[i].syntax_table);
+      mark_object (searchbufs[i].translate);
+    }
+}
+
 /* Shrink each compiled regexp buffer in the cache
-   to the size actually used right now.
+   to the size actually used right now, and free its automaton.
    This is called from garbage collection.  */
 
 void
@@ -167,8 +256,13 @@ shrink_regexp_cache (void)
 
   for (cp = searchbuf_head; cp != 0; cp = cp->next)
     {
+      if (!cp->buf.buffer)
+	continue;
       cp->buf.allocated = cp->buf.used;
       cp->buf.buffer = xrealloc (cp->buf.buffer, cp->buf.used);
+      /* The automaton refers to the tables it was made for without
+	 protecting them from garbage collection.  */
+      re_free_automaton (&cp->buf);
     }
 }
 
@@ -180,14 +274,20 @@ shrink_regexp_cache (void)
 void
 clear_regexp_cache (void)
 {
-  int i;
+  ptrdiff_t i;
 
-  for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    /* It's tempting to compare with the syntax-table we've actually changed,
-       but it's not sufficient because char-table inheritance means that
-       modifying one syntax-table can change others at the same time.  */
-    if (!EQ (searchbufs[i].syntax_table, Qt))
-      searchbufs[i].regexp = Qnil;
+  for (i = 0; i < searchbufs_size; ++i)
+    {
+      /* It's tempting to compare with the syntax-table we've actually
+	 changed, but it's not sufficient because char-table inheritance
+	 means that modifying one syntax-table can change others at the
+	 same time.  */
+      if (!EQ (searchbufs[i].syntax_table, Qt))
+	uncache_regexp (&searchbufs[i]);
+      /* The transitions cached in the automaton may depend on the
+	 syntax of characters even if the compiled pattern does not.  */
+      re_free_automaton (&searchbufs[i].buf);
+    }
 }
 
 /* Compile a regexp if necessary, but first check to see if there's one in
@@ -205,46 +305,68 @@ struct re_pattern_buffer *
 compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 		 Lisp_Object translate, bool posix, bool multibyte)
 {
-  struct regexp_cache *cp, **cpp;
-
-  for (cpp = &searchbuf_head; ; cpp = &cp->next)
-    {
-      cp = *cpp;
-      /* Entries are initialized to nil, and may be set to nil by
-	 compile_pattern_1 if the pattern isn't valid.  Don't apply
-	 string accessors in those cases.  However, compile_pattern_1
-	 is only applied to the cache entry we pick here to reuse.  So
-	 nil should never appear before a non-nil entry.  */
-      if (NILP (cp->regexp))
-	goto compile_it;
-      if (SCHARS (cp->regexp) == SCHARS (pattern)
-	  && STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
-	  && !NILP (Fstring_equal (cp->regexp, pattern))
-	  && EQ (cp->buf.translate, (! NILP (translate) ? translate : make_number (0)))
-	  && cp->posix == posix
-	  && (EQ (cp->syntax_table, Qt)
-	      || EQ (cp->syntax_table, BVAR (current_buffer, syntax_table)))
-	  && !NILP (Fequal (cp->whitespace_regexp, Vsearch_spaces_regexp))
-	  && cp->buf.charset_unibyte == charset_unibyte)
-	break;
-
-      /* If we're at the end of the cache, compile into the nil cell
-	 we found, or the last (least recently used) cell with a
-	 string value.  */
-      if (cp->next == 0)
-	{
-	compile_it:
-	  compile_pattern_1 (cp, pattern, translate, posix);
-	  break;
-	}
+  struct regexp_cache *cp;
+  EMACS_UINT hash;
+  ptrdiff_t size = clip_to_bounds (1, regexp_cache_size,
+				   (min (PTRDIFF_MAX, SIZE_MAX)
+				    / (2 * sizeof *searchbufs)));
+
+  if (size != searchbufs_size)
+    resize_regexp_cache (size);
+
+  hash = sxhash (pattern, 0);
+  for (cp = searchbuf_index[hash & (searchbuf_index_size - 1)];
+       cp != 0; cp = cp->next_in_bucket)
+    if (cp->hash == hash
+	&& SCHARS (cp->regexp) == SCHARS (pattern)
+	&& STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
+	&& !NILP (Fstring_equal (cp->regexp, pattern))
+	&& (EQ (cp->translate, translate)
+	    || (NILP (translate) && cp->buf.caseless))
+	&& cp->posix == posix
+	&& (EQ (cp->syntax_table, Qt)
+	    || EQ (cp->syntax_table, BVAR (current_buffer, syntax_table)))
+	&& !NILP (Fequal (cp->whitespace_regexp, Vsearch_spaces_regexp))
+	&& cp->buf.charset_unibyte == charset_unibyte)
+      break;
+
+  if (cp)
+    regexp_cache_hits++;
+  else
+    {
+      /* Compile into the least recently used entry.  */
+      struct timespec start = current_timespec ();
+      struct regexp_cache **bucket;
+
+      regexp_cache_misses++;
+      cp = searchbuf_tail;
+      uncache_regexp (cp);
+      compile_pattern_1 (cp, pattern, translate, posix);
+      cp->hash = hash;
+      bucket = &searchbuf_index[hash & (searchbuf_index_size - 1)];
+      cp->next_in_bucket = *bucket;
+      *bucket = cp;
+
+      if (FLOATP (Vregexp_compile_elapsed))
+	Vregexp_compile_elapsed
+	  = make_float (XFLOAT_DATA (Vregexp_compile_elapsed)
+			+ timespectod (timespec_sub (current_timespec (),
+						     start)));
     }
 
-  /* When we get here, cp (aka *cpp) contains the compiled pattern,
-     either because we found it in the cache or because we just compiled it.
-     Move it to the front of the queue to mark it as most recently used.  */
-  *cpp = cp->next;
-  cp->next = searchbuf_head;
-  searchbuf_head = cp;
+  /* Move CP to the front of the list to mark it as most recently used.  */
+  if (cp != searchbuf_head)
+    {
+      cp->prev->next = cp->next;
+      if (cp->next)
+	cp->next->prev = cp->prev;
+      else
+	searchbuf_tail = cp->prev;
+      cp->prev = 0;
+      cp->next = searchbuf_head;
+      searchbuf_head->prev = cp;
+      searchbuf_head = cp;
+    }
 
   /* Advise the searching functions about the space we have allocated
      for register data.  */
@@ -2287,6 +2409,513 @@ and `replace-match'.  */)
   return search_command (regexp, bound, noerror, count, 1, 1, 1);
 }
 
+/* Searching for any of a set of strings.  */
+
+/* An automaton that finds the keywords of a keyword set, built by the
+   Aho-Corasick algorithm.  It reads the multibyte form of the text a
+   byte at a time, after translating its characters by the table it
+   was made for, if any.  It does not distinguish bytes of the same
+   class, which keeps its table of transitions small.  */
+
+struct keyword_automaton
+{
+  /* The number of states and of classes of bytes.  */
+  int nstates, nclasses;
+
+  /* The class of each byte.  If the automaton ignores case, an ASCII
+     byte of the text has the class of its translation, unless
+     TRANSLATE_ASCII is true.  */
+  int class[256];
+
+  /* True if ASCII characters of the text must be translated like the
+     others, because some are translated to other characters than
+     ASCII.  */
+  bool translate_ascii;
+
+  /* The transitions.  The transition of the state whose row of TRANS
+     starts at ROW on a byte of class C is TRANS[ROW + C], which is
+     twice the row of the next state, plus 1 if a keyword ends there.
+     The start state has row 0.  */
+  int *trans;
+
+  /* For each state, the longest keyword that ends there, the keyword
+     that leads there from the start state, and the number of bytes
+     and characters that lead there.  No keyword is -1.  */
+  int *match, *word, *nbytes, *nchars;
+};
+
+struct Lisp_Keyword_Set
+{
+  struct vectorlike_header header;
+
+  /* The keywords, a vector of private copies of the strings given to
+     `make-keyword-set', so that changing those cannot corrupt the
+     automatons, and a vector of the strings themselves, which
+     `search-forward-any' returns.  */
+  Lisp_Object keywords, strings;
+
+  /* The case table that FOLDED is made for, or nil.  */
+  Lisp_Object fold_table;
+
+  /* The automaton that respects case, and the one that ignores it,
+     which is made when needed.  */
+  struct keyword_automaton *exact, *folded;
+};
+
+static struct Lisp_Keyword_Set *
+XKEYWORD_SET (Lisp_Object a)
+{
+  eassert (KEYWORD_SET_P (a));
+  return XUNTAG (a, Lisp_Vectorlike);
+}
+
+static void
+free_keyword_automaton (struct keyword_automaton *ka)
+{
+  if (ka)
+    {
+      xfree (ka->trans);
+      xfree (ka->match);
+      xfree (ka->word);
+      xfree (ka->nbytes);
+      xfree (ka->nchars);
+      xfree (ka);
+    }
+}
+
+/* Free the automata of KS.  This is called when KS is garbage.  */
+
+void
+finalize_keyword_set (struct Lisp_Keyword_Set *ks)
+{
+  free_keyword_automaton (ks->exact);
+  free_keyword_automaton (ks->folded);
+}
+
+/* Return an automaton that finds the strings of the vector KEYWORDS,
+   translated by TRANSLATE if it is not nil.  */
+
+static struct keyword_automaton *
+make_keyword_automaton (Lisp_Object keywords, Lisp_Object translate)
+{
+  struct keyword_automaton *ka;
+  ptrdiff_t nkeywords = ASIZE (keywords), total = 0, i, j;
+  unsigned char *bytes;
+  ptrdiff_t *offset;
+  int kclass[256], *fail, *queue;
+  int nc, s, c, maxstates, head, tail;
+  unsigned char *q;
+  bool used[256];
+
+  /* There are at most 256 classes, and a state for each byte of the
+     keywords and the start state.  */
+  for (i = 0; i < nkeywords; i++)
+    total += SCHARS (AREF (keywords, i));
+  if ((INT_MAX / 2 / 257 - 1) / MAX_MULTIBYTE_LENGTH < total)
+    error ("Too many keywords");
+  ka = xzalloc (sizeof *ka);
+  offset = xnmalloc (nkeywords + 1, sizeof *offset);
+
+  /* Put the keywords in multibyte form, and translate them.  */
+  q = bytes = xmalloc (total * MAX_MULTIBYTE_LENGTH + 1);
+  for (i = 0; i < nkeywords; i++)
+    {
+      Lisp_Object keyword = AREF (keywords, i);
+      unsigned char *p = SDATA (keyword);
+
+      offset[i] = q - bytes;
+      for (j = 0; j < SCHARS (keyword); j++)
+	{
+	  int len;
+
+	  if (STRING_MULTIBYTE (keyword))
+	    c = STRING_CHAR_AND_LENGTH (p, len);
+	  else
+	    c = *p < 0x80 ? *p : BYTE8_TO_CHAR (*p), len = 1;
+	  p += len;
+	  if (!NILP (translate))
+	    c = char_table_translate (translate, c);
+	  q += CHAR_STRING (c, q);
+	}
+    }
+  offset[nkeywords] = total = q - bytes;
+
+  /* Give each byte of the keywords its own class, and the others
+     class 0.  */
+  memset (used, 0, sizeof used);
+  for (j = 0; j < total; j++)
+    used[bytes[j]] = true;
+  nc = 1;
+  for (c = 0; c < 256; c++)
+    kclass[c] = used[c] ? nc++ : 0;
+  for (c = 0; c < 256; c++)
+    ka->class[c] = kclass[c];
+  if (!NILP (translate))
+    {
+      for (c = 0; c < 0x80; c++)
+	if (char_table_translate (translate, c) >= 0x80)
+	  ka->translate_ascii = true;
+      if (!ka->translate_ascii)
+	for (c = 0; c < 0x80; c++)
+	  ka->class[c] = kclass[char_table_translate (translate, c)];
+    }
+  ka->nclasses = nc;
+
+  maxstates = total + 1;
+  ka->trans = xnmalloc (maxstates, nc * sizeof *ka->trans);
+  ka->match = xnmalloc (maxstates, sizeof *ka->match);
+  ka->word = xnmalloc (maxstates, sizeof *ka->word);
+  ka->nbytes = xnmalloc (maxstates, sizeof *ka->nbytes);
+  ka->nchars = xnmalloc (maxstates, sizeof *ka->nchars);
+  fail = xnmalloc (maxstates, sizeof *fail);
+  queue = xnmalloc (maxstates, sizeof *queue);
+
+  /* Make the trie of the keywords.  */
+  ka->nstates = 1;
+  for (c = 0; c < nc; c++)
+    ka->trans[c] = -1;
+  ka->word[0] = -1;
+  ka->nbytes[0] = ka->nchars[0] = 0;
+  for (i = 0; i < nkeywords; i++)
+    {
+      s = 0;
+      for (j = offset[i]; j < offset[i + 1]; j++)
+	{
+	  int *t = &ka->trans[s * nc + kclass[bytes[j]]];
+
+	  if (*t < 0)
+	    {
+	      *t = ka->nstates++;
+	      for (c = 0; c < nc; c++)
+		ka->trans[*t * nc + c] = -1;
+	      ka->word[*t] = -1;
+	      ka->nbytes[*t] = ka->nbytes[s] + 1;
+	      ka->nchars[*t] = (ka->nchars[s]
+				+ CHAR_HEAD_P (bytes[j]));
+	    }
+	  s = *t;
+	}
+      if (ka->word[s] < 0)
+	ka->word[s] = i;
+    }
+
+  /* Make the transitions that leave the trie, breadth first, so that
+     those of the state that a state falls back to are made first.  */
+  head = tail = 0;
+  ka->match[0] = ka->word[0];
+  for (c = 0; c < nc; c++)
+    {
+      int t = ka->trans[c];
+
+      if (t < 0)
+	ka->trans[c] = 0;
+      else
+	{
+	  fail[t] = 0;
+	  queue[tail++] = t;
+	}
+    }
+  while (head < tail)
+    {
+      s = queue[head++];
+      ka->match[s] = (ka->word[s] >= 0 ? ka->word[s]
+		      : ka->match[fail[s]]);
+      for (c = 0; c < nc; c++)
+	{
+	  int t = ka->trans[s * nc + c];
+	  int f = ka->trans[fail[s] * nc + c];
+
+	  if (t < 0)
+	    ka->trans[s * nc + c] = f;
+	  else
+	    {
+	      fail[t] = f;
+	      queue[tail++] = t;
+	    }
+	}
+    }
+  for (j = 0; j < ka->nstates * nc; j++)
+    {
+      int t = ka->trans[j];
+
+      ka->trans[j] = 2 * t * nc + (ka->match[t] >= 0);
+    }
+
+  xfree (fail);
+  xfree (queue);
+  xfree (bytes);
+  xfree (offset);
+  return ka;
+}
+
+/* Return the character at byte position POS of the current buffer,
+   translated by TRANSLATE if it is not nil, and store its length in
+   bytes in *LEN.  */
+
+static int
+keyword_search_char (ptrdiff_t pos, Lisp_Object translate, int *len)
+{
+  int c;
+
+  if (!NILP (BVAR (current_buffer, enable_multibyte_characters)))
+    c = STRING_CHAR_AND_LENGTH (BYTE_POS_ADDR (pos), *len);
+  else
+    {
+      c = FETCH_BYTE (pos);
+      if (c >= 0x80)
+	c = BYTE8_TO_CHAR (c);
+      *len = 1;
+    }
+  return NILP (translate) ? c : char_table_translate (translate, c);
+}
+
+/* Return the longest keyword of KA that occurs at byte position POS of
+   the current buffer and ends by LIM, or -1 if none does.  Store the
+   position where it ends in *END.  */
+
+static int
+keyword_at (struct keyword_automaton *ka, Lisp_Object translate,
+	    ptrdiff_t pos, ptrdiff_t lim, ptrdiff_t *end)
+{
+  int s = 0, found = ka->word[0];
+
+  *end = pos;
+  while (pos < lim)
+    {
+      unsigned char str[MAX_MULTIBYTE_LENGTH];
+      int len, i, c = keyword_search_char (pos, translate, &len);
+      int n = CHAR_STRING (c, str);
+
+      for (i = 0; i < n; i++)
+	{
+	  int t = ka->trans[s * ka->nclasses + ka->class[str[i]]];
+	  int next = t / 2 / ka->nclasses;
+
+	  /* Only the transitions within the trie count.  */
+	  if (ka->nbytes[next] != ka->nbytes[s] + 1)
+	    return found;
+	  s = next;
+	}
+      pos += len;
+      if (ka->word[s] >= 0)
+	{
+	  found = ka->word[s];
+	  *end = pos;
+	}
+    }
+  return found;
+}
+
+/* The number of bytes keyword_search scans between checks for quitting.  */
+#define KEYWORD_SEARCH_CHUNK 65536
+
+/* Search the current buffer from byte position FROM to LIM for the
+   keywords of KA, which are KEYWORDS translated by TRANSLATE.  Return
+   the keyword of the match that starts first, the longest of those
+   that start there, or -1 if there is none.  Store the byte positions
+   where the match starts and ends in *BEG and *END.  */
+
+static int
+keyword_search (struct keyword_automaton *ka, Lisp_Object keywords,
+		Lisp_Object translate, ptrdiff_t from, ptrdiff_t lim,
+		ptrdiff_t *beg, ptrdiff_t *end)
+{
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+  /* Whether ASCII and other bytes of the text go straight to the
+     automaton, rather than as characters to be translated.  */
+  bool ascii_bytes = !ka->translate_ascii;
+  bool other_bytes = multibyte && NILP (translate);
+  const int *trans = ka->trans, *class = ka->class;
+  ptrdiff_t pos = from, start, s0;
+  int t = ka->match[0] >= 0, s, k, i;
+
+  while (! (t & 1) && pos < lim)
+    {
+      /* Scan at most KEYWORD_SEARCH_CHUNK bytes at a time, so as to
+	 check for quitting now and then.  */
+      ptrdiff_t seg_end = min (pos < GPT_BYTE ? min (GPT_BYTE, lim) : lim,
+			       pos + KEYWORD_SEARCH_CHUNK);
+      unsigned char *base, *p, *pend;
+
+      QUIT;
+      base = p = BYTE_POS_ADDR (pos);
+      pend = base + (seg_end - pos);
+
+      while (p < pend)
+	{
+	  int b = *p;
+
+	  if (b < 0x80 ? ascii_bytes : other_bytes)
+	    {
+	      t = trans[t / 2 + class[b]];
+	      p++;
+	    }
+	  else
+	    {
+	      unsigned char str[MAX_MULTIBYTE_LENGTH];
+	      int len, c = keyword_search_char (pos + (p - base), translate,
+						&len);
+	      int n = CHAR_STRING (c, str);
+
+	      for (i = 0; i < n; i++)
+		t = trans[t / 2 + class[str[i]]];
+	      p += len;
+	    }
+	  if (t & 1)
+	    break;
+	}
+      pos += p - base;
+    }
+  if (! (t & 1))
+    return -1;
+
+  /* A keyword ends at POS.  A match that starts before it can only
+     start where the text that leads to the state began.  */
+  s = t / 2 / ka->nclasses;
+  k = ka->match[s];
+  start = s0 = pos;
+  for (i = 0; i < ka->nchars[s]; i++)
+    {
+      if (multibyte)
+	DEC_POS (start);
+      else
+	start--;
+    }
+  for (i = 0; i < SCHARS (AREF (keywords, k)); i++)
+    {
+      if (multibyte)
+	DEC_POS (s0);
+      else
+	s0--;
+    }
+  while (start < s0)
+    {
+      int found = keyword_at (ka, translate, start, lim, end);
+
+      if (found >= 0)
+	{
+	  *beg = start;
+	  return found;
+	}
+      if (multibyte)
+	INC_POS (start);
+      else
+	start++;
+    }
+  *beg = s0;
+  return keyword_at (ka, translate, s0, lim, end);
+}
+
+DEFUN ("make-keyword-set", Fmake_keyword_set, Smake_keyword_set, 1, 1, 0,
+       doc: /* Return a keyword set of KEYWORDS, a list of strings.
+`search-forward-any' searches for all the strings of a keyword set at
+once, much faster than for a regexp that matches any of them.  */)
+  (Lisp_Object keywords)
+{
+  struct Lisp_Keyword_Set *ks;
+  Lisp_Object vec = Fvconcat (1, &keywords), result;
+  ptrdiff_t i;
+
+  for (i = 0; i < ASIZE (vec); i++)
+    CHECK_STRING (AREF (vec, i));
+
+  ks = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Keyword_Set, exact,
+				     PVEC_KEYWORD_SET);
+  ks->strings = vec;
+  ks->keywords = Fcopy_sequence (vec);
+  for (i = 0; i < ASIZE (vec); i++)
+    ASET (ks->keywords, i, Fcopy_sequence (AREF (vec, i)));
+  vec = ks->keywords;
+  ks->exact = make_keyword_automaton (vec, Qnil);
+  XSETKEYWORD_SET (result, ks);
+  return result;
+}
+
+DEFUN ("keyword-set-p", Fkeyword_set_p, Skeyword_set_p, 1, 1, 0,
+       doc: /* Return t if OBJECT is a keyword set.  */)
+  (Lisp_Object object)
+{
+  return KEYWORD_SET_P (object) ? Qt : Qnil;
+}
+
+DEFUN ("search-forward-any", Fsearch_forward_any, Ssearch_forward_any,
+       1, 3, 0,
+       doc: /* Search forward from point for any of the strings of KEYWORDS.
+KEYWORDS is a keyword set made by `make-keyword-set', or a list of
+strings.  Set point to the end of the occurrence found, and return the
+string of KEYWORDS that occurs there.  The occurrence found is the one
+that starts first, and the longest of those that start there.
+An optional second argument bounds the search; it is a buffer position.
+The match found must not extend after that position.  A value of nil is
+  equivalent to (point-max).
+Optional third argument, if t, means if fail just return nil (no error).
+  If not nil and not t, move to limit of search and return nil.
+
+Search case-sensitivity is determined by the value of the variable
+`case-fold-search', which see.
+
+See also the functions `match-beginning', `match-end' and `replace-match'.  */)
+  (Lisp_Object keywords, Lisp_Object bound, Lisp_Object noerror)
+{
+  struct Lisp_Keyword_Set *ks;
+  struct keyword_automaton *ka;
+  Lisp_Object translate = Qnil;
+  ptrdiff_t lim, lim_byte, beg, end;
+  int k;
+
+  if (!KEYWORD_SET_P (keywords))
+    keywords = Fmake_keyword_set (keywords);
+  ks = XKEYWORD_SET (keywords);
+
+  if (NILP (bound))
+    lim = ZV, lim_byte = ZV_BYTE;
+  else
+    {
+      CHECK_NUMBER_COERCE_MARKER (bound);
+      lim = XINT (bound);
+      if (lim < PT)
+	error ("Invalid search bound (wrong side of point)");
+      if (lim > ZV)
+	lim = ZV, lim_byte = ZV_BYTE;
+      else
+	lim_byte = CHAR_TO_BYTE (lim);
+    }
+
+  ka = ks->exact;
+  if (!NILP (BVAR (current_buffer, case_fold_search))
+      && CHAR_TABLE_P (BVAR (current_buffer, case_canon_table)))
+    {
+      translate = BVAR (current_buffer, case_canon_table);
+      if (!EQ (ks->fold_table, translate))
+	{
+	  free_keyword_automaton (ks->folded);
+	  ks->folded = NULL;
+	  ks->fold_table = Qnil;
+	  ks->folded = make_keyword_automaton (ks->keywords, translate);
+	  ks->fold_table = translate;
+	}
+      ka = ks->folded;
+    }
+
+  if (running_asynch_code)
+    save_search_regs ();
+
+  k = keyword_search (ka, ks->keywords, translate, PT_BYTE, lim_byte,
+		      &beg, &end);
+  if (k < 0)
+    {
+      if (NILP (noerror))
+	xsignal1 (Qsearch_failed, keywords);
+      if (!EQ (noerror, Qt))
+	SET_PT_BOTH (lim, lim_byte);
+      return Qnil;
+    }
+
+  set_search_regs (beg, end - beg);
+  SET_PT_BOTH (BYTE_TO_CHAR (end), end);
+  return AREF (ks->strings, k);
+}
+
 DEFUN ("replace-match", Freplace_match, Sreplace_match, 1, 5, 0,
        doc: /* Replace text matched by last search with NEWTEXT.
 Leave point at the end of the replacement text.
@@ -3010,11 +3639,9 @@ If optional arg RESEAT is non-nil, make markers on LIST point nowhere.  */)
   return Qnil;
 }
 
-/* If true the match data have been saved in saved_search_regs
-   during the execution of a sentinel or filter. */
-static bool search_regs_saved;
-static struct re_registers saved_search_regs;
-static Lisp_Object saved_last_thing_searched;
+/* The match data saved during the execution of a sentinel or filter,
+   search_regs_saved, saved_search_regs and saved_last_thing_searched,
+   are per-thread too.  */
 
 /* Called from Flooking_at, Fstring_match, search_buffer, Fstore_match_data
    if asynchronous code (filter or sentinel) is running. */
@@ -3056,19 +3683,249 @@ restore_search_regs (void)
     }
 }
 
+/* Match data objects hold a copy of the match data.  `save-match-data'
+   and record_unwind_save_match_data save the match data into one of
+   these rather than into a list made by Fmatch_data, and give it back
+   afterward, so that once there are enough of them saving and restoring
+   the match data allocates nothing.  */
+
+struct Lisp_Match_Data
+{
+  struct vectorlike_header header;
+
+  /* The value of last_thing_searched when the match data was saved.  */
+  Lisp_Object thing;
+
+  /* A vector of markers, or nil.  If THING is a buffer, markers 2N and
+     2N + 1 hold the positions of group N, so that they follow changes
+     to the buffer like the markers that `match-data' returns.  These
+     markers are never seen by Lisp code, so they are reused.  */
+  Lisp_Object markers;
+
+  /* The next object on match_data_free_list.  */
+  Lisp_Object next;
+
+  /* True if this object is on match_data_free_list.  */
+  bool free;
+
+  /* The saved registers, and the number of them allocated.  */
+  struct re_registers regs;
+  ptrdiff_t size;
+};
+
+/* Match data objects given back for reuse, chained by their NEXT
+   field.  */
+static Lisp_Object match_data_free_list;
+
+static struct Lisp_Match_Data *
+XMATCH_DATA (Lisp_Object a)
+{
+  eassert (MATCH_DATA_P (a));
+  return XUNTAG (a, Lisp_Vectorlike);
+}
+
+void
+finalize_match_data (struct Lisp_Match_Data *md)
+{
+  xfree (md->regs.start);
+  xfree (md->regs.end);
+}
+
+static void
+check_match_data (Lisp_Object object)
+{
+  CHECK_TYPE (MATCH_DATA_P (object), Qmatch_data_object_p, object);
+  if (XMATCH_DATA (object)->free)
+    error ("Match data object was released");
+}
+
+/* Copy the match data into MD.  */
+
+static void
+save_match_data (struct Lisp_Match_Data *md)
+{
+  ptrdiff_t i, nmarkers, n = search_regs.num_regs;
+
+  if (md->size < n)
+    {
+      md->regs.start = xpalloc (md->regs.start, &md->size, n - md->size,
+				min (PTRDIFF_MAX, UINT_MAX),
+				sizeof (regoff_t));
+      md->regs.end = xrealloc (md->regs.end, md->size * sizeof (regoff_t));
+    }
+  md->regs.num_regs = n;
+  md->thing = last_thing_searched;
+  if (n > 0)
+    {
+      memcpy (md->regs.start, search_regs.start, n * sizeof (regoff_t));
+      memcpy (md->regs.end, search_regs.end, n * sizeof (regoff_t));
+    }
+
+  nmarkers = NILP (md->markers) ? 0 : ASIZE (md->markers);
+  if (BUFFERP (md->thing) && nmarkers < 2 * n)
+    {
+      Lisp_Object markers = Fmake_vector (make_number (2 * md->size), Qnil);
+
+      for (i = 0; i < 2 * md->size; i++)
+	if (i < nmarkers)
+	  ASET (markers, i, AREF (md->markers, i));
+	else
+	  {
+	    Lisp_Object marker = Fmake_marker ();
+	    XMARKER (marker)->no_undo = true;
+	    ASET (markers, i, marker);
+	  }
+      md->markers = markers;
+      nmarkers = 2 * md->size;
+    }
+
+  /* Point the markers of the groups that matched in a buffer there,
+     and make the others point nowhere so that they do not slow down
+     changes to the buffer they were in.  */
+  for (i = 0; i < nmarkers; i++)
+    {
+      Lisp_Object marker = AREF (md->markers, i);
+
+      if (BUFFERP (md->thing) && i < 2 * n && md->regs.start[i / 2] >= 0)
+	Fset_marker (marker,
+		     make_number (i & 1
+				  ? md->regs.end[i / 2]
+				  : md->regs.start[i / 2]),
+		     md->thing);
+      else
+	unchain_marker (XMARKER (marker));
+    }
+}
+
+/* Set the match data from MD.  If RELEASE, put MD on
+   match_data_free_list afterward.  */
+
+static void
+restore_match_data (struct Lisp_Match_Data *md, bool release)
+{
+  ptrdiff_t i, n = md->regs.num_regs;
+  bool in_buffer = BUFFERP (md->thing);
+  bool live = in_buffer && BUFFER_LIVE_P (XBUFFER (md->thing));
+
+  if (running_asynch_code)
+    save_search_regs ();
+
+  if (search_regs.num_regs < n)
+    {
+      ptrdiff_t num_regs = search_regs.num_regs;
+      search_regs.start =
+	xpalloc (search_regs.start, &num_regs, n - num_regs,
+		 min (PTRDIFF_MAX, UINT_MAX), sizeof (regoff_t));
+      search_regs.end =
+	xrealloc (search_regs.end, num_regs * sizeof (regoff_t));
+      search_regs.num_regs = num_regs;
+    }
+
+  for (i = 0; i < n; i++)
+    if (md->regs.start[i] < 0)
+      search_regs.start[i] = -1;
+    else if (!in_buffer)
+      {
+	search_regs.start[i] = md->regs.start[i];
+	search_regs.end[i] = md->regs.end[i];
+      }
+    else if (live)
+      {
+	search_regs.start[i] = marker_position (AREF (md->markers, 2 * i));
+	search_regs.end[i] = marker_position (AREF (md->markers, 2 * i + 1));
+      }
+    else
+      /* The buffer was killed, which made the markers point nowhere;
+	 Fset_match_data treats those as 0.  */
+      search_regs.start[i] = search_regs.end[i] = 0;
+  for (; i < search_regs.num_regs; i++)
+    search_regs.start[i] = -1;
+
+  last_thing_searched = in_buffer && !live ? Qt : md->thing;
+
+  if (release)
+    {
+      if (in_buffer)
+	for (i = 0; i < 2 * n; i++)
+	  unchain_marker (XMARKER (AREF (md->markers, i)));
+      md->thing = Qnil;
+      md->free = true;
+      md->next = match_data_free_list;
+      XSETMATCH_DATA (match_data_free_list, md);
+    }
+}
+
+DEFUN ("match-data-save-into", Fmatch_data_save_into,
+       Smatch_data_save_into, 0, 1, 0,
+       doc: /* Save the data on the last search match into OBJECT.
+OBJECT should be a match data object that an earlier call returned.
+If it is nil or omitted, reuse one released by `match-data-restore-from',
+or make a new one.  Return the object.
+
+Unlike `match-data', this allocates nothing when OBJECT has room for
+the groups of the last search.  If the last match was on a buffer, the
+saved positions follow insertions and deletions in the buffer, like
+markers do.  */)
+  (Lisp_Object object)
+{
+  struct Lisp_Match_Data *md;
+
+  if (!NILP (object))
+    check_match_data (object);
+  else if (!NILP (match_data_free_list))
+    {
+      object = match_data_free_list;
+      md = XMATCH_DATA (object);
+      match_data_free_list = md->next;
+      md->next = Qnil;
+      md->free = false;
+    }
+  else
+    {
+      md = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Match_Data, free,
+					 PVEC_MATCH_DATA);
+      XSETMATCH_DATA (object, md);
+    }
+
+  save_match_data (XMATCH_DATA (object));
+  return object;
+}
+
+DEFUN ("match-data-restore-from", Fmatch_data_restore_from,
+       Smatch_data_restore_from, 1, 2, 0,
+       doc: /* Set the data on the last search match from OBJECT.
+OBJECT is a match data object made by `match-data-save-into'.
+
+If optional arg RELEASE is non-nil, OBJECT must not be used again
+afterward: its positions stop following changes to the buffer, and
+`match-data-save-into' can reuse it.  */)
+  (Lisp_Object object, Lisp_Object release)
+{
+  check_match_data (object);
+  restore_match_data (XMATCH_DATA (object), !NILP (release));
+  return Qnil;
+}
+
+DEFUN ("match-data-object-p", Fmatch_data_object_p, Smatch_data_object_p,
+       1, 1, 0,
+       doc: /* Return t if OBJECT is a match data object.  */)
+  (Lisp_Object object)
+{
+  return MATCH_DATA_P (object) ? Qt : Qnil;
+}
+
 static void
-unwind_set_match_data (Lisp_Object list)
+unwind_restore_match_data (Lisp_Object object)
 {
-  /* It is NOT ALWAYS safe to free (evaporate) the markers immediately.  */
-  Fset_match_data (list, Qt);
+  restore_match_data (XMATCH_DATA (object), true);
 }
 
 /* Called to unwind protect the match data.  */
 void
 record_unwind_save_match_data (void)
 {
-  record_unwind_protect (unwind_set_match_data,
-			 Fmatch_data (Qnil, Qnil, Qnil));
+  record_unwind_protect (unwind_restore_match_data,
+			 Fmatch_data_save_into (Qnil));
 }
 
 /* Quote a string to deactivate reg-expr chars */
@@ -3295,29 +4152,17 @@ the buffer.  If the buffer doesn't have a cache, the value is nil.  */)
 void
 syms_of_search (void)
 {
-  register int i;
-
-  for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    {
-      searchbufs[i].buf.allocated = 100;
-      searchbufs[i].buf.buffer = xmalloc (100);
-      searchbufs[i].buf.fastmap = searchbufs[i].fastmap;
-      searchbufs[i].regexp = Qnil;
-      searchbufs[i].whitespace_regexp = Qnil;
-      searchbufs[i].syntax_table = Qnil;
-      staticpro (&searchbufs[i].regexp);
-      staticpro (&searchbufs[i].whitespace_regexp);
-      staticpro (&searchbufs[i].syntax_table);
-      searchbufs[i].next = (i == REGEXP_CACHE_SIZE-1 ? 0 : &searchbufs[i+1]);
-    }
-  searchbuf_head = &searchbufs[0];
-
   /* Error condition used for failing searches.  */
   DEFSYM (Qsearch_failed, "search-failed");
 
   /* Error condition signaled when regexp compile_pattern fails.  */
   DEFSYM (Qinvalid_regexp, "invalid-regexp");
 
+  DEFSYM (Qmatch_data_object_p, "match-data-object-p");
+
+  match_data_free_list = Qnil;
+  staticpro (&match_data_free_list);
+
   Fput (Qsearch_failed, Qerror_conditions,
 	listn (CONSTYPE_PURE, 2, Qsearch_failed, Qerror));
   Fput (Qsearch_failed, Qerror_message,
@@ -3328,12 +4173,6 @@ syms_of_search (void)
   Fput (Qinvalid_regexp, Qerror_message,
 	build_pure_c_string ("Invalid regexp"));
 
-  last_thing_searched = Qnil;
-  staticpro (&last_thing_searched);
-
-  saved_last_thing_searched = Qnil;
-  staticpro (&saved_last_thing_searched);
-
   DEFVAR_LISP ("search-spaces-regexp", Vsearch_spaces_regexp,
       doc: /* Regexp to substitute for bunches of spaces in regexp search.
 Some commands use this for user-specified regexps.
@@ -3350,11 +4189,46 @@ do not set the match data.  The proper way to use this variable
 is to bind it with `let' around a small expression.  */);
   Vinhibit_changing_match_data = Qnil;
 
+  DEFVAR_INT ("regexp-cache-size", regexp_cache_size,
+	      doc: /* Number of compiled regexps that searches keep for reuse.
+Compiling a regexp takes much longer than looking it up, so this
+should exceed the number of regexps used over and over, such as those
+of Font Lock mode.  Changing it discards the compiled regexps.  */);
+  regexp_cache_size = REGEXP_CACHE_SIZE;
+
+  DEFVAR_INT ("regexp-cache-hits", regexp_cache_hits,
+	      doc: /* Number of searches that found their regexp compiled.
+See also `regexp-cache-misses'.  */);
+  regexp_cache_hits = 0;
+
+  DEFVAR_INT ("regexp-cache-misses", regexp_cache_misses,
+	      doc: /* Number of searches that had to compile their regexp.
+See also `regexp-cache-hits' and `regexp-compile-elapsed'.  */);
+  regexp_cache_misses = 0;
+
+  DEFVAR_LISP ("regexp-compile-elapsed", Vregexp_compile_elapsed,
+	       doc: /* Accumulated time elapsed in compiling regexps.
+The time is in seconds as a floating point value.  */);
+  Vregexp_compile_elapsed = make_float (0.0);
+
+  DEFVAR_BOOL ("regexp-use-automaton", regexp_use_automaton,
+      doc: /* Non-nil means regexp searches try a finite automaton first.
+The automaton finds where a match starts in time proportional to the
+length of the text, and the backtracking matcher then only has to
+match there.  It is used for the regexps that have no back-references,
+counted repetitions, or category or point assertions.  A value of nil
+means to use only the backtracking matcher.  The results are the same
+either way.  */);
+  regexp_use_automaton = true;
+
   defsubr (&Slooking_at);
   defsubr (&Sposix_looking_at);
   defsubr (&Sstring_match);
   defsubr (&Sposix_string_match);
   defsubr (&Ssearch_forward);
+  defsubr (&Smake_keyword_set);
+  defsubr (&Skeyword_set_p);
+  defsubr (&Ssearch_forward_any);
   defsubr (&Ssearch_backward);
   defsubr (&Sre_search_forward);
   defsubr (&Sre_search_backward);
@@ -3365,6 +4239,9 @@ is to bind it with `let' around a small expression.  */);
   defsubr (&Smatch_end);
   defsubr (&Smatch_data);
   defsubr (&Sset_match_data);
+  defsubr (&Smatch_data_save_into);
+  defsubr (&Smatch_data_restore_from);
+  defsubr (&Smatch_data_object_p);
   defsubr (&Sregexp_quote);
   defsubr (&Snewline_cache_check);
 }
@@ -86,6 +86,12 @@ fd_SET (int fd, fd_set *set)
 #define FD_ISSET(fd, set) fd_ISSET (fd, set)
 #define FD_SET(fd, set) fd_SET (fd, set)
 
+/* Defined in thread.c.  */
+typedef int select_func (int, fd_set *, fd_set *, fd_set *,
+			 struct timespec const *, sigset_t const *);
+extern int thread_select (select_func *, int, fd_set *, fd_set *, fd_set *,
+			  struct timespec const *, sigset_t const *);
+
 INLINE_HEADER_END
 
 #endif	/* !WINDOWSNT */
@@ -0,0 +1,185 @@
+/* System thread definitions
+   Copyright (C) 2015 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#include <config.h>
+#include <sched.h>
+#include "lisp.h"
+
+#ifdef THREADS_ENABLED
+
+void
+sys_mutex_init (sys_mutex_t *mutex)
+{
+  pthread_mutex_init (mutex, NULL);
+}
+
+void
+sys_mutex_lock (sys_mutex_t *mutex)
+{
+  pthread_mutex_lock (mutex);
+}
+
+void
+sys_mutex_unlock (sys_mutex_t *mutex)
+{
+  pthread_mutex_unlock (mutex);
+}
+
+void
+sys_cond_init (sys_cond_t *cond)
+{
+  pthread_cond_init (cond, NULL);
+}
+
+void
+sys_cond_wait (sys_cond_t *cond, sys_mutex_t *mutex)
+{
+  pthread_cond_wait (cond, mutex);
+}
+
+void
+sys_cond_signal (sys_cond_t *cond)
+{
+  pthread_cond_signal (cond);
+}
+
+void
+sys_cond_broadcast (sys_cond_t *cond)
+{
+  pthread_cond_broadcast (cond);
+}
+
+void
+sys_cond_destroy (sys_cond_t *cond)
+{
+  pthread_cond_destroy (cond);
+}
+
+sys_thread_t
+sys_thread_self (void)
+{
+  return pthread_self ();
+}
+
+bool
+sys_thread_equal (sys_thread_t t, sys_thread_t u)
+{
+  return pthread_equal (t, u);
+}
+
+/* Start a detached thread running FUNC on ARG, storing its handle in
+   *THREAD_PTR.  Return true if successful.  */
+
+bool
+sys_thread_create (sys_thread_t *thread_ptr, thread_creation_function *func,
+		   void *arg)
+{
+  pthread_attr_t attr;
+  bool result = false;
+
+  if (pthread_attr_init (&attr))
+    return false;
+
+  if (!pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED))
+    result = pthread_create (thread_ptr, &attr, func, arg) == 0;
+
+  pthread_attr_destroy (&attr);
+
+  return result;
+}
+
+void
+sys_thread_yield (void)
+{
+  sched_yield ();
+}
+
+#else /* not THREADS_ENABLED */
+
+/* Only the main thread exists, so locking never has to wait.  */
+
+void
+sys_mutex_init (sys_mutex_t *mutex)
+{
+  *mutex = 0;
+}
+
+void
+sys_mutex_lock (sys_mutex_t *mutex)
+{
+}
+
+void
+sys_mutex_unlock (sys_mutex_t *mutex)
+{
+}
+
+void
+sys_cond_init (sys_cond_t *cond)
+{
+  *cond = 0;
+}
+
+/* Waiting would never end, since no other thread can notify COND.  */
+
+void
+sys_cond_wait (sys_cond_t *cond, sys_mutex_t *mutex)
+{
+  emacs_abort ();
+}
+
+void
+sys_cond_signal (sys_cond_t *cond)
+{
+}
+
+void
+sys_cond_broadcast (sys_cond_t *cond)
+{
+}
+
+void
+sys_cond_destroy (sys_cond_t *cond)
+{
+}
+
+sys_thread_t
+sys_thread_self (void)
+{
+  return 0;
+}
+
+bool
+sys_thread_equal (sys_thread_t t, sys_thread_t u)
+{
+  return t == u;
+}
+
+bool
+sys_thread_create (sys_thread_t *thread_ptr, thread_creation_function *func,
+		   void *arg)
+{
+  return false;
+}
+
+void
+sys_thread_yield (void)
+{
+}
+
+#endif /* not THREADS_ENABLED */
@@ -0,0 +1,937 @@
+/* Threading code.
+   Copyright (C) 2015 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.  */
+
+
+#include <config.h>
+#include <errno.h>
+#include <stddef.h>
+#include "lisp.h"
+#include "character.h"
+#include "buffer.h"
+#include "sysselect.h"
+
+static struct thread_state main_thread;
+
+struct thread_state *current_thread = &main_thread;
+
+/* All threads that have been started and have not exited, most
+   recently started first.  */
+static struct thread_state *all_threads = &main_thread;
+
+/* The global lock.  A thread must hold it to run Lisp or to touch any
+   Lisp data.  */
+static sys_mutex_t global_lock;
+
+/* The error form that ended the last thread that exited because of
+   an error.  */
+static Lisp_Object last_thread_error;
+
+/* Return true if THREAD has been started and has not yet exited.  */
+
+static bool
+thread_alive_p (struct thread_state *thread)
+{
+  return thread->m_specpdl != NULL;
+}
+
+static void
+release_global_lock (void)
+{
+  sys_mutex_unlock (&global_lock);
+}
+
+/* You must call this after acquiring the global lock.
+   acquire_global_lock does it for you.  */
+
+static void
+post_acquire_global_lock (struct thread_state *self)
+{
+  struct thread_state *prev_thread = current_thread;
+
+  /* Switch first, so that errors signaled below are signaled in the
+     context of SELF.  */
+  current_thread = self;
+  self->event_object = Qnil;
+
+  if (prev_thread != self)
+    {
+      struct buffer *prev_buffer = prev_thread->m_current_buffer;
+
+      /* The let-bindings of PREV_THREAD are in effect; replace them
+	 with those of SELF.  If PREV_THREAD has exited, it has none
+	 left.  */
+      unbind_for_thread_switch (prev_thread);
+      rebind_for_thread_switch ();
+
+      /* Make the buffer of SELF current even if it is the buffer of
+	 PREV_THREAD, so that the variables forwarded to C reflect the
+	 bindings just made.  */
+      set_buffer_internal_2 (prev_buffer && BUFFER_LIVE_P (prev_buffer)
+			     ? prev_buffer : NULL,
+			     current_buffer);
+    }
+
+  /* A thread that has not yet set up its handlers cannot be signaled
+     yet; it will be the next time it gets the lock.  */
+  if (!NILP (self->error_symbol) && handlerlist)
+    {
+      Lisp_Object sym = self->error_symbol;
+      Lisp_Object data = self->error_data;
+
+      self->error_symbol = Qnil;
+      self->error_data = Qnil;
+      Fsignal (sym, data);
+    }
+}
+
+static void
+acquire_global_lock (struct thread_state *self)
+{
+  sys_mutex_lock (&global_lock);
+  post_acquire_global_lock (self);
+}
+
+
+
+/* Lisp mutexes.  A Lisp mutex is owned by at most one thread at a
+   time.  Waiting for it releases the global lock, and is done on the
+   mutex's condition variable, so that the wait can be interrupted by
+   thread-signal.  */
+
+static void
+lisp_mutex_init (lisp_mutex_t *mutex)
+{
+  mutex->owner = NULL;
+  mutex->count = 0;
+  sys_cond_init (&mutex->condition);
+}
+
+/* Lock MUTEX on behalf of LOCKER, setting its lock count to NEW_COUNT,
+   or incrementing it if NEW_COUNT is zero.  If NEW_COUNT is zero and
+   LOCKER is signaled while waiting, give up.  Return true if this had
+   to wait, in which case the caller must call
+   post_acquire_global_lock.  */
+
+static bool
+lisp_mutex_lock_for_thread (lisp_mutex_t *mutex, struct thread_state *locker,
+			    unsigned int new_count)
+{
+  if (mutex->owner == NULL)
+    {
+      mutex->owner = locker;
+      mutex->count = new_count == 0 ? 1 : new_count;
+      return false;
+    }
+  if (mutex->owner == locker)
+    {
+      eassert (new_count == 0);
+      ++mutex->count;
+      return false;
+    }
+
+  locker->wait_condvar = &mutex->condition;
+  while (mutex->owner != NULL
+	 && (new_count != 0 || NILP (locker->error_symbol)))
+    sys_cond_wait (&mutex->condition, &global_lock);
+  locker->wait_condvar = NULL;
+
+  if (new_count == 0 && !NILP (locker->error_symbol))
+    return true;
+
+  mutex->owner = locker;
+  mutex->count = new_count == 0 ? 1 : new_count;
+  return true;
+}
+
+/* Unlock MUTEX, which the current thread must own.  */
+
+static void
+lisp_mutex_unlock (lisp_mutex_t *mutex)
+{
+  if (mutex->owner != current_thread)
+    error ("Cannot unlock mutex owned by another thread");
+
+  if (--mutex->count > 0)
+    return;
+
+  mutex->owner = NULL;
+  sys_cond_broadcast (&mutex->condition);
+}
+
+/* Unlock MUTEX completely, so that the current thread can wait on a
+   condition variable, and return its previous lock count.  */
+
+static unsigned int
+lisp_mutex_unlock_for_wait (lisp_mutex_t *mutex)
+{
+  unsigned int result = mutex->count;
+
+  eassert (mutex->owner == current_thread);
+  mutex->count = 0;
+  mutex->owner = NULL;
+  sys_cond_broadcast (&mutex->condition);
+
+  return result;
+}
+
+static bool
+lisp_mutex_owned_p (lisp_mutex_t *mutex)
+{
+  return mutex->owner == current_thread;
+}
+
+
+
+DEFUN ("make-mutex", Fmake_mutex, Smake_mutex, 0, 1, 0,
+       doc: /* Create a mutex.
+A mutex provides a synchronization point for threads.
+Only one thread at a time can hold a mutex.  Other threads attempting
+to acquire it will block until the mutex is available.
+
+A thread can acquire a mutex any number of times.
+
+NAME, if given, is used as the name of the mutex.  The name is
+informational only.  */)
+  (Lisp_Object name)
+{
+  struct Lisp_Mutex *mutex;
+  Lisp_Object result;
+
+  if (!NILP (name))
+    CHECK_STRING (name);
+
+  mutex = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_Mutex, mutex, PVEC_MUTEX);
+  mutex->name = name;
+  lisp_mutex_init (&mutex->mutex);
+
+  XSETMUTEX (result, mutex);
+  return result;
+}
+
+static void
+mutex_lock_callback (void *arg)
+{
+  struct Lisp_Mutex *mutex = arg;
+  struct thread_state *self = current_thread;
+
+  if (lisp_mutex_lock_for_thread (&mutex->mutex, self, 0))
+    post_acquire_global_lock (self);
+}
+
+DEFUN ("mutex-lock", Fmutex_lock, Smutex_lock, 1, 1, 0,
+       doc: /* Acquire a mutex.
+If the current thread already owns MUTEX, increment the count and
+return.
+Otherwise, if no thread owns MUTEX, make the current thread own it.
+Otherwise, block until MUTEX is available, or until the current thread
+is signaled using `thread-signal'.
+Note that calls to `mutex-lock' and `mutex-unlock' must be paired.  */)
+  (Lisp_Object mutex)
+{
+  CHECK_MUTEX (mutex);
+
+  current_thread->event_object = mutex;
+  flush_stack_call_func (mutex_lock_callback, XMUTEX (mutex));
+  current_thread->event_object = Qnil;
+  return Qnil;
+}
+
+DEFUN ("mutex-unlock", Fmutex_unlock, Smutex_unlock, 1, 1, 0,
+       doc: /* Release the mutex.
+If this thread does not own MUTEX, signal an error.
+Otherwise, decrement the mutex's count.  If the count is zero,
+release MUTEX.  */)
+  (Lisp_Object mutex)
+{
+  CHECK_MUTEX (mutex);
+  lisp_mutex_unlock (&XMUTEX (mutex)->mutex);
+  return Qnil;
+}
+
+DEFUN ("mutex-name", Fmutex_name, Smutex_name, 1, 1, 0,
+       doc: /* Return the name of MUTEX.
+If no name was given when MUTEX was created, return nil.  */)
+  (Lisp_Object mutex)
+{
+  CHECK_MUTEX (mutex);
+  return XMUTEX (mutex)->name;
+}
+
+void
+finalize_one_mutex (struct Lisp_Mutex *mutex)
+{
+  sys_cond_destroy (&mutex->mutex.condition);
+}
+
+
+
+DEFUN ("make-condition-variable",
+       Fmake_condition_variable, Smake_condition_variable,
+       1, 2, 0,
+       doc: /* Make a condition variable associated with MUTEX.
+A condition variable provides a way for a thread to sleep while
+waiting for a state change.
+
+MUTEX is the mutex associated with this condition variable.
+NAME, if given, is the name of this condition variable.  The name is
+informational only.  */)
+  (Lisp_Object mutex, Lisp_Object name)
+{
+  struct Lisp_CondVar *condvar;
+  Lisp_Object result;
+
+  CHECK_MUTEX (mutex);
+  if (!NILP (name))
+    CHECK_STRING (name);
+
+  condvar = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_CondVar, cond,
+					  PVEC_CONDVAR);
+  condvar->mutex = mutex;
+  condvar->name = name;
+  sys_cond_init (&condvar->cond);
+
+  XSETCONDVAR (result, condvar);
+  return result;
+}
+
+static void
+condition_wait_callback (void *arg)
+{
+  struct Lisp_CondVar *cvar = arg;
+  struct Lisp_Mutex *mutex = XMUTEX (cvar->mutex);
+  struct thread_state *self = current_thread;
+  unsigned int saved_count;
+  Lisp_Object cond;
+
+  XSETCONDVAR (cond, cvar);
+  self->event_object = cond;
+  saved_count = lisp_mutex_unlock_for_wait (&mutex->mutex);
+  /* If we were signaled while unlocking, skip the wait, but still
+     reacquire the mutex.  */
+  if (NILP (self->error_symbol))
+    {
+      self->wait_condvar = &cvar->cond;
+      sys_cond_wait (&cvar->cond, &global_lock);
+      self->wait_condvar = NULL;
+    }
+  lisp_mutex_lock_for_thread (&mutex->mutex, self, saved_count);
+  post_acquire_global_lock (self);
+}
+
+DEFUN ("condition-wait", Fcondition_wait, Scondition_wait, 1, 1, 0,
+       doc: /* Wait for the condition variable COND to be notified.
+COND is the condition variable to wait on.
+
+The mutex associated with COND must be held when this is called.
+It is an error if it is not held.
+
+This releases the mutex and waits for COND to be notified or for
+this thread to be signaled with `thread-signal'.  When
+`condition-wait' returns, COND's mutex will again be locked by
+this thread.  */)
+  (Lisp_Object cond)
+{
+  struct Lisp_CondVar *cvar;
+  struct Lisp_Mutex *mutex;
+
+  CHECK_CONDVAR (cond);
+  cvar = XCONDVAR (cond);
+
+  mutex = XMUTEX (cvar->mutex);
+  if (!lisp_mutex_owned_p (&mutex->mutex))
+    error ("Condition variable's mutex is not held by current thread");
+
+#ifndef THREADS_ENABLED
+  /* No other thread exists that could notify COND.  */
+  error ("Waiting for a condition variable requires thread support");
+#endif
+
+  flush_stack_call_func (condition_wait_callback, cvar);
+
+  return Qnil;
+}
+
+DEFUN ("condition-notify", Fcondition_notify, Scondition_notify, 1, 2, 0,
+       doc: /* Notify COND, a condition variable.
+This wakes a thread waiting on COND.
+If ALL is non-nil, all waiting threads are awoken.
+
+The mutex associated with COND must be held when this is called.
+It is an error if it is not held.
+
+The woken threads do not run until this thread releases the mutex,
+since they must reacquire it before `condition-wait' returns.  */)
+  (Lisp_Object cond, Lisp_Object all)
+{
+  struct Lisp_CondVar *cvar;
+  struct Lisp_Mutex *mutex;
+
+  CHECK_CONDVAR (cond);
+  cvar = XCONDVAR (cond);
+
+  mutex = XMUTEX (cvar->mutex);
+  if (!lisp_mutex_owned_p (&mutex->mutex))
+    error ("Condition variable's mutex is not held by current thread");
+
+  if (NILP (all))
+    sys_cond_signal (&cvar->cond);
+  else
+    sys_cond_broadcast (&cvar->cond);
+
+  return Qnil;
+}
+
+DEFUN ("condition-mutex", Fcondition_mutex, Scondition_mutex, 1, 1, 0,
+       doc: /* Return the mutex associated with condition variable COND.  */)
+  (Lisp_Object cond)
+{
+  CHECK_CONDVAR (cond);
+  return XCONDVAR (cond)->mutex;
+}
+
+DEFUN ("condition-name", Fcondition_name, Scondition_name, 1, 1, 0,
+       doc: /* Return the name of condition variable COND.
+If no name was given when COND was created, return nil.  */)
+  (Lisp_Object cond)
+{
+  CHECK_CONDVAR (cond);
+  return XCONDVAR (cond)->name;
+}
+
+void
+finalize_one_condvar (struct Lisp_CondVar *condvar)
+{
+  sys_cond_destroy (&condvar->cond);
+}
+
+
+
+struct select_args
+{
+  select_func *func;
+  int max_fds;
+  fd_set *rfds;
+  fd_set *wfds;
+  fd_set *efds;
+  struct timespec const *timeout;
+  sigset_t const *sigmask;
+  int result;
+};
+
+static void
+really_call_select (void *arg)
+{
+  struct select_args *sa = arg;
+  struct thread_state *self = current_thread;
+  int err;
+
+  release_global_lock ();
+  sa->result = (sa->func) (sa->max_fds, sa->rfds, sa->wfds, sa->efds,
+			   sa->timeout, sa->sigmask);
+  err = errno;
+  acquire_global_lock (self);
+  errno = err;
+}
+
+/* Call FUNC, which is pselect or one of its replacements, with the
+   remaining arguments, letting other threads run while it waits.  */
+
+int
+thread_select (select_func *func, int max_fds, fd_set *rfds,
+	       fd_set *wfds, fd_set *efds, struct timespec const *timeout,
+	       sigset_t const *sigmask)
+{
+  struct select_args sa;
+
+  sa.func = func;
+  sa.max_fds = max_fds;
+  sa.rfds = rfds;
+  sa.wfds = wfds;
+  sa.efds = efds;
+  sa.timeout = timeout;
+  sa.sigmask = sigmask;
+  flush_stack_call_func (really_call_select, &sa);
+  return sa.result;
+}
+
+
+
+static void
+mark_one_thread (struct thread_state *thread)
+{
+  struct handler *handler;
+  Lisp_Object tem;
+
+  mark_specpdl (thread->m_specpdl, thread->m_specpdl_ptr);
+
+  /* A thread that has not started yet has no C stack.  */
+  if (thread->m_stack_bottom)
+    mark_stack (thread->m_stack_bottom, thread->stack_top);
+
+  for (handler = thread->m_handlerlist; handler; handler = handler->next)
+    {
+      mark_object (handler->tag_or_ch);
+      mark_object (handler->val);
+    }
+
+  if (thread->m_current_buffer)
+    {
+      XSETBUFFER (tem, thread->m_current_buffer);
+      mark_object (tem);
+    }
+
+  mark_object (thread->m_last_thing_searched);
+  mark_object (thread->m_saved_last_thing_searched);
+
+#ifdef HAVE_MODULES
+  mark_module_environments (thread->m_live_environments);
+#endif
+
+  mark_byte_stack (thread);
+}
+
+/* Mark all threads and everything they refer to, including their
+   stacks, during garbage collection.  */
+
+void
+mark_threads (void)
+{
+  struct thread_state *iter;
+
+  for (iter = all_threads; iter; iter = iter->next_thread)
+    {
+      Lisp_Object thread;
+
+      XSETTHREAD (thread, iter);
+      mark_object (thread);
+      mark_one_thread (iter);
+    }
+}
+
+/* The main thread is not allocated in the heap, so the sweep does not
+   clear its mark bit.  */
+
+void
+unmark_main_thread (void)
+{
+  main_thread.header.size &= ~ARRAY_MARK_FLAG;
+}
+
+void
+relocate_byte_stacks (void)
+{
+  struct thread_state *iter;
+
+  for (iter = all_threads; iter; iter = iter->next_thread)
+    relocate_byte_stack (iter);
+}
+
+
+
+static void
+yield_callback (void *ignore)
+{
+  struct thread_state *self = current_thread;
+
+  release_global_lock ();
+  sys_thread_yield ();
+  acquire_global_lock (self);
+}
+
+DEFUN ("thread-yield", Fthread_yield, Sthread_yield, 0, 0, 0,
+       doc: /* Yield the CPU to another thread.  */)
+  (void)
+{
+  flush_stack_call_func (yield_callback, NULL);
+  return Qnil;
+}
+
+static Lisp_Object
+invoke_thread_function (void)
+{
+  ptrdiff_t count = SPECPDL_INDEX ();
+
+  current_thread->result = Ffuncall (1, &current_thread->function);
+  return unbind_to (count, Qnil);
+}
+
+static Lisp_Object
+record_thread_error (Lisp_Object error_form)
+{
+  last_thread_error = error_form;
+  return error_form;
+}
+
+static void *
+run_thread (void *state)
+{
+  /* The bottom of this thread's C stack, suitably aligned for the
+     garbage collector.  */
+  max_align_t stack_pos;
+  struct thread_state *self = state;
+  struct thread_state **iter;
+  struct handler *c, *c_next;
+
+  self->m_stack_bottom = self->stack_top = (char *) &stack_pos;
+  self->thread_id = sys_thread_self ();
+
+  acquire_global_lock (self);
+
+  init_handlerlist ();
+
+  internal_condition_case (invoke_thread_function, Qt, record_thread_error);
+
+  xfree (self->m_specpdl - 1);
+  self->m_specpdl = NULL;
+  self->m_specpdl_ptr = NULL;
+  self->m_specpdl_size = 0;
+
+  for (c = self->m_handlerlist_sentinel; c; c = c_next)
+    {
+      c_next = c->nextfree;
+      xfree (c);
+    }
+  self->m_handlerlist = self->m_handlerlist_sentinel = NULL;
+
+  xfree (self->m_byte_stack_region);
+  self->m_byte_stack_region = self->m_byte_stack_region_top = NULL;
+
+  sys_cond_broadcast (&self->thread_condvar);
+
+  /* Unlink this thread from the list of all threads.  CURRENT_THREAD
+     keeps pointing to it until another thread gets the lock, which
+     needs it to undo its bindings; it has none left.  */
+  for (iter = &all_threads; *iter != self; iter = &(*iter)->next_thread)
+    ;
+  *iter = (*iter)->next_thread;
+
+  release_global_lock ();
+
+  return NULL;
+}
+
+void
+finalize_one_thread (struct thread_state *state)
+{
+  sys_cond_destroy (&state->thread_condvar);
+  xfree (state->m_search_regs.start);
+  xfree (state->m_search_regs.end);
+  xfree (state->m_saved_search_regs.start);
+  xfree (state->m_saved_search_regs.end);
+}
+
+DEFUN ("make-thread", Fmake_thread, Smake_thread, 1, 2, 0,
+       doc: /* Start a new thread and run FUNCTION in it.
+When the function exits, the thread dies.
+If NAME is given, it must be a string; it names the new thread.
+
+The new thread starts with the current buffer of the calling thread,
+and with the global values of all variables; let-bindings are local
+to the thread that makes them.  */)
+  (Lisp_Object function, Lisp_Object name)
+{
+  struct thread_state *new_thread;
+  Lisp_Object result;
+
+  /* Can't start a thread in temacs.  */
+  if (!initialized)
+    error ("Cannot start a thread while dumping");
+
+  if (!NILP (name))
+    CHECK_STRING (name);
+
+  new_thread = ALLOCATE_ZEROED_PSEUDOVECTOR (struct thread_state,
+					     m_stack_bottom, PVEC_THREAD);
+  new_thread->m_last_thing_searched = Qnil;
+  new_thread->m_saved_last_thing_searched = Qnil;
+  new_thread->name = name;
+  new_thread->function = function;
+  new_thread->result = Qnil;
+  new_thread->error_symbol = Qnil;
+  new_thread->error_data = Qnil;
+  new_thread->event_object = Qnil;
+
+  new_thread->m_current_buffer = current_buffer;
+
+  new_thread->m_specpdl_size = 50;
+  new_thread->m_specpdl = xmalloc ((1 + new_thread->m_specpdl_size)
+				   * sizeof *new_thread->m_specpdl);
+  /* Skip the dummy entry.  */
+  new_thread->m_specpdl_ptr = ++new_thread->m_specpdl;
+
+  sys_cond_init (&new_thread->thread_condvar);
+
+  new_thread->next_thread = all_threads;
+  all_threads = new_thread;
+
+  if (!sys_thread_create (&new_thread->thread_id, run_thread, new_thread))
+    {
+      /* Restore the previous situation.  */
+      all_threads = new_thread->next_thread;
+      xfree (new_thread->m_specpdl - 1);
+      new_thread->m_specpdl = new_thread->m_specpdl_ptr = NULL;
+      error ("Could not start a new thread");
+    }
+
+  XSETTHREAD (result, new_thread);
+  return result;
+}
+
+DEFUN ("current-thread", Fcurrent_thread, Scurrent_thread, 0, 0, 0,
+       doc: /* Return the current thread.  */)
+  (void)
+{
+  Lisp_Object result;
+  XSETTHREAD (result, current_thread);
+  return result;
+}
+
+DEFUN ("thread-name", Fthread_name, Sthread_name, 1, 1, 0,
+       doc: /* Return the name of the THREAD.
+The name is the same object that was passed to `make-thread'.  */)
+  (Lisp_Object thread)
+{
+  CHECK_THREAD (thread);
+  return XTHREAD (thread)->name;
+}
+
+DEFUN ("thread-signal", Fthread_signal, Sthread_signal, 3, 3, 0,
+       doc: /* Signal an error in a thread.
+This acts like `signal', but arranges for the signal to be raised
+in THREAD.  If THREAD is the current thread, acts just like `signal'.
+This will interrupt a blocked call to `mutex-lock', `condition-wait',
+or `thread-join' in the target thread.  */)
+  (Lisp_Object thread, Lisp_Object error_symbol, Lisp_Object data)
+{
+  struct thread_state *tstate;
+
+  CHECK_THREAD (thread);
+  tstate = XTHREAD (thread);
+
+  if (tstate == current_thread)
+    Fsignal (error_symbol, data);
+
+  if (!thread_alive_p (tstate))
+    return Qnil;
+
+  tstate->error_symbol = error_symbol;
+  tstate->error_data = data;
+
+  if (tstate->wait_condvar)
+    sys_cond_broadcast (tstate->wait_condvar);
+
+  return Qnil;
+}
+
+DEFUN ("thread-alive-p", Fthread_alive_p, Sthread_alive_p, 1, 1, 0,
+       doc: /* Return t if THREAD is alive, or nil if it has exited.  */)
+  (Lisp_Object thread)
+{
+  CHECK_THREAD (thread);
+  return thread_alive_p (XTHREAD (thread)) ? Qt : Qnil;
+}
+
+DEFUN ("thread--blocker", Fthread_blocker, Sthread_blocker, 1, 1, 0,
+       doc: /* Return the object that THREAD is blocking on.
+If THREAD is blocked in `thread-join' on a second thread, return that
+thread.
+If THREAD is blocked in `mutex-lock', return the mutex.
+If THREAD is blocked in `condition-wait', return the condition variable.
+Otherwise, if THREAD is not blocked, return nil.  */)
+  (Lisp_Object thread)
+{
+  CHECK_THREAD (thread);
+  return XTHREAD (thread)->event_object;
+}
+
+static void
+thread_join_callback (void *arg)
+{
+  struct thread_state *tstate = arg;
+  struct thread_state *self = current_thread;
+  Lisp_Object thread;
+
+  XSETTHREAD (thread, tstate);
+  self->event_object = thread;
+  self->wait_condvar = &tstate->thread_condvar;
+  while (thread_alive_p (tstate) && NILP (self->error_symbol))
+    sys_cond_wait (self->wait_condvar, &global_lock);
+
+  self->wait_condvar = NULL;
+  post_acquire_global_lock (self);
+}
+
+DEFUN ("thread-join", Fthread_join, Sthread_join, 1, 1, 0,
+       doc: /* Wait for THREAD to exit.
+This blocks the current thread until THREAD exits or until
+the current thread is signaled.
+Return the value THREAD's function returned, or nil if it exited
+because of an error.
+It is an error for a thread to try to join itself.  */)
+  (Lisp_Object thread)
+{
+  struct thread_state *tstate;
+
+  CHECK_THREAD (thread);
+  tstate = XTHREAD (thread);
+
+  if (tstate == current_thread)
+    error ("Cannot join current thread");
+
+  if (thread_alive_p (tstate))
+    flush_stack_call_func (thread_join_callback, tstate);
+
+  return tstate->result;
+}
+
+DEFUN ("all-threads", Fall_threads, Sall_threads, 0, 0, 0,
+       doc: /* Return a list of all the live threads.  */)
+  (void)
+{
+  Lisp_Object result = Qnil;
+  struct thread_state *iter;
+
+  for (iter = all_threads; iter; iter = iter->next_thread)
+    if (thread_alive_p (iter))
+      {
+	Lisp_Object thread;
+
+	XSETTHREAD (thread, iter);
+	result = Fcons (thread, result);
+      }
+
+  return result;
+}
+
+DEFUN ("thread-last-error", Fthread_last_error, Sthread_last_error, 0, 0, 0,
+       doc: /* Return the last error form recorded by a dying thread.  */)
+  (void)
+{
+  return last_thread_error;
+}
+
+
+
+DEFUN ("threadp", Fthreadp, Sthreadp, 1, 1, 0,
+       doc: /* Return t if OBJECT is a thread.  */)
+  (Lisp_Object object)
+{
+  return THREADP (object) ? Qt : Qnil;
+}
+
+DEFUN ("mutexp", Fmutexp, Smutexp, 1, 1, 0,
+       doc: /* Return t if OBJECT is a mutex.  */)
+  (Lisp_Object object)
+{
+  return MUTEXP (object) ? Qt : Qnil;
+}
+
+DEFUN ("condition-variable-p", Fcondition_variable_p, Scondition_variable_p,
+       1, 1, 0,
+       doc: /* Return t if OBJECT is a condition variable.  */)
+  (Lisp_Object object)
+{
+  return CONDVARP (object) ? Qt : Qnil;
+}
+
+
+
+bool
+thread_check_current_buffer (struct buffer *buffer)
+{
+  struct thread_state *iter;
+
+  for (iter = all_threads; iter; iter = iter->next_thread)
+    if (iter != current_thread && iter->m_current_buffer == buffer)
+      return true;
+
+  return false;
+}
+
+bool
+main_thread_p (void *ptr)
+{
+  return ptr == &main_thread;
+}
+
+
+
+void
+init_threads_once (void)
+{
+  main_thread.header.size = PSEUDOVECSIZE (struct thread_state,
+					   m_stack_bottom);
+  XSETPVECTYPE (&main_thread, PVEC_THREAD);
+  main_thread.m_last_thing_searched = Qnil;
+  main_thread.m_saved_last_thing_searched = Qnil;
+  main_thread.name = Qnil;
+  main_thread.function = Qnil;
+  main_thread.result = Qnil;
+  main_thread.error_symbol = Qnil;
+  main_thread.error_data = Qnil;
+  main_thread.event_object = Qnil;
+}
+
+void
+init_threads (void)
+{
+  sys_cond_init (&main_thread.thread_condvar);
+  sys_mutex_init (&global_lock);
+  sys_mutex_lock (&global_lock);
+  current_thread = &main_thread;
+  main_thread.thread_id = sys_thread_self ();
+  main_thread.m_stack_bottom = (char *) stack_base;
+}
+
+void
+syms_of_threads (void)
+{
+  defsubr (&Sthread_yield);
+  defsubr (&Smake_thread);
+  defsubr (&Scurrent_thread);
+  defsubr (&Sthread_name);
+  defsubr (&Sthread_signal);
+  defsubr (&Sthread_alive_p);
+  defsubr (&Sthread_join);
+  defsubr (&Sthread_blocker);
+  defsubr (&Sall_threads);
+  defsubr (&Sthread_last_error);
+  defsubr (&Smake_mutex);
+  defsubr (&Smutex_lock);
+  defsubr (&Smutex_unlock);
+  defsubr (&Smutex_name);
+  defsubr (&Smake_condition_variable);
+  defsubr (&Scondition_wait);
+  defsubr (&Scondition_notify);
+  defsubr (&Scondition_mutex);
+  defsubr (&Scondition_name);
+  defsubr (&Sthreadp);
+  defsubr (&Smutexp);
+  defsubr (&Scondition_variable_p);
+
+  last_thread_error = Qnil;
+  staticpro (&last_thread_error);
+
+  DEFSYM (Qthreadp, "threadp");
+  DEFSYM (Qmutexp, "mutexp");
+  DEFSYM (Qcondition_variable_p, "condition-variable-p");
+
+#ifdef THREADS_ENABLED
+  Fprovide (intern_c_string ("threads"), Qnil);
+#endif
+}
@@ -145,7 +145,7 @@ record_marker_adjustments (ptrdiff_t from, ptrdiff_t to)
       charpos = m->charpos;
       eassert (charpos <= Z);
 
-      if (from <= charpos && charpos <= to)
+      if (from <= charpos && charpos <= to && !m->no_undo)
         {
           /* insertion_type nil markers will end up at the beginning of
              the re-inserted text after undoing a deletion, and must be
@@ -45,4 +45,95 @@
             (should (eq buf (current-buffer))))
         (when msg-ov (delete-overlay msg-ov))))))
 
+;; Buffer-local variables.
+
+(defvar buffer-tests--var 'default)
+(put 'buffer-tests--permanent 'permanent-local t)
+(defvar buffer-tests--permanent 'default)
+
+(defun buffer-tests--variable (i)
+  "Return the symbol of the Ith test variable, defining it if needed."
+  (let ((symbol (intern (format "buffer-tests--var-%d" i))))
+    (unless (boundp symbol)
+      (set-default symbol 'default))
+    symbol))
+
+(ert-deftest buffer-tests-many-local-variables ()
+  "Test a buffer with many local variables, some of which are killed."
+  (with-temp-buffer
+    (dotimes (i 200)
+      (set (make-local-variable (buffer-tests--variable i)) i))
+    (dotimes (i 100)
+      (kill-local-variable (buffer-tests--variable (* 2 i))))
+    (let ((buffer (current-buffer)))
+      (with-temp-buffer
+        (dotimes (i 200)
+          (let ((variable (buffer-tests--variable i)))
+            (should-not (local-variable-p variable))
+            (should (eq (symbol-value variable) 'default))
+            (if (zerop (% i 2))
+                (progn
+                  (should-not (local-variable-p variable buffer))
+                  (should (eq (buffer-local-value variable buffer) 'default)))
+              (should (local-variable-p variable buffer))
+              (should (eq (buffer-local-value variable buffer) i)))))))
+    (dotimes (i 200)
+      (should (eq (symbol-value (buffer-tests--variable i))
+                  (if (zerop (% i 2)) 'default i))))
+    (should (= (length (buffer-local-variables))
+               (+ 100 (length (with-temp-buffer (buffer-local-variables))))))))
+
+(ert-deftest buffer-tests-kill-all-local-variables ()
+  (with-temp-buffer
+    (setq-local buffer-tests--var 'local)
+    (setq-local buffer-tests--permanent 'local)
+    (dotimes (i 50)
+      (set (make-local-variable (buffer-tests--variable i)) i))
+    (kill-all-local-variables)
+    (should-not (local-variable-p 'buffer-tests--var))
+    (should (eq buffer-tests--var 'default))
+    (should (local-variable-p 'buffer-tests--permanent))
+    (should (eq buffer-tests--permanent 'local))
+    (should (eq (symbol-value (buffer-tests--variable 7)) 'default))
+    (setq-local buffer-tests--var 'again)
+    (should (eq buffer-tests--var 'again))))
+
+(ert-deftest buffer-tests-clone-local-variables ()
+  "Test that a cloned buffer has its own copies of local variables."
+  (with-temp-buffer
+    (setq-local buffer-tests--var 'base)
+    (let ((clone (make-indirect-buffer (current-buffer) " *clone*" t)))
+      (unwind-protect
+          (progn
+            (with-current-buffer clone
+              (should (eq buffer-tests--var 'base))
+              (setq buffer-tests--var 'clone)
+              (kill-local-variable 'buffer-tests--var)
+              (should (eq buffer-tests--var 'default)))
+            (should (eq buffer-tests--var 'base)))
+        (kill-buffer clone)))))
+
+(ert-deftest buffer-tests-alternate-buffers ()
+  "Test reading and setting local variables while switching buffers."
+  (let ((buffers (mapcar (lambda (i)
+                           (with-current-buffer (generate-new-buffer " *b*")
+                             (when (zerop (% i 3))
+                               (setq-local buffer-tests--var i))
+                             (setq-local indent-tabs-mode (zerop (% i 2)))
+                             (current-buffer)))
+                         (number-sequence 0 29))))
+    (unwind-protect
+        (dotimes (_ 3)
+          (let ((i 0))
+            (dolist (buffer buffers)
+              (set-buffer buffer)
+              (should (eq buffer-tests--var (if (zerop (% i 3)) i 'default)))
+              ;; C code must see the value of this buffer, too.
+              (erase-buffer)
+              (indent-to 8)
+              (should (equal (buffer-string)
+                             (if (zerop (% i 2)) "\t" "        ")))
+              (setq i (1+ i)))))
+      (mapc #'kill-buffer buffers))))
+
 ;;; buffer-tests.el ends here
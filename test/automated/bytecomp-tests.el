@@ -241,7 +241,30 @@ byte-opt-testsuite-arith-data
     (let ((a 3) (b 2) (c 1.0)) (/ 1 a b c))
     (let ((a 3) (b 2) (c 1.0)) (/ a b c 0))
     (let ((a 3) (b 2) (c 1.0)) (/ a b c 1))
-    (let ((a 3) (b 2) (c 1.0)) (/ a b c -1)))
+    (let ((a 3) (b 2) (c 1.0)) (/ a b c -1))
+
+    ;; two-operand byte ops with fixnum, float and marker operands
+    (let ((a most-positive-fixnum) (b 1)) (+ a b))
+    (let ((a most-negative-fixnum) (b 1)) (- a b))
+    (let ((a most-positive-fixnum) (b most-positive-fixnum)) (* a b))
+    (let ((a most-negative-fixnum) (b -1)) (* a b))
+    (let ((a most-negative-fixnum) (b -1)) (/ a b))
+    (let ((a -7) (b 2) (c 1.0)) (/ a b))
+    (let ((a -7) (b 2) (c 1.0)) (% a b))
+    (let ((a -7) (b -2) (c 1.0)) (% a b))
+    (let ((a -7) (b 0) (c 1.0)) (% a b))
+    (let ((a -7) (b 2) (c 1.0)) (% a c))
+    (let ((a -7) (b 2) (c 1.0)) (max a b))
+    (let ((a -7) (b 2) (c 1.0)) (min a b))
+    (let ((a -7) (b 2) (c 1.0)) (max a c))
+    (let ((a -7) (b 2) (c 1.0)) (min b c))
+    (let ((a -7) (b 2) (c 1.0)) (list (< a b) (< b a) (< b b) (< a c)))
+    (let ((a -7) (b 2) (c 1.0)) (list (> a b) (> b a) (> b b) (> c a)))
+    (let ((a -7) (b 2) (c 1.0)) (list (<= a b) (<= b a) (<= b b) (<= a c)))
+    (let ((a -7) (b 2) (c 1.0)) (list (>= a b) (>= b a) (>= b b) (>= c a)))
+    (let ((a (point-min-marker)) (b 2)) (list (+ a b) (< a b) (max a b)))
+    (let ((a 'x) (b 2)) (+ a b))
+    (let ((a 'x) (b 2)) (< a b)))
   "List of expression for test.
 Each element will be executed by interpreter and with
 bytecompiled code, and their results compared.")
@@ -420,6 +443,197 @@ test-byte-comp-compile-and-load
       (defun def () (m))))
   (should (equal (funcall 'def) 4)))
 
+(defmacro bytecomp-tests--defun-lexical (name args &rest body)
+  "Define NAME as a byte-compiled function with lexical binding."
+  `(defalias ',name (let ((lexical-binding t))
+                      (byte-compile '(lambda ,args ,@body)))))
+
+(bytecomp-tests--defun-lexical bytecomp-tests--depth (n)
+  (if (= n 0) 0 (1+ (bytecomp-tests--depth (1- n)))))
+(bytecomp-tests--defun-lexical bytecomp-tests--throw (n)
+  (if (= n 0) (throw 'bytecomp-tests--tag n)
+    (list (bytecomp-tests--throw (1- n)))))
+(bytecomp-tests--defun-lexical bytecomp-tests--signal (n)
+  (if (= n 0) (error "Bottom")
+    (list (bytecomp-tests--signal (1- n)))))
+(bytecomp-tests--defun-lexical bytecomp-tests--catch (n)
+  (if (= n 0)
+      (condition-case nil (bytecomp-tests--signal 10) (error 'caught))
+    (cons n (bytecomp-tests--catch (1- n)))))
+(bytecomp-tests--defun-lexical bytecomp-tests--args (a &optional b &rest c)
+  (list a b c))
+(bytecomp-tests--defun-lexical bytecomp-tests--call-args ()
+  (list (bytecomp-tests--args 1) (bytecomp-tests--args 1 2)
+        (bytecomp-tests--args 1 2 3 4)))
+(bytecomp-tests--defun-lexical bytecomp-tests--call-no-args ()
+  (bytecomp-tests--args))
+(bytecomp-tests--defun-lexical bytecomp-tests--frames (n)
+  (if (> n 0) (append (bytecomp-tests--frames (1- n)) nil)
+    (let ((i 0) frame frames)
+      (while (setq frame (backtrace-frame i))
+        (when (eq (cadr frame) 'bytecomp-tests--frames)
+          (push (cddr frame) frames))
+        (setq i (1+ i)))
+      frames)))
+
+(ert-deftest bytecomp-tests-lexical-calls ()
+  "Test calls between byte-compiled functions with lexical binding."
+  ;; Deep enough to overflow the byte stack region.
+  (should (= (let ((max-lisp-eval-depth 10000)
+                   (max-specpdl-size 10000))
+               (bytecomp-tests--depth 5000))
+             5000))
+  (should-error (let ((max-lisp-eval-depth 100))
+                  (bytecomp-tests--depth 1000)))
+  (should (= (bytecomp-tests--depth 10) 10))
+  (should (= (catch 'bytecomp-tests--tag (bytecomp-tests--throw 100)) 0))
+  (should (equal (condition-case err (bytecomp-tests--signal 100)
+                   (error (cdr err)))
+                 '("Bottom")))
+  (should (equal (bytecomp-tests--catch 3) '(3 2 1 . caught)))
+  (should (equal (bytecomp-tests--call-args)
+                 '((1 nil nil) (1 2 nil) (1 2 (3 4)))))
+  (should (equal (should-error (bytecomp-tests--call-no-args)
+                               :type 'wrong-number-of-arguments)
+                 '(wrong-number-of-arguments (1 . &rest) 0)))
+  (should (equal (bytecomp-tests--frames 3) '((3) (2) (1) (0)))))
+
+(bytecomp-tests--defun-lexical bytecomp-tests--call-callee (x)
+  (bytecomp-tests--callee x))
+
+(ert-deftest bytecomp-tests-redefine-callee ()
+  "Test that calls from byte-code see the current definition."
+  (unwind-protect
+      (progn
+        (defalias 'bytecomp-tests--callee
+          (let ((lexical-binding t)) (byte-compile '(lambda (x) (* x 2)))))
+        (should (= (bytecomp-tests--call-callee 3) 6))
+        (defalias 'bytecomp-tests--callee '1+)
+        (should (= (bytecomp-tests--call-callee 3) 4))
+        (defalias 'bytecomp-tests--callee (lambda (x) (list x)))
+        (should (equal (bytecomp-tests--call-callee 3) '(3)))
+        (defalias 'bytecomp-tests--callee 'cons)
+        (should-error (bytecomp-tests--call-callee 3)
+                      :type 'wrong-number-of-arguments)
+        (fmakunbound 'bytecomp-tests--callee)
+        (should-error (bytecomp-tests--call-callee 3)
+                      :type 'void-function))
+    (fmakunbound 'bytecomp-tests--callee)))
+
+(bytecomp-tests--defun-lexical bytecomp-tests--forwarded-vars ()
+  (list case-fold-search inhibit-read-only))
+
+(ert-deftest bytecomp-tests-forwarded-variables ()
+  "Test references to built-in variables from byte-code."
+  (with-temp-buffer
+    (let ((inhibit-read-only 'foo))
+      (setq case-fold-search nil)
+      (should (equal (bytecomp-tests--forwarded-vars) '(nil foo)))
+      (setq case-fold-search t)
+      (should (equal (bytecomp-tests--forwarded-vars) '(t foo))))))
+
+(bytecomp-tests--defun-lexical bytecomp-tests--float-temps (a b)
+  (let* ((x (* a b))
+         (y (+ x x))
+         (z (list (- y (1+ x)))))
+    (list (+ (* a b) 1) x y (+ (car z) 0.5) z (- (/ (+ a b) 2) x))))
+
+(ert-deftest bytecomp-tests-float-temporaries ()
+  "Test that float arithmetic never changes a float in use."
+  (should (equal (bytecomp-tests--float-temps 2.0 3)
+                 '(7.0 6.0 12.0 5.5 (5.0) -3.5)))
+  (should (equal (bytecomp-tests--float-temps 2 3)
+                 '(7 6 12 5.5 (5) -4))))
+
+;; Float-heavy benchmarks.  The test below runs them at small sizes;
+;; run `bytecomp-tests-float-benchmark' by hand for timings.
+
+(bytecomp-tests--defun-lexical bytecomp-tests--mandelbrot (size)
+  (let ((count 0))
+    (dotimes (i size)
+      (dotimes (j size)
+        (let ((cr (- (/ (* 3.0 j) size) 2.0))
+              (ci (- (/ (* 2.0 i) size) 1.0))
+              (zr 0.0) (zi 0.0) (k 0))
+          (while (and (< k 50) (< (+ (* zr zr) (* zi zi)) 4.0))
+            (let ((tr (+ (- (* zr zr) (* zi zi)) cr)))
+              (setq zi (+ (* 2.0 zr zi) ci))
+              (setq zr tr))
+            (setq k (1+ k)))
+          (when (= k 50)
+            (setq count (1+ count))))))
+    count))
+
+(bytecomp-tests--defun-lexical bytecomp-tests--dot-product (v w)
+  (let ((sum 0.0))
+    (dotimes (i (length v))
+      (setq sum (+ sum (* (aref v i) (aref w i)))))
+    sum))
+
+(bytecomp-tests--defun-lexical bytecomp-tests--horner (coeffs x)
+  (let ((acc 0.0))
+    (dolist (c coeffs)
+      (setq acc (+ (* acc x) c)))
+    acc))
+
+(defun bytecomp-tests--float-benchmark-run (size)
+  "Run the float benchmarks at SIZE.
+Return a list of (NAME RESULT FLOATS-CONSED SECONDS) entries."
+  (let ((v (make-vector (* size 100) 0.5))
+        (coeffs (make-list (* size 100) 0.5)))
+    (mapcar
+     (lambda (bench)
+       (let ((floats floats-consed)
+             (start (float-time))
+             (result (funcall (cdr bench))))
+         (list (car bench) result (- floats-consed floats)
+               (- (float-time) start))))
+     `((mandelbrot . ,(lambda () (bytecomp-tests--mandelbrot size)))
+       (dot-product . ,(lambda () (bytecomp-tests--dot-product v v)))
+       (horner . ,(lambda () (bytecomp-tests--horner coeffs 0.5)))))))
+
+(defun bytecomp-tests-float-benchmark (&optional size)
+  "Run the float benchmarks at SIZE (default 200) and report the results."
+  (interactive)
+  (dolist (entry (bytecomp-tests--float-benchmark-run (or size 200)))
+    (message "%-12s %-10S %9d floats %8.3fs"
+             (nth 0 entry) (nth 1 entry) (nth 2 entry) (nth 3 entry))))
+
+(ert-deftest bytecomp-tests-float-benchmarks ()
+  "Test the float benchmarks at a small size."
+  (let ((results (bytecomp-tests--float-benchmark-run 10)))
+    (should (equal (mapcar (lambda (entry) (nth 1 entry)) results)
+                   '(29 250.0 1.0)))
+    ;; Each iteration of the dot product loop conses only the new sum,
+    ;; not the product.
+    (should (< (nth 2 (assq 'dot-product results)) 1500))))
+
+(bytecomp-tests--defun-lexical bytecomp-tests--count (n acc)
+  (if (= n 0) acc (bytecomp-tests--count (1- n) (1+ acc))))
+(bytecomp-tests--defun-lexical bytecomp-tests--even (n)
+  (if (= n 0) t (bytecomp-tests--odd (1- n))))
+(bytecomp-tests--defun-lexical bytecomp-tests--odd (n)
+  (if (= n 0) nil (bytecomp-tests--even (1- n))))
+(bytecomp-tests--defun-lexical bytecomp-tests--tail-frames (n)
+  (if (> n 0) (bytecomp-tests--tail-frames (1- n))
+    (bytecomp-tests--frames 0)))
+(bytecomp-tests--defun-lexical bytecomp-tests--not-tail (n)
+  (if (= n 0) 0
+    (let ((max-lisp-eval-depth max-lisp-eval-depth))
+      (bytecomp-tests--not-tail (1- n)))))
+
+(ert-deftest bytecomp-tests-tail-calls ()
+  "Test that tail calls between lexical functions use no stack."
+  (let ((max-lisp-eval-depth 100))
+    (should (= (bytecomp-tests--count 10000 0) 10000))
+    (should (bytecomp-tests--even 10000))
+    (should-not (bytecomp-tests--odd 10000))
+    ;; A dynamic binding makes a call not a tail call.
+    (should-error (bytecomp-tests--not-tail 1000)))
+  (should-error (bytecomp-tests--count 10 'a) :type 'wrong-type-argument)
+  ;; Only the last of a chain of tail calls stays in the backtrace.
+  (should (equal (bytecomp-tests--tail-frames 3) '((0)))))
+
 
 ;; Local Variables:
 ;; no-byte-compile: t
@@ -0,0 +1,56 @@
+;;; eval-tests.el --- tests for src/eval.c
+
+;; Copyright (C) 2015 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; This program is free software: you can redistribute it and/or
+;; modify it under the terms of the GNU General Public License as
+;; published by the Free Software Foundation, either version 3 of the
+;; License, or (at your option) any later version.
+;;
+;; This program is distributed in the hope that it will be useful, but
+;; WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+;; General Public License for more details.
+;;
+;; You should have received a copy of the GNU General Public License
+;; along with this program.  If not, see `http://www.gnu.org/licenses/'.
+
+;;; Commentary:
+
+;;; Code:
+
+(require 'ert)
+
+(defun eval-tests--deep (n)
+  (if (> n 0) (1+ (eval-tests--deep (1- n))) 0))
+
+(ert-deftest eval-tests-max-lisp-eval-depth ()
+  "Deep calls signal an error, both interpreted and compiled."
+  (let ((max-lisp-eval-depth 200))
+    (should (= (eval-tests--deep 50) 50))
+    (should-error (eval-tests--deep 1000))
+    (should-error (funcall (byte-compile
+                            '(lambda () (eval-tests--deep 1000)))))))
+
+(ert-deftest eval-tests-max-lisp-eval-depth-minimum ()
+  "A max-lisp-eval-depth below 100 is raised when exceeded."
+  (let ((max-lisp-eval-depth 10))
+    (should (= (eval-tests--deep 50) 50))
+    (should (= max-lisp-eval-depth 100))))
+
+(ert-deftest eval-tests-debug-on-next-call ()
+  "The debugger is entered on a call and its exit from byte-code."
+  (let* ((entries nil)
+         (debugger (lambda (&rest args)
+                     (push (car args) entries)
+                     (if (eq (car args) 'exit) 'replaced))))
+    (should (eq (funcall (byte-compile
+                          '(lambda ()
+                            (let ((debug-on-next-call t))
+                              (eval-tests--deep 3)))))
+                'replaced))
+    (should (equal entries '(exit lambda)))))
+
+;;; eval-tests.el ends here
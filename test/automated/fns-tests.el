@@ -191,3 +191,117 @@ fns-tests--collate-enabled-p
 	      (string-collate-lessp
 	       a b (if (eq system-type 'windows-nt) "enu_USA" "en_US.UTF-8")))))
     '("Adrian" "Ævar" "Agustín" "Eli"))))
+
+(define-hash-table-test 'fns-tests--mod-8
+  (lambda (a b) (= a b)) (lambda (k) (% k 8)))
+
+(defun fns-tests--check-hash-table (table alist)
+  "Check that TABLE maps exactly the keys of ALIST to their values."
+  (should (= (hash-table-count table) (length alist)))
+  (dolist (pair alist)
+    (should (eq (gethash (car pair) table 'missing) (cdr pair))))
+  (maphash (lambda (k v) (should (eq (cdr (assoc k alist)) v))) table))
+
+(ert-deftest fns-tests-hash-table-collisions ()
+  ;; Every key hashes to one of eight codes, so removals must keep
+  ;; the long probe sequences intact.
+  (let ((table (make-hash-table :test 'fns-tests--mod-8 :size 3))
+        (alist nil))
+    (dotimes (i 200)
+      (puthash i (* i i) table)
+      (push (cons i (* i i)) alist))
+    (fns-tests--check-hash-table table alist)
+    (dotimes (i 200)
+      (when (zerop (% i 3))
+        (remhash i table)
+        (setq alist (assq-delete-all i alist))))
+    (fns-tests--check-hash-table table alist)
+    (dotimes (i 50)
+      (puthash (+ i 1000) i table)
+      (push (cons (+ i 1000) i) alist))
+    (fns-tests--check-hash-table table alist)
+    (clrhash table)
+    (fns-tests--check-hash-table table nil)))
+
+(ert-deftest fns-tests-hash-table-weak ()
+  (let ((table (make-hash-table :test 'equal :weakness 'key))
+        (kept nil))
+    (dotimes (i 1000)
+      (let ((key (format "key%d" i)))
+        (puthash key i table)
+        (when (zerop (% i 2))
+          (push (cons key i) kept))))
+    (garbage-collect)
+    (should (>= (hash-table-count table) (length kept)))
+    (dolist (pair kept)
+      (should (eq (gethash (car pair) table) (cdr pair))))
+    (let ((count 0))
+      (maphash (lambda (_k _v) (setq count (1+ count))) table)
+      (should (= count (hash-table-count table))))))
+
+(ert-deftest fns-tests-sxhash-string ()
+  ;; Equal strings hash alike, whatever their length.
+  (dotimes (len 40)
+    (let ((s (make-string len ?x)))
+      (should (= (sxhash s) (sxhash (copy-sequence s))))))
+  ;; The cached hash code follows changes to the string.
+  (let* ((s (copy-sequence "abcdefghijklmnop"))
+         (table (make-hash-table :test 'equal)))
+    ;; This computes the hash code, and caches it.
+    (should (= (sxhash s) (sxhash "abcdefghijklmnop")))
+    (aset s 3 ?X)
+    (should (= (sxhash s) (sxhash "abcXefghijklmnop")))
+    (aset s 3 ?α)
+    (should (= (sxhash s) (sxhash "abcαefghijklmnop")))
+    (aset s 4 ?β)
+    (should (= (sxhash s) (sxhash "abcαβfghijklmnop")))
+    (setq s (copy-sequence "abcdefghijklmnop"))
+    (should (integerp (sxhash s)))
+    (fillarray s ?z)
+    (should (= (sxhash s) (sxhash (make-string 16 ?z))))
+    (puthash (copy-sequence "key") 'value table)
+    (setq s (copy-sequence "kex"))
+    (should-not (gethash s table))
+    (aset s 2 ?y)
+    (should (eq (gethash s table) 'value))
+    (clear-string s)
+    (should (= (sxhash s) (sxhash (make-string 3 0))))))
+
+(ert-deftest fns-tests-hash-table-from-alist ()
+  (let* ((alist (mapcar (lambda (i) (cons i (* i i))) (number-sequence 0 99)))
+         (table (hash-table-from-alist alist)))
+    (should (eq (hash-table-test table) 'eql))
+    (should (= (hash-table-size table) 100))
+    (fns-tests--check-hash-table table alist))
+  (let ((table (hash-table-from-alist '(("a" . 1) ("b" . 2) ("a" . 3))
+                                      :test 'equal :size 10)))
+    (should (= (hash-table-size table) 10))
+    (fns-tests--check-hash-table table '(("a" . 1) ("b" . 2))))
+  (should (= (hash-table-count (hash-table-from-alist nil)) 0))
+  (should-error (hash-table-from-alist '((a . 1) b)))
+  (should-error (hash-table-from-alist '((a . 1)) :size)))
+
+(ert-deftest fns-tests-hash-table-from-plist ()
+  (let ((table (hash-table-from-plist '(a 1 b 2 a 3) :test 'eq)))
+    (should (eq (hash-table-test table) 'eq))
+    (should (= (hash-table-size table) 3))
+    (fns-tests--check-hash-table table '((a . 1) (b . 2))))
+  (should-error (hash-table-from-plist '(a 1 b))))
+
+(ert-deftest fns-tests-hash-table-reserve ()
+  (let ((table (make-hash-table :size 4))
+        alist)
+    (dotimes (i 3)
+      (puthash i i table)
+      (push (cons i i) alist))
+    (should (eq (hash-table-reserve table 1000) table))
+    (should (= (hash-table-size table) 1000))
+    (fns-tests--check-hash-table table alist)
+    (dotimes (i 997)
+      (puthash (+ i 3) i table)
+      (push (cons (+ i 3) i) alist))
+    (should (= (hash-table-size table) 1000))
+    (fns-tests--check-hash-table table alist)
+    (hash-table-reserve table 10)
+    (should (= (hash-table-size table) 1000))
+    (should-error (hash-table-reserve table -1))))
@@ -0,0 +1,82 @@
+;;; lread-tests.el --- Test suite for lread.c  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2015 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;;; Code:
+
+(require 'ert)
+
+(defun lread-tests--symbols (table)
+  "Return the sorted names of the symbols in obarray TABLE."
+  (let ((names nil))
+    (mapatoms (lambda (symbol) (push (symbol-name symbol) names)) table)
+    (sort names #'string<)))
+
+(ert-deftest lread-tests-obarray-growth ()
+  "Test that an obarray holds many more symbols than buckets."
+  (let ((table (make-vector 3 0))
+        (names (mapcar (lambda (i) (format "s%d" i)) (number-sequence 0 999))))
+    (dolist (name names)
+      (intern name table))
+    (should (vectorp table))
+    (should (= (length table) 3))
+    (should (equal (lread-tests--symbols table) (sort names #'string<)))
+    (dolist (name names)
+      (should (equal (symbol-name (intern-soft name table)) name)))
+    (should-not (intern-soft "s1000" table))
+    (should (eq (intern "s10" table) (intern-soft "s10" table)))
+    (should (= (length (all-completions "s99" table)) 11))
+    (should (equal (try-completion "s99" table) "s99"))
+    (should (test-completion "s999" table))
+    (should (unintern "s999" table))
+    (should-not (intern-soft "s999" table))
+    (should-not (test-completion "s999" table))
+    (should (= (length (lread-tests--symbols table)) 999))
+    ;; Filling an obarray with 0 still empties it.
+    (fillarray table 0)
+    (should-not (intern-soft "s1" table))
+    (should-not (lread-tests--symbols table))))
+
+(ert-deftest lread-tests-obarray-intern-while-mapping ()
+  "Test that interning symbols inside `mapatoms' loses none."
+  (let ((table (make-vector 1 0))
+        (seen nil))
+    (dotimes (i 20)
+      (intern (format "m%d" i) table))
+    (mapatoms (lambda (symbol)
+                (unless (string-match "-" (symbol-name symbol))
+                  (push symbol seen)
+                  (dotimes (i 20)
+                    (intern (format "%s-%d" symbol i) table))))
+              table)
+    (should (= (length seen) 20))
+    (should (= (length (lread-tests--symbols table)) (* 21 20)))
+    (dotimes (i 20)
+      (should (intern-soft (format "m%d-19" i) table)))))
+
+(ert-deftest lread-tests-obarray-keywords ()
+  "Test that keywords are interned as constants in the initial obarray."
+  (let ((keyword (intern ":lread-tests-keyword")))
+    (should (keywordp keyword))
+    (should (eq (symbol-value keyword) keyword))
+    (should (eq (intern-soft ":lread-tests-keyword") keyword))))
+
+(provide 'lread-tests)
+;;; lread-tests.el ends here
@@ -0,0 +1,198 @@
+;;; module-tests.el --- Test GNU Emacs modules.  -*- lexical-binding: t -*-
+
+;; Copyright 2015 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; The test module data/emacs-module/mod-test.c is built by the test
+;; Makefile in the build directory.  All tests are skipped if Emacs
+;; was configured without module support.
+
+;;; Code:
+
+(require 'ert)
+
+(defconst module-tests--mod-test
+  (and module-file-suffix
+       (expand-file-name (concat "data/emacs-module/mod-test"
+                                 module-file-suffix))))
+
+(defun module-tests--load ()
+  "Load the test module.
+Return nil if the test module is not available."
+  (and module-tests--mod-test
+       (file-exists-p module-tests--mod-test)
+       (module-load module-tests--mod-test)))
+
+(declare-function mod-test-return-t "mod-test")
+(declare-function mod-test-sum "mod-test")
+(declare-function mod-test-signal "mod-test")
+(declare-function mod-test-throw "mod-test")
+(declare-function mod-test-non-local-exit-funcall "mod-test")
+(declare-function mod-test-globref-make "mod-test")
+(declare-function mod-test-string-a-to-b "mod-test")
+(declare-function mod-test-userptr-make "mod-test")
+(declare-function mod-test-userptr-get "mod-test")
+(declare-function mod-test-vector-fill "mod-test")
+(declare-function mod-test-vector-eq "mod-test")
+(declare-function mod-test-nargs "mod-test")
+
+;;
+;; Basic tests.
+;;
+
+(ert-deftest mod-test-load ()
+  (skip-unless (module-tests--load))
+  (should (featurep 'mod-test))
+  (should (eq (mod-test-return-t 1) t))
+  ;; Loading the module a second time doesn't reinitialize it.
+  (should (eq (module-load module-tests--mod-test) t)))
+
+(ert-deftest mod-test-load-via-load ()
+  (skip-unless (module-tests--load))
+  (should (eq (load (file-name-sans-extension module-tests--mod-test)
+                    nil t)
+              t)))
+
+(ert-deftest mod-test-load-errors ()
+  (skip-unless module-file-suffix)
+  (should-error (module-load (make-temp-name "/nonexistent-module"))
+                :type 'module-open-failed))
+
+(ert-deftest mod-test-sum-test ()
+  (skip-unless (module-tests--load))
+  (should (= (mod-test-sum 1 2) 3))
+  (should (equal (documentation 'mod-test-sum) "Return A + B"))
+  (let ((err (should-error (mod-test-sum "1" 2) :type 'wrong-type-argument)))
+    (should (equal (cdr err) '(integerp "1"))))
+  (should-error (mod-test-sum 1) :type 'wrong-number-of-arguments))
+
+(ert-deftest mod-test-arity ()
+  (skip-unless (module-tests--load))
+  (should-error (mod-test-nargs) :type 'wrong-number-of-arguments)
+  (should (= (mod-test-nargs 'a) 1))
+  (should (= (mod-test-nargs 'a 'b 'c) 3))
+  (should (= (apply #'mod-test-nargs (make-list 1000 nil)) 1000)))
+
+;;
+;; Non-local exit tests.
+;;
+
+(ert-deftest mod-test-non-local-exit-signal-test ()
+  (skip-unless (module-tests--load))
+  (should-error (mod-test-signal)))
+
+(ert-deftest mod-test-non-local-exit-throw-test ()
+  (skip-unless (module-tests--load))
+  (should (equal
+           (catch 'tag
+             (mod-test-throw)
+             (ert-fail "expected throw"))
+           65)))
+
+(ert-deftest mod-test-non-local-exit-funcall-normal ()
+  (skip-unless (module-tests--load))
+  (should (equal (mod-test-non-local-exit-funcall (lambda () 23))
+                 23)))
+
+(ert-deftest mod-test-non-local-exit-funcall-signal ()
+  (skip-unless (module-tests--load))
+  (should (equal (mod-test-non-local-exit-funcall
+                  (lambda () (signal 'error '(32))))
+                 '(signal error (32)))))
+
+(ert-deftest mod-test-non-local-exit-funcall-throw ()
+  (skip-unless (module-tests--load))
+  (should (equal (mod-test-non-local-exit-funcall
+                  (lambda () (throw 'tag 32)))
+                 '(throw tag 32))))
+
+;;
+;; String tests.
+;;
+
+(defun module-tests--multiply-string (s n)
+  "Return N copies of the string S concatenated."
+  (let ((res ""))
+    (dotimes (_ n res)
+      (setq res (concat res s)))))
+
+(ert-deftest mod-test-threads ()
+  "Test module calls of several threads that yield inside them."
+  (skip-unless (module-tests--load))
+  (skip-unless (featurep 'threads))
+  (let* ((call (lambda (n)
+                 (lambda ()
+                   (mod-test-non-local-exit-funcall
+                    (lambda ()
+                      (thread-yield)
+                      (garbage-collect)
+                      (thread-yield)
+                      (make-list n 'x))))))
+         (first (make-thread (funcall call 2)))
+         (second (make-thread (funcall call 3))))
+    (should (equal (thread-join first) '(x x)))
+    (should (equal (thread-join second) '(x x x)))))
+
+(ert-deftest mod-test-globref-make-test ()
+  (skip-unless (module-tests--load))
+  (let ((mod-str (mod-test-globref-make))
+        (ref-str (module-tests--multiply-string
+                  "abcdefghijklmnopqrstuvwxyz" 100)))
+    ;; The module must keep its global reference alive across a GC.
+    (garbage-collect)
+    (should (string= ref-str mod-str))))
+
+(ert-deftest mod-test-string-a-to-b-test ()
+  (skip-unless (module-tests--load))
+  (should (string= (mod-test-string-a-to-b "aaa") "bbb"))
+  (should (string= (mod-test-string-a-to-b "äa") "äb")))
+
+;;
+;; User-pointer tests.
+;;
+
+(ert-deftest mod-test-userptr-fun-test ()
+  (skip-unless (module-tests--load))
+  (let* ((n 42)
+         (v (mod-test-userptr-make n))
+         (r (mod-test-userptr-get v)))
+
+    (should (eq (type-of v) 'user-ptr))
+    (should (user-ptrp v))
+    (should (integerp r))
+    (should (= r n))
+    (should (string-prefix-p "#<user-ptr " (prin1-to-string v)))
+    (should-error (mod-test-userptr-get 'nope) :type 'wrong-type-argument)))
+
+;;
+;; Vector tests.
+;;
+
+(ert-deftest mod-test-vector-test ()
+  (skip-unless (module-tests--load))
+  (dolist (s '(2 10 100 1000))
+    (dolist (e '(42 foo "foo"))
+      (let* ((v-ref (make-vector 2 e))
+             (eq-ref (eq (aref v-ref 0) (aref v-ref 1)))
+             (v-test (make-vector s nil)))
+
+        (should (eq (mod-test-vector-fill v-test e) t))
+        (should (eq (mod-test-vector-eq v-test e) eq-ref))))))
+
+;;; module-tests.el ends here
@@ -0,0 +1,121 @@
+;;; profiler-tests.el --- Test suite for profiler.c  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2015 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;;; Code:
+
+(require 'ert)
+
+(defun profiler-tests--call (f x)
+  (funcall f x))
+
+(defun profiler-tests--loop (n)
+  (let ((sum 0))
+    (dotimes (i n)
+      (when (= i 10)
+        (profiler-byte-code-start))
+      (setq sum (+ sum i)))
+    sum))
+
+(defun profiler-tests--stop-in-unwind (x)
+  (profiler-byte-code-start)
+  (unwind-protect
+      (profiler-tests--call #'car x)
+    (ignore (profiler-byte-code-log))
+    (profiler-byte-code-stop)
+    (ignore (profiler-byte-code-log)))
+  (list (car x) (profiler-tests--call #'car x)))
+
+(defmacro profiler-tests--with-byte-code-log (var &rest body)
+  "Run BODY with the byte-code profiler, then bind VAR to its log."
+  (declare (indent 1))
+  `(let ((,var nil))
+     (ignore (profiler-byte-code-log))
+     (unwind-protect
+         (progn
+           (profiler-byte-code-start)
+           ,@body)
+       (profiler-byte-code-stop)
+       (setq ,var (profiler-byte-code-log)))
+     ,var))
+
+(defun profiler-tests--entry (log function)
+  "Return the entry of LOG for the byte-compiled FUNCTION."
+  (gethash (aref (symbol-function function) 1) log))
+
+(ert-deftest profiler-tests-byte-code-counts ()
+  (byte-compile 'profiler-tests--call)
+  (let* ((log (profiler-tests--with-byte-code-log log
+                (should (profiler-byte-code-running-p))
+                (should-error (profiler-byte-code-start))
+                (dotimes (_ 5)
+                  (profiler-tests--call #'car '(1)))))
+         (entry (profiler-tests--entry log 'profiler-tests--call)))
+    (should-not (profiler-byte-code-running-p))
+    (should-not (profiler-byte-code-stop))
+    (should (eq (aref entry 0) 'profiler-tests--call))
+    (should (= (length (aref entry 1))
+               (length (aref (symbol-function 'profiler-tests--call) 1))))
+    (should (= (aref (aref entry 1) 0) 5))
+    (should (member '((car . 5)) (append (aref entry 2) nil)))))
+
+(ert-deftest profiler-tests-byte-code-callees ()
+  "Test that the callees of a call site are counted."
+  (byte-compile 'profiler-tests--call)
+  (let* ((functions '(car cdr identity list vector length
+                      symbolp consp listp atom))
+         (log (profiler-tests--with-byte-code-log log
+                (dolist (f functions)
+                  (profiler-tests--call f '(1)))
+                (profiler-tests--call #'car '(1))))
+         (entry (profiler-tests--entry log 'profiler-tests--call))
+         (callees (car (delq nil (append (aref entry 2) nil)))))
+    ;; Only the first 8 different functions are recorded.
+    (should (= (length callees) 9))
+    (should (equal (assq 'car callees) '(car . 2)))
+    (should (equal (assq t callees) '(t . 2)))
+    (should-not (assq 'atom callees))))
+
+(ert-deftest profiler-tests-byte-code-running-loop ()
+  "Test that the profiler counts a loop that was running when it started."
+  (byte-compile 'profiler-tests--loop)
+  (ignore (profiler-byte-code-log))
+  (let (log)
+    (unwind-protect
+        (should (= (profiler-tests--loop 100) 4950))
+      (profiler-byte-code-stop)
+      (setq log (profiler-byte-code-log)))
+    (should (> (apply #'+ (append (aref (profiler-tests--entry
+                                         log 'profiler-tests--loop)
+                                        1)
+                                  nil))
+               89))))
+
+(ert-deftest profiler-tests-byte-code-stop-in-unwind ()
+  "Test stopping the profiler and taking its log in an unwind form."
+  (byte-compile 'profiler-tests--call)
+  (byte-compile 'profiler-tests--stop-in-unwind)
+  (ignore (profiler-byte-code-log))
+  (should (equal (profiler-tests--stop-in-unwind '(1)) '(1 1)))
+  (should-not (profiler-byte-code-running-p))
+  (should-not (profiler-byte-code-log)))
+
+(provide 'profiler-tests)
+;;; profiler-tests.el ends here
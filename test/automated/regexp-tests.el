@@ -30,4 +30,141 @@
 The test data is in `compile-tests--test-regexps-data'."
   (should (string-match (regexp-opt-charset '(?^)) "a^b")))
 
+;; Patterns whose search results must be the same whether or not
+;; the automaton is used.
+(defconst regexp-tests--automaton-regexps
+  '("a" "abc" "a*b" "\\(a*\\)*b" "a.*?b" "a+?" "x*" "a\\|b\\|"
+    "\\(?:ab\\|a\\)c" "\\(foo\\|foobar\\)baz" "\\(a\\|b\\)*c"
+    "^x" "x$" "^$" "\\`a" "z\\'" "\n"
+    "\\bfoo\\b" "\\Bo" "o\\B" "\\<\\w" "\\w\\>" "\\_<foo-bar\\_>"
+    "\\w+" "\\sw\\S-" "[[:alpha:]]+" "[^a-z ]+"
+    "[[:upper:]][[:lower:]]*" "[[:space:]]+\\w" "é+" "[é-ü]"
+    "(\\(def\\(un\\|var\\)\\)\\s-+\\(\\sw\\|\\s_\\)+"
+    ;; These are left to the backtracking matcher.
+    "\\(.\\)\\1" "a\\{2,3\\}" "\\ca"))
+
+(defconst regexp-tests--automaton-strings
+  '("" "a" "abc" "aab" "aaaaaaaaaaaaaaaaaaaab" "foo bar foo-bar foobarbaz"
+    "x\ny\nx" "Hello World" "éèü ab" "ça va été" "foo_bar" "\nfoo\n"
+    "(defun foo-bar (x)\n  (defvar y))" "aaac bbc" "日本語 foo"))
+
+(defun regexp-tests--search (automaton regexp string start)
+  "Search for REGEXP in STRING from START in several ways.
+Return a list of the results.  Use the automaton if AUTOMATON is
+non-nil."
+  (let ((regexp-use-automaton automaton)
+        (results nil))
+    (push (and (string-match regexp string start) (match-data)) results)
+    (with-temp-buffer
+      (insert string)
+      (dolist (bound (list nil (min (point-max) (+ start 4))))
+        (goto-char (1+ start))
+        (push (and (re-search-forward regexp bound t)
+                   (delq (current-buffer) (match-data t)))
+              results)
+        (goto-char (1+ start))
+        (push (and (looking-at regexp)
+                   (delq (current-buffer) (match-data t)))
+              results)))
+    results))
+
+(ert-deftest regexp-test-automaton ()
+  "Test that the automaton does not change search results."
+  (dolist (case-fold-search '(nil t))
+    (dolist (regexp regexp-tests--automaton-regexps)
+      (dolist (string (append regexp-tests--automaton-strings
+                              (list (string-to-unibyte "foo bar\nab")
+                                    (encode-coding-string "éa b" 'latin-1))))
+        (dotimes (start (1+ (length string)))
+          (should (equal (list regexp string start
+                               (regexp-tests--search t regexp string start))
+                         (list regexp string start
+                               (regexp-tests--search nil regexp string
+                                                     start)))))))))
+
+(ert-deftest regexp-test-automaton-gap ()
+  "Test searching with the automaton across the gap of a buffer."
+  (with-temp-buffer
+    (insert (make-string 1000 ?a) "foo-bar baz\n" (make-string 1000 ?b))
+    ;; Move the gap into the middle of \"foo\".
+    (goto-char 1003)
+    (insert "x")
+    (delete-char -1)
+    (dolist (regexp '("foo-bar" "\\_<foo-bar\\_>" "o-b" "a\\(f\\)o"
+                      "\\bfoo\\b" "bar baz$" "b+$"))
+      (let (results)
+        (dolist (regexp-use-automaton '(t nil))
+          (goto-char (point-min))
+          (push (list (re-search-forward regexp nil t) (match-data t))
+                results))
+        (should (equal (nth 0 results) (nth 1 results)))))))
+
+(ert-deftest regexp-test-automaton-exponential ()
+  "Test that the automaton fails quickly where backtracking would not."
+  (let ((regexp-use-automaton t)
+        (string (concat (make-string 100 ?a) "c")))
+    (should-not (string-match "\\(a*\\)*b" string))
+    (should (equal (string-match "\\(a*\\)*c" string) 0))
+    (should (equal (match-end 0) 101))))
+
+(ert-deftest regexp-test-literal ()
+  "Test searching for regexps whose matches all contain a literal."
+  (with-temp-buffer
+    (insert "x foo-bar FOO-BAR\nfoo\tbar é-ü " (make-string 100 ?z))
+    ;; Move the gap into the middle of \"foo-bar\".
+    (goto-char 6)
+    (insert "x")
+    (delete-char -1)
+    (dolist (regexp-use-automaton '(t nil))
+      ;; Each case is (REGEXP FROM CASE-FOLD MATCH-BEGINNING).
+      (dolist (case '(("o-b" 1 nil 5)
+                      ("o-b" 6 nil nil)
+                      ("o-b" 6 t 13)
+                      ("f\\(o\\)+-b" 4 t 11)
+                      ("[fb]o*-bar" 1 nil 3)
+                      ("o\\(-\\|\t\\)bar" 6 nil 21)
+                      ("^foo\\|bar" 1 nil 7)
+                      ("é-ü" 1 nil 27)
+                      ("FOO.*R$" 1 nil 11)
+                      ("\\(o\\)\\1-bar" 6 t 12)))
+        (let ((case-fold-search (nth 2 case)))
+          (goto-char (nth 1 case))
+          (should (equal (list case (and (re-search-forward (car case) nil t)
+                                         (match-beginning 0)))
+                         (list case (nth 3 case))))))
+      ;; The literal must end before the bound.
+      (goto-char 1)
+      (should-not (re-search-forward "o-b" 7 t))
+      (should (= (re-search-forward "o-b" 8 t) 8)))))
+
+(ert-deftest regexp-test-cache ()
+  "Test the cache of compiled regexps."
+  (let ((regexp-cache-size 4))
+    (with-temp-buffer
+      (insert "Foo 123 foo")
+      ;; A regexp that case does not matter to is compiled once for
+      ;; both values of `case-fold-search'.
+      (let ((hits regexp-cache-hits)
+            (misses regexp-cache-misses))
+        (dolist (case-fold-search '(t nil t nil))
+          (goto-char (point-min))
+          (should (= (re-search-forward "[0-9]+" nil t) 8)))
+        (should (= (- regexp-cache-hits hits) 3))
+        (should (= (- regexp-cache-misses misses) 1)))
+      ;; Other regexps are compiled for each value.
+      (let ((misses regexp-cache-misses))
+        (dolist (case-fold-search '(t nil t nil))
+          (goto-char (point-min))
+          (should (= (re-search-forward "f[o]o" nil t)
+                     (if case-fold-search 4 12))))
+        (should (= (- regexp-cache-misses misses) 2)))
+      ;; The least recently used regexps are recompiled.
+      (dotimes (i 4)
+        (string-match (format "x%d+" i) "x1"))
+      (let ((misses regexp-cache-misses)
+            (elapsed regexp-compile-elapsed))
+        (should (= (string-match "[0-9]+" "ab12") 2))
+        (should (= (- regexp-cache-misses misses) 1))
+        (should (>= regexp-compile-elapsed elapsed))))))
+
 ;;; regexp-tests.el ends here.
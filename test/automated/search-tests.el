@@ -0,0 +1,145 @@
+;;; search-tests.el --- Test suite for search.c  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2015 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;;; Code:
+
+(require 'ert)
+
+(ert-deftest search-tests-keyword-set ()
+  (let ((set (make-keyword-set '("foo" "foobar" "obar" "é" "日本"))))
+    (should (keyword-set-p set))
+    (should-not (keyword-set-p '("foo")))
+    (should (eq (type-of set) 'keyword-set))
+    (should-error (make-keyword-set '("foo" bar)) :type 'wrong-type-argument)
+    (with-temp-buffer
+      (insert "xfoobaz foobar é FOO 日本")
+      ;; Move the gap into the middle of \"foobar\".
+      (goto-char 12)
+      (insert "x")
+      (delete-char -1)
+      (goto-char (point-min))
+      (let ((case-fold-search nil))
+        (should (equal (search-forward-any set) "foo"))
+        (should (equal (list (match-beginning 0) (match-end 0) (point))
+                       '(2 5 5)))
+        ;; The longest keyword that starts first is found.
+        (should (equal (search-forward-any set) "foobar"))
+        (should (equal (list (match-beginning 0) (point)) '(9 15)))
+        (should (equal (search-forward-any set) "é"))
+        (should (equal (search-forward-any set) "日本"))
+        (should (= (point) (point-max)))
+        (goto-char 17)
+        (should-error (search-forward-any set 21) :type 'search-failed)
+        (should-not (search-forward-any set 21 t))
+        (should (= (point) 17))
+        (should-not (search-forward-any set 21 'move))
+        (should (= (point) 21)))
+      (let ((case-fold-search t))
+        (goto-char 17)
+        (should (equal (search-forward-any set) "foo"))
+        (should (equal (list (match-beginning 0) (point)) '(18 21))))
+      ;; A list of strings is a keyword set too.
+      (goto-char (point-min))
+      (should (equal (search-forward-any '("baz" "z f")) "baz"))
+      (should (equal (search-forward-any '("")) ""))
+      (should (= (match-beginning 0) (match-end 0) 8)))))
+
+(ert-deftest search-tests-keyword-set-copy ()
+  (let* ((foo (copy-sequence "foo"))
+         (set (make-keyword-set (list foo "bar"))))
+    ;; Changing a string does not change the keyword set.
+    (aset foo 0 ?x)
+    (with-temp-buffer
+      (insert "xoo foo FOO")
+      (goto-char (point-min))
+      (let ((case-fold-search nil))
+        (should (eq (search-forward-any set) foo))
+        (should (= (match-beginning 0) 5)))
+      (let ((case-fold-search t))
+        (should (eq (search-forward-any set) foo))
+        (should (= (match-beginning 0) 9))))))
+
+(ert-deftest search-tests-keyword-set-long ()
+  ;; The search scans the text in chunks; find keywords across them.
+  (with-temp-buffer
+    (dotimes (_ 30000)
+      (insert "ab é "))
+    (insert "日本語")
+    (goto-char (point-min))
+    (let ((case-fold-search nil))
+      (should (equal (search-forward-any '("日本" "x")) "日本"))
+      (should (= (point) (- (point-max) 1))))
+    (let ((case-fold-search t))
+      (goto-char (point-min))
+      (should (equal (search-forward-any '("É A" "語")) "É A"))
+      (should (= (point) 7))
+      (should (equal (search-forward-any '("語" "zz")) "語")))))
+
+(ert-deftest search-tests-match-data-object ()
+  (with-temp-buffer
+    (insert "foo bar baz")
+    (goto-char (point-min))
+    (re-search-forward "\\(x\\)?b\\(a\\)r")
+    (let ((object (match-data-save-into)))
+      (should (match-data-object-p object))
+      (should-not (match-data-object-p (match-data)))
+      (should (eq (type-of object) 'match-data-object))
+      ;; The saved positions follow changes to the buffer.
+      (goto-char (point-min))
+      (insert "xx")
+      (should (string-match "o" "foo"))
+      (match-data-restore-from object)
+      (should (equal (match-data t) (list 7 10 nil nil 8 9 (current-buffer))))
+      ;; Saving into the object again reuses it.
+      (should (string-match "o\\(o\\)" "foo"))
+      (should (eq (match-data-save-into object) object))
+      (set-match-data nil)
+      (match-data-restore-from object t)
+      (should (equal (match-data) '(1 3 2 3)))
+      ;; A released object is reused, and cannot be restored from.
+      (should-error (match-data-restore-from object))
+      (should (eq (match-data-save-into) object))))
+  (let ((buffer (generate-new-buffer " *search-tests*")))
+    (with-current-buffer buffer
+      (insert "abc")
+      (goto-char (point-min))
+      (re-search-forward "b"))
+    (let ((object (match-data-save-into)))
+      (kill-buffer buffer)
+      (match-data-restore-from object t)
+      (should (equal (match-data) '(0 0))))))
+
+(ert-deftest search-tests-save-match-data ()
+  (with-temp-buffer
+    (insert "foo bar")
+    (goto-char (point-min))
+    (re-search-forward "bar")
+    (save-match-data
+      (should (string-match "\\(a\\)\\(b\\)\\(c\\)" "abc"))
+      (goto-char (point-min))
+      (insert "x")
+      (delete-region 1 3))
+    (should (equal (match-data t) (list 4 7 (current-buffer))))
+    (should-error (save-match-data (string-match "b" "b") (error "Foo")))
+    (should (equal (match-data t) (list 4 7 (current-buffer))))))
+
+(provide 'search-tests)
+;;; search-tests.el ends here
@@ -0,0 +1,175 @@
+;;; thread-tests.el --- Test suite for thread.c  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2015 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;;; Code:
+
+(require 'ert)
+
+(defvar thread-tests--var 'global)
+
+(ert-deftest thread-tests-join ()
+  "Test that `thread-join' returns the value of the thread's function."
+  (skip-unless (featurep 'threads))
+  (let ((thread (make-thread (lambda () (+ 1 2)) "adder")))
+    (should (threadp thread))
+    (should (equal (thread-name thread) "adder"))
+    (should (= (thread-join thread) 3))
+    (should-not (thread-alive-p thread))
+    (should-not (memq thread (all-threads)))
+    (should (eq (type-of thread) 'thread))))
+
+(ert-deftest thread-tests-join-self ()
+  (skip-unless (featurep 'threads))
+  (should (thread-alive-p (current-thread)))
+  (should-error (thread-join (current-thread))))
+
+(ert-deftest thread-tests-error ()
+  "Test that an error ends only the thread that signaled it."
+  (skip-unless (featurep 'threads))
+  (let ((thread (make-thread (lambda () (signal 'error '("boom"))))))
+    (should-not (thread-join thread))
+    (should (equal (thread-last-error) '(error "boom")))))
+
+(ert-deftest thread-tests-mutex ()
+  (skip-unless (featurep 'threads))
+  (let ((mutex (make-mutex "m")))
+    (should (mutexp mutex))
+    (should (equal (mutex-name mutex) "m"))
+    ;; A mutex can be locked recursively.
+    (with-mutex mutex
+      (with-mutex mutex
+        (should-not (thread-join (make-thread
+                                  (lambda () (mutex-unlock mutex)))))
+        (should (equal (thread-last-error)
+                       '(error "Cannot unlock mutex owned by another thread")))))
+    (should-error (mutex-unlock (make-mutex)))))
+
+(ert-deftest thread-tests-mutex-exclusion ()
+  "Test that threads holding a mutex in turn do not interleave."
+  (skip-unless (featurep 'threads))
+  (let* ((mutex (make-mutex))
+         (log nil)
+         (threads
+          (mapcar (lambda (n)
+                    (make-thread
+                     (lambda ()
+                       (with-mutex mutex
+                         (push (list 'enter n) log)
+                         (thread-yield)
+                         (sleep-for 0.01)
+                         (push (list 'exit n) log)))))
+                  '(1 2 3))))
+    (mapc #'thread-join threads)
+    (setq log (nreverse log))
+    (should (= (length log) 6))
+    (while log
+      (should (eq (car (nth 0 log)) 'enter))
+      (should (equal (nth 1 log) (list 'exit (cadr (nth 0 log)))))
+      (setq log (nthcdr 2 log)))))
+
+(ert-deftest thread-tests-condition-variable ()
+  (skip-unless (featurep 'threads))
+  (let* ((mutex (make-mutex))
+         (cond (make-condition-variable mutex "c"))
+         (queue nil)
+         (consumer
+          (make-thread
+           (lambda ()
+             (with-mutex mutex
+               (while (not queue)
+                 (condition-wait cond))
+               (pop queue))))))
+    (should (condition-variable-p cond))
+    (should (eq (condition-mutex cond) mutex))
+    (should (equal (condition-name cond) "c"))
+    (should-error (condition-notify cond))
+    (with-mutex mutex
+      (push 'item queue)
+      (condition-notify cond))
+    (should (eq (thread-join consumer) 'item))))
+
+(ert-deftest thread-tests-signal ()
+  "Test that `thread-signal' interrupts a blocked thread."
+  (skip-unless (featurep 'threads))
+  (let* ((mutex (make-mutex))
+         (cond (make-condition-variable mutex))
+         (thread (make-thread
+                  (lambda ()
+                    (condition-case err
+                        (with-mutex mutex
+                          (condition-wait cond))
+                      (error err))))))
+    (while (not (eq (thread--blocker thread) cond))
+      (thread-yield))
+    (thread-signal thread 'error '("wake"))
+    (should (equal (thread-join thread) '(error "wake")))))
+
+(ert-deftest thread-tests-let-bindings ()
+  "Test that let-bindings and the current buffer are per-thread."
+  (skip-unless (featurep 'threads))
+  (let* ((mutex (make-mutex))
+         (cond (make-condition-variable mutex))
+         (started nil)
+         (seen nil)
+         (thread
+          (make-thread
+           (lambda ()
+             (let ((thread-tests--var 'thread))
+               (with-temp-buffer
+                 (with-mutex mutex
+                   (setq started t)
+                   (condition-notify cond))
+                 (sleep-for 0.01)
+                 (setq seen (list thread-tests--var (current-buffer)))
+                 (buffer-live-p (current-buffer))))))))
+    (with-temp-buffer
+      (let ((thread-tests--var 'main)
+            (buffer (current-buffer)))
+        (with-mutex mutex
+          (while (not started)
+            (condition-wait cond)))
+        (should (eq thread-tests--var 'main))
+        (should (eq (current-buffer) buffer))
+        (should (thread-join thread))
+        (should (eq thread-tests--var 'main))
+        (should (eq (current-buffer) buffer))
+        (should (eq (car seen) 'thread))
+        (should-not (eq (cadr seen) buffer))))
+    (should (eq thread-tests--var 'global))))
+
+(ert-deftest thread-tests-garbage-collect ()
+  (skip-unless (featurep 'threads))
+  (let ((threads
+         (mapcar (lambda (_)
+                   (make-thread
+                    (lambda ()
+                      (let ((list nil))
+                        (dotimes (_ 10000)
+                          (push (make-string 10 ?a) list))
+                        (garbage-collect)
+                        (thread-yield)
+                        (length list)))))
+                 '(1 2 3))))
+    (garbage-collect)
+    (should (equal (mapcar #'thread-join threads) '(10000 10000 10000)))))
+
+(provide 'thread-tests)
+;;; thread-tests.el ends here
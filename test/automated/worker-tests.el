@@ -0,0 +1,77 @@
+;;; worker-tests.el --- Test suite for worker.el  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2015 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <http://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;;; Code:
+
+(require 'ert)
+(require 'worker)
+
+(defmacro worker-tests--with-pool (count &rest body)
+  "Evaluate BODY with a pool of COUNT workers, and kill it afterwards."
+  (declare (indent 1) (debug t))
+  `(let ((worker-count ,count))
+     (unwind-protect
+         (progn (worker-stop) ,@body)
+       (worker-stop))))
+
+(ert-deftest worker-tests-map ()
+  (worker-tests--with-pool 3
+    (should (equal (worker-map (lambda (x) (* x x)) (number-sequence 1 30))
+                   (mapcar (lambda (x) (* x x)) (number-sequence 1 30))))
+    (should (= (length worker--processes) 3))
+    ;; The pool is reused.
+    (let ((processes (copy-sequence worker--processes)))
+      (should (equal (worker-map #'1+ [1 2]) '(2 3)))
+      (should (equal worker--processes processes)))
+    (should (equal (worker-map #'identity nil) nil))))
+
+(ert-deftest worker-tests-strings ()
+  "Test that strings survive the transfer unchanged."
+  (worker-tests--with-pool 1
+    (let ((strings '("a\nb" "\"quoted\"" "été" "あ" "")))
+      (should (equal (worker-map #'identity strings) strings)))))
+
+(ert-deftest worker-tests-named-function ()
+  "Test that a worker loads the file defining a named function."
+  (worker-tests--with-pool 1
+    (should (equal (worker-map #'worker--print '((a . "b")))
+                   '("(a . \"b\")")))))
+
+(ert-deftest worker-tests-error ()
+  (worker-tests--with-pool 2
+    (should (equal (should-error (worker-map (lambda (x) (/ 1 x)) '(1 0 2 0))
+                                 :type 'arith-error)
+                   '(arith-error)))
+    ;; The pool survives errors.
+    (should (= (length worker--processes) 2))
+    (should (equal (worker-map #'1+ '(1)) '(2)))))
+
+(ert-deftest worker-tests-dead-worker ()
+  (worker-tests--with-pool 1
+    (should (equal (should-error (worker-map (lambda (_) (kill-emacs 3)) '(1))
+                                 :type 'worker-error)
+                   '(worker-error "Worker died" 3)))
+    (should-not worker--processes)
+    ;; A new pool is started on demand.
+    (should (equal (worker-map #'1+ '(1)) '(2)))))
+
+(provide 'worker-tests)
+;;; worker-tests.el ends here